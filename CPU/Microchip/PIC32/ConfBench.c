@@ -0,0 +1,410 @@
+#ifndef CONFBENCH_C
+#define CONFBENCH_C
+
+#include "ConfBench.h"
+//-----------------------------------------------------------------------
+// CROSS-BOARD PERFORMANCE CONFORMANCE SUITE -- see ConfBench.h for the
+// row format and the sharing model
+//-----------------------------------------------------------------------
+
+#define CONF_BUF_SIZE  256	// block size for the Mem_Copy / CRC rows
+
+#define CONF_ECHO_STK_SIZE   256	// helper task stacks; limits follow the
+#define CONF_ECHO_STK_LIMIT  (CONF_ECHO_STK_SIZE  / 10)	// ... app_cfg.h 90%-full rule
+#define CONF_DUMMY_STK_SIZE  128
+#define CONF_DUMMY_STK_LIMIT (CONF_DUMMY_STK_SIZE / 10)
+
+//----- Kernel objects and helper tasks.  The echo task is the ping-pong
+//      partner for the context switch row; the dummy task is created
+//      below the caller's priority and deleted before it ever runs.
+static OS_SEM  Conf_SemGo;	// start task -> echo task
+static OS_SEM  Conf_SemEcho;	// echo task -> start task
+static OS_SEM  Conf_Sem;	// same-task post/pend round trip
+#if OS_CFG_Q_EN > 0u
+#define CONF_Q_SIZE  4
+static OS_Q    Conf_Q;		// same-task post/pend round trip
+static OS_MSG  Conf_QMsgTbl[CONF_Q_SIZE];
+#endif
+
+static OS_TCB  Conf_TaskEchoTCB;
+static CPU_STK Conf_TaskEchoStk[CONF_ECHO_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;
+#if OS_CFG_TASK_DEL_EN > 0u
+static OS_TCB  Conf_TaskDummyTCB;
+static CPU_STK Conf_TaskDummyStk[CONF_DUMMY_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;
+static void    Conf_TaskDummy (void *p_arg);
+#endif
+
+static CPU_INT08U Conf_BufSrc[CONF_BUF_SIZE];	// Mem_Copy / CRC work blocks:
+static CPU_INT08U Conf_BufDst[CONF_BUF_SIZE];	// RAM-resident on every board
+
+static const char *Conf_Board;	// board= field, set once by ConfBench_Run()
+
+//----- Per-row statistics: every iteration is timed individually so the
+//      row shows min (the uncontended hot path), avg, and max (the tail
+//      the tick interrupt or a cache refill adds).
+typedef struct {
+	CPU_INT32U Min;
+	CPU_INT32U Max;
+	CPU_INT32U Total;
+	CPU_INT32U Cnt;
+} CONF_STATS;
+
+static void Conf_StatsInit (CONF_STATS *p_stats)
+{
+	p_stats->Min   = 0xFFFFFFFFu;
+	p_stats->Max   = 0u;
+	p_stats->Total = 0u;
+	p_stats->Cnt   = 0u;
+}
+
+static void Conf_StatsUpdate (CONF_STATS *p_stats, CPU_INT32U val)
+{
+	if (val < p_stats->Min) {
+		p_stats->Min = val;
+	}
+	if (val > p_stats->Max) {
+		p_stats->Max = val;
+	}
+	p_stats->Total += val;
+	p_stats->Cnt++;
+}
+
+//----- Row output: unsigned base 10, no leading zeroes, over UART1.
+static void Conf_PrintNum (CPU_INT32U v)
+{
+	char buf[10];		// 4294967295 is 10 digits
+	int  n = 0;
+
+	do {
+		buf[n++] = (char)(v % 10u + '0');
+		v /= 10u;
+	} while (v > 0u);
+	while (n > 0) {
+		putU1(buf[--n]);
+	}
+}
+
+static void Conf_RowBegin (void)
+{
+	putsU1("conf board=");
+	putsU1((char *)Conf_Board);
+}
+
+static void Conf_Row (const char *p_name, CONF_STATS *p_stats)
+{
+	Conf_RowBegin();
+	putsU1(" bench=");
+	putsU1((char *)p_name);
+	putsU1(" n=");
+	Conf_PrintNum(p_stats->Cnt);
+	putsU1(" min=");
+	Conf_PrintNum(p_stats->Min);
+	putsU1(" avg=");
+	Conf_PrintNum(p_stats->Total / p_stats->Cnt);
+	putsU1(" max=");
+	Conf_PrintNum(p_stats->Max);
+	putsU1("\r\n");
+}
+
+//----- The benchmarks.  Same set, same order, on every board; rows a
+//      board's configuration cannot support are compiled out so the
+//      remaining rows still line up by bench= name.
+
+// Cost of the measurement itself: two back-to-back core timer reads.
+// Subtract the avg of this row from every other row.
+static void Conf_TmrOverhead (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	Conf_Row("tmr_rd", &stats);
+}
+
+// One interrupt disable/restore pair -- the cost every kernel critical
+// section pays, sensitive to the BSP's wait-state setup.
+static void Conf_CritSection (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+	CPU_SR_ALLOC();
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		CPU_CRITICAL_ENTER();
+		CPU_CRITICAL_EXIT();
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	Conf_Row("crit", &stats);
+}
+
+// OSSemPost() then OSSemPend() from the same task: the post + pend hot
+// path with no task switch.
+static void Conf_SemRoundTrip (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+	OS_ERR     err;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		OSSemPost(&Conf_Sem, OS_OPT_POST_1, &err);
+		OSSemPend(&Conf_Sem, (OS_TICK)0, OS_OPT_PEND_BLOCKING,
+		          (CPU_TS *)0, &err);
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	Conf_Row("sem_rt", &stats);
+}
+
+#if OS_CFG_Q_EN > 0u
+// OSQPost() then OSQPend() from the same task, message already queued
+// when the pend runs.
+static void Conf_QRoundTrip (void)
+{
+	CONF_STATS  stats;
+	CPU_TS_TMR  t0, t1;
+	CPU_INT32U  i;
+	OS_MSG_SIZE msg_size;
+	OS_ERR      err;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		OSQPost(&Conf_Q, (void *)&Conf_Q, (OS_MSG_SIZE)0,
+		        OS_OPT_POST_FIFO, &err);
+		(void)OSQPend(&Conf_Q, (OS_TICK)0, OS_OPT_PEND_BLOCKING,
+		              &msg_size, (CPU_TS *)0, &err);
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	Conf_Row("q_rt", &stats);
+}
+#endif
+
+// Semaphore ping-pong with the echo task: one round trip is two full
+// context switches plus two posts and two pends.
+static void Conf_CtxSw (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+	OS_ERR     err;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		OSSemPost(&Conf_SemGo, OS_OPT_POST_1, &err);
+		OSSemPend(&Conf_SemEcho, (OS_TICK)0, OS_OPT_PEND_BLOCKING,
+		          (CPU_TS *)0, &err);
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	Conf_Row("ctx_sw", &stats);
+}
+
+// Period between successive OSTimeDly(1) wakeups as seen by the task;
+// the header row's ticknom= is the ideal period, the min/max spread is
+// the wakeup jitter.
+static void Conf_DlyJitter (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR prev, now;
+	CPU_INT32U i;
+	OS_ERR     err;
+
+	Conf_StatsInit(&stats);
+	OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);	// align to a tick edge
+	prev = CPU_TS_TMR_RD();
+	for (i = 0; i < CONF_BENCH_TICK_ITER; i++) {
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+		now = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(now - prev));
+		prev = now;
+	}
+	Conf_Row("dly1", &stats);
+}
+
+#if OS_CFG_TASK_DEL_EN > 0u
+// OSTaskCreate() cost; the dummy task sits below the caller so it never
+// runs before OSTaskDel() removes it, and the delete is outside the
+// timed window.
+static void Conf_TaskCreate (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+	OS_ERR     err;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_TICK_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		OSTaskCreate((OS_TCB      *)&Conf_TaskDummyTCB,
+		             (CPU_CHAR    *)"Conf Dummy",
+		             (OS_TASK_PTR  )Conf_TaskDummy,
+		             (void        *)0,
+		             (OS_PRIO      )CONF_BENCH_DUMMY_PRIO,
+		             (CPU_STK     *)&Conf_TaskDummyStk[0],
+		             (CPU_STK_SIZE )CONF_DUMMY_STK_LIMIT,
+		             (CPU_STK_SIZE )CONF_DUMMY_STK_SIZE,
+		             (OS_MSG_QTY   )0u,
+		             (OS_TICK      )0u,
+		             (void        *)0,
+		             (OS_OPT       )0u,
+		             (OS_ERR      *)&err);
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+		OSTaskDel(&Conf_TaskDummyTCB, &err);
+	}
+	Conf_Row("task_create", &stats);
+}
+
+// Created and deleted by Conf_TaskCreate() below the caller's priority
+// -- this body never executes.
+static void Conf_TaskDummy (void *p_arg)
+{
+	OS_ERR err;
+
+	(void)p_arg;
+	while (DEF_TRUE) {
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+	}
+}
+#endif
+
+// Mem_Copy() of a 256 byte RAM block -- the uC/LIB copy loop the IPC
+// and driver paths lean on; tracks RAM wait states and prefetch setup.
+static void Conf_MemCopy (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		Mem_Copy((void *)&Conf_BufDst[0], (void *)&Conf_BufSrc[0],
+		         (CPU_SIZE_T)CONF_BUF_SIZE);
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	Conf_Row("mem_copy256", &stats);
+}
+
+// CRC-16 over the same 256 byte block -- the uC/LIB table-driven CRC
+// the link frames use; the table lives in flash, so this row moves with
+// the BSP's flash wait states where mem_copy256 does not.
+static void Conf_Crc16 (void)
+{
+	CONF_STATS stats;
+	CPU_TS_TMR t0, t1;
+	CPU_INT32U i;
+	CPU_INT16U crc;
+
+	Conf_StatsInit(&stats);
+	for (i = 0; i < CONF_BENCH_ITER; i++) {
+		t0 = CPU_TS_TMR_RD();
+		crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL,
+		                     (void *)&Conf_BufSrc[0],
+		                     (CPU_SIZE_T)CONF_BUF_SIZE);
+		crc = CRC_CRC16_Final(crc);
+		t1 = CPU_TS_TMR_RD();
+		Conf_StatsUpdate(&stats, (CPU_INT32U)(t1 - t0));
+	}
+	(void)crc;
+	Conf_Row("crc16_256", &stats);
+}
+
+//----- Ping-pong partner: echoes every Conf_SemGo post back on
+//      Conf_SemEcho.  Left pended (harmless) once the suite is done.
+static void Conf_TaskEcho (void *p_arg)
+{
+	OS_ERR err;
+
+	(void)p_arg;
+	while (DEF_TRUE) {
+		OSSemPend(&Conf_SemGo, (OS_TICK)0, OS_OPT_PEND_BLOCKING,
+		          (CPU_TS *)0, &err);
+		OSSemPost(&Conf_SemEcho, OS_OPT_POST_1, &err);
+	}
+}
+
+//----- Run the whole suite once -- see ConfBench.h.
+void ConfBench_Run (const char *p_board)
+{
+	CPU_INT32U i;
+	OS_ERR     err;
+
+	Conf_Board = p_board;
+
+	OSSemCreate(&Conf_SemGo,   "Conf Go",   0, &err);
+	OSSemCreate(&Conf_SemEcho, "Conf Echo", 0, &err);
+	OSSemCreate(&Conf_Sem,     "Conf Sem",  0, &err);
+#if OS_CFG_Q_EN > 0u
+	OSQCreate(&Conf_Q, "Conf Q", (OS_MSG_QTY)CONF_Q_SIZE,
+	          &Conf_QMsgTbl[0], (OS_MSG_QTY)CONF_Q_SIZE, &err);
+#endif
+
+	OSTaskCreate((OS_TCB      *)&Conf_TaskEchoTCB,
+	             (CPU_CHAR    *)"Conf Echo",
+	             (OS_TASK_PTR  )Conf_TaskEcho,
+	             (void        *)0,
+	             (OS_PRIO      )CONF_BENCH_ECHO_PRIO,
+	             (CPU_STK     *)&Conf_TaskEchoStk[0],
+	             (CPU_STK_SIZE )CONF_ECHO_STK_LIMIT,
+	             (CPU_STK_SIZE )CONF_ECHO_STK_SIZE,
+	             (OS_MSG_QTY   )0u,
+	             (OS_TICK      )0u,
+	             (void        *)0,
+	             (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+	             (OS_ERR      *)&err);
+	if (err != OS_ERR_NONE) {
+		putsU1("conf error=echo_task_create\r\n");
+		return;
+	}
+
+	for (i = 0; i < CONF_BUF_SIZE; i++) {	// deterministic CRC input
+		Conf_BufSrc[i] = (CPU_INT08U)i;
+	}
+
+	Conf_RowBegin();
+	putsU1(" clk=");
+	Conf_PrintNum((CPU_INT32U)BSP_CLK_FREQ);
+	putsU1(" tickhz=");
+	Conf_PrintNum((CPU_INT32U)OS_CFG_TICK_RATE_HZ);
+	putsU1(" ticknom=");
+	Conf_PrintNum((CPU_INT32U)(BSP_CLK_FREQ / (2 * OS_CFG_TICK_RATE_HZ)));
+	putsU1(" iter=");
+	Conf_PrintNum((CPU_INT32U)CONF_BENCH_ITER);
+	putsU1("\r\n");
+
+	Conf_TmrOverhead();
+	Conf_CritSection();
+	Conf_SemRoundTrip();
+#if OS_CFG_Q_EN > 0u
+	Conf_QRoundTrip();
+#endif
+	Conf_CtxSw();
+	Conf_DlyJitter();
+#if OS_CFG_TASK_DEL_EN > 0u
+	Conf_TaskCreate();
+#endif
+	Conf_MemCopy();
+	Conf_Crc16();
+
+	Conf_RowBegin();
+	putsU1(" done=1\r\n");
+}
+
+#endif
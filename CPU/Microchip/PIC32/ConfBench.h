@@ -0,0 +1,58 @@
+// ConfBench.h
+
+#ifndef CONFBENCH_H
+#define CONFBENCH_H
+
+#include <includes.h>
+
+//-----------------------------------------------------------------------
+// CROSS-BOARD PERFORMANCE CONFORMANCE SUITE
+//
+// The same kernel and libraries run on four boards in this tree (Max32,
+// UNO32, Explorer16, PIC32SK-USB-II) whose BSPs differ in clocking,
+// flash wait states, and peripheral setup.  A kernel change verified on
+// one board is not automatically safe on the others -- this module is
+// the identical microbenchmark set every board's Conf project compiles
+// in, so each board gets a comparable baseline from the SAME measurement
+// code (like UART1.c, this file is shared: it is built into each
+// project, picking up that project's bsp.h / os_cfg.h / app_cfg.h).
+//
+// Every output line is machine readable, one "name=value" list per row:
+//
+//   conf board=<id> clk=... tickhz=... ticknom=... iter=...
+//   conf board=<id> bench=<name> n=... min=... avg=... max=...
+//   conf board=<id> done=1
+//
+// so per-board result tables diff and track cleanly under version
+// control.  All figures are core timer ticks (SYSCLK / 2); the header
+// row carries the clock so tick counts convert to time offline.
+//
+// The caller (the board's App_TaskStart) must run initU1() first: the
+// rows go out over the UART1 console driver, which all four boards use.
+// The tick-hook interrupt latency row and the ISR post queue sweep stay
+// in the Max32 Bench project -- they need the time tick hook pointer,
+// which not every board's os_app_hooks.c carries.
+//-----------------------------------------------------------------------
+
+#ifndef CONF_BENCH_ITER
+#define CONF_BENCH_ITER       1000	// iterations for the CPU-bound rows
+#endif
+
+#ifndef CONF_BENCH_TICK_ITER
+#define CONF_BENCH_TICK_ITER    32	// iterations for the tick-paced rows
+#endif
+
+#ifndef CONF_BENCH_ECHO_PRIO
+#define CONF_BENCH_ECHO_PRIO     2	// ping-pong partner: just below the start task
+#endif
+
+#ifndef CONF_BENCH_DUMMY_PRIO
+#define CONF_BENCH_DUMMY_PRIO    3	// created and deleted suspended, never runs
+#endif
+
+//----- Run the whole suite once and print the rows above.  p_board is
+//      the board identifier for the board= field; call from the start
+//      task after initU1(), before the application claims the UART.
+void ConfBench_Run (const char *p_board);
+
+#endif
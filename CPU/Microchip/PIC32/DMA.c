@@ -0,0 +1,230 @@
+#ifndef DMA_C
+#define DMA_C
+
+#include "DMA.h"
+#include "UART1.h"
+//-----------------------------------------------------------------------
+// BOARD-LEVEL DMA CHANNEL ALLOCATOR -- see DMA.h for the channel model
+//-----------------------------------------------------------------------
+
+//----- Register overlay: every DMA channel exposes the same block of
+//      SFRs (each with CLR/SET/INV companions) at a fixed layout, so one
+//      struct pointer per channel replaces the hardcoded DCHx names
+//      (same scheme as the UART overlay in UARTn.c).
+typedef struct dma_ch_regs {
+	volatile unsigned int CON,  CONCLR,  CONSET,  CONINV;
+	volatile unsigned int ECON, ECONCLR, ECONSET, ECONINV;
+	volatile unsigned int INT,  INTCLR,  INTSET,  INTINV;
+	volatile unsigned int SSA,  SSACLR,  SSASET,  SSAINV;
+	volatile unsigned int DSA,  DSACLR,  DSASET,  DSAINV;
+	volatile unsigned int SSIZ, SSIZCLR, SSIZSET, SSIZINV;
+	volatile unsigned int DSIZ, DSIZCLR, DSIZSET, DSIZINV;
+	volatile unsigned int SPTR, SPTRCLR, SPTRSET, SPTRINV;
+	volatile unsigned int DPTR, DPTRCLR, DPTRSET, DPTRINV;
+	volatile unsigned int CSIZ, CSIZCLR, CSIZSET, CSIZINV;
+	volatile unsigned int CPTR, CPTRCLR, CPTRSET, CPTRINV;
+	volatile unsigned int DAT,  DATCLR,  DATSET,  DATINV;
+} DMA_CH_REGS;
+
+#define DMA_CH(ch)       (((DMA_CH_REGS *)&DCH0CON) + (ch))
+
+#define DMA_CON_CHEN     0x80		// DCHxCON:  channel enable
+#define DMA_ECON_CFORCE  0x80		// DCHxECON: force the first cell transfer
+#define DMA_ECON_CABORT  0x40		// DCHxECON: abort the transfer
+#define DMA_ECON_PATEN   0x20		// DCHxECON: pattern-match abort enable
+#define DMA_ECON_SIRQEN  0x10		// DCHxECON: cell transfer on the SIRQ event
+#define DMA_INT_CHBCIE   0x80000	// DCHxINT:  block-complete interrupt enable
+
+#define DMA_KVA_TO_PA(v) ((unsigned int)(v) & 0x1FFFFFFF)	// virtual to physical for the DMA engine
+
+#define DMA_INT_PRIO     1	// allocator channels (2..7) dispatch through the
+				// full-save bsp_a.S stubs, so they must stay BELOW
+				// BSP_SRS_INT_PRIO: a priority-2 entry there would
+				// run the shadow set's uninitialized stack pointer.
+				// UART1.c's channels 0/1 have SRS stubs and keep
+				// their own priority (U1_DMA_INT_PRIO).
+
+//----- Interrupt controller access, indexed as in UARTn.c.  Channel ch
+//      raises IFS1<16+ch> (request number 48+ch) and its priority field
+//      sits in vector 36+ch's IPC lane (DMA0 is vector 36, IPC9<4:2>),
+//      matching the bsp_a.S stubs (.vector_36 is BSP_DMA0ISR).
+#define DMA_IRQ(ch)      (48 + (ch))
+#define DMA_VEC(ch)      (36 + (ch))
+#define DMA_IFSCLR(irq)  (*((&IFS0) + ((irq) >> 5) * 4 + 1))
+#define DMA_IECCLR(irq)  (*((&IEC0) + ((irq) >> 5) * 4 + 1))
+#define DMA_IECSET(irq)  (*((&IEC0) + ((irq) >> 5) * 4 + 2))
+#define DMA_IRQ_BIT(irq) (1u << ((irq) & 31))
+#define DMA_IPCCLR(vec)  (*((&IPC0) + ((vec) >> 2) * 4 + 1))
+#define DMA_IPCSET(vec)  (*((&IPC0) + ((vec) >> 2) * 4 + 2))
+#define DMA_IPC_SHIFT(vec) ((((vec) & 3) * 8) + 2)	// priority field within the IPC byte lane
+
+//----- Per-channel allocator state
+typedef struct dma_ch_state {
+	volatile int Used;	// channel handed out (or reserved by UART1.c)
+	unsigned int BlockBytes;	// programmed block size, for the byte counter
+	int EventIRQ;		// trigger event, -1 = software force start
+	DMA_CALLBACK Callback;	// completion callback, 0 = none
+	void *CallbackArg;
+} DMA_CH_STATE;
+
+static DMA_CH_STATE DmaChTbl[DMA_NBR_CH];
+
+volatile unsigned int DMA_ChBlockCtr[DMA_NBR_CH];	// completed transfers per channel
+volatile unsigned int DMA_ChByteCtr[DMA_NBR_CH];	// bytes moved per channel
+
+//----- Turn the controller on and reserve UART1.c's channels (see DMA.h)
+void DMA_Init (void)
+{
+	int ch;
+
+	for (ch = 0; ch < DMA_NBR_CH; ch++) {
+		DmaChTbl[ch].Used = 0;
+		DMA_ChBlockCtr[ch] = 0;
+		DMA_ChByteCtr[ch]  = 0;
+	}
+#if U1_TX_DMA_EN
+	DmaChTbl[0].Used = 1;	// console TX owns channel 0 (see UART1.c)
+#endif
+#if U1_RX_DMA_EN
+	DmaChTbl[1].Used = 1;	// console pattern-match RX owns channel 1
+#endif
+	DMACONSET = 0x8000;	// DMA controller ON (no-op if UART1.c already set it)
+}
+
+//----- Claim a free channel at arbitration priority 0..3 (see DMA.h)
+int DMA_ChAlloc (int prio)
+{
+	int ch;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	for (ch = 0; ch < DMA_NBR_CH; ch++) {
+		if (!DmaChTbl[ch].Used) {
+			DmaChTbl[ch].Used = 1;
+			CPU_CRITICAL_EXIT();
+			DMA_CH(ch)->CON = (unsigned int)(prio & 0x03);	// channel off, arbitration priority
+			return ch;
+		}
+	}
+	CPU_CRITICAL_EXIT();
+	return DMA_CH_NONE;
+}
+
+//----- Return a channel to the free pool (see DMA.h)
+void DMA_ChFree (int ch)
+{
+	if (ch < 0 || ch >= DMA_NBR_CH)
+		return;
+	DMA_ChAbort(ch);
+	DMA_IECCLR(DMA_IRQ(ch)) = DMA_IRQ_BIT(DMA_IRQ(ch));
+	DmaChTbl[ch].Callback = (DMA_CALLBACK)0;
+	DmaChTbl[ch].Used = 0;
+}
+
+//----- Program a channel from a descriptor (see DMA.h)
+void DMA_ChCfg (int ch, const DMA_XFER *p_xfer, DMA_CALLBACK callback, void *arg)
+{
+	DMA_CH_REGS *p_ch;
+	DMA_CH_STATE *p_st;
+	unsigned int econ;
+
+	if (ch < 0 || ch >= DMA_NBR_CH)
+		return;
+	p_ch = DMA_CH(ch);
+	p_st = &DmaChTbl[ch];
+
+	p_st->Callback    = callback;
+	p_st->CallbackArg = arg;
+	p_st->EventIRQ    = p_xfer->EventIRQ;
+	p_st->BlockBytes  = (p_xfer->SrcSize > p_xfer->DstSize) ?	// a block completes when the larger
+	                     p_xfer->SrcSize : p_xfer->DstSize;		// of the two sizes is exhausted
+
+	p_ch->SSA  = DMA_KVA_TO_PA(p_xfer->Src);
+	p_ch->DSA  = DMA_KVA_TO_PA(p_xfer->Dst);
+	p_ch->SSIZ = p_xfer->SrcSize;
+	p_ch->DSIZ = p_xfer->DstSize;
+	p_ch->CSIZ = p_xfer->CellSize;
+
+	econ = 0;
+	if (p_xfer->EventIRQ >= 0)
+		econ |= ((unsigned int)p_xfer->EventIRQ << 8) | DMA_ECON_SIRQEN;
+	if (p_xfer->Pattern >= 0) {
+		econ |= DMA_ECON_PATEN;
+		p_ch->DAT = (unsigned int)p_xfer->Pattern;
+	}
+	p_ch->ECON = econ;
+	p_ch->INT  = DMA_INT_CHBCIE;	// block-complete interrupt (pattern abort raises it too)
+
+	DMA_IFSCLR(DMA_IRQ(ch)) = DMA_IRQ_BIT(DMA_IRQ(ch));
+	DMA_IPCCLR(DMA_VEC(ch)) = 7u << DMA_IPC_SHIFT(DMA_VEC(ch));
+	DMA_IPCSET(DMA_VEC(ch)) = (unsigned int)DMA_INT_PRIO << DMA_IPC_SHIFT(DMA_VEC(ch));
+	DMA_IECSET(DMA_IRQ(ch)) = DMA_IRQ_BIT(DMA_IRQ(ch));
+}
+
+//----- Arm the channel (see DMA.h)
+void DMA_ChStart (int ch)
+{
+	DMA_CH_REGS *p_ch;
+
+	if (ch < 0 || ch >= DMA_NBR_CH)
+		return;
+	p_ch = DMA_CH(ch);
+	p_ch->INTCLR  = 0x000000FF;	// clear channel event flags
+	p_ch->CONSET  = DMA_CON_CHEN;
+	if (DmaChTbl[ch].EventIRQ < 0)
+		p_ch->ECONSET = DMA_ECON_CFORCE;	// no trigger event -- start the block now
+}
+
+//----- Abort an in-flight transfer (see DMA.h)
+void DMA_ChAbort (int ch)
+{
+	DMA_CH_REGS *p_ch;
+
+	if (ch < 0 || ch >= DMA_NBR_CH)
+		return;
+	p_ch = DMA_CH(ch);
+	p_ch->ECONSET = DMA_ECON_CABORT;
+	p_ch->CONCLR  = DMA_CON_CHEN;
+	p_ch->INTCLR  = 0x000000FF;	// drop the abort's event so no callback fires
+	DMA_IFSCLR(DMA_IRQ(ch)) = DMA_IRQ_BIT(DMA_IRQ(ch));
+}
+
+//----- Per-channel interrupt service (see DMA.h)
+//      Counts the transfer, clears the channel events and hands the
+//      completion to the consumer's callback.  DCHxDPTR still holds the
+//      bytes moved when a pattern match aborted the block; it reads 0
+//      after a full block, so 0 means the whole programmed size.
+void DMA_ISR_Handler (int ch)
+{
+	DMA_CH_REGS *p_ch;
+	DMA_CH_STATE *p_st;
+	unsigned int n;
+
+	p_ch = DMA_CH(ch);
+	p_st = &DmaChTbl[ch];
+
+	n = p_ch->DPTR;
+	if (n == 0)
+		n = p_st->BlockBytes;
+	DMA_ChBlockCtr[ch]++;
+	DMA_ChByteCtr[ch] += n;
+
+	p_ch->INTCLR = 0x000000FF;	// clear the channel event flags
+	DMA_IFSCLR(DMA_IRQ(ch)) = DMA_IRQ_BIT(DMA_IRQ(ch));
+
+	if (p_st->Callback != (DMA_CALLBACK)0) {
+		(*p_st->Callback)(ch, p_st->CallbackArg);	// ISR level -- post family only (see DMA.h)
+	}			// the full-save epilogue's OSIntExit() reschedules if the callback posted
+}
+
+//----- Per-channel entry points for the bsp_a.S vector stubs: the stubs
+//      take no argument, so each channel gets a one-line wrapper.
+//      Channels 0/1 stay wired to UART1.c's handlers.
+void DMA_Ch2_ISR_Handler (void) { DMA_ISR_Handler(2); }
+void DMA_Ch3_ISR_Handler (void) { DMA_ISR_Handler(3); }
+void DMA_Ch4_ISR_Handler (void) { DMA_ISR_Handler(4); }
+void DMA_Ch5_ISR_Handler (void) { DMA_ISR_Handler(5); }
+void DMA_Ch6_ISR_Handler (void) { DMA_ISR_Handler(6); }
+void DMA_Ch7_ISR_Handler (void) { DMA_ISR_Handler(7); }
+
+#endif
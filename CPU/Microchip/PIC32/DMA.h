@@ -0,0 +1,98 @@
+// DMA.h
+
+#ifndef DMA_H
+#define DMA_H
+
+#include <p32xxxx.h>
+#include <includes.h>
+
+//-----------------------------------------------------------------------
+// BOARD-LEVEL DMA CHANNEL ALLOCATOR (PIC32MX795 DMA channels 0..7)
+//
+// UART1.c grabs channels 0 and 1 by name for console TX/RX; every new
+// DMA consumer after that would have to pick a free channel by reading
+// the other drivers.  This library is the arbiter: channels are handed
+// out by DMA_ChAlloc, configured from a descriptor (source, destination,
+// sizes, trigger event, optional pattern) and armed/aborted through one
+// channel-indexed API, so consumers compose without knowing about each
+// other.  UART1.c's channels are marked as taken at init time and are
+// otherwise untouched.
+//
+// Completion callbacks run at ISR level, dispatched from the bsp_a.S
+// vector stubs through DMA_ISR_Handler (the kernel is built with direct
+// ISR posts, so there is no deferred-post queue to hand them to).  A
+// callback may therefore only use ISR-safe kernel calls (the post
+// family); it should post to a task for any real work and must not
+// block.  Allocator channels interrupt at priority 1 through the
+// full-save stubs -- NOT at BSP_SRS_INT_PRIO, whose shadow-set entry
+// only vectors 24/26/31/36/37 are equipped for (see bsp.c).  Per-channel block/byte counters live in globals so throughput
+// can be watched from the debugger or uC/Probe.
+//-----------------------------------------------------------------------
+
+#define DMA_NBR_CH    8		// DMA channels on the PIC32MX795
+#define DMA_CH_NONE  (-1)	// DMA_ChAlloc return when no channel is free
+
+//----- Transfer descriptor: everything DMA_ChCfg programs into a channel.
+//      Addresses are virtual (the library translates for the DMA engine).
+typedef struct dma_xfer {
+	const void *Src;	// source buffer / register
+	void *Dst;		// destination buffer / register
+	unsigned int SrcSize;	// source size in bytes (1 for a register)
+	unsigned int DstSize;	// destination size in bytes
+	unsigned int CellSize;	// bytes moved per trigger event
+	int EventIRQ;		// interrupt request number that triggers a cell
+				// transfer, -1 = none (DMA_ChStart force-starts)
+	int Pattern;		// byte value that aborts the transfer when moved
+				// (pattern-match reception), -1 = disabled
+} DMA_XFER;
+
+//----- Completion callback, invoked at ISR level when the channel's
+//      block transfer completes or its pattern match aborts it.
+typedef void (*DMA_CALLBACK)(int ch, void *arg);
+
+//----- Per-channel throughput counters, maintained by DMA_ISR_Handler:
+//      completed transfers and bytes moved (a pattern-aborted transfer
+//      adds only the bytes moved before the match).
+extern volatile unsigned int DMA_ChBlockCtr[DMA_NBR_CH];
+extern volatile unsigned int DMA_ChByteCtr[DMA_NBR_CH];
+
+//----- Turn the DMA controller on and reserve the channels UART1.c owns.
+//      Call once at BSP init, before any DMA_ChAlloc.
+void DMA_Init (void);
+
+//----- Claim a free channel at hardware arbitration priority 0..3
+//      (3 = serviced first when several channels want the bus).
+//      Returns the channel number, or DMA_CH_NONE if all are taken.
+int DMA_ChAlloc (int prio);
+
+//----- Return a channel to the free pool; aborts it if still armed.
+void DMA_ChFree (int ch);
+
+//----- Program a channel from a descriptor and register the completion
+//      callback (may be 0 when the caller polls the counters instead).
+//      The channel is left disarmed; DMA_ChStart arms it.
+void DMA_ChCfg (int ch, const DMA_XFER *p_xfer, DMA_CALLBACK callback, void *arg);
+
+//----- Arm the channel: transfers run on the descriptor's trigger event,
+//      or start immediately when the descriptor has no event.  A channel
+//      disarms itself at block completion; DMA_ChStart re-arms it for
+//      another identical block (the hardware reset its pointers).
+void DMA_ChStart (int ch);
+
+//----- Abort an in-flight transfer and disarm the channel.  No
+//      completion callback is invoked for an aborted transfer.
+void DMA_ChAbort (int ch);
+
+//----- Per-channel interrupt service.  The bsp_a.S stubs of vectors
+//      38..43 call the DMA_Chn_ISR_Handler wrappers; channels 0/1 stay
+//      wired to UART1.c's handlers at vectors 36/37.
+void DMA_ISR_Handler (int ch);
+
+void DMA_Ch2_ISR_Handler (void);
+void DMA_Ch3_ISR_Handler (void);
+void DMA_Ch4_ISR_Handler (void);
+void DMA_Ch5_ISR_Handler (void);
+void DMA_Ch6_ISR_Handler (void);
+void DMA_Ch7_ISR_Handler (void);
+
+#endif
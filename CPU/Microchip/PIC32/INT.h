@@ -169,6 +169,93 @@ void INTEnableSystemSingleVectoredInt(void);
  * Overview:        Disables system interrupts
  ********************************************************************/
 void INTDisableSystemSingleVectoredInt(void);
+/*********************************************************************
+ * Function:        void INTMapShadowSetToPriority(unsigned int priority)
+ *
+ * PreCondition:    Multi-vectored interrupts enabled
+ *
+ * Input:           priority - interrupt priority level (1 - 7)
+ *
+ * Output:          None
+ *
+ * Side Effects:    Interrupts of the given priority run on the shadow
+ *                  register set
+ *
+ * Overview:        Maps the given priority to the highest implemented
+ *                  shadow register set via the SRSMap register
+ ********************************************************************/
+void INTMapShadowSetToPriority(unsigned int priority);
+/*********************************************************************
+ * Function:        void INTSetCoreSWInt0(void)
+ *                  void INTClearCoreSWInt0(void)
+ *
+ * PreCondition:    None
+ *
+ * Input:           None
+ *
+ * Output:          None
+ *
+ * Side Effects:    Core software interrupt 0 pended / acknowledged
+ *
+ * Overview:        Raise or clear core software interrupt 0 (CP0
+ *                  cause IP0)
+ ********************************************************************/
+void INTSetCoreSWInt0(void);
+void INTClearCoreSWInt0(void);
+
+/*********************************************************************
+ * Interrupt latency classes
+ *
+ * Drivers no longer pick raw IPL numbers: they request a latency
+ * class and INTLatencyClassAssign() maps it to the IPL that class
+ * owns, so the relative urgency of every ISR in the system is fixed
+ * by construction:
+ *
+ *   INT_CLASS_HARD        IPL 4 -- above the kernel tick (3).  The
+ *                         handler preempts everything the kernel
+ *                         does outside DI critical sections, and in
+ *                         exchange may not call ANY kernel service:
+ *                         it runs on a raw vector stub with none of
+ *                         the OS entry/exit bookkeeping.
+ *
+ *   INT_CLASS_KERNEL      IPL 2 -- the shadow-register-set level
+ *                         (must equal the BSP's BSP_SRS_INT_PRIO).
+ *                         Handlers may use the ISR-safe post calls
+ *                         and reschedule via the BSP_IntNeedSched
+ *                         relay.
+ *
+ *   INT_CLASS_BACKGROUND  IPL 1 -- beneath everything, sharing the
+ *                         level of the core-software-interrupt 0
+ *                         reschedule relay.  For housekeeping ISRs
+ *                         that tolerate arbitrary deferral.
+ *
+ * Assignments are recorded in a table (vector, class, name) readable
+ * through INTLatencyClassMapQty()/INTLatencyClassMapGet() so a boot
+ * report can print the resulting interrupt map.
+ ********************************************************************/
+#define INT_CLASS_HARD            0
+#define INT_CLASS_KERNEL          1
+#define INT_CLASS_BACKGROUND      2
+#define INT_CLASS_QTY             3
+
+#define INT_CLASS_HARD_IPL        4
+#define INT_CLASS_KERNEL_IPL      2    /* == BSP_SRS_INT_PRIO       */
+#define INT_CLASS_BACKGROUND_IPL  1
+
+#define INT_CLASS_MAP_SIZE       16    /* max recorded assignments  */
+
+/* Program the IPC priority field of 'vector' from 'class' and record
+   the assignment; 'name' labels it in the boot report.  Returns the
+   IPL the vector now runs at (0 if the class is invalid).           */
+unsigned int INTLatencyClassAssign(unsigned int vector, unsigned int latency_class, const char *name);
+
+/* The IPL a class maps to, without assigning anything               */
+unsigned int INTLatencyClassIPL(unsigned int latency_class);
+
+/* Walk the recorded assignments (ix 0..Qty-1); returns the IPL and
+   fills any non-NULL out parameter                                  */
+unsigned int INTLatencyClassMapQty(void);
+unsigned int INTLatencyClassMapGet(unsigned int ix, unsigned int *p_vector, unsigned int *p_class, const char **p_name);
 
 /*********************************************************************
  * Interrupt Priority and sub-priority defines
@@ -700,10 +787,10 @@ void INTDisableSystemSingleVectoredInt(void);
 /*********************************************************************
  * SPI 1 Error
  ********************************************************************/
-#define mSPI1EClearIntFlag()                (IFS0CLR = (1 << 24))
+#define mSPI1EClearIntFlag()                (IFS0CLR = (1 << 23))
 #define mSPI1EGetIntFlag()                  (IFS0bits.SPI1EIF)
 #define mSPI1EGetIntEnable()                (IEC0bits.SPI1EIE)
-#define mSPI1EIntEnable(enable)             (IEC0CLR = (1 << 24), IEC0SET = (enable << 24))
+#define mSPI1EIntEnable(enable)             (IEC0CLR = (1 << 23), IEC0SET = (enable << 23))
 /*********************************************************************
  * SPI 1 Transfer
  ********************************************************************/
@@ -714,18 +801,18 @@ void INTDisableSystemSingleVectoredInt(void);
 /*********************************************************************
  * SPI 1 Receive
  ********************************************************************/
-#define mSPI1RXClearIntFlag()               (IFS0CLR = (1 << 26))
+#define mSPI1RXClearIntFlag()               (IFS0CLR = (1 << 24))
 #define mSPI1RXGetIntFlag()                 (IFS0bits.SPI1RXIF)
 #define mSPI1RXGetIntEnable()               (IEC0bits.SPI1RXIE)
-#define mSPI1RXIntEnable(enable)            (IEC0CLR = (1 << 26), IEC0SET = (enable << 26))
+#define mSPI1RXIntEnable(enable)            (IEC0CLR = (1 << 24), IEC0SET = (enable << 24))
 /*********************************************************************
  * SPI 1 Vector
  ********************************************************************/
-#define mSPI1ClearAllIntFlags()              ( IFS0CLR = (7 << 24) )
-#define mSPI1IntDisable()                    ( IEC0CLR = (7 << 24) )
-#define mSPI1SetIntPriority(priority)        (IPC6CLR = (7 << 2), IPC6SET = (priority << 2))
+#define mSPI1ClearAllIntFlags()              ( IFS0CLR = (7 << 23) )
+#define mSPI1IntDisable()                    ( IEC0CLR = (7 << 23) )
+#define mSPI1SetIntPriority(priority)        (IPC5CLR = (7 << 26), IPC5SET = (priority << 26))
 #define mSPI1GetIntPriority()                (IPC6bits.SPI1IP)
-#define mSPI1SetIntSubPriority(subPriority)  (IPC6CLR = (3), IPC6SET = (subPriority))
+#define mSPI1SetIntSubPriority(subPriority)  (IPC5CLR = (3 << 24), IPC5SET = (subPriority << 24))
 #define mSPI1GetIntSubPriority()             (IPC6bits.SPI1IS) 
 /*********************************************************************
  * SPI 2 Interrupt Control Functions
@@ -802,37 +889,37 @@ void INTDisableSystemSingleVectoredInt(void);
 /*********************************************************************
  * UART 1 General
  ********************************************************************/
-#define mU1IntEnable(enable)                (IEC0SET = (enable << 27))
-#define mU1IntDisable(enable)               (IEC0CLR = (enable << 27))
+#define mU1IntEnable(enable)                (IEC0SET = (enable << 26))
+#define mU1IntDisable(enable)               (IEC0CLR = (enable << 26))
 /*********************************************************************
  * UART 1 Error
  ********************************************************************/
-#define mU1EClearIntFlag()                  (IFS0CLR = (1 << 27))
+#define mU1EClearIntFlag()                  (IFS0CLR = (1 << 26))
 #define mU1EGetIntFlag()                    (IFS0bits.U1EIF)
 #define mU1EGetIntEnable()                  (IEC0bits.U1EIE)
-#define mU1EIntEnable(enable)               (IEC0CLR = (1 << 27), IEC0SET = (enable << 27))
+#define mU1EIntEnable(enable)               (IEC0CLR = (1 << 26), IEC0SET = (enable << 26))
 /*********************************************************************
  * UART 1 Receive
  ********************************************************************/
-#define mU1RXClearIntFlag()                 (IFS0CLR = (1 << 28))
+#define mU1RXClearIntFlag()                 (IFS0CLR = (1 << 27))
 #define mU1RXGetIntFlag()                   (IFS0bits.U1RXIF)
-#define mU1RXGetIntEnable()                 (IEC0bits.U1RXIF)
-#define mU1RXIntEnable(enable)              (IEC0CLR = (1 << 28), IEC0SET = (enable << 28))
+#define mU1RXGetIntEnable()                 (IEC0bits.U1RXIE)
+#define mU1RXIntEnable(enable)              (IEC0CLR = (1 << 27), IEC0SET = (enable << 27))
 /*********************************************************************
  * UART 1 Transfer
  ********************************************************************/
-#define mU1TXClearIntFlag()                 (IFS0CLR = (1 << 29))
+#define mU1TXClearIntFlag()                 (IFS0CLR = (1 << 28))
 #define mU1TXGetIntFlag()                   (IFS0bits.U1TXIF)
 #define mU1TXGetIntEnable()                 (IEC0bits.U1TXIE)
-#define mU1TXIntEnable(enable)              (IEC0CLR = (1 << 29), IEC0SET = (enable << 29))
+#define mU1TXIntEnable(enable)              (IEC0CLR = (1 << 28), IEC0SET = (enable << 28))
 /*********************************************************************
  * UART 1 Vector
  ********************************************************************/
-#define mU1ClearAllIntFlags()               ( IFS0CLR = (7 << 27) )
-#define mU1IntDisableAll()                  ( IEC0CLR = (7 << 27) )
-#define mU1SetIntPriority(priority)         ( IPC6CLR = (7 << 10), IPC6SET = (priority << 10))
+#define mU1ClearAllIntFlags()               ( IFS0CLR = (7 << 26) )
+#define mU1IntDisableAll()                  ( IEC0CLR = (7 << 26) )
+#define mU1SetIntPriority(priority)         ( IPC6CLR = (7 << 2), IPC6SET = (priority << 2))
 #define mU1GetIntPriority()                 (IPC6bits.U1IP)
-#define mU1SetIntSubPriority(subPriority)   ( IPC6CLR = (3 << 8), IPC6SET = (subPriority << 8))
+#define mU1SetIntSubPriority(subPriority)   ( IPC6CLR = (3), IPC6SET = (subPriority))
 #define mU1GetIntSubPriority()              (IPC6bits.U1IS) 
 /*********************************************************************
  * UART 2 Interrupt Control Functions
@@ -913,32 +1000,32 @@ void INTDisableSystemSingleVectoredInt(void);
 /*********************************************************************
  * I2C 1 Bus Colision
  ********************************************************************/
-#define mI2C1BClearIntFlag()                (IFS0CLR = (1 << 30))
+#define mI2C1BClearIntFlag()                (IFS0CLR = (1 << 29))
 #define mI2C1BGetIntFlag()                  (IFS0bits.I2C1BCIF)
 #define mI2C1BGetIntEnable()                (IEC0bits.I2C1BCIE)
-#define mI2C1BIntEnable(enable)             (IEC0CLR = (1 << 30), IEC0SET = (enable << 30))
+#define mI2C1BIntEnable(enable)             (IEC0CLR = (1 << 29), IEC0SET = (enable << 29))
 /*********************************************************************
  * I2C 1 Slave
  ********************************************************************/
-#define mI2C1SClearIntFlag()                (IFS0CLR = (1 << 31))
+#define mI2C1SClearIntFlag()                (IFS0CLR = (1 << 30))
 #define mI2C1SGetIntFlag()                  (IFS0bits.I2C1SIF)
 #define mI2C1SGetIntEnable()                (IEC0bits.I2C1SIE)
-#define mI2C1SIntEnable(enable)             (IEC0CLR = (1 << 31), IEC0SET = (enable << 31))
+#define mI2C1SIntEnable(enable)             (IEC0CLR = (1 << 30), IEC0SET = (enable << 30))
 /*********************************************************************
  * I2C 1 Master
  ********************************************************************/
-#define mI2C1MClearIntFlag()                (IFS1CLR = (1))
-#define mI2C1MGetIntFlag()                  (IFS1bits.I2C1MIF)
-#define mI2C1MGetIntEnable()                (IEC1bits.I2C1MIE)
-#define mI2C1MIntEnable(enable)             (IEC1CLR = (1), IEC1SET = (enable))
+#define mI2C1MClearIntFlag()                (IFS0CLR = (1 << 31))
+#define mI2C1MGetIntFlag()                  (IFS0bits.I2C1MIF)
+#define mI2C1MGetIntEnable()                (IEC0bits.I2C1MIE)
+#define mI2C1MIntEnable(enable)             (IEC0CLR = (1 << 31), IEC0SET = (enable << 31))
 /*********************************************************************
  * I2C 1 Vector
  ********************************************************************/
-#define mI2C1ClearAllIntFlags()             ( IFS0CLR = (3 << 30), IFS1CLR = 1)
-#define mI2C1IntDisable()                   ( IEC0CLR = (3 << 30), IEC1CLR = 1)
-#define mI2C1SetIntPriority(priority)       ( IPC6CLR = (7 << 18), IPC6SET = (priority << 18))
-#define mI2C1GetIntPriority()               (IPC6bits.I2C1IS)
-#define mI2C1SetIntSubPriority(subPriority) ( IPC6CLR = (3 << 16), IPC6SET = (subPriority << 16))
+#define mI2C1ClearAllIntFlags()             ( IFS0CLR = (7 << 29) )
+#define mI2C1IntDisable()                   ( IEC0CLR = (7 << 29) )
+#define mI2C1SetIntPriority(priority)       ( IPC6CLR = (7 << 10), IPC6SET = (priority << 10))
+#define mI2C1GetIntPriority()               (IPC6bits.I2C1IP)
+#define mI2C1SetIntSubPriority(subPriority) ( IPC6CLR = (3 << 8), IPC6SET = (subPriority << 8))
 #define mI2C1GetIntSubPriority()            (IPC6bits.I2C1IS) 
 /*********************************************************************
  * I2C 2 Interrupt Control Functions
@@ -1219,47 +1306,47 @@ void INTDisableSystemSingleVectoredInt(void);
 /*********************************************************************
  * DMA 0
  ********************************************************************/
-#define mDMA0ClearIntFlag()                     (IFS1CLR = (1 << 17))
+#define mDMA0ClearIntFlag()                     (IFS1CLR = (1 << 16))
 #define mDMA0GetIntFlag()                       (IFS1bits.DMA0IF)
 #define mDMA0GetIntEnable()                     (IEC1bits.DMA0IE)
-#define mDMA0IntEnable(enable)                  (IEC1CLR = (1 << 17), IEC1SET = (enable << 17))
-#define mDMA0SetIntPriority(priority)           (IPC9CLR = (7 << 10), IPC9SET = (priority << 10))
+#define mDMA0IntEnable(enable)                  (IEC1CLR = (1 << 16), IEC1SET = (enable << 16))
+#define mDMA0SetIntPriority(priority)           (IPC9CLR = (7 << 2), IPC9SET = (priority << 2))
 #define mDMA0GetIntPriority()                   (IPC9bits.DMA0IP)
-#define mDMA0SetIntSubPriority(subPriority)     (IPC9CLR = (3 << 8), IPC9SET = (subPriority << 8))
+#define mDMA0SetIntSubPriority(subPriority)     (IPC9CLR = (3), IPC9SET = (subPriority))
 #define mDMA0GetIntSubPriority()                (IPC9bits.DMA0IS) 
 /*********************************************************************
  * DMA 1
  ********************************************************************/
-#define mDMA1ClearIntFlag()                     (IFS1CLR = (1 << 18))
+#define mDMA1ClearIntFlag()                     (IFS1CLR = (1 << 17))
 #define mDMA1GetIntFlag()                       (IFS1bits.DMA1IF)
 #define mDMA1GetIntEnable()                     (IEC1bits.DMA1IE)
-#define mDMA1IntEnable(enable)                  (IEC1CLR = (1 << 18), IEC1SET = (enable << 18))
-#define mDMA1SetIntPriority(priority)           (IPC9CLR = (7 << 18), IPC9SET = (priority << 18))
+#define mDMA1IntEnable(enable)                  (IEC1CLR = (1 << 17), IEC1SET = (enable << 17))
+#define mDMA1SetIntPriority(priority)           (IPC9CLR = (7 << 10), IPC9SET = (priority << 10))
 #define mDMA1GetIntPriority()                   (IPC9bits.DMA1IP)
-#define mDMA1SetIntSubPriority(subPriority)     (IPC9CLR = (3 << 16), IPC9SET = (subPriority << 16))
+#define mDMA1SetIntSubPriority(subPriority)     (IPC9CLR = (3 << 8), IPC9SET = (subPriority << 8))
 #define mDMA1GetIntSubPriority()                (IPC9bits.DMA1IS) 
 /*********************************************************************
  * DMA 2
  ********************************************************************/
-#define mDMA2ClearIntFlag()                     (IFS1CLR = (1 << 19))
+#define mDMA2ClearIntFlag()                     (IFS1CLR = (1 << 18))
 #define mDMA2GetIntFlag()                       (IFS1bits.DMA2IF)
 #define mDMA2GetIntEnable()                     (IEC1bits.DMA2IE)
-#define mDMA2IntEnable(enable)                  (IEC1CLR = (1 << 19), IEC1SET = (enable << 19))
-#define mDMA2SetIntPriority(priority)           (IPC9CLR = (7 << 26), IPC9SET = (priority << 26))
+#define mDMA2IntEnable(enable)                  (IEC1CLR = (1 << 18), IEC1SET = (enable << 18))
+#define mDMA2SetIntPriority(priority)           (IPC9CLR = (7 << 18), IPC9SET = (priority << 18))
 #define mDMA2GetIntPriority()                   (IPC9bits.DMA2IP)
-#define mDMA2SetIntSubPriority(subPriority)     (IPC9CLR = (3 << 24), IPC9SET = (subPriority << 24))
+#define mDMA2SetIntSubPriority(subPriority)     (IPC9CLR = (3 << 16), IPC9SET = (subPriority << 16))
 #define mDMA2GetIntSubPriority()                (IPC9bits.DMA2IS) 
 /*********************************************************************
  * DMA 3
  ********************************************************************/
-#define mDMA3ClearIntFlag()                     (IFS1CLR = (1 << 20))
+#define mDMA3ClearIntFlag()                     (IFS1CLR = (1 << 19))
 #define mDMA3GetIntFlag()                       (IFS1bits.DMA3IF)
 #define mDMA3GetIntEnable()                     (IEC1bits.DMA3IE)
-#define mDMA3IntEnable(enable)                  (IEC1CLR = (1 << 20),    IEC1SET = (enable << 20))
-#define mDMA3SetIntPriority(priority)           (IPC10CLR = (7 << 2), IPC10SET = (priority << 2))
-#define mDMA3GetIntPriority()                   (IPC10bits.DMA3IP)
-#define mDMA3SetIntSubPriority(subPriority)     (IPC10CLR = (3), IPC10SET = (subPriority))
-#define mDMA3GetIntSubPriority()                (IPC10bits.DMA3IS) 
+#define mDMA3IntEnable(enable)                  (IEC1CLR = (1 << 19),    IEC1SET = (enable << 19))
+#define mDMA3SetIntPriority(priority)           (IPC9CLR = (7 << 26), IPC9SET = (priority << 26))
+#define mDMA3GetIntPriority()                   (IPC9bits.DMA3IP)
+#define mDMA3SetIntSubPriority(subPriority)     (IPC9CLR = (3 << 24), IPC9SET = (subPriority << 24))
+#define mDMA3GetIntSubPriority()                (IPC9bits.DMA3IS) 
 /*********************************************************************
  * DMA 4
  ********************************************************************/
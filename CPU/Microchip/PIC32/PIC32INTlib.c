@@ -177,3 +177,208 @@ unsigned int INTGetPendingInterrupt(void)
 #endif
     return INT_NUM_IRQ;
 }
+
+/*********************************************************************
+ * Function:        void INTMapShadowSetToPriority(unsigned int priority)
+ *
+ * PreCondition:    Multi-vectored interrupts enabled
+ *
+ * Input:           priority - the interrupt priority level (1 - 7) to
+ *                  run on the shadow register set
+ *
+ * Output:          None
+ *
+ * Side Effects:    Interrupts of the given priority no longer use the
+ *                  normal register set
+ *
+ * Overview:        Maps the given interrupt priority level to the
+ *                  highest implemented shadow register set (SRSCtl's
+ *                  HSS field, 1 on the PIC32MX) by programming the
+ *                  matching 4-bit field of the SRSMap register.
+ *                  Handlers entered at this priority get a fresh bank
+ *                  of general purpose registers and need not save or
+ *                  restore the interrupted context.
+ ********************************************************************/
+void INTMapShadowSetToPriority(unsigned int priority)
+{
+    unsigned int srsctl;
+    unsigned int srsmap;
+    unsigned int hss;
+
+    // read the highest implemented shadow set from SRSCtl<HSS>
+    asm volatile("mfc0   %0,$12,2" : "=r"(srsctl));
+    hss = (srsctl >> 26) & 0x0F;
+
+    // program the SSV field for this priority in SRSMap
+    asm volatile("mfc0   %0,$12,3" : "=r"(srsmap));
+    srsmap &= ~(0x0F << (priority << 2));
+    srsmap |=  (hss  << (priority << 2));
+    asm volatile("mtc0   %0,$12,3" : "+r"(srsmap));
+    asm volatile("ehb");
+}
+/*********************************************************************
+ * Function:        void INTSetCoreSWInt0(void)
+ *
+ * PreCondition:    None
+ *
+ * Input:           None
+ *
+ * Output:          None
+ *
+ * Side Effects:    Core software interrupt 0 becomes pending
+ *
+ * Overview:        Raises core software interrupt 0 by setting the
+ *                  CP0 cause IP0 bit.  The interrupt is taken as soon
+ *                  as its priority (IPC0<CS0IP>) unmasks.
+ ********************************************************************/
+void INTSetCoreSWInt0(void)
+{
+    unsigned int val;
+
+    asm volatile("mfc0   %0,$13" : "=r"(val));
+    val |= 0x00000100;
+    asm volatile("mtc0   %0,$13" : "+r"(val));
+}
+/*********************************************************************
+ * Function:        void INTClearCoreSWInt0(void)
+ *
+ * PreCondition:    None
+ *
+ * Input:           None
+ *
+ * Output:          None
+ *
+ * Side Effects:    Core software interrupt 0 is no longer pending
+ *
+ * Overview:        Clears the CP0 cause IP0 bit.  The handler must
+ *                  call this (and clear IFS0<CS0IF>) before returning
+ *                  or the interrupt is re-entered forever.
+ ********************************************************************/
+void INTClearCoreSWInt0(void)
+{
+    unsigned int val;
+
+    asm volatile("mfc0   %0,$13" : "=r"(val));
+    val &= ~0x00000100;
+    asm volatile("mtc0   %0,$13" : "+r"(val));
+}
+
+/*********************************************************************
+ * Latency-class interrupt priority mapping  (see int.h for the class
+ * definitions and the rules each class buys the handler)
+ ********************************************************************/
+
+typedef struct int_class_map {
+    unsigned int Vector;
+    unsigned int Class;
+    const char *Name;
+} INT_CLASS_MAP;
+
+static INT_CLASS_MAP INTClassMapTbl[INT_CLASS_MAP_SIZE];
+static unsigned int  INTClassMapQty = 0;
+
+static const unsigned int INTClassIPLTbl[INT_CLASS_QTY] = {
+    INT_CLASS_HARD_IPL,
+    INT_CLASS_KERNEL_IPL,
+    INT_CLASS_BACKGROUND_IPL
+};
+
+/*********************************************************************
+ * Function:        unsigned int INTLatencyClassIPL(unsigned int latency_class)
+ *
+ * PreCondition:    None
+ *
+ * Input:           latency_class - one of the INT_CLASS_xxx values
+ *
+ * Output:          The IPL level the class maps to, 0 if invalid
+ *
+ * Side Effects:    None
+ *
+ * Overview:        Class to IPL lookup without assigning a vector
+ ********************************************************************/
+unsigned int INTLatencyClassIPL(unsigned int latency_class)
+{
+    if(latency_class >= INT_CLASS_QTY)
+        return 0;
+    return INTClassIPLTbl[latency_class];
+}
+
+/*********************************************************************
+ * Function:        unsigned int INTLatencyClassAssign(unsigned int vector,
+ *                                  unsigned int latency_class, const char *name)
+ *
+ * PreCondition:    Multi-vectored interrupts set up
+ *
+ * Input:           vector        - interrupt vector number (0 - 63)
+ *                  latency_class - one of the INT_CLASS_xxx values
+ *                  name          - label for the boot report
+ *
+ * Output:          The IPL the vector now runs at, 0 if the class or
+ *                  vector is invalid (the vector is left untouched)
+ *
+ * Side Effects:    The vector's IPC priority field is reprogrammed
+ *                  (sub-priority 0) and the assignment is recorded
+ *
+ * Overview:        Programs the 4-vectors-per-register IPC file from
+ *                  the class map.  The IPC blocks are contiguous SFRs
+ *                  with CLR/SET/INV companions at +1..+3 words, so the
+ *                  field is indexed instead of named per vector.
+ ********************************************************************/
+unsigned int INTLatencyClassAssign(unsigned int vector, unsigned int latency_class, const char *name)
+{
+    volatile unsigned int *ipc;
+    unsigned int shift;
+    unsigned int ipl;
+
+    if((latency_class >= INT_CLASS_QTY) || (vector > 63))
+        return 0;
+    ipl   = INTClassIPLTbl[latency_class];
+    ipc   = (&IPC0) + (vector >> 2) * 4;
+    shift = (vector & 3) * 8;                  // the vector's byte lane
+    ipc[1] = (unsigned int)0x1F << shift;      // CLR: priority and sub-priority fields
+    ipc[2] = (ipl << 2) << shift;              // SET: class IPL, sub-priority 0
+
+    if(INTClassMapQty < INT_CLASS_MAP_SIZE)
+    {
+        INTClassMapTbl[INTClassMapQty].Vector = vector;
+        INTClassMapTbl[INTClassMapQty].Class  = latency_class;
+        INTClassMapTbl[INTClassMapQty].Name   = name;
+        INTClassMapQty++;
+    }
+    return ipl;
+}
+
+/*********************************************************************
+ * Function:        unsigned int INTLatencyClassMapQty(void)
+ *                  unsigned int INTLatencyClassMapGet(unsigned int ix, ...)
+ *
+ * PreCondition:    None
+ *
+ * Input:           ix - assignment index, 0 .. INTLatencyClassMapQty()-1
+ *
+ * Output:          MapQty: number of recorded assignments
+ *                  MapGet: the assignment's IPL (0 if ix out of range);
+ *                          each non-NULL out pointer is filled in
+ *
+ * Side Effects:    None
+ *
+ * Overview:        Read back the recorded class assignments so the
+ *                  application can print the boot-time interrupt map
+ ********************************************************************/
+unsigned int INTLatencyClassMapQty(void)
+{
+    return INTClassMapQty;
+}
+
+unsigned int INTLatencyClassMapGet(unsigned int ix, unsigned int *p_vector, unsigned int *p_class, const char **p_name)
+{
+    if(ix >= INTClassMapQty)
+        return 0;
+    if(p_vector)
+        *p_vector = INTClassMapTbl[ix].Vector;
+    if(p_class)
+        *p_class = INTClassMapTbl[ix].Class;
+    if(p_name)
+        *p_name = INTClassMapTbl[ix].Name;
+    return INTClassIPLTbl[INTClassMapTbl[ix].Class];
+}
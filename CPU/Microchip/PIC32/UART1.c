@@ -7,19 +7,246 @@
 // UART FUNCTIONS
 //-----------------------------------------------------------------------
 
+#if U1_TX_INT_EN
+//----- TX ring buffer, filled by putU1/putsU1 and drained by the U1TX interrupt
+static volatile char U1TxBuf[U1_TX_BUF_SIZE];
+static volatile unsigned int U1TxIn;	// next free slot
+static volatile unsigned int U1TxOut;	// next byte the ISR transmits
+static volatile unsigned int U1TxCtr;	// bytes queued
+
+#if OS_CFG_SEM_EN > 0u
+static OS_SEM U1TxSem;	// backpressure: counts slots freed by the TX ISR
+					// (shared by both lanes; a woken writer rechecks its own ring)
+#endif
+
+#if U1_TX_LANE_EN
+//----- High-priority TX lane: render bytes (Screen_* submissions) queue
+//      here and the ISR drains this ring before the default one, so bulk
+//      stats/trace output queued ahead of a ball-erase no longer delays
+//      it.  U1TxHiRun counts consecutive high-lane bytes sent while the
+//      default lane has data; at U1_TX_LANE_BUDGET one default-lane byte
+//      is interleaved so background output is never starved outright.
+static volatile char U1TxHiBuf[U1_TX_HI_BUF_SIZE];
+static volatile unsigned int U1TxHiIn;
+static volatile unsigned int U1TxHiOut;
+static volatile unsigned int U1TxHiCtr;
+static unsigned int U1TxHiRun;	// ISR-private: consecutive high-lane bytes this run
+#endif
+
+#if U1_TX_SCAT_EN
+//----- Scatter descriptors: a (pointer, length) reference to const data
+//      the ISR transmits straight out of flash, with zero ring copies
+//      and zero ring occupancy.  Mark records the default-lane stream
+//      position at submission (total bytes queued so far), so the ISR
+//      interleaves the descriptor exactly where it was submitted: ring
+//      bytes queued before it go first, bytes queued after it follow.
+typedef struct u1_tx_desc {
+	const char *Ptr;
+	unsigned int Len;
+	unsigned int Mark;	// U1TxInTot when the descriptor was queued
+} U1_TX_DESC;
+
+static U1_TX_DESC U1TxDescQ[U1_TX_DESC_Q_SIZE];
+static volatile unsigned int U1TxDescIn;
+static volatile unsigned int U1TxDescOut;
+static volatile unsigned int U1TxDescCtr;
+static volatile unsigned int U1TxInTot;		// default-lane ring bytes ever queued
+static volatile unsigned int U1TxOutTot;	// default-lane ring bytes ever sent
+#endif
+#endif
+
+#if U1_RX_INT_EN
+//----- RX ring buffer, filled by the U1RX interrupt and drained by getU1
+static volatile char U1RxBuf[U1_RX_BUF_SIZE];
+static volatile unsigned int U1RxIn;	// next free slot (ISR side)
+static volatile unsigned int U1RxOut;	// next byte getU1 returns
+static volatile unsigned int U1RxCtr;	// bytes queued
+static OS_TCB *U1RxWaiterTCB;	// single task pending on RX data, woken by OSTaskSemPostFromISR
+#endif
+
+#if U1_KEY_EVT_EN
+//----- VT100 key parser, run byte-at-a-time inside the RX interrupt.
+//      Arrow keys arrive as ESC [ A/B/C/D; WASD is decoded too so the
+//      game plays from any terminal.  While enabled, decoded keys go to
+//      the event queue instead of the RX ring; an ESC that turns out not
+//      to start an arrow sequence is replayed into the ring unharmed.
+#define U1_KEY_ST_IDLE 0
+#define U1_KEY_ST_ESC  1	// got ESC
+#define U1_KEY_ST_CSI  2	// got ESC [
+
+static volatile int U1KeyEn;	// 0 = parser passes everything through
+static unsigned char U1KeyState;
+static volatile U1_KEY_EVT U1KeyEvtQ[U1_KEY_EVT_Q_SIZE];
+static volatile unsigned int U1KeyEvtIn;
+static volatile unsigned int U1KeyEvtOut;
+static volatile unsigned int U1KeyEvtCtr;
+#endif
+
+#if U1_LINE_EVT_EN
+//----- Interrupt-side line editor.  getsU1 runs echo/backspace/CR
+//      handling synchronously in the caller, blocking a whole task for
+//      the duration of human typing.  Here the same state machine runs
+//      byte-at-a-time in the RX interrupt (like the key parser above):
+//      edits echo immediately, and only COMPLETED lines are queued and
+//      posted, so the consuming task sleeps until a command is ready.
+static volatile int U1LineEn;	// 0 = bytes flow to the RX ring as usual
+static char U1LineAsm[U1_LINE_MAX];	// line being typed (ISR only)
+static unsigned int U1LineAsmLen;
+static volatile char U1LineQ[U1_LINE_Q_SIZE][U1_LINE_MAX];	// completed lines
+static volatile unsigned int U1LineQIn;
+static volatile unsigned int U1LineQOut;
+static volatile unsigned int U1LineQCtr;
+static OS_TCB *U1LineWaiterTCB;	// single task pending in getsU1_evt
+#endif
+
+#if U1_TX_DMA_EN
+#define U1_KVA_TO_PA(v) ((unsigned int)(v) & 0x1FFFFFFF)	// virtual to physical for the DMA engine
+
+static volatile int U1DmaBusy;	// a DMA block transfer is in flight
+#if OS_CFG_SEM_EN > 0u
+static OS_SEM U1DmaSem;	// posted by the DMA ISR on block completion
+#endif
+#endif
+
+#if U1_BAUD_NEG_EN
+static unsigned long U1BaudCur = BAUD_RATE;	// rate currently on the wire
+static volatile unsigned int U1BaudErrCtr;	// framing/overrun errors since the last switch
+#endif
+
+#if U1_RX_DMA_EN
+static volatile int U1DmaRxBusy;	// a pattern-match line reception is armed
+#if OS_CFG_SEM_EN > 0u
+static OS_SEM U1DmaRxSem;	// posted by the DMA channel 1 ISR when the line is complete
+#endif
+#endif
+
 //----- Initialize UART1
 void initU1 (void)
 {
 	U1BRG = BRATE;  // initialize the baud rate generator
 	U1MODE = U_ENABLE;
 	U1STA = U_TX | U_RX;
+#if U1_TX_INT_EN
+	U1TxIn = 0;
+	U1TxOut = 0;
+	U1TxCtr = 0;
+#if U1_TX_SCAT_EN
+	U1TxDescIn = 0;
+	U1TxDescOut = 0;
+	U1TxDescCtr = 0;
+	U1TxInTot = 0;
+	U1TxOutTot = 0;
+#endif
+#if U1_TX_LANE_EN
+	U1TxHiIn = 0;
+	U1TxHiOut = 0;
+	U1TxHiCtr = 0;
+	U1TxHiRun = 0;
+#endif
+#if OS_CFG_SEM_EN > 0u
+	{
+	OS_ERR err;
+		OSSemCreate(&U1TxSem, "U1 TX Sem", (OS_SEM_CTR)0, &err);
+	}
+#endif
+	mU1ClearAllIntFlags();
+	mU1SetIntPriority(U1_TX_INT_PRIO);
+	mU1SetIntSubPriority(0);
+	// The TX interrupt is enabled by putU1 when the ring holds data
+	// and disabled again by the ISR once the ring drains.
+#endif
+#if U1_RX_INT_EN
+	U1RxIn = 0;
+	U1RxOut = 0;
+	U1RxCtr = 0;
+	U1RxWaiterTCB = (OS_TCB *)0;
+#if !U1_TX_INT_EN
+	mU1ClearAllIntFlags();
+	mU1SetIntPriority(U1_TX_INT_PRIO);
+	mU1SetIntSubPriority(0);
+#endif
+	mU1RXIntEnable(1);	// RX interrupts run for the life of the port
+#endif
+#if U1_TX_DMA_EN
+	U1DmaBusy = 0;
+#if OS_CFG_SEM_EN > 0u
+	{
+	OS_ERR err;
+		OSSemCreate(&U1DmaSem, "U1 DMA Sem", (OS_SEM_CTR)0, &err);
+	}
+#endif
+	DMACONSET = 0x8000;		// DMA controller ON
+	DCH0CON   = 0x03;		// channel off, priority 3, no chaining
+	DCH0ECON  = (U1TX_IRQ << 8) | 0x10;	// cell transfer on each U1TX event (SIRQEN)
+	DCH0DSA   = U1_KVA_TO_PA(&U1TXREG);	// destination: UART1 TX register
+	DCH0DSIZ  = 1;			// 1 byte destination
+	DCH0CSIZ  = 1;			// 1 byte per cell transfer
+	DCH0INT   = 0x80000;	// enable block-complete interrupt (CHBCIE)
+	mDMA0ClearIntFlag();
+	mDMA0SetIntPriority(U1_DMA_INT_PRIO);
+	mDMA0SetIntSubPriority(0);
+	mDMA0IntEnable(1);
+#endif
+#if U1_RX_DMA_EN
+	U1DmaRxBusy = 0;
+#if OS_CFG_SEM_EN > 0u
+	{
+	OS_ERR err;
+		OSSemCreate(&U1DmaRxSem, "U1 DMA RX Sem", (OS_SEM_CTR)0, &err);
+	}
+#endif
+	DMACONSET = 0x8000;		// DMA controller ON (no-op if TX DMA already set it)
+	DCH1CON   = 0x03;		// channel off, priority 3, no chaining
+	DCH1ECON  = (U1RX_IRQ << 8) | 0x30;	// cell transfer per U1RX event (SIRQEN) + pattern abort (PATEN)
+	DCH1DAT   = '\r';		// pattern: channel stops when a carriage return is transferred
+	DCH1SSA   = U1_KVA_TO_PA(&U1RXREG);	// source: UART1 RX register
+	DCH1SSIZ  = 1;			// 1 byte source
+	DCH1CSIZ  = 1;			// 1 byte per cell transfer
+	DCH1INT   = 0x80000;	// enable block-complete interrupt (CHBCIE); pattern abort raises it too
+	mDMA1ClearIntFlag();
+	mDMA1SetIntPriority(U1_DMA_RX_INT_PRIO);
+	mDMA1SetIntSubPriority(0);
+	mDMA1IntEnable(1);
+#endif
 } // initU1
 
 //----- Output character to UART1
-void putU1 (char c)
+//      With U1_TX_INT_EN the byte is queued in the TX ring and the calling
+//      task returns immediately; the U1TX interrupt feeds the hardware FIFO.
+//      When the ring is full, backpressure is an OSSemPend if semaphores are
+//      enabled in os_cfg.h, otherwise a spin while the ISR drains the ring.
+//      RAM-resident (.ramfunc) -- every character printed goes through here,
+//      so skipping the flash wait states is worth the copy into KSEG0 RAM.
+void __attribute__((section(".ramfunc"), longcall, nomips16)) putU1 (char c)
 {
+#if U1_TX_INT_EN
+	CPU_SR_ALLOC();
+#if OS_CFG_SEM_EN > 0u
+	OS_ERR err;
+#endif
+
+	CPU_CRITICAL_ENTER();
+	while (U1TxCtr >= U1_TX_BUF_SIZE) {	// ring full -- wait for the ISR to free a slot.
+		CPU_CRITICAL_EXIT();		// The check must hold INSIDE the critical section:
+#if OS_CFG_SEM_EN > 0u			// between a wakeup and re-entry another producer (a
+						// second task, or U1_LineEcho in the ISR) can take
+						// the freed slot, so recheck before every store.
+		OSSemPend(&U1TxSem, (OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+#endif
+		CPU_CRITICAL_ENTER();
+	}
+	U1TxBuf[U1TxIn] = c;
+	U1TxIn = (U1TxIn + 1) & (U1_TX_BUF_SIZE - 1);
+	U1TxCtr++;
+#if U1_TX_SCAT_EN
+	U1TxInTot++;		// scatter descriptors order against this position
+#endif
+	mU1TXIntEnable(1);	// ring not empty -- make sure the drain interrupt runs
+	CPU_CRITICAL_EXIT();
+#else
 	while (U1STAbits.UTXBF);	// wait while TX buffer is full
 	U1TXREG = c;
+#endif
 }
 
 //----- Output zero terminated string to UART1
@@ -29,27 +256,625 @@ void putsU1(char *s)
 		putU1(*s++);
 }
 
+//----- Output character on the high-priority TX lane
+//      Same ring discipline as putU1; the ISR drains this ring first.
+//      RAM-resident for the same reason as putU1 -- every render byte
+//      goes through here.
+#if U1_TX_INT_EN && U1_TX_LANE_EN
+void __attribute__((section(".ramfunc"), longcall, nomips16)) putU1_hi (char c)
+{
+	CPU_SR_ALLOC();
+#if OS_CFG_SEM_EN > 0u
+	OS_ERR err;
+#endif
+
+	CPU_CRITICAL_ENTER();
+	while (U1TxHiCtr >= U1_TX_HI_BUF_SIZE) {	// lane full -- wait for the ISR to free a
+		CPU_CRITICAL_EXIT();			// slot, rechecking inside the critical
+#if OS_CFG_SEM_EN > 0u				// section as in putU1
+		OSSemPend(&U1TxSem, (OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+#endif
+		CPU_CRITICAL_ENTER();
+	}
+	U1TxHiBuf[U1TxHiIn] = c;
+	U1TxHiIn = (U1TxHiIn + 1) & (U1_TX_HI_BUF_SIZE - 1);
+	U1TxHiCtr++;
+	mU1TXIntEnable(1);	// lane not empty -- make sure the drain interrupt runs
+	CPU_CRITICAL_EXIT();
+}
+#else
+void putU1_hi (char c)
+{
+	putU1(c);	// no lanes configured -- everything shares the default ring
+}
+#endif
+
+//----- Output zero terminated string on the high-priority TX lane
+void putsU1_hi (char *s)
+{
+	while (*s)
+		putU1_hi(*s++);
+}
+
+//----- Zero-copy transmit of const data (see UART1.h)
+void putsU1_scat (const char *buf, unsigned int len)
+{
+#if U1_TX_INT_EN && U1_TX_SCAT_EN
+	CPU_SR_ALLOC();
+#endif
+
+	if (len == 0) {		// zero terminated -- measure it
+		const char *s = buf;
+		while (*s)
+			s++;
+		len = (unsigned int)(s - buf);
+		if (len == 0)
+			return;
+	}
+#if U1_TX_INT_EN && U1_TX_SCAT_EN
+	CPU_CRITICAL_ENTER();
+	if (U1TxDescCtr < U1_TX_DESC_Q_SIZE) {
+		U1TxDescQ[U1TxDescIn].Ptr  = buf;
+		U1TxDescQ[U1TxDescIn].Len  = len;
+		U1TxDescQ[U1TxDescIn].Mark = U1TxInTot;
+		U1TxDescIn = (U1TxDescIn + 1) & (U1_TX_DESC_Q_SIZE - 1);
+		U1TxDescCtr++;
+		mU1TXIntEnable(1);
+		CPU_CRITICAL_EXIT();
+		return;
+	}
+	CPU_CRITICAL_EXIT();	// descriptor queue full -- fall back to the copy path
+#endif
+	while (len--)
+		putU1(*buf++);
+}
+
+#if U1_RX_INT_EN
+//----- Enqueue one received byte into the RX ring (interrupt context)
+static void U1RxPut (char c)
+{
+	if (U1RxCtr < U1_RX_BUF_SIZE) {	// byte is dropped on overflow
+		U1RxBuf[U1RxIn] = c;
+		U1RxIn = (U1RxIn + 1) & (U1_RX_BUF_SIZE - 1);
+		U1RxCtr++;
+	}
+}
+#endif
+
+#if U1_KEY_EVT_EN
+//----- Post one decoded key event (interrupt context, drops on overflow)
+static void U1_KeyEvtPost (unsigned char dir)
+{
+	if (U1KeyEvtCtr < U1_KEY_EVT_Q_SIZE) {
+		U1KeyEvtQ[U1KeyEvtIn].Dir = dir;
+		U1KeyEvtQ[U1KeyEvtIn].TS  = ReadCoreTimer();
+		U1KeyEvtIn = (U1KeyEvtIn + 1) & (U1_KEY_EVT_Q_SIZE - 1);
+		U1KeyEvtCtr++;
+	}
+}
+
+//----- Feed one RX byte through the escape-sequence state machine.
+//      Returns 1 if the byte was consumed (decoded or mid-sequence),
+//      0 if it should go into the RX ring as ordinary data.  The hot
+//      path -- ordinary data in the idle state -- is four compares.
+static int U1_KeyParse (char c)
+{
+	switch (U1KeyState) {
+	case U1_KEY_ST_IDLE:
+		if (c == 0x1B) {	// maybe an arrow sequence
+			U1KeyState = U1_KEY_ST_ESC;
+			return 1;
+		}
+		if (c == 'w' || c == 'W') { U1_KeyEvtPost(U1_KEY_UP);    return 1; }
+		if (c == 's' || c == 'S') { U1_KeyEvtPost(U1_KEY_DOWN);  return 1; }
+		if (c == 'a' || c == 'A') { U1_KeyEvtPost(U1_KEY_LEFT);  return 1; }
+		if (c == 'd' || c == 'D') { U1_KeyEvtPost(U1_KEY_RIGHT); return 1; }
+		return 0;
+	case U1_KEY_ST_ESC:
+		if (c == '[') {
+			U1KeyState = U1_KEY_ST_CSI;
+			return 1;
+		}
+		U1KeyState = U1_KEY_ST_IDLE;	// not a CSI -- replay the ESC
+		U1RxPut(0x1B);
+		return 0;	// current byte goes to the ring too
+	case U1_KEY_ST_CSI:
+	default:
+		U1KeyState = U1_KEY_ST_IDLE;
+		switch (c) {
+		case 'A': U1_KeyEvtPost(U1_KEY_UP);    return 1;
+		case 'B': U1_KeyEvtPost(U1_KEY_DOWN);  return 1;
+		case 'D': U1_KeyEvtPost(U1_KEY_LEFT);  return 1;
+		case 'C': U1_KeyEvtPost(U1_KEY_RIGHT); return 1;
+		default:	// unknown sequence -- replay it whole
+			U1RxPut(0x1B);
+			U1RxPut('[');
+			return 0;
+		}
+	}
+}
+
+//----- Enable/disable diverting keys from the RX ring (task level)
+void U1_KeyInputEn (int en)
+{
+	U1KeyEn = en;
+	U1KeyState = U1_KEY_ST_IDLE;
+}
+
+//----- Fetch the next decoded key event, nonblocking
+int U1_KeyEvtGet (U1_KEY_EVT *p_evt)
+{
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	if (U1KeyEvtCtr == 0) {
+		CPU_CRITICAL_EXIT();
+		return 0;
+	}
+	p_evt->Dir = U1KeyEvtQ[U1KeyEvtOut].Dir;
+	p_evt->TS  = U1KeyEvtQ[U1KeyEvtOut].TS;
+	U1KeyEvtOut = (U1KeyEvtOut + 1) & (U1_KEY_EVT_Q_SIZE - 1);
+	U1KeyEvtCtr--;
+	CPU_CRITICAL_EXIT();
+	return 1;
+}
+#endif
+
+#if U1_LINE_EVT_EN
+//----- Echo one byte from interrupt context.  Straight into the default
+//      TX ring -- putU1 could pend on a full ring, which an ISR must
+//      not.  Echo is dropped if the ring is full; at typing speed that
+//      never happens.
+static void U1_LineEcho (char c)
+{
+#if U1_TX_INT_EN
+	if (U1TxCtr < U1_TX_BUF_SIZE) {
+		U1TxBuf[U1TxIn] = c;
+		U1TxIn = (U1TxIn + 1) & (U1_TX_BUF_SIZE - 1);
+		U1TxCtr++;
+#if U1_TX_SCAT_EN
+		U1TxInTot++;
+#endif
+		mU1TXIntEnable(1);
+	}
+#else
+	if (!U1STAbits.UTXBF)
+		U1TXREG = c;
+#endif
+}
+
+//----- Feed one RX byte through the line editor (interrupt context).
+//      Returns 1 if the byte was consumed, 0 if it should go into the
+//      RX ring as ordinary data.  Same editing rules as getsU1: echo,
+//      backspace erases, LF ignored, CR completes the line.
+static int U1_LineParse (char c)
+{
+	unsigned int i;
+
+	if (c == 0x08) {	// backspace -- erase the last character
+		if (U1LineAsmLen > 0) {
+			U1LineAsmLen--;
+			U1_LineEcho(0x08);
+			U1_LineEcho(' ');
+			U1_LineEcho(0x08);
+		}
+		return 1;
+	}
+	if (c == '\n')		// line feed, ignore it
+		return 1;
+	if (c == '\r') {	// end of line -- queue it complete
+		U1_LineEcho('\r');
+		U1_LineEcho('\n');
+		if (U1LineQCtr < U1_LINE_Q_SIZE) {	// full queue drops the line whole
+			for (i = 0; i < U1LineAsmLen; i++)
+				U1LineQ[U1LineQIn][i] = U1LineAsm[i];
+			U1LineQ[U1LineQIn][U1LineAsmLen] = '\0';
+			U1LineQIn = (U1LineQIn + 1) & (U1_LINE_Q_SIZE - 1);
+			U1LineQCtr++;
+			if (U1LineWaiterTCB != (OS_TCB *)0) {	// wake the task in getsU1_evt
+				OS_ERR err;
+				OS_TCB *p_tcb = U1LineWaiterTCB;
+				U1LineWaiterTCB = (OS_TCB *)0;
+				OSTaskSemPostFromISR(p_tcb, &err);
+				BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+			}
+		}
+		U1LineAsmLen = 0;
+		return 1;
+	}
+	if (U1LineAsmLen < U1_LINE_MAX - 1) {	// ordinary byte -- store and echo
+		U1LineAsm[U1LineAsmLen++] = c;
+		U1_LineEcho(c);
+	}
+	return 1;
+}
+
+//----- Enable/disable the interrupt-side line editor (task level)
+void U1_LineInputEn (int en)
+{
+	U1LineEn = en;
+	U1LineAsmLen = 0;
+}
+
+//----- Fetch the next completed line, nonblocking
+int U1_LineEvtGet (char *s, int len)
+{
+	int i;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	if (U1LineQCtr == 0) {
+		CPU_CRITICAL_EXIT();
+		return 0;
+	}
+	for (i = 0; i < len - 1 && U1LineQ[U1LineQOut][i] != '\0'; i++)
+		s[i] = U1LineQ[U1LineQOut][i];
+	s[i] = '\0';
+	U1LineQOut = (U1LineQOut + 1) & (U1_LINE_Q_SIZE - 1);
+	U1LineQCtr--;
+	CPU_CRITICAL_EXIT();
+	return 1;
+}
+
+//----- Fetch the next completed line, blocking (see UART1.h)
+char *getsU1_evt (char *s, int len)
+{
+	OS_ERR err;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	while (U1LineQCtr == 0) {	// no line yet -- sleep until the ISR posts one
+		U1LineWaiterTCB = OSTCBCurPtr;
+		CPU_CRITICAL_EXIT();
+		OSTaskSemPend((OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		CPU_CRITICAL_ENTER();
+	}
+	CPU_CRITICAL_EXIT();
+	(void)U1_LineEvtGet(s, len);
+	return s;
+}
+#endif
+
+#if U1_TX_INT_EN || U1_RX_INT_EN
+//----- UART1 interrupt handler
+//      Dispatched by the vector 24 stub in bsp_a.S on the shadow register
+//      set (ISR_SRS_PROLOGUE / ISR_SRS_EPILOGUE, so no context is saved;
+//      setting BSP_IntNeedSched after a post makes the epilogue pend the
+//      core software interrupt 0 relay that reschedules).  Drains received
+//      bytes into the RX ring, then moves bytes from the TX ring into the
+//      hardware FIFO until one of them is empty.
+void U1_ISR_Handler (void)
+{
+#if OS_CFG_SEM_EN > 0u
+	OS_ERR err;
+	unsigned int freed = 0;
+#endif
+
+#if U1_RX_INT_EN
+	if (mU1RXGetIntFlag()) {
+#if U1_BAUD_NEG_EN
+		if (U1STAbits.FERR || U1STAbits.OERR) {	// garbled byte: count toward sync loss
+			U1BaudErrCtr++;
+			U1STAbits.OERR = 0;	// clearing OERR un-stalls the receive FIFO
+		}
+#endif
+		while (U1STAbits.URXDA) {
+			char c = U1RXREG;
+#if U1_KEY_EVT_EN
+			if (U1KeyEn && U1_KeyParse(c))	// decoded (or mid-sequence):
+				continue;	// the byte never enters the ring
+#endif
+#if U1_LINE_EVT_EN
+			if (U1LineEn && U1_LineParse(c))	// line editor owns the byte
+				continue;
+#endif
+			U1RxPut(c);
+		}
+		mU1RXClearIntFlag();
+		if (U1RxWaiterTCB != (OS_TCB *)0) {	// wake the task pending in getU1
+			OS_ERR rx_err;
+			OS_TCB *p_tcb = U1RxWaiterTCB;
+			U1RxWaiterTCB = (OS_TCB *)0;
+			OSTaskSemPostFromISR(p_tcb, &rx_err);
+			BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+		}
+	}
+#endif
+
+#if U1_TX_INT_EN
+	if (mU1TXGetIntFlag() && mU1TXGetIntEnable()) {
+#if U1_TX_SCAT_EN
+#define U1_TX_LO_RDY()	((U1TxCtr > 0) || (U1TxDescCtr > 0))
+#else
+#define U1_TX_LO_RDY()	(U1TxCtr > 0)
+#endif
+#if U1_TX_LANE_EN
+		while (((U1TxHiCtr > 0) || U1_TX_LO_RDY()) && !U1STAbits.UTXBF) {
+			if ((U1TxHiCtr > 0) &&
+			    (!U1_TX_LO_RDY() || (U1TxHiRun < U1_TX_LANE_BUDGET))) {
+				U1TXREG = U1TxHiBuf[U1TxHiOut];	// render bytes go first
+				U1TxHiOut = (U1TxHiOut + 1) & (U1_TX_HI_BUF_SIZE - 1);
+				U1TxHiCtr--;
+				U1TxHiRun++;
+#if OS_CFG_SEM_EN > 0u
+				freed++;
+#endif
+				continue;
+			}
+			U1TxHiRun = 0;	// budget spent (or lane idle): one background byte
+#if U1_TX_SCAT_EN
+			if ((U1TxDescCtr > 0) &&
+			    (U1TxOutTot == U1TxDescQ[U1TxDescOut].Mark)) {
+				U1TXREG = *U1TxDescQ[U1TxDescOut].Ptr++;	// straight from flash
+				if (--U1TxDescQ[U1TxDescOut].Len == 0) {
+					U1TxDescOut = (U1TxDescOut + 1) & (U1_TX_DESC_Q_SIZE - 1);
+					U1TxDescCtr--;
+				}
+				continue;	// no ring slot freed -- no semaphore post
+			}
+#endif
+			U1TXREG = U1TxBuf[U1TxOut];
+			U1TxOut = (U1TxOut + 1) & (U1_TX_BUF_SIZE - 1);
+			U1TxCtr--;
+#if U1_TX_SCAT_EN
+			U1TxOutTot++;
+#endif
+#if OS_CFG_SEM_EN > 0u
+			freed++;
+#endif
+		}
+		if ((U1TxHiCtr == 0) && !U1_TX_LO_RDY())
+			mU1TXIntEnable(0);	// both lanes empty -- stop TX interrupts until the next putU1
+#else
+		while (U1_TX_LO_RDY() && !U1STAbits.UTXBF) {
+#if U1_TX_SCAT_EN
+			if ((U1TxDescCtr > 0) &&
+			    (U1TxOutTot == U1TxDescQ[U1TxDescOut].Mark)) {
+				U1TXREG = *U1TxDescQ[U1TxDescOut].Ptr++;	// straight from flash
+				if (--U1TxDescQ[U1TxDescOut].Len == 0) {
+					U1TxDescOut = (U1TxDescOut + 1) & (U1_TX_DESC_Q_SIZE - 1);
+					U1TxDescCtr--;
+				}
+				continue;	// no ring slot freed -- no semaphore post
+			}
+#endif
+			U1TXREG = U1TxBuf[U1TxOut];
+			U1TxOut = (U1TxOut + 1) & (U1_TX_BUF_SIZE - 1);
+			U1TxCtr--;
+#if U1_TX_SCAT_EN
+			U1TxOutTot++;
+#endif
+#if OS_CFG_SEM_EN > 0u
+			freed++;
+#endif
+		}
+		if (!U1_TX_LO_RDY())
+			mU1TXIntEnable(0);	// ring empty -- stop TX interrupts until the next putU1
+#endif
+#undef U1_TX_LO_RDY
+		mU1TXClearIntFlag();
+#if OS_CFG_SEM_EN > 0u
+		if (freed > 0)
+			BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+		while (freed--)		// wake writers blocked on a full ring
+			OSSemPost(&U1TxSem, OS_OPT_POST_1, &err);
+#endif
+	}
+#endif
+}
+#endif
+
+#if U1_TX_DMA_EN
+//----- putsU1_DMA
+//      Zero-copy bulk transmit: hands buf to DMA channel 0, which feeds
+//      U1TXREG one byte per U1TX event with no CPU involvement.  The caller
+//      blocks (OSSemPend when semaphores are enabled, otherwise OSTimeDly
+//      polling) until the block completes, so buf may live on the stack.
+//      The TX ring is allowed to drain first so output is not interleaved.
+void putsU1_DMA (const char *buf, unsigned int len)
+{
+	OS_ERR err;
+
+	if (len == 0)
+		return;
+#if U1_TX_INT_EN
+#if U1_TX_LANE_EN
+	while ((U1TxHiCtr > 0) || (U1TxCtr > 0))	// let queued ring bytes (both lanes) go out first
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#else
+	while (U1TxCtr > 0)			// let queued ring bytes go out first
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#endif
+#if U1_TX_SCAT_EN
+	while (U1TxDescCtr > 0)		// and pending scatter descriptors
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#endif
+#endif
+	while (U1DmaBusy)			// one block transfer at a time
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+
+	U1DmaBusy = 1;
+	DCH0SSA  = U1_KVA_TO_PA(buf);	// source buffer (physical address)
+	DCH0SSIZ = len;
+	DCH0INTCLR = 0x000000FF;	// clear channel event flags
+	DCH0CONSET = 0x80;			// channel enable -- transfers start on U1TX events
+
+#if OS_CFG_SEM_EN > 0u
+	OSSemPend(&U1DmaSem, (OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+#else
+	while (U1DmaBusy)			// ISR clears the flag at block completion
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#endif
+}
+
+//----- DMA channel 0 interrupt handler
+//      Dispatched by the vector 36 stub in bsp_a.S.  Signals the task
+//      blocked in putsU1_DMA that the block transfer finished.
+void U1_DMA_ISR_Handler (void)
+{
+#if OS_CFG_SEM_EN > 0u
+	OS_ERR err;
+#endif
+
+	DCH0INTCLR = 0x000000FF;	// clear the channel block-complete event
+	mDMA0ClearIntFlag();
+	U1DmaBusy = 0;
+#if OS_CFG_SEM_EN > 0u
+	OSSemPost(&U1DmaSem, OS_OPT_POST_1, &err);
+	BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+#endif
+}
+#endif
+
+#if U1_RX_DMA_EN
+//----- getsU1_DMA
+//      Pattern-match line reception: DMA channel 1 copies each received
+//      byte from U1RXREG into s with zero CPU involvement and aborts the
+//      transfer the moment it moves a '\r' (or after len-1 bytes), so the
+//      calling task takes ONE wakeup per line instead of one per byte.
+//      While the channel is armed it owns the receiver -- the RX ring
+//      interrupt is suspended -- and only bytes arriving AFTER the call
+//      are part of the line.  There is no echo and no backspace editing;
+//      getsU1 remains the interactive editor.  The terminating '\r' is
+//      replaced with '\0' in place.  One line reception at a time.
+char *getsU1_DMA (char *s, int len)
+{
+	OS_ERR err;
+	int n;
+
+	if (len < 2) {		// need room for at least one byte and the '\0'
+		if (len == 1)
+			*s = '\0';
+		return s;
+	}
+	while (U1DmaRxBusy)	// one armed line reception at a time
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+	U1DmaRxBusy = 1;
+#if U1_RX_INT_EN
+	mU1RXIntEnable(0);	// the channel owns the receiver while armed
+#endif
+	DCH1DSA  = U1_KVA_TO_PA(s);	// destination buffer (physical address)
+	DCH1DSIZ = len - 1;
+	DCH1INTCLR = 0x000000FF;	// clear channel event flags
+	DCH1CONSET = 0x80;			// channel enable -- transfers start on U1RX events
+
+#if OS_CFG_SEM_EN > 0u
+	OSSemPend(&U1DmaRxSem, (OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+#else
+	while (U1DmaRxBusy)			// ISR clears the flag when the line lands
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#endif
+
+	for (n = 0; n < len - 1; n++)	// terminate at the '\r' (or buffer full)
+		if (s[n] == '\r')
+			break;
+	s[n] = '\0';
+	return s;
+}
+
+//----- DMA channel 1 interrupt handler
+//      Dispatched by the vector 37 stub in bsp_a.S.  Runs when the armed
+//      line reception completes (pattern '\r' seen or buffer full); hands
+//      the receiver back to the RX ring and wakes the task in getsU1_DMA.
+void U1_DMA_RX_ISR_Handler (void)
+{
+#if OS_CFG_SEM_EN > 0u
+	OS_ERR err;
+#endif
+
+	DCH1CONCLR = 0x80;			// make sure the channel is off (pattern abort already did this)
+	DCH1INTCLR = 0x000000FF;	// clear the channel event flags
+	mDMA1ClearIntFlag();
+#if U1_RX_INT_EN
+	mU1RXIntEnable(1);			// hand the receiver back to the RX ring
+#endif
+	U1DmaRxBusy = 0;
+#if OS_CFG_SEM_EN > 0u
+	OSSemPost(&U1DmaRxSem, OS_OPT_POST_1, &err);
+	BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+#endif
+}
+#endif
+
 // ----- Get character from UART1
 // wait for a new character to arrive to the UART1 serial port
+// With U1_RX_INT_EN the calling task sleeps on its task semaphore until the
+// RX ISR queues a byte, so waiting for input costs zero CPU cycles.
+// Only one task may wait on UART1 input at a time.
 char getU1( void)
 {
+#if U1_RX_INT_EN
+    char c;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    while (U1RxCtr == 0) {          // nothing queued -- sleep until the ISR posts
+        U1RxWaiterTCB = OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+        OSTaskSemPend((OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        CPU_CRITICAL_ENTER();
+    }
+    c = U1RxBuf[U1RxOut];
+    U1RxOut = (U1RxOut + 1) & (U1_RX_BUF_SIZE - 1);
+    U1RxCtr--;
+    CPU_CRITICAL_EXIT();
+    return c;
+#else
     while ( !U1STAbits.URXDA);	// wait for a new character to arrive
     return U1RXREG;		// read the character from the receive buffer
+#endif
 }// getU1
 
+// ----- Get character from UART1 with timeout
+// timeout is in OS ticks; 0 waits forever.  Returns -1 if no character
+// arrived before the timeout, otherwise the character.
+int getU1_timeout( OS_TICK timeout)
+{
+#if U1_RX_INT_EN
+    char c;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    while (U1RxCtr == 0) {
+        U1RxWaiterTCB = OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+        OSTaskSemPend(timeout, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (err == OS_ERR_TIMEOUT)
+            return -1;
+        CPU_CRITICAL_ENTER();
+    }
+    c = U1RxBuf[U1RxOut];
+    U1RxOut = (U1RxOut + 1) & (U1_RX_BUF_SIZE - 1);
+    U1RxCtr--;
+    CPU_CRITICAL_EXIT();
+    return (int)c;
+#else
+    (void)timeout;          // no timeout support on the busy-wait path
+    return (int)getU1();
+#endif
+}// getU1_timeout
+
 // ------------------------------------------------------------
-// baseconv
-//	convert signed val into base and return as a zero terminated string
+// baseconv_r
+//	reentrant baseconv: convert signed val into base as a zero
+//	terminated string in the caller supplied dst buffer of len bytes
+//	(sign character always included, as baseconv emits it)
 //   1<base<=16
-// from http://www.jb.man.ac.uk/~slowe/cpp/itoa.html
+//	Returns a pointer to the start of the string inside dst (the
+//	digits are built from the end of the buffer), or 0 if dst is
+//	too small.  No statics, so no OSSchedLock needed around calls.
 // ------------------------------------------------------------
 
-char* baseconv(int val, int base){
-#define BUFSIZE 32
-static char buf[BUFSIZE] = {0};
-int i = 30;
+char* baseconv_r(int val, int base, char *dst, int len){
+int i = len-2;
 char sign;
 
+	if (len < 3)		// need room for sign, one digit and '\0'
+		return 0;
+	dst[len-1] = '\0';
+
 	if (val<0) {
 		val = -val;
 		sign = '-';
@@ -57,32 +882,70 @@ char sign;
 	else sign = '+';
 
 	if (val == 0) {
-		buf[i]='0';
+		dst[i]='0';
 	}
 	else {
 		for(; val && i ; --i, val /= base)
-			buf[i] = "0123456789abcdef"[val % base];
-		buf[i] = sign;
+			dst[i] = "0123456789abcdef"[val % base];
+		if (val)	// ran out of buffer before running out of digits
+			return 0;
+		dst[i] = sign;
 	}
 
-	return &buf[i];
+	return &dst[i];
+}
+
+// ------------------------------------------------------------
+// baseconv
+//	convert signed val into base and return as a zero terminated string
+//   1<base<=16
+// from http://www.jb.man.ac.uk/~slowe/cpp/itoa.html
+//	NOT reentrant (shared static buffer) -- use baseconv_r from tasks
+// ------------------------------------------------------------
+
+char* baseconv(int val, int base){
+#define BUFSIZE 32
+static char buf[BUFSIZE] = {0};
+
+	return baseconv_r(val, base, buf, BUFSIZE);
 }
 
 
+// ------------------------------------------------------------
+// uint2str_r
+//	reentrant uint2str: convert unsigned val into base as a zero
+//	terminated string in the caller supplied dst buffer of len bytes
+//   1<base<=16
+//	Returns a pointer to the start of the string inside dst (the
+//	digits are built from the end of the buffer), or 0 if dst is
+//	too small.  No statics, so no OSSchedLock needed around calls.
+// ------------------------------------------------------------
+char* uint2str_r(unsigned int val, int base, char *dst, int len){
+int i = len-2;
+
+	if (len < 2)		// need room for at least one digit and '\0'
+		return 0;
+	dst[len-1] = '\0';
+	if (val == 0)
+		dst[i--] = '0';
+	for(; val && i ; --i, val /= base)
+            dst[i] = "0123456789abcdef"[val % base];
+	if (val)			// ran out of buffer before running out of digits
+		return 0;
+	return &dst[i+1];
+}
+
 // ------------------------------------------------------------
 // uint2str
 //  convert unsigned val into base and return as a zero terminated string
 //   1<base<=16
 // from http://www.jb.man.ac.uk/~slowe/cpp/itoa.html
+//	NOT reentrant (shared static buffer) -- use uint2str_r from tasks
 // ------------------------------------------------------------
 char* uint2str(unsigned int val, int base){
-#define BUFSIZE 32
 static char buf[BUFSIZE] = {0};
-int i = 30;
-char sign;
-	for(; val && i ; --i, val /= base)
-            buf[i] = "0123456789abcdef"[val % base];
-	return &buf[i+1];
+
+	return uint2str_r(val, base, buf, BUFSIZE);
 }
 // ------------------------------------------------------------
 // fracConv
@@ -114,39 +977,98 @@ static char buf[32]={0};
 }
 
 // ------------------------------------------------------------
-// Scaled2String
-// Convert signed k with scaleFactor into a noFracDigits string in base
+// Scaled2String_r
+// Convert signed k with scaleFactor into a noFracDigits string in base,
+// written in a single pass into the caller supplied dst buffer of len
+// bytes (sign, whole digits, radix point, frac digits, '\0').
+// Reentrant: no statics, so every task can format on its own stack.
+// Returns the string length (excluding the '\0'), or -1 if dst is too
+// small -- dst contents are undefined in that case.
 // ------------------------------------------------------------
-char * Scaled2String(int k,
+int Scaled2String_r(int k,
   unsigned int base,
   unsigned int scaleFactor,
-  unsigned int noFracDigits)
+  unsigned int noFracDigits,
+  char *dst,
+  int len)
 {
-char m, numStr[33];
-unsigned int i,j,p, q;
-static char buf[32] = {0};
-char *bufptr;
+unsigned int i,j,p;
+int n, start, end;
+char c;
 
-	buf[0] = '\0';		// Set buffer to empty string
+	if (len < 2)		// need room for at least the sign and '\0'
+		return -1;
+	n = 0;
 // put sign into string
 	if (k<0)
 	{
 		k = -k;
-		strcpy(buf,"-");
+		dst[n++] = '-';
 	}
-	else strcpy(buf,"+");
-// process whole part
+	else dst[n++] = '+';
+// process whole part, least significant digit first
 	p=k;				// whole.frac
 	p=p>>scaleFactor;	// whole
-	strcat(buf,uint2str(p,base));
+	start = n;
+	do {
+		if (n >= len-1)
+			return -1;
+		dst[n++] = "0123456789abcdef"[p % base];
+		p /= base;
+	} while (p);
+	for (end = n-1; start < end; start++, end--)	// reverse the digit span in place
+	{
+		c = dst[start];
+		dst[start] = dst[end];
+		dst[end] = c;
+	}
 // insert radix point
-	strcat(buf,".");
-// process frac part
+	if (n >= len-1)
+		return -1;
+	dst[n++] = '.';
+// process frac part, most significant digit first
 	p=k;					//get whole.frac
-	p <<= (32-scaleFactor);	//
-	p >>= (32-scaleFactor);	// 0.frac
-	strcat(buf,fracConv(p,base,scaleFactor,noFracDigits));
-// return string
+	if (scaleFactor == 0)	// if scale factor is 0 the fraction part is 0
+		p = 0;
+	else
+	{
+		p <<= (32-scaleFactor);	//
+		p >>= (32-scaleFactor);	// 0.frac
+	}
+	for (i=0; i<noFracDigits; i++)
+	{
+		if (n >= len-1)
+			return -1;
+		if (scaleFactor == 0)
+		{
+			dst[n++] = '0';
+		}
+		else
+		{
+			p *= base;
+			j = p >> scaleFactor;
+			p <<= (32-scaleFactor);
+			p >>= (32-scaleFactor);
+			dst[n++] = "0123456789abcdef"[j];
+		}
+	}
+	dst[n] = '\0';	// End of String
+	return n;
+}
+
+// ------------------------------------------------------------
+// Scaled2String
+// Convert signed k with scaleFactor into a noFracDigits string in base
+// NOT reentrant (shared static buffer) -- use Scaled2String_r from tasks
+// ------------------------------------------------------------
+char * Scaled2String(int k,
+  unsigned int base,
+  unsigned int scaleFactor,
+  unsigned int noFracDigits)
+{
+static char buf[32] = {0};
+
+	Scaled2String_r(k,base,scaleFactor,noFracDigits,buf,sizeof(buf));
 	return &buf[0];
 }
 
@@ -185,19 +1107,66 @@ char *getsU1( char *s, int len)
     return p;               // return buffer pointer
 } // getsn
 
-// Not working correctly
+// ----- convert float to ASCII string, single pass into the caller
+//		supplied dst buffer of len bytes, rounded to the scale d
+//		(e.g. d = 1000 gives three decimal places, zero padded)
+//		Reentrant: no statics.  Returns the string length (excluding
+//		the '\0'), or -1 if dst is too small.
+int ftoa_r (float f,int d,char *dst,int len)
+{
+unsigned int ip, dp, scale;
+int n, start, end;
+char c;
+
+	if (len < 2)
+		return -1;
+	n = 0;
+	if (f < 0.0f)
+	{
+		f = -f;
+		dst[n++] = '-';
+	}
+	ip = (unsigned int)f;
+	dp = (unsigned int)((f - (float)ip) * (float)d + 0.5f);	// rounded fraction
+	if (dp >= (unsigned int)d)		// rounding carried into the whole part
+	{
+		dp -= (unsigned int)d;
+		ip++;
+	}
+	start = n;						// whole part, least significant digit first
+	do {
+		if (n >= len-1)
+			return -1;
+		dst[n++] = '0' + (ip % 10u);
+		ip /= 10u;
+	} while (ip);
+	for (end = n-1; start < end; start++, end--)	// reverse the digit span in place
+	{
+		c = dst[start];
+		dst[start] = dst[end];
+		dst[end] = c;
+	}
+	if (n >= len-1)
+		return -1;
+	dst[n++] = '.';
+	for (scale = (unsigned int)d/10u; scale > 0u; scale /= 10u)	// fixed width, keeps leading zeros
+	{
+		if (n >= len-1)
+			return -1;
+		dst[n++] = '0' + ((dp/scale) % 10u);
+	}
+	dst[n] = '\0';
+	return n;
+}
+
 // ----- convert float to ASCII string
 //		basic idea from:
 //       http://stackoverflow.com/questions/499939/extract-decimal-part-from-a-floating-point-number-in-c
+//		NOT reentrant (shared static buffer) -- use ftoa_r from tasks
  char* ftoa (float f,int d)
 {
-//#define N_DECIMAL_POINTS_PRECISION (1000) // n = 3. Three decimal points.
-int integerPart = (int)f;
-int decimalPart = ((int)(f*d)%d);  //
 static char str[32];
-	strcpy(str,baseconv(integerPart,10));
-	strcat(str,".");
-	strcat(str,uint2str(decimalPart,10));
+	ftoa_r(f,d,str,sizeof(str));
 	return str;
 
 }
@@ -213,10 +1182,151 @@ Remarks: This function as provided always writes to UART 2 and assumes that
 the UART has already been initialized. This function can be replaced
 with one that writes to another UART or other output device.
 */
+#if U1_MON_BUF_EN
+//----- Line-buffered stdout.  The C library calls _mon_putc once per
+//      character, so an unbuffered printf costs one ring transaction
+//      (critical section, interrupt enable) per byte and its output
+//      interleaves byte-at-a-time with the renderer's cursor sequences.
+//      Buffering until \n hands each printf line to the TX ring as one
+//      burst on the default (low-priority) lane: cheap, and a line can
+//      no longer land in the middle of a positioning sequence.
+//      NOT reentrant (shared static buffer) -- stdout is a single debug
+//      stream, same rule as ftoa above.
+static char U1MonBuf[U1_MON_BUF_SIZE];
+static volatile unsigned int U1MonCnt;
+
+void U1_MonFlush (void)
+{
+	unsigned int i;
+
+	for (i = 0; i < U1MonCnt; i++)
+		putU1(U1MonBuf[i]);
+	U1MonCnt = 0;
+}
+
+void _mon_putc (char c)
+{
+	U1MonBuf[U1MonCnt++] = c;
+	if ((c == '\n') || (U1MonCnt >= U1_MON_BUF_SIZE))
+		U1_MonFlush();
+} // _mon_putc
+#else
 void _mon_putc (char c)
 {
 	putU1(c);
 } // _mon_putc
 
+void U1_MonFlush (void)
+{
+}
+#endif
+
+#if U1_BAUD_NEG_EN
+// ------------------------------------------------------------
+// Baud negotiation.  115200 caps a frame at ~2 KB of escape
+// sequences; with BRGH=1 at 80 MHz the BRG error at 921600 is
+// under 1%, well inside UART tolerance.  The handshake keeps a
+// dumb terminal working: every announcement and probe is plain
+// ASCII, and a host that never acks leaves the port at 115200.
+// ------------------------------------------------------------
+
+//----- Block until every queued TX byte has left the shifter, so a rate
+//      switch cannot garble output already committed at the old rate
+static void U1_TxDrainWait (void)
+{
+	OS_ERR err;
+
+#if U1_TX_INT_EN
+#if U1_TX_LANE_EN
+	while ((U1TxHiCtr > 0) || (U1TxCtr > 0))
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#else
+	while (U1TxCtr > 0)
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#endif
+#if U1_TX_SCAT_EN
+	while (U1TxDescCtr > 0)
+		OSTimeDly((OS_TICK)1, OS_OPT_TIME_DLY, &err);
+#endif
+#endif
+	while (!U1STAbits.TRMT);	// last byte is still shifting out
+}
+
+//----- Discard whatever reception the old rate left behind
+static void U1_RxFlush (void)
+{
+#if U1_RX_INT_EN
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	U1RxIn = 0;
+	U1RxOut = 0;
+	U1RxCtr = 0;
+	CPU_CRITICAL_EXIT();
+#endif
+	while (U1STAbits.URXDA)	// and the hardware FIFO
+		(void)U1RXREG;
+}
+
+//----- Switch the BRG; the divisor formula is the BRATE one with the
+//      rate as a parameter (BRGH=1 throughout)
+static void U1_BaudSet (unsigned long baud)
+{
+	U1BRG = ((BSP_CLK_FREQ / 4) / baud) - 1;
+	U1BaudCur = baud;
+	U1BaudErrCtr = 0;
+}
+
+//----- Negotiate the highest clean rate (see UART1.h)
+unsigned long U1_BaudNegotiate (void)
+{
+	static const unsigned long rate_tbl[] = { 921600, 460800, 230400 };
+	char dig_buf[12];
+	char *p_dig;
+	unsigned int i;
+	int c;
+
+	for (i = 0; i < sizeof(rate_tbl) / sizeof(rate_tbl[0]); i++) {
+		putsU1("+++B");		// announce the rate we are about to try
+		p_dig = uint2str_r((unsigned int)rate_tbl[i], 10, dig_buf, sizeof(dig_buf));
+		if (p_dig)
+			putsU1(p_dig);
+		putsU1("\r\n");
+		U1_TxDrainWait();
+
+		U1_BaudSet(rate_tbl[i]);
+		U1_RxFlush();
+		putU1('U');		// 0x55: alternating bit pattern, worst case for sync
+		U1_TxDrainWait();
+
+		c = getU1_timeout((OS_TICK)U1_BAUD_ACK_TIMEOUT);
+		if (c == 'K')		// host saw a clean 'U' at the new rate
+			return (U1BaudCur);
+
+		U1_BaudSet(BAUD_RATE);	// no (clean) ack -- back to base before the next try
+		U1_RxFlush();
+		putsU1("\r\n");	// resync a host that switched but answered garbage
+		U1_TxDrainWait();
+	}
+	return (U1BaudCur);	// 115200: every probe timed out
+}
+
+//----- Sync-loss check (see UART1.h)
+int U1_BaudSyncLost (void)
+{
+	if (U1BaudCur == BAUD_RATE)
+		return 0;	// base rate: errors are noise, not negotiation drift
+	return (U1BaudErrCtr >= U1_BAUD_ERR_LIM);
+}
+
+//----- Fall back to the boot rate (see UART1.h)
+void U1_BaudFallback (void)
+{
+	U1_TxDrainWait();
+	U1_BaudSet(BAUD_RATE);
+	U1_RxFlush();
+}
+#endif
+
 
 #endif
@@ -22,6 +22,74 @@
 //#define BRATE 155       // 72 MHz clock with Fpb = 72 MHz
 #define BRATE ((BSP_CLK_FREQ/4) / (BAUD_RATE))-1
 
+//-----------------------------------------------------------------------
+// UART1 TX RING BUFFER DEFINES
+//-----------------------------------------------------------------------
+#define U1_TX_INT_EN   1	// 1 = interrupt-driven TX through ring buffer, 0 = legacy busy-wait TX
+#define U1_TX_BUF_SIZE 256	// ring size in bytes, must be a power of two
+#define U1_TX_LANE_EN  1	// 1 = second, high-priority TX lane (render output) ahead of the
+					// default lane (stats, trace); requires U1_TX_INT_EN
+#define U1_TX_HI_BUF_SIZE  256	// high lane ring size in bytes, must be a power of two
+#define U1_TX_LANE_BUDGET   32	// consecutive high-lane bytes before ONE default-lane byte is
+					// interleaved, so background output trickles out but can never
+					// delay render bytes by more than one character time each
+#define U1_MON_BUF_EN   1	// 1 = line-buffered _mon_putc (stdout/printf), 0 = byte-at-a-time
+#define U1_MON_BUF_SIZE 128	// stdout line buffer; flushed on \n, on overflow, or by U1_MonFlush()
+#define U1_TX_SCAT_EN      1	// 1 = scatter descriptors: const data transmits from flash, no ring copy
+#define U1_TX_DESC_Q_SIZE  4	// pending scatter descriptors, must be a power of two
+#define U1_TX_INT_PRIO 2	// UART1 interrupt priority, must stay below the kernel tick priority;
+					// priority 2 (BSP_SRS_INT_PRIO) runs on the shadow register set -- see bsp_a.S
+
+//-----------------------------------------------------------------------
+// UART1 RX RING BUFFER DEFINES
+//-----------------------------------------------------------------------
+#define U1_RX_INT_EN   1	// 1 = interrupt-driven RX through ring buffer, 0 = legacy busy-wait RX
+#define U1_RX_BUF_SIZE 64	// ring size in bytes, must be a power of two
+
+//-----------------------------------------------------------------------
+// UART1 LINE INPUT DEFINES   (interrupt-side line editor, see getsU1_evt)
+//-----------------------------------------------------------------------
+#define U1_LINE_EVT_EN  1	// 1 = echo/backspace/CR editing runs in the RX interrupt
+#define U1_LINE_MAX    64	// longest accepted line, including the '\0'
+#define U1_LINE_Q_SIZE  2	// completed lines buffered, must be a power of two
+
+//-----------------------------------------------------------------------
+// UART1 BAUD NEGOTIATION DEFINES   (rate switch above 115200, see U1_BaudNegotiate)
+//-----------------------------------------------------------------------
+#define U1_BAUD_NEG_EN       1	// 1 = boot-time handshake up to the highest clean rate
+#define U1_BAUD_ACK_TIMEOUT 10	// ticks to wait for the host's ack at each probed rate
+#define U1_BAUD_ERR_LIM      4	// framing/overrun errors before sync is declared lost
+
+//-----------------------------------------------------------------------
+// UART1 VT100 KEY INPUT DEFINES   (arrow/WASD decoding in the RX interrupt)
+//-----------------------------------------------------------------------
+#define U1_KEY_EVT_EN     1	// 1 = escape-sequence key parser in the RX path
+#define U1_KEY_EVT_Q_SIZE 8	// decoded key events, must be a power of two
+
+#define U1_KEY_UP     0
+#define U1_KEY_DOWN   1
+#define U1_KEY_LEFT   2
+#define U1_KEY_RIGHT  3
+
+typedef struct u1_key_evt {
+	unsigned char Dir;	// U1_KEY_xxx
+	unsigned int  TS;	// ReadCoreTimer() when the key was decoded
+} U1_KEY_EVT;
+
+//-----------------------------------------------------------------------
+// UART1 DMA TRANSMIT DEFINES   (DMA channel 0 feeds U1TXREG)
+//-----------------------------------------------------------------------
+#define U1_TX_DMA_EN    1	// 1 = putsU1_DMA available (PIC32MX5xx/6xx/7xx DMA controller)
+#define U1_DMA_INT_PRIO 2	// DMA channel 0 interrupt priority
+#define U1TX_IRQ        28	// U1TX interrupt request number (IFS0 bit 28), DMA cell trigger
+
+//-----------------------------------------------------------------------
+// UART1 DMA RECEIVE DEFINES   (DMA channel 1 drains U1RXREG, pattern-match '\r')
+//-----------------------------------------------------------------------
+#define U1_RX_DMA_EN       1	// 1 = getsU1_DMA available (pattern-match line reception)
+#define U1_DMA_RX_INT_PRIO 2	// DMA channel 1 interrupt priority
+#define U1RX_IRQ           27	// U1RX interrupt request number (IFS0 bit 27), DMA cell trigger
+
 //-----------------------------------------------------------------------
 // UART FUNCTIONS
 //-----------------------------------------------------------------------
@@ -35,11 +103,90 @@ void putU1 (char c);
 //----- Output zero terminated string to UART1
 void putsU1(char *s);
 
+//----- High-priority TX lane: same ring discipline as putU1/putsU1 but the
+//      U1TX interrupt drains this lane first (budgeted, see U1_TX_LANE_BUDGET).
+//      Used by the Screen_* render layer so a queued stats/trace dump cannot
+//      make the game stutter.  Without U1_TX_LANE_EN these fall through to
+//      the default lane.
+void putU1_hi (char c);
+void putsU1_hi (char *s);
+
+//----- Flush the _mon_putc (stdout/printf) line buffer to the TX ring.
+//      stdout is line buffered with U1_MON_BUF_EN: call this before a
+//      blocking wait if a partial line (no \n yet) must reach the wire.
+void U1_MonFlush (void);
+
+//----- Zero-copy transmit of const (flash-resident) data: queues a
+//      (pointer, length) descriptor instead of copying into the TX ring,
+//      and the ISR interleaves it at exactly the submission point of the
+//      default-lane byte stream.  len 0 = zero-terminated, measure it.
+//      The data MUST stay untouched until it has left the wire -- string
+//      literals and const tables qualify, stack buffers do not.
+void putsU1_scat (const char *buf, unsigned int len);
+
+//----- UART1 interrupt handler, called from the vector 24 stub in bsp_a.S
+void U1_ISR_Handler(void);
+
+//----- Divert arrow keys and WASD from the RX ring into the key queue.
+//      Off (the default) the parser costs one compare per received byte.
+void U1_KeyInputEn(int en);
+
+//----- Fetch the next decoded key event, nonblocking; 1 = event returned
+int U1_KeyEvtGet(U1_KEY_EVT *p_evt);
+
+//----- Divert RX bytes through the interrupt-side line editor (echo,
+//      backspace, CR handling).  While enabled, ordinary bytes assemble
+//      into lines instead of entering the RX ring.
+void U1_LineInputEn(int en);
+
+//----- Fetch the next completed line, nonblocking; 1 = line copied into s
+int U1_LineEvtGet(char *s, int len);
+
+//----- Fetch the next completed line, blocking.  The calling task sleeps
+//      on its task semaphore until the RX interrupt posts a finished line,
+//      so a shell waiting for a command costs zero CPU while the human
+//      types.  Editing happened in the interrupt; unlike getsU1 the caller
+//      never sees partial input.
+char *getsU1_evt(char *s, int len);
+
+//----- Negotiate the highest clean rate with a capable host.  Announces
+//      "+++B<rate>\r\n" at the current rate, switches, sends the probe
+//      'U' and expects 'K' back within U1_BAUD_ACK_TIMEOUT ticks; probes
+//      921600/460800/230400 in turn and stays at 115200 when none acks.
+//      Returns the rate in effect.  Call from a task after initU1().
+unsigned long U1_BaudNegotiate(void);
+
+//----- 1 once U1_BAUD_ERR_LIM framing/overrun errors accumulated at an
+//      elevated rate (the RX interrupt counts them) -- the host likely
+//      lost sync; call U1_BaudFallback() and re-negotiate if desired
+int U1_BaudSyncLost(void);
+
+//----- Drop back to the boot rate (115200) immediately
+void U1_BaudFallback(void);
+
+//----- Zero-copy DMA transmit of len bytes, blocks the caller until complete
+void putsU1_DMA(const char *buf, unsigned int len);
+
+//----- DMA channel 0 interrupt handler, called from the vector 36 stub in bsp_a.S
+void U1_DMA_ISR_Handler(void);
+
+//----- DMA pattern-match line receive: sleeps until a whole '\r'-terminated
+//      line (or len-1 bytes) has landed in s with zero CPU involvement.
+//      No echo and no backspace editing -- see getsU1 for the interactive path.
+char *getsU1_DMA(char *s, int len);
+
+//----- DMA channel 1 interrupt handler, called from the vector 37 stub in bsp_a.S
+void U1_DMA_RX_ISR_Handler(void);
+
 
 // ----- Get character from UART1
 // wait for a new character to arrive to the UART1 serial port
 char getU1( void);
 
+// ----- Get character from UART1 with a timeout in OS ticks (0 = wait forever)
+// returns the character, or -1 if the timeout expired with no data
+int getU1_timeout(OS_TICK timeout);
+
 // ------------------------------------------------------------
 // uint2str
 //  convert unsigned val into base and return as a zero terminated string
@@ -48,11 +195,21 @@ char getU1( void);
 // ------------------------------------------------------------
 char* uint2str(unsigned int val, int base);
 
+// ----- reentrant uint2str: digits built into the caller supplied dst
+//   buffer of len bytes, returns pointer to start of string inside dst
+//   (or 0 if dst too small) -- no statics, no serialization needed
+char* uint2str_r(unsigned int val, int base, char *dst, int len);
+
 // ----- convert val into base and return as a zero terminated string
 //   1<base<=16
 // from http://www.jb.man.ac.uk/~slowe/cpp/itoa.html
 char* baseconv(int val, int base);
 
+// ----- reentrant baseconv: digits built into the caller supplied dst
+//   buffer of len bytes, returns pointer to start of string inside dst
+//   (or 0 if dst too small) -- no statics, no serialization needed
+char* baseconv_r(int val, int base, char *dst, int len);
+
 // ----- convert scaled val into whole.frac base and return as a zero terminated string
 //   1<base<=16
 
@@ -61,6 +218,20 @@ char * Scaled2String(int k,
   unsigned int scaleFactor,
   unsigned int noFracDigits);
 
+// ----- reentrant Scaled2String: single pass into the caller supplied
+//   dst buffer of len bytes, returns string length or -1 if too small
+int Scaled2String_r(int k,
+  unsigned int base,
+  unsigned int scaleFactor,
+  unsigned int noFracDigits,
+  char *dst,
+  int len);
+
+// ----- reentrant float to ASCII: single pass into the caller supplied
+//   dst buffer of len bytes, rounded to scale d (1000 = 3 decimals),
+//   returns string length or -1 if too small
+int ftoa_r(float f, int d, char *dst, int len);
+
 // ----- Get String from U1.
 //       From Programming 32-Bit Microcontrollers in C: Exploring the PIC32,
 //		 By Lucio Di Jasio, Newnes Publishing.
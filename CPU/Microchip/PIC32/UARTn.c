@@ -0,0 +1,256 @@
+#ifndef UARTN_C
+#define UARTN_C
+
+#include "UARTn.h"
+//-----------------------------------------------------------------------
+// GENERIC UART DRIVER -- see UARTn.h for the port model
+//-----------------------------------------------------------------------
+
+//----- Register overlay: every PIC32 UART exposes the same block of
+//      SFRs (each with CLR/SET/INV companions) at a fixed layout, so one
+//      struct pointer per instance replaces the hardcoded U1xxx names.
+typedef struct un_regs {
+	volatile unsigned int MODE, MODECLR, MODESET, MODEINV;
+	volatile unsigned int STA,  STACLR,  STASET,  STAINV;
+	volatile unsigned int TXREG, TXREGCLR, TXREGSET, TXREGINV;
+	volatile unsigned int RXREG, RXREGCLR, RXREGSET, RXREGINV;
+	volatile unsigned int BRG,  BRGCLR,  BRGSET,  BRGINV;
+} UN_REGS;
+
+#define UN_STA_URXDA 0x0001	// receive data available
+#define UN_STA_UTXBF 0x0200	// transmit buffer full
+#define UN_MODE_ON   0x8008	// UARTEN, BRGH=1, 8N1 (same as UART1's U_ENABLE)
+#define UN_STA_EN    0x1400	// URXEN | UTXEN
+
+//----- Per-port wiring that never changes: register block base address
+//      and interrupt controller request numbers (PIC32MX795; UART2A/3A/
+//      1B/2B/3B in the datasheet's vector table are UART2/3/4/5/6).
+//      Each UART owns an error/RX/TX request triplet whose first member
+//      is its vector's first IRQ -- 24->26, 31->37, 32->40, 49->61,
+//      50->64, 51->67 -- so IrqRx/IrqTx must be that base +1/+2.
+typedef struct un_cfg {
+	UN_REGS *Regs;
+	unsigned char Vec;	// interrupt vector, for the IPC priority field
+	unsigned char IrqRx;	// RX interrupt request number (IFSx/IECx bit)
+	unsigned char IrqTx;	// TX interrupt request number
+} UN_CFG;
+
+static UN_CFG const UnCfgTbl[UN_NBR_PORTS] = {
+	{ (UN_REGS *)&U1MODE, 24, 27, 28 },	// UART1  (UART1A)
+	{ (UN_REGS *)&U2MODE, 31, 38, 39 },	// UART2  (UART2A)
+	{ (UN_REGS *)&U3MODE, 32, 41, 42 },	// UART3  (UART3A)
+	{ (UN_REGS *)&U4MODE, 49, 62, 63 },	// UART4  (UART1B)
+	{ (UN_REGS *)&U5MODE, 50, 65, 66 },	// UART5  (UART2B)
+	{ (UN_REGS *)&U6MODE, 51, 68, 69 },	// UART6  (UART3B)
+};
+
+//----- Per-port mutable state: the rings UART1.c keeps in file statics,
+//      one copy per instance.
+typedef struct un_state {
+	volatile char TxBuf[UN_TX_BUF_SIZE];
+	volatile unsigned int TxIn, TxOut, TxCtr;
+	volatile char RxBuf[UN_RX_BUF_SIZE];
+	volatile unsigned int RxIn, RxOut, RxCtr;
+	OS_TCB *RxWaiterTCB;	// single task pending on RX data
+#if OS_CFG_SEM_EN > 0u
+	OS_SEM TxSem;		// backpressure: counts slots freed by the TX ISR
+#endif
+} UN_STATE;
+
+static UN_STATE UnTbl[UN_NBR_PORTS];
+
+volatile unsigned int Un_RxDropCtr[UN_NBR_PORTS];	// bytes dropped on a full RX ring
+
+//----- Interrupt controller access from a request/vector number.  The
+//      IFS/IEC/IPC blocks are contiguous SFRs with CLR/SET/INV at +1..+3
+//      words, so indexing replaces a per-port #define forest.
+#define UN_IFS(irq)     (*((&IFS0) + ((irq) >> 5) * 4))
+#define UN_IFSCLR(irq)  (*((&IFS0) + ((irq) >> 5) * 4 + 1))
+#define UN_IECCLR(irq)  (*((&IEC0) + ((irq) >> 5) * 4 + 1))
+#define UN_IECSET(irq)  (*((&IEC0) + ((irq) >> 5) * 4 + 2))
+#define UN_IEC(irq)     (*((&IEC0) + ((irq) >> 5) * 4))
+#define UN_IRQ_BIT(irq) (1u << ((irq) & 31))
+#define UN_IPCCLR(vec)  (*((&IPC0) + ((vec) >> 2) * 4 + 1))
+#define UN_IPCSET(vec)  (*((&IPC0) + ((vec) >> 2) * 4 + 2))
+#define UN_IPC_SHIFT(vec) ((((vec) & 3) * 8) + 2)	// priority field within the IPC byte lane
+
+//----- Initialize one port (see UARTn.h)
+void initUn (int port, unsigned long baud)
+{
+	UN_CFG const *p_cfg;
+	UN_STATE *p_un;
+	unsigned int prio;
+
+	if (port < 1 || port > UN_NBR_PORTS)
+		return;
+	p_cfg = &UnCfgTbl[port - 1];
+	p_un  = &UnTbl[port - 1];
+
+	p_un->TxIn = p_un->TxOut = p_un->TxCtr = 0;
+	p_un->RxIn = p_un->RxOut = p_un->RxCtr = 0;
+	p_un->RxWaiterTCB = (OS_TCB *)0;
+	Un_RxDropCtr[port - 1] = 0;
+#if OS_CFG_SEM_EN > 0u
+	{
+	OS_ERR err;
+		OSSemCreate(&p_un->TxSem, "Un TX Sem", (OS_SEM_CTR)0, &err);
+	}
+#endif
+
+	p_cfg->Regs->BRG  = (BSP_CLK_FREQ / 4 / baud) - 1;	// BRGH=1
+	p_cfg->Regs->MODE = UN_MODE_ON;
+	p_cfg->Regs->STA  = UN_STA_EN;
+
+	// Only vectors with shadow-set stubs may use BSP_SRS_INT_PRIO
+	// (see UN_INT_PRIO_FULL in UARTn.h); ports 3..6 land there once
+	// their bsp_a.S stubs are converted.
+	prio = (BSP_IntVectIsSRS(p_cfg->Vec) == DEF_YES) ? UN_INT_PRIO
+							 : UN_INT_PRIO_FULL;
+	UN_IPCCLR(p_cfg->Vec) = 7u << UN_IPC_SHIFT(p_cfg->Vec);	// priority field
+	UN_IPCSET(p_cfg->Vec) = prio << UN_IPC_SHIFT(p_cfg->Vec);
+	UN_IFSCLR(p_cfg->IrqRx) = UN_IRQ_BIT(p_cfg->IrqRx);
+	UN_IFSCLR(p_cfg->IrqTx) = UN_IRQ_BIT(p_cfg->IrqTx);
+	UN_IECSET(p_cfg->IrqRx) = UN_IRQ_BIT(p_cfg->IrqRx);	// RX interrupts run for the life of the port
+	// The TX interrupt is enabled by putUn when the ring holds data
+	// and disabled again by the ISR once the ring drains.
+} // initUn
+
+//----- Output character (see UARTn.h).  Same ring discipline as putU1:
+//      queue, enable the drain interrupt, block only on a full ring.
+void putUn (int port, char c)
+{
+	UN_CFG const *p_cfg = &UnCfgTbl[port - 1];
+	UN_STATE *p_un = &UnTbl[port - 1];
+	CPU_SR_ALLOC();
+
+	while (p_un->TxCtr >= UN_TX_BUF_SIZE) {	// ring full -- wait for the ISR to free a slot
+#if OS_CFG_SEM_EN > 0u
+		OS_ERR err;
+		OSSemPend(&p_un->TxSem, (OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+#endif
+	}
+	CPU_CRITICAL_ENTER();
+	p_un->TxBuf[p_un->TxIn] = c;
+	p_un->TxIn = (p_un->TxIn + 1) & (UN_TX_BUF_SIZE - 1);
+	p_un->TxCtr++;
+	UN_IECSET(p_cfg->IrqTx) = UN_IRQ_BIT(p_cfg->IrqTx);	// ring not empty -- drain interrupt on
+	CPU_CRITICAL_EXIT();
+}
+
+//----- Output zero terminated string
+void putsUn (int port, char *s)
+{
+	while (*s)
+		putUn(port, *s++);
+}
+
+//----- Get character (see UARTn.h)
+char getUn (int port)
+{
+	UN_STATE *p_un = &UnTbl[port - 1];
+	char c;
+	OS_ERR err;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	while (p_un->RxCtr == 0) {	// nothing queued -- sleep until the ISR posts
+		p_un->RxWaiterTCB = OSTCBCurPtr;
+		CPU_CRITICAL_EXIT();
+		OSTaskSemPend((OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		CPU_CRITICAL_ENTER();
+	}
+	c = p_un->RxBuf[p_un->RxOut];
+	p_un->RxOut = (p_un->RxOut + 1) & (UN_RX_BUF_SIZE - 1);
+	p_un->RxCtr--;
+	CPU_CRITICAL_EXIT();
+	return c;
+}
+
+//----- Get character with timeout (see UARTn.h)
+int getUn_timeout (int port, OS_TICK timeout)
+{
+	UN_STATE *p_un = &UnTbl[port - 1];
+	char c;
+	OS_ERR err;
+	CPU_SR_ALLOC();
+
+	CPU_CRITICAL_ENTER();
+	while (p_un->RxCtr == 0) {
+		p_un->RxWaiterTCB = OSTCBCurPtr;
+		CPU_CRITICAL_EXIT();
+		OSTaskSemPend(timeout, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+		if (err == OS_ERR_TIMEOUT)
+			return -1;
+		CPU_CRITICAL_ENTER();
+	}
+	c = p_un->RxBuf[p_un->RxOut];
+	p_un->RxOut = (p_un->RxOut + 1) & (UN_RX_BUF_SIZE - 1);
+	p_un->RxCtr--;
+	CPU_CRITICAL_EXIT();
+	return (int)c;
+}
+
+//----- Per-port interrupt service.  Same structure as U1_ISR_Handler:
+//      drain RX into the ring (waking a pending getUn), then move TX ring
+//      bytes into the hardware FIFO until one of them is empty.
+void Un_ISR_Handler (int port)
+{
+	UN_CFG const *p_cfg = &UnCfgTbl[port - 1];
+	UN_STATE *p_un = &UnTbl[port - 1];
+#if OS_CFG_SEM_EN > 0u
+	OS_ERR err;
+	unsigned int freed = 0;
+#endif
+
+	if (UN_IFS(p_cfg->IrqRx) & UN_IRQ_BIT(p_cfg->IrqRx)) {
+		while (p_cfg->Regs->STA & UN_STA_URXDA) {
+			char c = (char)p_cfg->Regs->RXREG;
+			if (p_un->RxCtr < UN_RX_BUF_SIZE) {
+				p_un->RxBuf[p_un->RxIn] = c;
+				p_un->RxIn = (p_un->RxIn + 1) & (UN_RX_BUF_SIZE - 1);
+				p_un->RxCtr++;
+			} else {
+				Un_RxDropCtr[port - 1]++;	// ring full -- byte dropped
+			}
+		}
+		UN_IFSCLR(p_cfg->IrqRx) = UN_IRQ_BIT(p_cfg->IrqRx);
+		if (p_un->RxWaiterTCB != (OS_TCB *)0) {	// wake the task pending in getUn
+			OS_ERR rx_err;
+			OS_TCB *p_tcb = p_un->RxWaiterTCB;
+			p_un->RxWaiterTCB = (OS_TCB *)0;
+			OSTaskSemPostFromISR(p_tcb, &rx_err);
+			BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+		}
+	}
+
+	if ((UN_IFS(p_cfg->IrqTx) & UN_IRQ_BIT(p_cfg->IrqTx)) &&
+	    (UN_IEC(p_cfg->IrqTx) & UN_IRQ_BIT(p_cfg->IrqTx))) {
+		while ((p_un->TxCtr > 0) && !(p_cfg->Regs->STA & UN_STA_UTXBF)) {
+			p_cfg->Regs->TXREG = p_un->TxBuf[p_un->TxOut];
+			p_un->TxOut = (p_un->TxOut + 1) & (UN_TX_BUF_SIZE - 1);
+			p_un->TxCtr--;
+#if OS_CFG_SEM_EN > 0u
+			freed++;
+#endif
+		}
+		if (p_un->TxCtr == 0)
+			UN_IECCLR(p_cfg->IrqTx) = UN_IRQ_BIT(p_cfg->IrqTx);	// ring empty -- TX interrupt off
+		UN_IFSCLR(p_cfg->IrqTx) = UN_IRQ_BIT(p_cfg->IrqTx);
+#if OS_CFG_SEM_EN > 0u
+		if (freed > 0)
+			BSP_IntNeedSched = 1;	// ask the shadow-set epilogue for a reschedule
+		while (freed--)		// wake writers blocked on a full ring
+			OSSemPost(&p_un->TxSem, OS_OPT_POST_1, &err);
+#endif
+	}
+}
+
+//----- Vector wrappers: bsp_a.S stubs take no arguments, so each wired
+//      port gets a tiny trampoline.  Vector 31 (UART2) is wired; add a
+//      wrapper and repoint the stub to wire another port.
+void U2_ISR_Handler (void)
+{
+	Un_ISR_Handler(2);
+}
+
+#endif
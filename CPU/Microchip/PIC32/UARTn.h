@@ -0,0 +1,67 @@
+// UARTn.h
+
+#ifndef UARTN_H
+#define UARTN_H
+
+#include <p32xxxx.h>
+#include <inttypes.h>
+#include <includes.h>
+
+//-----------------------------------------------------------------------
+// GENERIC UART DRIVER (PIC32MX795 UART1..UART6)
+//
+// UART1.c is the tuned single-port console driver (VT100 key parser,
+// DMA paths, .ramfunc hot path).  This file is the generalization for
+// the OTHER ports: every UART is an instance -- a struct of register
+// overlay pointer plus per-instance TX/RX rings -- behind the same API
+// surface, so bringing up a second high-rate port (multiplayer link
+// next to the debug console) does not mean copy-pasting the driver and
+// doubling the static-buffer hazards.
+//
+// Ports are numbered 1..6 as on the part.  Port 1 is normally left to
+// UART1.c: both drivers work on it, but the bsp_a.S vector 24 stub
+// dispatches to U1_ISR_Handler, so use one or the other.
+//-----------------------------------------------------------------------
+
+#define UN_NBR_PORTS   6	// UART1..UART6 on the PIC32MX795
+
+#define UN_TX_BUF_SIZE 128	// per-instance ring sizes, must be powers of two
+#define UN_RX_BUF_SIZE 64
+
+#define UN_INT_PRIO    2	// ports whose vector has an SRS stub (UART2) run at
+					// BSP_SRS_INT_PRIO on the shadow register set
+#define UN_INT_PRIO_FULL 1	// ports with only a full-save stub: entering those at
+					// the shadow-set priority would run ISR_PROLOGUE on
+					// the shadow set's uninitialized stack pointer, so
+					// initUn drops them below it (BSP_IntVectIsSRS, bsp.c)
+
+//----- Bring up one port: baud rate generator, 8N1, rings, interrupts.
+//      BRGH=1 as on UART1 (BRG = PBCLK / (4 * baud) - 1).
+void initUn (int port, unsigned long baud);
+
+//----- Output one character / a zero terminated string on a port.
+//      Queued into the port's TX ring; blocks only when the ring is full.
+void putUn (int port, char c);
+void putsUn (int port, char *s);
+
+//----- Get a character from a port; the calling task sleeps on its task
+//      semaphore until the RX interrupt queues a byte.  Only one task may
+//      wait on a given port at a time.
+char getUn (int port);
+
+//----- As getUn with a timeout in OS ticks (0 = wait forever);
+//      returns -1 if the timeout expired with no data
+int getUn_timeout (int port, OS_TICK timeout);
+
+//----- Per-port RX overrun counter, maintained by Un_ISR_Handler: bytes
+//      the RX interrupt dropped on a full software ring.  Watchable from
+//      the debugger like the DMA channel counters.
+extern volatile unsigned int Un_RxDropCtr[UN_NBR_PORTS];
+
+//----- Per-port interrupt service, called from the bsp_a.S vector stubs.
+//      U2_ISR_Handler is wired to vector 31 (UART2); wire further ports
+//      by pointing their vector stubs at a wrapper the same way.
+void Un_ISR_Handler (int port);
+void U2_ISR_Handler (void);
+
+#endif
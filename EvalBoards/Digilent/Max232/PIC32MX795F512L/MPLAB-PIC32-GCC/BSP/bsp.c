@@ -43,6 +43,7 @@
 
 #define  BSP_TMR_RELOAD          (BSP_CLK_FREQ / (2 * OS_CFG_TICK_RATE_HZ))
 #define  BSP_DLY_CONST            BSP_CLK_FREQ / 1000000 
+#define  BSP_US_TO_CT_CONST      (BSP_CLK_FREQ / 2000000)                 /* Core timer ticks per uS (SYSCLK / 2)     */
 
 
 /*
@@ -214,6 +215,52 @@ void  LED_Toggle (CPU_INT08U led)
     }
 }
 
+/*
+*********************************************************************************************************
+*                                          BSP_LEDPatternWrite()
+*
+* Description : Drive all eight shield LEDs from one bitmask.  Each port is updated with its atomic
+*               LATxSET/LATxCLR registers (two bus writes per port, three ports on the Max32 shield),
+*               so there is no read-modify-write window to race against ISRs touching the same LAT.
+*
+* Arguments   : pattern    Bit 0 = LED D1 ... bit 7 = LED D8; 1 = on, 0 = off.
+*
+* Returns     : None
+*********************************************************************************************************
+*/
+
+#define  BSP_LED_PORTA_MSK      (IOPORT_BIT_0 | IOPORT_BIT_1 | IOPORT_BIT_4 | IOPORT_BIT_5)
+#define  BSP_LED_PORTC_MSK      (IOPORT_BIT_13)
+#define  BSP_LED_PORTD_MSK      (IOPORT_BIT_7 | IOPORT_BIT_9 | IOPORT_BIT_13)
+
+void  BSP_LEDPatternWrite (CPU_INT08U  pattern)
+{
+    CPU_INT32U  a_msk;
+    CPU_INT32U  c_msk;
+    CPU_INT32U  d_msk;
+
+
+    a_msk = 0u;
+    c_msk = 0u;
+    d_msk = 0u;
+
+    if (pattern & 0x01) a_msk |= IOPORT_BIT_0;                                /* LED D1                                     */
+    if (pattern & 0x02) a_msk |= IOPORT_BIT_1;                                /* LED D2                                     */
+    if (pattern & 0x04) a_msk |= IOPORT_BIT_4;                                /* LED D3                                     */
+    if (pattern & 0x08) a_msk |= IOPORT_BIT_5;                                /* LED D4                                     */
+    if (pattern & 0x10) d_msk |= IOPORT_BIT_9;                                /* LED D5                                     */
+    if (pattern & 0x20) c_msk |= IOPORT_BIT_13;                               /* LED D6                                     */
+    if (pattern & 0x40) d_msk |= IOPORT_BIT_13;                               /* LED D7                                     */
+    if (pattern & 0x80) d_msk |= IOPORT_BIT_7;                                /* LED D8                                     */
+
+    mPORTASetBits(a_msk);                                                     /* LATxSET / LATxCLR are write-only --        */
+    mPORTAClearBits(BSP_LED_PORTA_MSK & ~a_msk);                              /* ...no RMW anywhere in this update          */
+    mPORTCSetBits(c_msk);
+    mPORTCClearBits(BSP_LED_PORTC_MSK & ~c_msk);
+    mPORTDSetBits(d_msk);
+    mPORTDClearBits(BSP_LED_PORTD_MSK & ~d_msk);
+}
+
 /*
 *********************************************************************************************************
 *                                       LED_Init()
@@ -252,6 +299,216 @@ static  void  BSP_IO_Init (void)
     SW1_CONFIG; SW2_CONFIG; SW3_CONFIG; SW4_CONFIG;
 }
 
+/*
+*********************************************************************************************************
+*                                    CHANGE-NOTICE BUTTON EVENTS
+*
+* Description: Interrupt-driven input capture for the Basic Shield buttons.  BTN1 (RC14) sits on the
+*              CN0 change-notice pin, so any edge raises the CN interrupt; the handler then snapshots
+*              all four buttons, applies a per-button debounce window and posts a timestamped event
+*              per changed button into a small ring.  One task at a time may sleep on events through
+*              BSP_BtnEventGet(), woken with OSTaskSemPostFromISR() the same way the UART1 RX driver does it.
+*********************************************************************************************************
+*/
+
+#define  BSP_BTN_DEBOUNCE_CT     ((BSP_CLK_FREQ / 2000) * BSP_BTN_DEBOUNCE_MS)  /* core timer counts  */
+
+static  BSP_BTN_EVENT           BSP_BtnEventQ[BSP_BTN_EVENT_Q_SIZE];
+static  volatile  CPU_INT08U    BSP_BtnEventIn;
+static  volatile  CPU_INT08U    BSP_BtnEventOut;
+static  volatile  CPU_INT08U    BSP_BtnEventCtr;
+static  volatile  CPU_INT08U    BSP_BtnLastState;                         /* last debounced snapshot  */
+static  CPU_INT32U              BSP_BtnLastTS[4];                         /* last accepted edge, per button */
+static  OS_TCB                 *BSP_BtnWaiterTCB;
+
+volatile  CPU_INT08U            BSP_IntNeedSched;                         /* shadow-set ISR readied a task  */
+
+volatile  CPU_INT32U            BSP_IntEntryCount;                        /* CP0 Count stamped by the ISR   */
+                                                                          /* ... prologues (bsp_a.S and the */
+                                                                          /* ... port's CoreTimerIntHandler)*/
+typedef  struct  bsp_int_lat {
+    CPU_INT32U  Max;                                                      /* worst entry-to-handler latency */
+    CPU_INT32U  Cnt;                                                      /* recorded interrupts            */
+    CPU_INT16U  HistTbl[BSP_INT_LAT_HIST_SIZE];                           /* log2 buckets, saturating       */
+} BSP_INT_LAT;
+
+static  BSP_INT_LAT             BSP_IntLatTbl[BSP_INT_LAT_VECT_QTY];
+
+
+/*
+*********************************************************************************************************
+*                                       BSP_BtnIntInit()
+*
+* Description: Enable the change-notice interrupt for the shield buttons.  Call once after BSP_InitIO().
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_BtnIntInit (void)
+{
+    BSP_BtnEventIn   = 0;
+    BSP_BtnEventOut  = 0;
+    BSP_BtnEventCtr  = 0;
+    BSP_BtnLastState = 0;
+    BSP_BtnWaiterTCB = (OS_TCB *)0;
+
+    CNEN    = 0x00000001;                                               /* CN0 = RC14 = BTN1        */
+    CNCONSET = 0x8000;                                                  /* change-notice module ON  */
+    (void)PORTC;                                                        /* clear any pending mismatch */
+    mCNClearIntFlag();
+    (void)INTLatencyClassAssign(BSP_INT_VECT_CN,                          /* buttons ride the shadow set: class   */
+                                INT_CLASS_KERNEL, "CN buttons");          /* ...kernel == BSP_CN_INT_PRIO (2)     */
+    IEC1SET = 0x00000001;                                               /* enable the CN interrupt  */
+}
+
+/*
+*********************************************************************************************************
+*                                       BSP_BtnEventGet()
+*
+* Description: Fetch the next button event, sleeping on the caller's task semaphore until one arrives.
+*
+* Arguments  : p_evt     where the event is copied
+*
+*              timeout   in OS ticks, 0 = wait forever
+*
+* Returns    : DEF_TRUE if an event was returned, DEF_FALSE on timeout
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  BSP_BtnEventGet (BSP_BTN_EVENT  *p_evt,
+                              OS_TICK         timeout)
+{
+    OS_ERR  err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    while (BSP_BtnEventCtr == 0) {
+        BSP_BtnWaiterTCB = OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+        OSTaskSemPend(timeout, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (err == OS_ERR_TIMEOUT) {
+            return (DEF_FALSE);
+        }
+        CPU_CRITICAL_ENTER();
+    }
+   *p_evt           = BSP_BtnEventQ[BSP_BtnEventOut];
+    BSP_BtnEventOut = (BSP_BtnEventOut + 1) & (BSP_BTN_EVENT_Q_SIZE - 1);
+    BSP_BtnEventCtr--;
+    CPU_CRITICAL_EXIT();
+    return (DEF_TRUE);
+}
+
+/*
+*********************************************************************************************************
+*                                       BSP_CNHandler_BS()
+*
+* Description: Change-notice ISR body, dispatched from the vector 26 stub in bsp_a.S.  Reads the
+*              buttons once, posts one event per debounced edge and wakes the pending task.
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_CNHandler_BS (void)
+{
+    CPU_INT08U     snapshot;
+    CPU_INT08U     changed;
+    CPU_INT08U     i;
+    CPU_INT32U     ts;
+    BSP_BTN_EVENT *p_evt;
+
+
+    BSP_IntLatRecord(BSP_INT_VECT_CN);                                  /* entry-to-handler latency */
+    snapshot  = 0;                                                      /* one read per port        */
+    if (BTN1) snapshot |= BSP_BTN1_MSK;
+    if (BTN2) snapshot |= BSP_BTN2_MSK;
+    if (BTN3) snapshot |= BSP_BTN3_MSK;
+    if (BTN4) snapshot |= BSP_BTN4_MSK;
+    mCNClearIntFlag();
+
+    ts      = ReadCoreTimer();
+    changed = snapshot ^ BSP_BtnLastState;
+    for (i = 0; i < 4; i++) {
+        CPU_INT08U msk = (CPU_INT08U)(1 << i);
+        if ((changed & msk) == 0) {
+            continue;
+        }
+        if ((ts - BSP_BtnLastTS[i]) < BSP_BTN_DEBOUNCE_CT) {            /* still bouncing -- ignore */
+            continue;
+        }
+        BSP_BtnLastTS[i]  = ts;
+        BSP_BtnLastState ^= msk;
+        if (BSP_BtnEventCtr < BSP_BTN_EVENT_Q_SIZE) {                   /* drop on overflow         */
+            p_evt        = &BSP_BtnEventQ[BSP_BtnEventIn];
+            p_evt->Btn   = msk;
+            p_evt->State = (snapshot & msk) ? 1 : 0;
+            p_evt->TS    = ts;
+            BSP_BtnEventIn = (BSP_BtnEventIn + 1) & (BSP_BTN_EVENT_Q_SIZE - 1);
+            BSP_BtnEventCtr++;
+        }
+    }
+
+    if ((BSP_BtnEventCtr > 0) && (BSP_BtnWaiterTCB != (OS_TCB *)0)) {
+        OS_ERR   err;
+        OS_TCB  *p_tcb;
+
+        p_tcb            = BSP_BtnWaiterTCB;
+        BSP_BtnWaiterTCB = (OS_TCB *)0;
+        OSTaskSemPostFromISR(p_tcb, &err);
+        BSP_IntNeedSched = 1;                                           /* ask the SRS epilogue for a reschedule */
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                       BSP_ButtonsSnapshot()
+*
+* Description: Sample every Basic Shield input in one pass.  Each PORT register involved is read
+*              exactly once (the buttons and switches span ports A, C, D, E and G) and the result
+*              is packed into a bitmask, so per-frame input sampling costs five bus accesses total
+*              instead of one volatile read per Ball_* helper.
+*
+* Arguments  : None
+*
+* Returns    : Bitmask of BSP_BTNx_MSK / BSP_SWx_MSK bits, 1 = pressed / on
+*********************************************************************************************************
+*/
+
+CPU_INT08U  BSP_ButtonsSnapshot (void)
+{
+    CPU_INT32U  port_a;
+    CPU_INT32U  port_c;
+    CPU_INT32U  port_d;
+    CPU_INT32U  port_e;
+    CPU_INT32U  port_g;
+    CPU_INT08U  snapshot;
+
+
+    port_a = PORTA;                                                     /* one read per port        */
+    port_c = PORTC;
+    port_d = PORTD;
+    port_e = PORTE;
+    port_g = PORTG;
+
+    snapshot = 0;
+    if (port_c & (1 << 14)) snapshot |= BSP_BTN1_MSK;                   /* BTN1 = RC14              */
+    if (port_g & (1 <<  1)) snapshot |= BSP_BTN2_MSK;                   /* BTN2 = RG1               */
+    if (port_a & (1 <<  6)) snapshot |= BSP_BTN3_MSK;                   /* BTN3 = RA6               */
+    if (port_a & (1 <<  7)) snapshot |= BSP_BTN4_MSK;                   /* BTN4 = RA7               */
+    if (port_e & (1 <<  8)) snapshot |= BSP_SW1_MSK;                    /* SW1  = RE8               */
+    if (port_e & (1 <<  9)) snapshot |= BSP_SW2_MSK;                    /* SW2  = RE9               */
+    if (port_d & (1 << 12)) snapshot |= BSP_SW3_MSK;                    /* SW3  = RD12              */
+    if (port_g & (1 <<  0)) snapshot |= BSP_SW4_MSK;                    /* SW4  = RG0               */
+
+    return (snapshot);
+}
+
 /*
 *********************************************************************************************************
 *                                       Tmr_Init()
@@ -266,9 +523,54 @@ static  void  BSP_IO_Init (void)
 
 void  Tmr_Init (void)
 {
-    OpenCoreTimer(BSP_TMR_RELOAD);                                            /* Initialize the Count and Compare registers */                                               
-    mConfigIntCoreTimer((CT_INT_ON | CT_INT_PRIOR_3));                        /* Enable the core timer's interrupt          */      
+#if (OS_CFG_TICKLESS_IDLE_EN > 0u) || (OS_CFG_DLY_HIGH_RES_EN > 0u)
+    OSTickReload = BSP_TMR_RELOAD;                                            /* Published for the port's Compare arithmetic*/
+#endif
+    OpenCoreTimer(BSP_TMR_RELOAD);                                            /* Initialize the Count and Compare registers */
+    mConfigIntCoreTimer((CT_INT_ON | CT_INT_PRIOR_3));                        /* Enable the core timer's interrupt          */
+}
+
+/*
+*********************************************************************************************************
+*                                       CPU_TS_TmrInit()
+*
+* Description: uC/CPU timestamp timer initialization.  The free-running MIPS core timer (Count
+*              register, SYSCLK / 2 = 40 MHz) is used as the timestamp timer; it is already started
+*              and kept running by the kernel tick (see Tmr_Init() / BSP_TickISR_Handler(), which
+*              program only the Compare register), so only the frequency needs to be published here.
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void  CPU_TS_TmrInit (void)
+{
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)(BSP_CLK_FREQ / 2));                   /* Core timer increments every 2 SYSCLK cycles*/
 }
+#endif
+
+/*
+*********************************************************************************************************
+*                                       CPU_TS_TmrRd()
+*
+* Description: Read the uC/CPU timestamp timer, i.e. the 32-bit core timer Count register.
+*
+* Arguments  : None
+*
+* Returns    : Current core timer count (wraps every ~107 seconds; see CPU_TS_Get64() for the
+*              wrap-extended 64-bit timestamp)
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return ((CPU_TS_TMR)ReadCoreTimer());
+}
+#endif
 
 /*
 *********************************************************************************************************
@@ -282,8 +584,128 @@ void  Tmr_Init (void)
 
 void  BSP_TickISR_Handler (void)
 {
+    BSP_IntLatRecord(BSP_INT_VECT_CT);                                        /* Record entry-to-handler latency            */
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+    if (OS_CPU_HighResWake() == DEF_TRUE) {                                   /* Early sub-tick wake, not a tick boundary:  */
+        mCTClearIntFlag();                                                    /* ... the port restored Compare and posted   */
+        return;                                                               /* ... the waiter, so skip tick processing    */
+    }
+#endif
     UpdateCoreTimer(BSP_TMR_RELOAD);                                          /* Prepare for the next core timer interrupt  */
     mCTClearIntFlag();                                                        /* Clear the core timer interrupt             */
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+    while (OSTickStretch > 1u) {                                              /* The Compare interval covered several ticks */
+        OSTickStretch--;                                                      /* ... deliver all but the last one here ...  */
+        OSTimeTick();
+    }
+#endif
+    OSTimeTick();                                                             /* ... and the tick that raised the interrupt */
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+    OS_CPU_HighResTickArm();                                                  /* Arm a sub-tick wake due within this tick   */
+#endif
+}
+
+/*
+*********************************************************************************************************
+*                        BSP_IntLatRecord() / BSP_IntLatGet() / BSP_IntLatReset()
+*
+* Description: Per-vector interrupt latency monitor.  The ISR prologues (bsp_a.S, and the port's
+*              CoreTimerIntHandler in os_cpu_a.S) stamp the CP0 Count register into BSP_IntEntryCount
+*              before a single register is saved; a handler that calls BSP_IntLatRecord() as its first
+*              statement therefore measures the full hardware-vectoring + context-save path in front
+*              of it.  Max, count and a log2 histogram are kept per vector so the latency DISTRIBUTION
+*              is visible, not just the worst case.
+*
+* Arguments  : vect_nbr     The interrupt vector number (BSP_INT_VECT_xxx, 0..BSP_INT_LAT_VECT_QTY-1).
+*
+*              p_max/p_cnt/p_hist_tbl
+*                           BSP_IntLatGet(): where to copy the statistics; any may be NULL.  The
+*                           histogram copy needs room for BSP_INT_LAT_HIST_SIZE entries; bucket n
+*                           counts latencies in [2^n, 2^(n+1)) core timer counts (25 nS each).
+*
+* Returns    : BSP_IntLatGet(): DEF_TRUE if the vector number is valid, DEF_FALSE otherwise.
+*
+* Note(s)    : 1) If a higher-priority interrupt preempts between the prologue stamp and the
+*                 handler's BSP_IntLatRecord() call, the delta is attributed to the preempted
+*                 vector and includes the preemption -- which is exactly the latency its handler
+*                 experienced, so no correction is attempted.
+*********************************************************************************************************
+*/
+
+void  BSP_IntLatRecord (CPU_INT08U  vect_nbr)
+{
+    BSP_INT_LAT  *p_lat;
+    CPU_INT32U    delta;
+    CPU_INT08U    bucket;
+
+
+    if (vect_nbr >= BSP_INT_LAT_VECT_QTY) {
+        return;
+    }
+    delta = ReadCoreTimer() - BSP_IntEntryCount;                          /* wrap-safe unsigned delta */
+    p_lat = &BSP_IntLatTbl[vect_nbr];
+    p_lat->Cnt++;
+    if (delta > p_lat->Max) {
+        p_lat->Max = delta;
+    }
+    bucket = 0;                                                           /* log2 bucket              */
+    while ((delta > 1u) && (bucket < (BSP_INT_LAT_HIST_SIZE - 1u))) {
+        delta >>= 1;
+        bucket++;
+    }
+    if (p_lat->HistTbl[bucket] < 0xFFFFu) {                               /* saturate, never wrap     */
+        p_lat->HistTbl[bucket]++;
+    }
+}
+
+
+CPU_BOOLEAN  BSP_IntLatGet (CPU_INT08U   vect_nbr,
+                            CPU_INT32U  *p_max,
+                            CPU_INT32U  *p_cnt,
+                            CPU_INT16U  *p_hist_tbl)
+{
+    BSP_INT_LAT  *p_lat;
+    CPU_INT08U    i;
+    CPU_SR_ALLOC();
+
+
+    if (vect_nbr >= BSP_INT_LAT_VECT_QTY) {
+        return (DEF_FALSE);
+    }
+    p_lat = &BSP_IntLatTbl[vect_nbr];
+    CPU_CRITICAL_ENTER();                                                 /* consistent snapshot      */
+    if (p_max != (CPU_INT32U *)0) {
+       *p_max = p_lat->Max;
+    }
+    if (p_cnt != (CPU_INT32U *)0) {
+       *p_cnt = p_lat->Cnt;
+    }
+    if (p_hist_tbl != (CPU_INT16U *)0) {
+        for (i = 0; i < BSP_INT_LAT_HIST_SIZE; i++) {
+            p_hist_tbl[i] = p_lat->HistTbl[i];
+        }
+    }
+    CPU_CRITICAL_EXIT();
+    return (DEF_TRUE);
+}
+
+
+void  BSP_IntLatReset (void)
+{
+    CPU_INT08U  vect;
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    for (vect = 0; vect < BSP_INT_LAT_VECT_QTY; vect++) {
+        BSP_IntLatTbl[vect].Max = 0;
+        BSP_IntLatTbl[vect].Cnt = 0;
+        for (i = 0; i < BSP_INT_LAT_HIST_SIZE; i++) {
+            BSP_IntLatTbl[vect].HistTbl[i] = 0;
+        }
+    }
+    CPU_CRITICAL_EXIT();
 }
 
 /*
@@ -320,6 +742,27 @@ void  BSP_DefaultHandler (void)
 {
 }
 
+/*
+*********************************************************************************************************
+*                                    BSP_CoreSW0ISR_Handler()
+*
+* Description: Core software interrupt 0 handler, dispatched from the full-save vector 1 stub in 
+*              bsp_a.S.  A shadow register set handler pends this interrupt after readying a task 
+*              (see bsp_a.S 'SHADOW REGISTER SET ISR MACROS'); all this handler must do is 
+*              acknowledge it -- the ISR_EPILOGUE's OSIntExit() performs the context switch.
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_CoreSW0ISR_Handler (void)
+{
+    INTClearCoreSWInt0();
+    mCS0ClearIntFlag();
+}
+
 /*
 *********************************************************************************************************
 *                                    OSProbe_TmrInit()
@@ -378,6 +821,152 @@ void  BSP_Dly (CPU_INT32U  us)
     }    
 }    
     
+/*
+*********************************************************************************************************
+*                                               BSP_DlyUs()
+*
+* Description: Busy-wait for a calibrated number of microseconds using the CP0 Count register.  Unlike
+*              BSP_Dly(), which spins on an uncalibrated NOP loop, this counts actual core timer ticks
+*              (SYSCLK / 2), so a 10uS device settling time costs 10uS -- not a whole OS tick.  The
+*              core timer keeps counting through interrupts, so preemption lengthens but never breaks
+*              the delay.
+*
+* Arguments  : us           The number of uS to delay (up to ~100 seconds before 32-bit wrap).
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_DlyUs (CPU_INT32U  us)
+{
+    CPU_INT32U  start;
+    CPU_INT32U  cnts;
+
+
+    start = ReadCoreTimer();
+    cnts  = us * BSP_US_TO_CT_CONST;
+
+    while ((CPU_INT32U)(ReadCoreTimer() - start) < cnts) {
+        ;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                   BSP_DeadlineSet() / BSP_DeadlineExpired()
+*
+* Description: Non-blocking companion to BSP_DlyUs().  BSP_DeadlineSet() arms a deadline a given number
+*              of microseconds in the future; BSP_DeadlineExpired() polls it.  Lets driver code overlap
+*              a device settling time with useful work instead of spinning or over-sleeping with a
+*              whole-tick OSTimeDly().  The unsigned Count arithmetic is wrap-safe.
+*
+* Arguments  : p_dl         The deadline to arm / poll.
+*
+*              us           BSP_DeadlineSet(): microseconds until expiry (up to ~100 seconds).
+*
+* Returns    : BSP_DeadlineExpired(): DEF_TRUE once the deadline has passed, DEF_FALSE before.
+*********************************************************************************************************
+*/
+
+void  BSP_DeadlineSet (BSP_DEADLINE  *p_dl,
+                       CPU_INT32U     us)
+{
+    p_dl->Start = ReadCoreTimer();
+    p_dl->Cnts  = us * BSP_US_TO_CT_CONST;
+}
+
+CPU_BOOLEAN  BSP_DeadlineExpired (BSP_DEADLINE  *p_dl)
+{
+    if ((CPU_INT32U)(ReadCoreTimer() - p_dl->Start) >= p_dl->Cnts) {
+        return (DEF_TRUE);
+    }
+    return (DEF_FALSE);
+}
+
+/*
+*********************************************************************************************************
+*                                            BSP_FlashCfgSet()
+*
+* Description: Program the prefetch cache module's flash wait-state and predictive prefetch settings.
+*              SYSTEMConfigPerformance() picks these once from BSP_CLK_FREQ; this gives board bring-up
+*              code an explicit knob so the fastest stable configuration can be found per board variant
+*              (verify each setting with BSP_FlashFetchBench()).
+*
+* Arguments  : wait_states    Flash wait states, 0-7 (CHECON<PFMWS>).
+*
+*              prefetch_mode  Predictive prefetch mode (CHECON<PREFEN>); one of BSP_FLASH_PREFEN_xxx.
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_FlashCfgSet (CPU_INT08U  wait_states,
+                       CPU_INT08U  prefetch_mode)
+{
+    CHECONbits.PFMWS  = wait_states;
+    CHECONbits.PREFEN = prefetch_mode;
+}
+
+/*
+*********************************************************************************************************
+*                                 BSP_FlashWaitStatesGet() / BSP_FlashPrefetchGet()
+*
+* Description: Report the prefetch cache module's current flash wait-state count (CHECON<PFMWS>) and
+*              predictive prefetch mode (CHECON<PREFEN>), i.e. whatever SYSTEMConfigPerformance() or a
+*              later BSP_FlashCfgSet() call actually programmed.
+*
+* Arguments  : None
+*
+* Returns    : The current value of the corresponding CHECON field.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  BSP_FlashWaitStatesGet (void)
+{
+    return ((CPU_INT08U)CHECONbits.PFMWS);
+}
+
+CPU_INT08U  BSP_FlashPrefetchGet (void)
+{
+    return ((CPU_INT08U)CHECONbits.PREFEN);
+}
+
+/*
+*********************************************************************************************************
+*                                           BSP_FlashFetchBench()
+*
+* Description: Time an instruction-fetch microbenchmark with the core timer: a fixed flash-resident
+*              loop of BSP_FLASH_BENCH_LOOP_NBR iterations, run with interrupts disabled.  The count
+*              moves with the wait-state/prefetch configuration, so comparing the returned value
+*              across BSP_FlashCfgSet() settings shows which configuration actually fetches fastest.
+*
+* Arguments  : None
+*
+* Returns    : Core timer counts consumed by the loop (core timer runs at BSP_CLK_FREQ / 2).
+*********************************************************************************************************
+*/
+
+#define  BSP_FLASH_BENCH_LOOP_NBR      1000u
+
+CPU_INT32U  BSP_FlashFetchBench (void)
+{
+    CPU_INT32U           ts_start;
+    CPU_INT32U           ts_end;
+    volatile CPU_INT32U  i;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    ts_start = CPU_TS_TMR_RD();
+    for (i = 0u; i < BSP_FLASH_BENCH_LOOP_NBR; i++) {
+        ;
+    }
+    ts_end   = CPU_TS_TMR_RD();
+    CPU_CRITICAL_EXIT();
+
+    return (ts_end - ts_start);
+}
+
 /*
 *********************************************************************************************************
 *                                             BSP_IntDisAll()
@@ -395,6 +984,44 @@ void  BSP_IntDisAll (void)
     INTDisableInterrupts();
 }
 
+/*
+*********************************************************************************************************
+*                                        BSP_IntVectIsSRS()
+*
+* Description: Test whether an interrupt vector enters through a shadow-register-set stub
+*              (ISR_SRS_PROLOGUE) in bsp_a.S.  The hardware selects the shadow set by PRIORITY, so
+*              only such a vector may be programmed to BSP_SRS_INT_PRIO: a priority-2 entry through a
+*              full-save stub would run ISR_PROLOGUE on the shadow set's uninitialized stack pointer.
+*              Any code that assigns BSP_SRS_INT_PRIO to a source must consult this first (see
+*              initUn() in UARTn.c, which drops unequipped ports to a full-save priority).
+*
+* Arguments  : vect         interrupt vector number, 0..63.
+*
+* Returns    : DEF_YES if bsp_a.S enters 'vect' on the shadow register set, DEF_NO otherwise.
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT08U  BSP_IntSRSVectTbl[] = {                      /* keep in step with the ISR_SRS_PROLOGUE... */
+    24u,                                                                /* ...stubs in bsp_a.S: UART1                */
+    26u,                                                                /* change notice (buttons)                   */
+    31u,                                                                /* UART2                                     */
+    36u,                                                                /* DMA0 (UART1 TX DMA)                       */
+    37u                                                                 /* DMA1 (UART1 RX DMA)                       */
+};
+
+CPU_BOOLEAN  BSP_IntVectIsSRS (CPU_INT32U  vect)
+{
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < sizeof(BSP_IntSRSVectTbl); i++) {
+        if (BSP_IntSRSVectTbl[i] == vect) {
+            return (DEF_YES);
+        }
+    }
+    return (DEF_NO);
+}
+
 /*
 *********************************************************************************************************
 *                                      BSP_InitIntCtrl()
@@ -411,6 +1038,76 @@ static  void  BSP_InitIntCtrl (void)
 {
     INTCONSET = 0x1000; 
     INTEnableSystemMultiVectoredInt();
+
+    INTMapShadowSetToPriority(BSP_SRS_INT_PRIO);                        /* Prio-2 handlers run on the shadow set...  */
+                                                                        /* ...(see bsp_a.S  SHADOW REGISTER SET...   */
+                                                                        /* ...ISR MACROS).  The mapping is GLOBAL:   */
+                                                                        /* ...only BSP_IntVectIsSRS() vectors may... */
+                                                                        /* ...be given this priority                 */
+    mCS0ClearIntFlag();                                                 /* Arm core software int 0 at the lowest...  */
+    mCS0SetIntPriority(1);                                              /* ...priority as the shadow-set handlers'   */
+    mCS0SetIntSubPriority(0);                                           /* ...reschedule relay                       */
+    mCS0IntEnable(1);
+}
+
+/*
+*********************************************************************************************************
+*                        BSP_BootMark() / BSP_BootMarkQty() / BSP_BootMarkGet()
+*
+* Description: Boot-stage timestamping.  The core timer starts counting at reset, so every mark is an
+*              absolute time-since-reset; the gaps between consecutive marks are the stage costs.  The
+*              table is static and the recorder is a table store plus one ReadCoreTimer(), so stages
+*              can be marked long before any I/O works; the report is printed by the application once
+*              UART1 is up (see APP_CFG_BOOT_PROF_RPT_EN in the Pong project).
+*
+* Arguments  : p_name       BSP_BootMark(): stage label; must point at a string that stays valid
+*                           (a literal).  Marks past BSP_BOOT_MARK_QTY are dropped.
+*
+*              ix           BSP_BootMarkGet(): mark index, 0..BSP_BootMarkQty()-1.
+*
+*              p_pname/p_count
+*                           BSP_BootMarkGet(): receive the stage label and core timer count.
+*
+* Returns    : BSP_BootMarkGet(): DEF_TRUE if 'ix' is a recorded mark, DEF_FALSE otherwise.
+*********************************************************************************************************
+*/
+
+typedef  struct  bsp_boot_mark {
+    const  CPU_CHAR  *NamePtr;
+    CPU_INT32U        Count;                                            /* core timer, counts since reset (25 nS)           */
+} BSP_BOOT_MARK;
+
+static  BSP_BOOT_MARK  BSP_BootMarkTbl[BSP_BOOT_MARK_QTY];
+static  CPU_INT08U     BSP_BootMarkCtr;
+
+
+void  BSP_BootMark (const CPU_CHAR  *p_name)
+{
+    if (BSP_BootMarkCtr >= BSP_BOOT_MARK_QTY) {
+        return;
+    }
+    BSP_BootMarkTbl[BSP_BootMarkCtr].NamePtr = p_name;
+    BSP_BootMarkTbl[BSP_BootMarkCtr].Count   = ReadCoreTimer();
+    BSP_BootMarkCtr++;
+}
+
+
+CPU_INT08U  BSP_BootMarkQty (void)
+{
+    return (BSP_BootMarkCtr);
+}
+
+
+CPU_BOOLEAN  BSP_BootMarkGet (CPU_INT08U        ix,
+                              const CPU_CHAR  **p_pname,
+                              CPU_INT32U       *p_count)
+{
+    if (ix >= BSP_BootMarkCtr) {
+        return (DEF_FALSE);
+    }
+   *p_pname = BSP_BootMarkTbl[ix].NamePtr;
+   *p_count = BSP_BootMarkTbl[ix].Count;
+    return (DEF_TRUE);
 }
 
 /*
@@ -427,8 +1124,10 @@ static  void  BSP_InitIntCtrl (void)
 
 void  BSP_InitIO (void)    
 {
+    BSP_BootMark("bsp io");
                                                                         /* Enable optimal performance                       */
     SYSTEMConfigPerformance(BSP_CLK_FREQ);
+    BSP_BootMark("cfg perf");                                           /* SYSTEMConfigPerformance() alone                  */
     mOSCSetPBDIV(0);                                                    /* Use 1:1 CPU Core:Peripheral clocks               */
 
 #if JTAG_ENABLE 
@@ -91,22 +91,126 @@
 
 
 
+// ***************************************************************************
+// Shadow register set interrupts
+//   BSP_InitIntCtrl() maps interrupt priority BSP_SRS_INT_PRIO to the
+//   PIC32MX's shadow register set, so the handlers that run at that
+//   priority (UART1, UART1 DMA and the CN buttons) skip the ~30-register
+//   save/restore of ISR_PROLOGUE/ISR_EPILOGUE in bsp_a.S.  Such a handler
+//   cannot context switch itself; when it readies a task it sets
+//   BSP_IntNeedSched and the epilogue pends core software interrupt 0,
+//   whose full-save handler (BSP_CoreSW0ISR_Handler + OSIntExit) performs
+//   the switch as soon as the shadow-set handler erets.
+//   BSP_SRS_INT_PRIO must stay below the kernel tick priority (3) and
+//   must not be shared with any full-save (ISR_PROLOGUE) vector: the
+//   hardware picks the shadow set by PRIORITY alone, so a priority-2
+//   entry through a full-save stub pushes context onto the shadow set's
+//   uninitialized stack pointer.  BSP_IntVectIsSRS() is the list of
+//   vectors with shadow-set stubs; any code assigning BSP_SRS_INT_PRIO
+//   to a source must check it first (see initUn() in UARTn.c).
+// ***************************************************************************
+#define BSP_SRS_INT_PRIO            2
+
+extern volatile CPU_INT08U BSP_IntNeedSched;    // set by shadow-set ISR bodies after an OS post
+
+CPU_BOOLEAN  BSP_IntVectIsSRS (CPU_INT32U  vect);   // does 'vect' enter on the shadow register set?
+
+                                                /* ------------- INTERRUPT LATENCY MONITOR ---------- */
+#define BSP_INT_LAT_VECT_QTY    64u             /* PIC32MX795 has vectors 0..63                       */
+#define BSP_INT_LAT_HIST_SIZE   16u             /* log2 buckets of core timer counts (25 nS)          */
+
+#define BSP_INT_VECT_CT          0u             /* core timer (kernel tick)                           */
+#define BSP_INT_VECT_CN         26u             /* change notice (Basic Shield buttons)               */
+
+extern volatile CPU_INT32U BSP_IntEntryCount;   // CP0 Count stamped by the ISR prologues (bsp_a.S)
+
+// ***************************************************************************
+// Change-notice button events
+//   BTN1 (RC14) is CN0-capable on the Max32/Basic Shield wiring, so a press
+//   raises a CN interrupt; the ISR then snapshots all four buttons, debounces
+//   and posts one timestamped event per changed button to a small ring.
+//   A single task may pend on events with BSP_BtnEventGet().
+// ***************************************************************************
+#define BSP_BTN_EVENT_Q_SIZE        8           // must be a power of two
+#define BSP_BTN_DEBOUNCE_MS        20           // per-button dead time
+#define BSP_CN_INT_PRIO             BSP_SRS_INT_PRIO    // buttons ride the shadow set
+
+#define BSP_BTN1_MSK             0x01
+#define BSP_BTN2_MSK             0x02
+#define BSP_BTN3_MSK             0x04
+#define BSP_BTN4_MSK             0x08
+#define BSP_SW1_MSK              0x10
+#define BSP_SW2_MSK              0x20
+#define BSP_SW3_MSK              0x40
+#define BSP_SW4_MSK              0x80
+
+typedef struct {
+    CPU_INT08U  Btn;                            /* BSP_BTNx_MSK of the button that changed      */
+    CPU_INT08U  State;                          /* 1 = pressed, 0 = released                    */
+    CPU_INT32U  TS;                             /* core timer value at capture                  */
+} BSP_BTN_EVENT;
+
+typedef struct {
+    CPU_INT32U  Start;                          /* core timer value when the deadline was armed */
+    CPU_INT32U  Cnts;                           /* core timer ticks until expiry                */
+} BSP_DEADLINE;
+
+
 /*
 *********************************************************************************************************
 *                                             PROTOTYPES
 *********************************************************************************************************
-*/    
+*/
+
+void        BSP_BtnIntInit      (void);
+CPU_BOOLEAN BSP_BtnEventGet     (BSP_BTN_EVENT *p_evt, OS_TICK timeout);
+void        BSP_CNHandler_BS    (void);
+
+CPU_INT08U  BSP_ButtonsSnapshot (void);
 
 void        LED_Toggle          (CPU_INT08U led);
+void        BSP_LEDPatternWrite (CPU_INT08U pattern);
 void        LED_Off             (CPU_INT08U led);
 void        LED_On              (CPU_INT08U led);
 
 void        BSP_TickISR_Handler (void);
+void        BSP_IntLatRecord    (CPU_INT08U vect_nbr);
+CPU_BOOLEAN BSP_IntLatGet       (CPU_INT08U vect_nbr,
+                                 CPU_INT32U *p_max,
+                                 CPU_INT32U *p_cnt,
+                                 CPU_INT16U *p_hist_tbl);
+void        BSP_IntLatReset     (void);
+
+                                                /* --------------- BOOT-STAGE TIMESTAMPS ------------ */
+#define BSP_BOOT_MARK_QTY       16u
+
+void        BSP_BootMark        (const CPU_CHAR *p_name);
+CPU_INT08U  BSP_BootMarkQty     (void);
+CPU_BOOLEAN BSP_BootMarkGet     (CPU_INT08U ix,
+                                 const CPU_CHAR **p_pname,
+                                 CPU_INT32U *p_count);
 void        BSP_Except_Handler  (void);
+void        BSP_CoreSW0ISR_Handler (void);
 
 void        BSP_InitIO          (void);
 void        BSP_IntDisableALL   (void);
 
 void        BSP_Dly             (CPU_INT32U  us);
+void        BSP_DlyUs           (CPU_INT32U  us);
+void        BSP_DeadlineSet     (BSP_DEADLINE *p_dl, CPU_INT32U us);
+CPU_BOOLEAN BSP_DeadlineExpired (BSP_DEADLINE *p_dl);
+
+/* ------------------- Prefetch cache / flash wait states ------------------- */
+/* Predictive prefetch modes for BSP_FlashCfgSet() (CHECON<PREFEN>)           */
+#define  BSP_FLASH_PREFEN_DIS            0      /* Predictive prefetch disabled                  */
+#define  BSP_FLASH_PREFEN_CACHEABLE      1      /* Prefetch cacheable regions only               */
+#define  BSP_FLASH_PREFEN_NON_CACHEABLE  2      /* Prefetch non-cacheable regions only           */
+#define  BSP_FLASH_PREFEN_ALL            3      /* Prefetch cacheable & non-cacheable regions    */
+
+void        BSP_FlashCfgSet        (CPU_INT08U  wait_states,
+                                    CPU_INT08U  prefetch_mode);
+CPU_INT08U  BSP_FlashWaitStatesGet (void);
+CPU_INT08U  BSP_FlashPrefetchGet   (void);
+CPU_INT32U  BSP_FlashFetchBench    (void);
 
 
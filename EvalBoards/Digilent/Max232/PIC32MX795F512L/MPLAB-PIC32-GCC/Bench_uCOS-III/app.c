@@ -0,0 +1,652 @@
+/**************************************************************************
+ * File:         app.c       uCOS-III kernel microbenchmark suite
+ * Date:         August 2013
+ * Status:       functional
+ * Processor:	 PIC32MX795F512L
+ * Toolchain:	 MPLAB-X
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	Measures the kernel primitives this port leans on and
+ *		prints a results table over UART1 (TeraTerm or PuTTY):
+ *		  - timer read overhead (subtract this from the others)
+ *		  - semaphore ping-pong between two tasks (2 context switches)
+ *		  - OSSemPost/OSSemPend round trip, no task switch
+ *		  - OSQPost/OSQPend round trip, no task switch
+ *		  - OSTimeDly(1) wakeup period as seen by the task
+ *		  - OSTaskCreate() cost
+ *		  - tick interrupt to task-resume latency (via the time
+ *		    tick hook in os_app_hooks.c)
+ *		All figures are core timer ticks: SYSCLK / 2, i.e. 40 MHz
+ *		(25 ns) with the stock 80 MHz configuration in bsp.h.
+ *
+ *		Run this before and after touching the kernel, the port,
+ *		or the BSP -- it is the baseline every optimization is
+ *		judged against.
+ *
+ * Notes:
+ *       bsp.c holds pragma config
+ *       uart1.h holds BAUD_RATE 115200
+ *       os_cfg.h enables OS_CFG_SEM_EN / OS_CFG_Q_EN for this project
+ **************************************************************************/
+#include <includes.h>
+#include <os_app_hooks.h>
+#if APP_CFG_TRACE_EN > 0u
+#include "app_trace.h"
+#include "app_shell.h"
+#endif
+
+/*
+ *******************************************************************************
+ *                                                Task Stacks/TCB
+ *******************************************************************************
+ */
+
+#define TASK_STK_SIZE 512
+
+#define APP_CFG_TASK_ECHO_STK_SIZE              TASK_STK_SIZE
+#define APP_CFG_TASK_DUMMY_STK_SIZE             128
+
+#define APP_CFG_TASK_STK_SIZE_PCT_FULL          90u
+#define APP_CFG_TASK_ECHO_STK_SIZE_LIMIT        (APP_CFG_TASK_ECHO_STK_SIZE * (100u - APP_CFG_TASK_STK_SIZE_PCT_FULL)) / 100u
+#define APP_CFG_TASK_DUMMY_STK_SIZE_LIMIT       (APP_CFG_TASK_DUMMY_STK_SIZE * (100u - APP_CFG_TASK_STK_SIZE_PCT_FULL)) / 100u
+
+static OS_TCB App_TaskStartTCB;
+static CPU_STK App_TaskStartStk[APP_CFG_TASK_START_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;
+
+static OS_TCB App_TaskEchoTCB;
+static CPU_STK App_TaskEchoStk[APP_CFG_TASK_ECHO_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;    // benchmark tasks: keep the
+
+static OS_TCB App_TaskDummyTCB;
+static CPU_STK App_TaskDummyStk[APP_CFG_TASK_DUMMY_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;  // create-time fixup a no-op
+
+/*
+ *******************************************************************************
+ *                                            Task PROTOTYPES
+ *******************************************************************************
+ */
+
+static void App_TaskStart(void *p_arg);
+static void App_TaskEcho(void *p_arg);
+static void App_TaskDummy(void *p_arg);
+
+/*
+ *******************************************************************************
+ *                                            Task Priorities
+ *******************************************************************************
+ */
+
+#define APP_CFG_TASK_ECHO_PRIO          2   // just below the start task
+#define APP_CFG_TASK_DUMMY_PRIO         3   // never runs: created and deleted while suspended below us
+
+/*
+ *******************************************************************************
+ *                                            Kernel objects
+ *******************************************************************************
+ */
+
+#define BENCH_Q_SIZE        4
+
+static OS_SEM Bench_SemGo;      // start task -> echo task
+static OS_SEM Bench_SemEcho;    // echo task -> start task
+static OS_SEM Bench_Sem;        // same-task post/pend round trip
+static OS_SEM Bench_TickSem;    // posted from the time tick hook
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+static OS_SEM Bench_IntQSem;    // burst-posted from the tick hook for the ISR queue sweep
+#endif
+static OS_Q Bench_Q;            // same-task post/pend round trip
+static OS_MSG Bench_QMsgTbl[BENCH_Q_SIZE]; // message storage for Bench_Q
+
+static volatile CPU_TS_TMR Bench_TickTs; // core timer at tick-hook entry
+
+// ***************************************************************************
+// Per-benchmark statistics
+//   Every iteration is timed individually so the table shows min (the
+//   uncontended hot path), avg, and max (the tail the tick interrupt or
+//   a cache refill adds).
+// ***************************************************************************
+typedef struct {
+    CPU_INT32U Min;
+    CPU_INT32U Max;
+    CPU_INT32U Total;
+    CPU_INT32U Cnt;
+} BENCH_STATS;
+
+static void Bench_StatsInit(BENCH_STATS *p_stats) {
+    p_stats->Min = 0xFFFFFFFFu;
+    p_stats->Max = 0u;
+    p_stats->Total = 0u;
+    p_stats->Cnt = 0u;
+}
+
+static void Bench_StatsUpdate(BENCH_STATS *p_stats, CPU_INT32U val) {
+    if (val < p_stats->Min) {
+        p_stats->Min = val;
+    }
+    if (val > p_stats->Max) {
+        p_stats->Max = val;
+    }
+    p_stats->Total += val;
+    p_stats->Cnt++;
+}
+
+/*
+ *********************************************************************************************************
+ *                                                main()
+ *
+ * Description : This is the standard entry point for C code.
+ *
+ * Arguments   : none
+ *********************************************************************************************************
+ */
+
+int main(void) {
+
+    OS_ERR os_err;
+
+    CPU_Init(); /* Initialize the uC/CPU services  */
+
+    BSP_IntDisAll();
+
+    OSInit(&os_err); /* Init uC/OS-III.                  */
+
+    App_OS_SetAllHooks(); /* Tick hook feeds the interrupt latency benchmark */
+
+#if APP_CFG_TRACE_EN > 0u
+    AppTrace_Init(); /* Trace ring ready; recording starts after the suite */
+#endif
+
+    OSSemCreate(&Bench_SemGo, "Bench Go", 0, &os_err);
+    OSSemCreate(&Bench_SemEcho, "Bench Echo", 0, &os_err);
+    OSSemCreate(&Bench_Sem, "Bench Sem", 0, &os_err);
+    OSSemCreate(&Bench_TickSem, "Bench Tick", 0, &os_err);
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    OSSemCreate(&Bench_IntQSem, "Bench IntQ", 0, &os_err);
+#endif
+    OSQCreate(&Bench_Q, "Bench Q", (OS_MSG_QTY) BENCH_Q_SIZE,
+            &Bench_QMsgTbl[0], (OS_MSG_QTY) BENCH_Q_SIZE, &os_err);
+
+    // app_cfg.h holds priority, stack size, and limit for start task
+    OSTaskCreate((OS_TCB *) & App_TaskStartTCB, /* Create the start task            */
+            (CPU_CHAR *) "Start",
+            (OS_TASK_PTR) App_TaskStart,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_START_PRIO,
+            (CPU_STK *) & App_TaskStartStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_START_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_START_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & os_err);
+
+    OSStart(&os_err); /* Start multitasking (i.e. give control to uC/OS-III). */
+    /* Should not return here as RTOS takes control */
+    (void) &os_err;
+
+    return (0);
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* UART output helpers */
+// *********************************************************************
+
+// Prints an unsigned base 10 number without leading zeroes
+
+static void UART_PrintNumU32(CPU_INT32U v) {
+    char buf[10]; // 4294967295 is 10 digits
+    int n = 0;
+
+    do {
+        buf[n++] = (char) (v % 10u + '0');
+        v /= 10u;
+    } while (v > 0u);
+    while (n > 0) {
+        putU1(buf[--n]);
+    }
+}
+
+// Prints an unsigned number right-aligned in a 9 character column
+
+static void Bench_PrintCol(CPU_INT32U v) {
+    CPU_INT32U tmp = v;
+    int digits = 1;
+
+    while (tmp >= 10u) {
+        tmp /= 10u;
+        digits++;
+    }
+    while (digits < 9) {
+        putU1(' ');
+        digits++;
+    }
+    UART_PrintNumU32(v);
+}
+
+// Prints one table row: name padded to 28 columns, then min / avg / max
+
+static void Bench_PrintRow(const char *name, BENCH_STATS *p_stats) {
+    int n = 0;
+
+    putsU1("  ");
+    while (name[n] != '\0') {
+        putU1(name[n]);
+        n++;
+    }
+    while (n < 28) {
+        putU1(' ');
+        n++;
+    }
+    Bench_PrintCol(p_stats->Min);
+    Bench_PrintCol(p_stats->Total / p_stats->Cnt);
+    Bench_PrintCol(p_stats->Max);
+    putsU1("\r\n");
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Benchmarks */
+// *********************************************************************
+
+// Cost of the measurement itself: two back-to-back core timer reads.
+// Subtract the avg of this row from every other row.
+
+static void Bench_TmrOverhead(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR t0, t1;
+    CPU_INT32U i;
+
+    Bench_StatsInit(&stats);
+    for (i = 0; i < APP_CFG_BENCH_ITER; i++) {
+        t0 = CPU_TS_TMR_RD();
+        t1 = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (t1 - t0));
+    }
+    Bench_PrintRow("timer read overhead", &stats);
+}
+
+// Semaphore ping-pong with the echo task.  Each iteration blocks on
+// Bench_SemEcho (switch to the echo task) and is preempted back when the
+// echo task posts it, so one round trip is two full context switches
+// plus two posts and two pends.
+
+static void Bench_CtxSw(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR t0, t1;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    Bench_StatsInit(&stats);
+    for (i = 0; i < APP_CFG_BENCH_ITER; i++) {
+        t0 = CPU_TS_TMR_RD();
+        OSSemPost(&Bench_SemGo, OS_OPT_POST_1, &err);
+        OSSemPend(&Bench_SemEcho, (OS_TICK) 0, OS_OPT_PEND_BLOCKING,
+                (CPU_TS *) 0, &err);
+        t1 = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (t1 - t0));
+    }
+    Bench_PrintRow("sem ping-pong (2 ctx sw)", &stats);
+}
+
+// OSSemPost() then OSSemPend() from the same task.  The count is
+// available when the pend runs, so this is the post + pend hot path
+// with no task switch.
+
+static void Bench_SemRoundTrip(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR t0, t1;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    Bench_StatsInit(&stats);
+    for (i = 0; i < APP_CFG_BENCH_ITER; i++) {
+        t0 = CPU_TS_TMR_RD();
+        OSSemPost(&Bench_Sem, OS_OPT_POST_1, &err);
+        OSSemPend(&Bench_Sem, (OS_TICK) 0, OS_OPT_PEND_BLOCKING,
+                (CPU_TS *) 0, &err);
+        t1 = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (t1 - t0));
+    }
+    Bench_PrintRow("sem post+pend, no switch", &stats);
+}
+
+// OSQPost() then OSQPend() from the same task, message already queued
+// when the pend runs.
+
+static void Bench_QRoundTrip(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR t0, t1;
+    CPU_INT32U i;
+    OS_MSG_SIZE msg_size;
+    OS_ERR err;
+
+    Bench_StatsInit(&stats);
+    for (i = 0; i < APP_CFG_BENCH_ITER; i++) {
+        t0 = CPU_TS_TMR_RD();
+        OSQPost(&Bench_Q, (void *) &Bench_Q, (OS_MSG_SIZE) 0,
+                OS_OPT_POST_FIFO, &err);
+        (void) OSQPend(&Bench_Q, (OS_TICK) 0, OS_OPT_PEND_BLOCKING,
+                &msg_size, (CPU_TS *) 0, &err);
+        t1 = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (t1 - t0));
+    }
+    Bench_PrintRow("q post+pend, no switch", &stats);
+}
+
+// Period between successive OSTimeDly(1) wakeups as seen by the task.
+// With a perfect tick and instant resume every delta equals the tick
+// reload (BSP_CLK_FREQ / (2 * OS_CFG_TICK_RATE_HZ) core timer ticks);
+// the min/max spread is the wakeup jitter.
+
+static void Bench_DlyJitter(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR prev, now;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    Bench_StatsInit(&stats);
+    OSTimeDly((OS_TICK) 1, OS_OPT_TIME_DLY, &err); // align to a tick edge
+    prev = CPU_TS_TMR_RD();
+    for (i = 0; i < APP_CFG_BENCH_TICK_ITER; i++) {
+        OSTimeDly((OS_TICK) 1, OS_OPT_TIME_DLY, &err);
+        now = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (now - prev));
+        prev = now;
+    }
+    Bench_PrintRow("dly(1) wakeup period", &stats);
+    putsU1("    (nominal tick period: ");
+    UART_PrintNumU32((CPU_INT32U) (BSP_CLK_FREQ / (2 * OS_CFG_TICK_RATE_HZ)));
+    putsU1(")\r\n");
+}
+
+// OSTaskCreate() cost.  The dummy task sits below the start task's
+// priority so it never runs before OSTaskDel() removes it again; the
+// delete is outside the timed window.
+
+static void Bench_TaskCreate(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR t0, t1;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    Bench_StatsInit(&stats);
+    for (i = 0; i < APP_CFG_BENCH_TICK_ITER; i++) {
+        t0 = CPU_TS_TMR_RD();
+        OSTaskCreate((OS_TCB *) & App_TaskDummyTCB,
+                (CPU_CHAR *) "Dummy",
+                (OS_TASK_PTR) App_TaskDummy,
+                (void *) 0,
+                (OS_PRIO) APP_CFG_TASK_DUMMY_PRIO,
+                (CPU_STK *) & App_TaskDummyStk[0],
+                (CPU_STK_SIZE) APP_CFG_TASK_DUMMY_STK_SIZE_LIMIT,
+                (CPU_STK_SIZE) APP_CFG_TASK_DUMMY_STK_SIZE,
+                (OS_MSG_QTY) 0u,
+                (OS_TICK) 0u,
+                (void *) 0,
+                (OS_OPT) 0u,
+                (OS_ERR *) & err);
+        t1 = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (t1 - t0));
+        OSTaskDel(&App_TaskDummyTCB, &err);
+    }
+    Bench_PrintRow("OSTaskCreate", &stats);
+}
+
+// Tick interrupt to task-resume latency.  The time tick hook (ISR
+// context, dispatched through App_TimeTickHookFnctPtr in os_app_hooks.c)
+// timestamps the tick and posts Bench_TickSem; the delta read here spans
+// the remaining tick processing, the post, and the context switch back
+// to this task.
+
+static void Bench_TickHook(void) {
+    OS_ERR err;
+
+    Bench_TickTs = CPU_TS_TMR_RD();
+    OSSemPost(&Bench_TickSem, OS_OPT_POST_1, &err);
+}
+
+static void Bench_IntLatency(void) {
+    BENCH_STATS stats;
+    CPU_TS_TMR t1;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    Bench_StatsInit(&stats);
+    App_TimeTickHookFnctPtr = Bench_TickHook;
+    for (i = 0; i < APP_CFG_BENCH_TICK_ITER; i++) {
+        OSSemPend(&Bench_TickSem, (OS_TICK) 0, OS_OPT_PEND_BLOCKING,
+                (CPU_TS *) 0, &err);
+        t1 = CPU_TS_TMR_RD();
+        Bench_StatsUpdate(&stats, (CPU_INT32U) (t1 - Bench_TickTs));
+    }
+    App_TimeTickHookFnctPtr = (void (*)(void)) 0;
+    Bench_PrintRow("tick ISR to task resume", &stats);
+}
+
+// Message pool and queue depth telemetry: the OS_MSG pool watermark
+// (OSMsgPoolStatGet) says what OS_CFG_MSG_POOL_SIZE really needs to be,
+// and the per-queue peak depths (OSQDbgStatNext over the kernel's debug
+// list) do the same for each queue's max_qty -- measured, not guessed.
+
+static void Bench_QTelemetry(void) {
+    OS_MSG_QTY nbr_free;
+    OS_MSG_QTY nbr_used;
+    OS_MSG_QTY nbr_used_max;
+    OS_MSG_QTY entries;
+    OS_MSG_QTY entries_max;
+    CPU_CHAR *q_name;
+    OS_Q *p_q;
+    OS_ERR err;
+
+    OSMsgPoolStatGet(&nbr_free, &nbr_used, &nbr_used_max, &err);
+    putsU1("  msg pool: free=");
+    UART_PrintNumU32((CPU_INT32U) nbr_free);
+    putsU1(" used=");
+    UART_PrintNumU32((CPU_INT32U) nbr_used);
+    putsU1(" peak=");
+    UART_PrintNumU32((CPU_INT32U) nbr_used_max);
+    putsU1("\r\n");
+
+    p_q = OSQDbgStatNext((OS_Q *) 0, &q_name, &entries, &entries_max, &err);
+    while (p_q != (OS_Q *) 0) {
+        putsU1("  q \"");
+        putsU1(q_name);
+        putsU1("\": depth=");
+        UART_PrintNumU32((CPU_INT32U) entries);
+        putsU1(" peak=");
+        UART_PrintNumU32((CPU_INT32U) entries_max);
+        putsU1("\r\n");
+        p_q = OSQDbgStatNext(p_q, &q_name, &entries, &entries_max, &err);
+    }
+}
+
+// ISR post queue characterization (deferred-post mode only).  The time
+// tick hook fires a burst of B semaphore posts from ISR context; with
+// OS_CFG_ISR_POST_DEFERRED_EN each lands in the OSIntQ ring, so the ring
+// holds about B entries (plus the tick itself) until the drain task
+// catches up.  Sweeping B against the queue's peak depth, near-full
+// count (>= 3/4 full), and overflow count turns OS_CFG_INT_Q_SIZE from a
+// guess into a measurement: the knee is the first burst that trips the
+// near-full counter, and any overflow means posts were silently lost
+// (delivered < burst shows it from the receiving side).
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+static volatile CPU_INT32U Bench_IntQBurst; // posts per tick-hook burst
+static volatile CPU_BOOLEAN Bench_IntQArm;  // one burst per arming
+
+static void Bench_IntQBurstHook(void) {
+    CPU_INT32U i;
+    OS_ERR err;
+
+    if (Bench_IntQArm) {
+        for (i = 0; i < Bench_IntQBurst; i++) {
+            OSSemPost(&Bench_IntQSem, OS_OPT_POST_1, &err);
+        }
+        Bench_IntQArm = DEF_FALSE;
+    }
+}
+
+static void Bench_IntQSweep(void) {
+    static const CPU_INT32U burst_tbl[] = {1, 2, 4, 8, 12, 16};
+    CPU_INT32U b, i, delivered;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    putsU1("  ISR post queue sweep, OS_CFG_INT_Q_SIZE=");
+    UART_PrintNumU32((CPU_INT32U) OSCfg_IntQSize);
+    putsU1("\r\n");
+    App_TimeTickHookFnctPtr = Bench_IntQBurstHook;
+    for (b = 0; b < sizeof (burst_tbl) / sizeof (burst_tbl[0]); b++) {
+        CPU_CRITICAL_ENTER(); // fresh telemetry for this burst size
+        OSIntQMaxNbrEntries = (OS_OBJ_QTY) 0;
+        OSIntQNearFullCtr = (OS_OBJ_QTY) 0;
+        OSIntQOvfCtr = (OS_OBJ_QTY) 0;
+        CPU_CRITICAL_EXIT();
+
+        Bench_IntQBurst = burst_tbl[b];
+        Bench_IntQArm = DEF_TRUE;
+        delivered = 0;
+        for (i = 0; i < burst_tbl[b]; i++) { // drain what survived
+            OSSemPend(&Bench_IntQSem, (OS_TICK) 2, OS_OPT_PEND_BLOCKING,
+                    (CPU_TS *) 0, &err);
+            if (err != OS_ERR_NONE) {
+                break; // timeout: the rest of the burst was lost
+            }
+            delivered++;
+        }
+
+        putsU1("    burst=");
+        UART_PrintNumU32(burst_tbl[b]);
+        putsU1(" delivered=");
+        UART_PrintNumU32(delivered);
+        putsU1(" peak=");
+        UART_PrintNumU32((CPU_INT32U) OSIntQMaxNbrEntries);
+        putsU1(" nearfull=");
+        UART_PrintNumU32((CPU_INT32U) OSIntQNearFullCtr);
+        putsU1(" ovf=");
+        UART_PrintNumU32((CPU_INT32U) OSIntQOvfCtr);
+        putsU1("\r\n");
+    }
+    App_TimeTickHookFnctPtr = (void (*)(void)) 0;
+}
+#endif
+
+/*$PAGE*/
+
+/*
+ *********************************************************************************************************
+ *                                          STARTUP TASK
+ *
+ * Description : Runs the whole suite once, prints the table, then idles
+ *               blinking an LED so the board is visibly alive.
+ * Arguments   : p_arg   is the argument passed to 'AppStartTask()' by 'OSTaskCreate()'.
+ *********************************************************************************************************
+ */
+
+static void App_TaskStart(void *p_arg) {
+    OS_ERR err;
+
+    (void) p_arg;
+
+    BSP_InitIO(); /* Initialize BSP functions                                 */
+
+    initU1(); // Initialize UART1
+
+    OSTaskCreate((OS_TCB *) & App_TaskEchoTCB, /* Create the ping-pong partner */
+            (CPU_CHAR *) "Echo",
+            (OS_TASK_PTR) App_TaskEcho,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_ECHO_PRIO,
+            (CPU_STK *) & App_TaskEchoStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_ECHO_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_ECHO_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & err);
+
+    if (err != OS_ERR_NONE) {
+        putsU1("Error starting Echo task ");
+    }
+
+    OSTimeDlyHMSM(0, 0, 1, 0, OS_OPT_TIME_HMSM_STRICT, &err); // let the terminal connect
+
+    putsU1("\r\nuC/OS-III microbenchmarks, core timer ticks (SYSCLK/2 = 25 ns)\r\n");
+    putsU1("  benchmark                       min      avg      max\r\n");
+
+    Bench_TmrOverhead();
+    Bench_CtxSw();
+    Bench_SemRoundTrip();
+    Bench_QRoundTrip();
+    Bench_DlyJitter();
+    Bench_TaskCreate();
+    Bench_IntLatency();
+
+    Bench_QTelemetry();
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    Bench_IntQSweep();
+#endif
+
+    putsU1("done\r\n");
+
+#if APP_CFG_SHELL_EN > 0u
+    // The shell owns UART1 from here: interactive 'run <bench>' commands
+    // against the registered uC/LIB microbenchmarks (see app_shell.h).
+    AppShell_Init();
+    AppShell_TaskCreate(APP_CFG_TASK_SHELL_PRIO);
+#elif APP_CFG_TRACE_EN > 0u
+    // From here on the UART carries framed binary trace records (see
+    // app_trace.h): task switches, ticks, and task create/delete events
+    // stream out while the board idles, for offline timeline tools.
+    AppTrace_TaskCreate(APP_CFG_TASK_TRACE_PRIO);
+#if APP_CFG_TRACE_TRIG_EN > 0u
+    // Triggered capture: the ring holds only the latest window and
+    // freezes when the kernel reports a late timed wakeup or an
+    // over-long scheduler lock; the frozen window then streams out
+    // once as an offline-analyzable snapshot.
+    AppTrace_TrigArm();
+#else
+    AppTrace_Start();
+#endif
+#endif
+
+    while (DEF_TRUE) { /* Task body, always written as an infinite loop.            */
+        LED_Toggle(1);
+        OSTimeDly(OS_MS_TO_TICKS(500), OS_OPT_TIME_DLY, &err); /* constant-folded, no per-call conversion */
+    }
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Application Tasks */
+// *********************************************************************
+
+// Ping-pong partner: echoes every Bench_SemGo post back on Bench_SemEcho.
+
+static void App_TaskEcho(void *p_arg) {
+    OS_ERR err;
+
+    (void) p_arg;
+    while (DEF_TRUE) {
+        OSSemPend(&Bench_SemGo, (OS_TICK) 0, OS_OPT_PEND_BLOCKING,
+                (CPU_TS *) 0, &err);
+        OSSemPost(&Bench_SemEcho, OS_OPT_POST_1, &err);
+    }
+}
+
+// Created and deleted by Bench_TaskCreate() below the start task's
+// priority -- this body never executes.
+
+static void App_TaskDummy(void *p_arg) {
+    OS_ERR err;
+
+    (void) p_arg;
+    while (DEF_TRUE) {
+        OSTimeDly((OS_TICK) 1, OS_OPT_TIME_DLY, &err);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                          (c) Copyright 2004-2010; Micrium, Inc.; Weston, FL               
+*
+*               All rights reserved.  Protected by international copyright laws.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       APPLICATION CONFIGURATION
+*
+*
+* Filename      : app_cfg.h
+* Version       : V1.00
+* Programmer(s) : FT
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_MODULE_PRESENT
+#define  APP_CFG_MODULE_PRESENT
+
+#include <lib_cfg.h>
+
+/*
+*********************************************************************************************************
+*                                        BENCHMARK CONFIGURATION
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_BENCH_ITER                             1000u  /* Iterations for the CPU-bound benchmarks             */
+#define  APP_CFG_BENCH_TICK_ITER                          32u  /* Iterations for the tick-paced benchmarks            */
+
+                                                               /* Stream binary scheduling/IPC trace records over ... */
+#define  APP_CFG_TRACE_EN                                  1u  /* ... UART1 after the suite (see app_trace.h)         */
+
+                                                               /* Triggered capture instead of streaming: freeze the  */
+                                                               /* ... trace ring when a kernel anomaly trigger fires  */
+#define  APP_CFG_TRACE_TRIG_EN                             0u  /* ... and dump it once as a snapshot (see app_trace.h)*/
+
+                                                               /* Start the interactive benchmark shell after the     */
+                                                               /* ... suite (see app_shell.h).  The shell and the     */
+#define  APP_CFG_SHELL_EN                                  0u  /* ... trace stream both own UART1: enable only one    */
+
+
+/*
+*********************************************************************************************************
+*                                            TASK PRIORITIES
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_PRIO                           1u
+
+
+/*
+*********************************************************************************************************
+*                                            TASK STACK SIZES
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_STK_SIZE                     384u //256u // mjb 512u
+
+
+
+/*
+*********************************************************************************************************
+*                                            TASK STACK SIZES LIMIT
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_STK_SIZE_PCT_FULL             90u
+
+#define  APP_CFG_TASK_START_STK_SIZE_LIMIT       (APP_CFG_TASK_START_STK_SIZE * (100u - APP_CFG_TASK_START_STK_SIZE_PCT_FULL))   / 100u
+
+#endif
+
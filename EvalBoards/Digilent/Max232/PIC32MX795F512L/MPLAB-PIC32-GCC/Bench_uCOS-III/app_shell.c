@@ -0,0 +1,389 @@
+/**************************************************************************
+ * File:         app_shell.c  Resident microbenchmark shell
+ * Processor:	 PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	See app_shell.h.  The built-in benchmarks cover the uC/LIB
+ *		routines we keep rewriting (Mem_Copy, Mem_Clr, Str_Len,
+ *		Str_FmtNbr_Int32U); application code can add its own with
+ *		APP_SHELL_BENCH_REG() before AppShell_TaskCreate().
+ **************************************************************************/
+#include <includes.h>
+#include "app_shell.h"
+
+/*
+ *******************************************************************************
+ *                                            Local variables
+ *******************************************************************************
+ */
+
+typedef struct {
+    const char *Name;
+    APP_SHELL_BENCH_FNCT Fnct;
+} APP_SHELL_BENCH;
+
+static APP_SHELL_BENCH AppShell_BenchTbl[APP_SHELL_BENCH_MAX];
+static CPU_INT08U AppShell_BenchQty;
+
+static CPU_INT32U AppShell_Samples[APP_SHELL_RUNS_MAX];
+static CPU_INT32U AppShell_CallOverhead;   // cycles the harness itself costs per call
+
+static volatile CPU_INT32U AppShell_Sink;  // benchmark results land here, so the
+                                           // ... compiler cannot delete the work
+
+#define APP_CFG_TASK_SHELL_STK_SIZE     512
+#define APP_CFG_TASK_SHELL_STK_SIZE_LIMIT (APP_CFG_TASK_SHELL_STK_SIZE * 10u) / 100u
+
+static OS_TCB AppShell_TaskTCB;
+static CPU_STK AppShell_TaskStk[APP_CFG_TASK_SHELL_STK_SIZE];
+
+static void AppShell_Task(void *p_arg);
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Built-in benchmarks */
+// *********************************************************************
+
+static CPU_INT08U AppShell_BufSrc[1024];
+static CPU_INT08U AppShell_BufDst[1024];
+
+static CPU_INT32U mem_copy_64(void) {
+    Mem_Copy((void *) &AppShell_BufDst[0], (void *) &AppShell_BufSrc[0], 64u);
+    return ((CPU_INT32U) AppShell_BufDst[63]);
+}
+
+static CPU_INT32U mem_copy_1k(void) {
+    Mem_Copy((void *) &AppShell_BufDst[0], (void *) &AppShell_BufSrc[0], 1024u);
+    return ((CPU_INT32U) AppShell_BufDst[1023]);
+}
+
+static CPU_INT32U mem_clr_1k(void) {
+    Mem_Clr((void *) &AppShell_BufDst[0], 1024u);
+    return ((CPU_INT32U) AppShell_BufDst[0]);
+}
+
+static CPU_INT32U str_len_64(void) {
+    return ((CPU_INT32U) Str_Len((CPU_CHAR *) &AppShell_BufSrc[0]));
+}
+
+static CPU_INT32U str_fmt_u32(void) {
+    CPU_CHAR buf[12];
+
+    Str_FmtNbr_Int32U(4294967295u, 10u, 10u, ' ', DEF_NO, DEF_YES, &buf[0]);
+    return ((CPU_INT32U) buf[0]);
+}
+
+// Timed by the calibration pass: whatever this costs is harness overhead.
+
+static CPU_INT32U bench_empty(void) {
+    return (0u);
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Output helpers */
+// *********************************************************************
+
+static void AppShell_PrintNum(CPU_INT32U v) {
+    char buf[10];
+    int n = 0;
+
+    do {
+        buf[n++] = (char) (v % 10u + '0');
+        v /= 10u;
+    } while (v > 0u);
+    while (n > 0) {
+        putU1(buf[--n]);
+    }
+}
+
+static void AppShell_PrintCol(CPU_INT32U v) {
+    CPU_INT32U tmp = v;
+    int digits = 1;
+
+    while (tmp >= 10u) {
+        tmp /= 10u;
+        digits++;
+    }
+    while (digits < 9) {
+        putU1(' ');
+        digits++;
+    }
+    AppShell_PrintNum(v);
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Measurement core */
+// *********************************************************************
+
+// Time one call under the core timer with interrupts masked.
+
+static CPU_INT32U AppShell_TimeOne(APP_SHELL_BENCH_FNCT fnct) {
+    CPU_INT32U t0;
+    CPU_INT32U t1;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    t0 = ReadCoreTimer();
+    AppShell_Sink += (*fnct)();
+    t1 = ReadCoreTimer();
+    CPU_CRITICAL_EXIT();
+    return (t1 - t0);
+}
+
+// Run a benchmark N times; sort the samples (N <= 101, insertion sort is
+// fine) and print min / median / max with the calibrated call overhead
+// subtracted from each.
+
+static void AppShell_Run(const APP_SHELL_BENCH *p_bench, CPU_INT32U runs) {
+    CPU_INT32U delta;
+    CPU_INT32U i;
+    CPU_INT32U j;
+    int n;
+
+    if (runs < 3u) {
+        runs = 3u;
+    }
+    if (runs > APP_SHELL_RUNS_MAX) {
+        runs = APP_SHELL_RUNS_MAX;
+    }
+    (void) AppShell_TimeOne(p_bench->Fnct);            // warm the cache once, untimed
+    for (i = 0u; i < runs; i++) {
+        delta = AppShell_TimeOne(p_bench->Fnct);
+        if (delta > AppShell_CallOverhead) {
+            delta -= AppShell_CallOverhead;
+        } else {
+            delta = 0u;
+        }
+        for (j = i; j > 0u; j--) {                     // insert in ascending order
+            if (AppShell_Samples[j - 1u] <= delta) {
+                break;
+            }
+            AppShell_Samples[j] = AppShell_Samples[j - 1u];
+        }
+        AppShell_Samples[j] = delta;
+    }
+
+    putsU1("  ");
+    n = 0;
+    while (p_bench->Name[n] != '\0') {
+        putU1(p_bench->Name[n]);
+        n++;
+    }
+    while (n < 20) {
+        putU1(' ');
+        n++;
+    }
+    AppShell_PrintCol(AppShell_Samples[0]);
+    AppShell_PrintCol(AppShell_Samples[runs / 2u]);
+    AppShell_PrintCol(AppShell_Samples[runs - 1u]);
+    putsU1("  (N=");
+    AppShell_PrintNum(runs);
+    putsU1(")\r\n");
+}
+
+// Calibrate what AppShell_TimeOne() costs around an empty function: the
+// minimum of 64 trials is the overhead subtracted from every sample.
+
+static void AppShell_Calibrate(void) {
+    CPU_INT32U delta;
+    CPU_INT08U i;
+
+    AppShell_CallOverhead = 0xFFFFFFFFu;
+    for (i = 0u; i < 64u; i++) {
+        delta = AppShell_TimeOne(bench_empty);
+        if (delta < AppShell_CallOverhead) {
+            AppShell_CallOverhead = delta;
+        }
+    }
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Command parsing */
+// *********************************************************************
+
+static CPU_BOOLEAN AppShell_StrEq(const char *s1, const char *s2) {
+    while ((*s1 != '\0') && (*s1 == *s2)) {
+        s1++;
+        s2++;
+    }
+    return ((*s1 == *s2) ? DEF_TRUE : DEF_FALSE);
+}
+
+static const APP_SHELL_BENCH *AppShell_BenchFind(const char *name) {
+    CPU_INT08U i;
+
+    for (i = 0u; i < AppShell_BenchQty; i++) {
+        if (AppShell_StrEq(AppShell_BenchTbl[i].Name, name) == DEF_TRUE) {
+            return (&AppShell_BenchTbl[i]);
+        }
+    }
+    return ((const APP_SHELL_BENCH *) 0);
+}
+
+static void AppShell_CmdExec(char *line) {
+    const APP_SHELL_BENCH *p_bench;
+    CPU_INT32U runs;
+    CPU_INT08U i;
+    char *arg;
+    char *num;
+
+    while (*line == ' ') {                              // skip leading blanks
+        line++;
+    }
+    if (*line == '\0') {
+        return;
+    }
+
+    arg = line;                                         // split "cmd arg [N]"
+    while ((*arg != ' ') && (*arg != '\0')) {
+        arg++;
+    }
+    if (*arg == ' ') {
+        *arg++ = '\0';
+        while (*arg == ' ') {
+            arg++;
+        }
+    }
+
+    if (AppShell_StrEq(line, "list") == DEF_TRUE) {
+        for (i = 0u; i < AppShell_BenchQty; i++) {
+            putsU1("  ");
+            putsU1((char *) AppShell_BenchTbl[i].Name);
+            putsU1("\r\n");
+        }
+        return;
+    }
+
+    if (AppShell_StrEq(line, "run") == DEF_TRUE) {
+        num = arg;                                      // split "arg [N]"
+        while ((*num != ' ') && (*num != '\0')) {
+            num++;
+        }
+        runs = 0u;
+        if (*num == ' ') {
+            *num++ = '\0';
+            while ((*num >= '0') && (*num <= '9')) {
+                runs = runs * 10u + (CPU_INT32U)(*num - '0');
+                num++;
+            }
+        }
+        if (runs == 0u) {
+            runs = APP_SHELL_RUNS_DFLT;
+        }
+        if (AppShell_StrEq(arg, "all") == DEF_TRUE) {
+            for (i = 0u; i < AppShell_BenchQty; i++) {
+                AppShell_Run(&AppShell_BenchTbl[i], runs);
+            }
+            return;
+        }
+        p_bench = AppShell_BenchFind(arg);
+        if (p_bench == (const APP_SHELL_BENCH *) 0) {
+            putsU1("  no such benchmark (try 'list')\r\n");
+            return;
+        }
+        AppShell_Run(p_bench, runs);
+        return;
+    }
+
+    putsU1("  commands: list | run <name>|all [N]\r\n");
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Shell task */
+// *********************************************************************
+
+static void AppShell_Task(void *p_arg) {
+    char line[48];
+
+    (void) p_arg;
+    AppShell_Calibrate();
+    putsU1("\r\nbench shell: list | run <name>|all [N]   (cycles, overhead of ");
+    AppShell_PrintNum(AppShell_CallOverhead);
+    putsU1(" subtracted)\r\n");
+
+    while (DEF_TRUE) {
+        putsU1("bench> ");
+        getsU1(line, sizeof(line));                     // blocks polling UART1; this
+        putsU1("\r\n");                                 // ... task runs below the idle
+        AppShell_CmdExec(line);                         // ... measurements anyway
+    }
+}
+
+/*
+ *********************************************************************************************************
+ *                                          AppShell_Init() / AppShell_BenchReg()
+ *
+ * Description : AppShell_Init() fills the source buffer with a known pattern and registers the built-in
+ *               benchmarks.  AppShell_BenchReg() appends one entry; use the APP_SHELL_BENCH_REG() macro
+ *               so the registered name matches the function.  Returns DEF_FAIL when the table is full.
+ *********************************************************************************************************
+ */
+
+CPU_BOOLEAN AppShell_BenchReg(const char *name, APP_SHELL_BENCH_FNCT fnct) {
+    if (AppShell_BenchQty >= APP_SHELL_BENCH_MAX) {
+        return (DEF_FAIL);
+    }
+    AppShell_BenchTbl[AppShell_BenchQty].Name = name;
+    AppShell_BenchTbl[AppShell_BenchQty].Fnct = fnct;
+    AppShell_BenchQty++;
+    return (DEF_OK);
+}
+
+void AppShell_Init(void) {
+    CPU_INT32U i;
+
+    for (i = 0u; i < sizeof(AppShell_BufSrc) - 1u; i++) {
+        AppShell_BufSrc[i] = (CPU_INT08U)('A' + (i % 26u));
+    }
+    AppShell_BufSrc[63] = 0u;                           // str_len_64 stops here
+    AppShell_BenchQty   = 0u;
+
+    APP_SHELL_BENCH_REG(mem_copy_64);
+    APP_SHELL_BENCH_REG(mem_copy_1k);
+    APP_SHELL_BENCH_REG(mem_clr_1k);
+    APP_SHELL_BENCH_REG(str_len_64);
+    APP_SHELL_BENCH_REG(str_fmt_u32);
+}
+
+/*
+ *********************************************************************************************************
+ *                                          AppShell_TaskCreate()
+ *
+ * Description : Create the shell task.  Call after the UART is initialized and any one-shot output
+ *               (the boot benchmark suite) is done -- the shell owns UART1 from then on.
+ *
+ * Arguments   : prio      priority for the shell task; pass APP_CFG_TASK_SHELL_PRIO unless the
+ *                         application owns that level already.
+ *********************************************************************************************************
+ */
+
+void AppShell_TaskCreate(OS_PRIO prio) {
+    OS_ERR err;
+
+    OSTaskCreate((OS_TCB *) & AppShell_TaskTCB, /* Create the shell task */
+            (CPU_CHAR *) "Shell",
+            (OS_TASK_PTR) AppShell_Task,
+            (void *) 0,
+            (OS_PRIO) prio,
+            (CPU_STK *) & AppShell_TaskStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_SHELL_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_SHELL_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & err);
+
+    if (err != OS_ERR_NONE) {
+        putsU1("Error starting Shell task ");
+    }
+}
@@ -0,0 +1,63 @@
+/**************************************************************************
+ * File:         app_shell.h  Resident microbenchmark shell
+ * Processor:	 PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	Interactive harness for timing uC/LIB (and other) functions
+ *		on the target without re-flashing ad-hoc test code.  A
+ *		low-priority task owns UART1 after the boot benchmark
+ *		suite, reads commands with getsU1(), and runs registered
+ *		benchmarks under the core timer with the measured call
+ *		overhead subtracted:
+ *
+ *		    bench> list
+ *		    bench> run mem_copy_1k
+ *		    bench> run str_fmt_u32 101
+ *
+ *		Each run prints min / median / max cycles over N samples
+ *		(default 33, max 101).  Samples are taken one call at a
+ *		time inside a critical section, so the distribution shows
+ *		the function under test, not preemption -- and the median
+ *		is robust if a sample does catch a stretched path.
+ **************************************************************************/
+
+#ifndef  APP_SHELL_MODULE_PRESENT
+#define  APP_SHELL_MODULE_PRESENT
+
+/*
+ *******************************************************************************
+ *                                            Configuration
+ *******************************************************************************
+ */
+
+#define  APP_SHELL_BENCH_MAX        16u     /* Registration table slots                  */
+#define  APP_SHELL_RUNS_DFLT        33u     /* Samples per run unless the command says   */
+#define  APP_SHELL_RUNS_MAX        101u     /* Bound on N (sizes the sample buffer)      */
+
+#define  APP_CFG_TASK_SHELL_PRIO     9u     /* Below everything that is being measured   */
+
+/*
+ *******************************************************************************
+ *                                            Registration
+ *******************************************************************************
+ */
+
+typedef  CPU_INT32U  (*APP_SHELL_BENCH_FNCT)(void);     /* Return a live value so the    */
+                                                        /* ... call cannot be optimized  */
+                                                        /* ... away                      */
+
+/* Register a benchmark under its own function name:  APP_SHELL_BENCH_REG(mem_copy_1k); */
+#define  APP_SHELL_BENCH_REG(fnct)  AppShell_BenchReg(#fnct, (fnct))
+
+/*
+ *******************************************************************************
+ *                                            PROTOTYPES
+ *******************************************************************************
+ */
+
+void        AppShell_Init       (void);
+CPU_BOOLEAN AppShell_BenchReg   (const char            *name,
+                                 APP_SHELL_BENCH_FNCT   fnct);
+void        AppShell_TaskCreate (OS_PRIO                prio);
+
+#endif
@@ -0,0 +1,269 @@
+/**************************************************************************
+ * File:         app_trace.c  Binary scheduling/IPC trace ring
+ * Processor:	 PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	See app_trace.h for the wire format.  The recorder claims
+ *		a ring slot inside a few-instruction critical section (the
+ *		hooks run in ISR and context-switch paths, so the index
+ *		update must not be torn); everything slow -- the UART --
+ *		happens in the drain task, outside any lock, so recording
+ *		an event costs well under a microsecond and does not
+ *		change the schedule being traced.  When the ring is full
+ *		new records are dropped and counted; the count is emitted
+ *		as a TRACE_EVT_DROP record once space frees up, so the
+ *		offline tools know exactly where the timeline has holes.
+ *		In triggered mode (AppTrace_TrigArm) a full ring instead
+ *		overwrites its oldest record, so the window leading up to
+ *		the anomaly is what survives the freeze.
+ **************************************************************************/
+#include <includes.h>
+#include "app_trace.h"
+
+/*
+ *******************************************************************************
+ *                                            Local variables
+ *******************************************************************************
+ */
+
+#define APP_TRACE_RING_MASK     (APP_TRACE_RING_SIZE - 1u)
+
+typedef struct {                // 8 bytes -- see app_trace.h for the layout
+    CPU_TS Ts;
+    CPU_INT08U Id;
+    CPU_INT08U Arg8;
+    CPU_INT16U Arg16;
+} APP_TRACE_REC;
+
+static APP_TRACE_REC AppTrace_Ring[APP_TRACE_RING_SIZE];
+static volatile CPU_INT16U AppTrace_In;      // written by recorders only
+static volatile CPU_INT16U AppTrace_Out;     // written by the drain task (and the recorder in triggered mode)
+static volatile CPU_INT16U AppTrace_DropCnt; // records lost while the ring was full
+static volatile CPU_BOOLEAN AppTrace_Armed = DEF_FALSE;
+static volatile CPU_BOOLEAN AppTrace_TrigMode = DEF_FALSE; // ring keeps the latest window, frozen on trigger
+static volatile CPU_BOOLEAN AppTrace_SnapReq = DEF_FALSE;  // a trigger fired: the drain task owes one snapshot
+
+#define APP_CFG_TASK_TRACE_STK_SIZE     256
+#define APP_CFG_TASK_TRACE_STK_SIZE_LIMIT (APP_CFG_TASK_TRACE_STK_SIZE * 10u) / 100u
+
+#define APP_TRACE_DRAIN_BUDGET          16  // records emitted per wakeup
+
+static OS_TCB AppTrace_TaskTCB;
+static CPU_STK AppTrace_TaskStk[APP_CFG_TASK_TRACE_STK_SIZE];
+
+static void AppTrace_Task(void *p_arg);
+
+/*
+ *********************************************************************************************************
+ *                                          AppTrace_Init()
+ *
+ * Description : Reset the ring.  Call once after OSInit(); recording stays off until AppTrace_Start().
+ *********************************************************************************************************
+ */
+
+void AppTrace_Init(void) {
+    AppTrace_In = 0;
+    AppTrace_Out = 0;
+    AppTrace_DropCnt = 0;
+    AppTrace_Armed = DEF_FALSE;
+    AppTrace_TrigMode = DEF_FALSE;
+    AppTrace_SnapReq = DEF_FALSE;
+}
+
+void AppTrace_Start(void) {
+    AppTrace_Armed = DEF_TRUE;
+}
+
+void AppTrace_Stop(void) {
+    AppTrace_Armed = DEF_FALSE;
+}
+
+/*
+ *********************************************************************************************************
+ *                                          AppTrace_Record()
+ *
+ * Description : Append one event record.  Safe from task, hook, and ISR context: the slot claim and
+ *               index advance sit inside a critical section a handful of instructions long, and the
+ *               timestamp is taken while the slot is held so records are emitted in timeline order.
+ *
+ * Arguments   : evt_id    TRACE_EVT_xxx (see app_trace.h)
+ *               arg8      event-specific byte, usually a task priority
+ *               arg16     event-specific half-word, usually low object address bits
+ *********************************************************************************************************
+ */
+
+void AppTrace_Record(CPU_INT08U evt_id, CPU_INT08U arg8, CPU_INT16U arg16) {
+    APP_TRACE_REC *rec;
+    CPU_INT16U in_next;
+    CPU_SR_ALLOC();
+
+    if (AppTrace_Armed != DEF_TRUE) {
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+    in_next = (AppTrace_In + 1u) & APP_TRACE_RING_MASK;
+    if (in_next == AppTrace_Out) {
+        if (AppTrace_TrigMode == DEF_TRUE) { // pre-trigger window: overwrite the oldest record
+            AppTrace_Out = (AppTrace_Out + 1u) & APP_TRACE_RING_MASK; // drain task is idle until the freeze
+        } else { // streaming: drop and count, never block
+            AppTrace_DropCnt++;
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+    }
+    rec = &AppTrace_Ring[AppTrace_In];
+    rec->Ts = (CPU_TS) CPU_TS_TMR_RD();
+    rec->Id = evt_id;
+    rec->Arg8 = arg8;
+    rec->Arg16 = arg16;
+    AppTrace_In = in_next;
+    CPU_CRITICAL_EXIT();
+}
+
+/*
+ *********************************************************************************************************
+ *                                          AppTrace_TrigArm()
+ *
+ * Description : Switch to triggered capture: the ring keeps the most recent window (oldest records are
+ *               overwritten, nothing streams out), the kernel anomaly thresholds are armed from the
+ *               APP_TRACE_TRIG_xxx settings in app_trace.h, and the moment one fires the ring freezes
+ *               and the drain task emits it once as a snapshot.  Call again to re-arm after a capture.
+ *********************************************************************************************************
+ */
+
+// Kernel anomaly hook (see os.h): runs in the detecting context -- the
+// context switch path for a late wakeup, OSSchedUnlock() for a lock
+// overrun -- so it only records one event and flips flags.
+
+static void AppTrace_TrigHook(CPU_INT08U anomaly_id, CPU_TS measured) {
+    CPU_TS scaled;
+
+    if (AppTrace_Armed != DEF_TRUE) { // already frozen: keep the first capture
+        return;
+    }
+    scaled = measured >> 8; // TS units / 256 so the value fits Arg16
+    if (scaled > 0xFFFFu) {
+        scaled = 0xFFFFu;
+    }
+    AppTrace_Record(TRACE_EVT_TRIG, anomaly_id, (CPU_INT16U) scaled);
+    AppTrace_Armed = DEF_FALSE;   // freeze the window ...
+    AppTrace_SnapReq = DEF_TRUE;  // ... and ask the drain task to dump it
+}
+
+void AppTrace_TrigArm(void) {
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    AppTrace_In = 0;
+    AppTrace_Out = 0;
+    AppTrace_DropCnt = 0;
+    AppTrace_SnapReq = DEF_FALSE;
+    AppTrace_TrigMode = DEF_TRUE;
+    AppTrace_Armed = DEF_TRUE;
+    CPU_CRITICAL_EXIT();
+
+#if OS_CFG_TASK_JITTER_EN > 0u
+    OSAnomalyDlyLateTrig = (CPU_TS) (APP_TRACE_TRIG_DLY_LATE_TICKS * // core timer ticks per OS tick
+            (BSP_CLK_FREQ / (2u * OS_CFG_TICK_RATE_HZ)));
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    OSAnomalySchedLockTrig = (CPU_TS_TMR) (APP_TRACE_TRIG_LOCK_US * // core timer ticks per microsecond
+            (BSP_CLK_FREQ / 2000000u));
+#endif
+    OSAnomalyHookPtr = AppTrace_TrigHook;
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Drain task */
+// *********************************************************************
+
+// Emit one framed record: sync byte then the 8 record bytes, little-endian.
+
+static void AppTrace_Emit(APP_TRACE_REC *rec) {
+    putU1((char) 0xA5);
+    putU1((char) (rec->Ts & 0xFFu));
+    putU1((char) ((rec->Ts >> 8) & 0xFFu));
+    putU1((char) ((rec->Ts >> 16) & 0xFFu));
+    putU1((char) ((rec->Ts >> 24) & 0xFFu));
+    putU1((char) rec->Id);
+    putU1((char) rec->Arg8);
+    putU1((char) (rec->Arg16 & 0xFFu));
+    putU1((char) ((rec->Arg16 >> 8) & 0xFFu));
+}
+
+// Low-priority drain: forwards up to APP_TRACE_DRAIN_BUDGET records per
+// tick so the UART never monopolizes the CPU, then reports any records
+// dropped while the ring was full.  In triggered mode it sits idle
+// until a trigger freezes the ring, then emits the whole window once;
+// the ring stays frozen until AppTrace_TrigArm() re-arms it.
+
+static void AppTrace_Task(void *p_arg) {
+    CPU_INT16U dropped;
+    CPU_INT08U budget;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    (void) p_arg;
+    while (DEF_TRUE) {
+        if (AppTrace_TrigMode == DEF_TRUE) {
+            if (AppTrace_SnapReq == DEF_TRUE) { // a trigger froze the ring: emit the window
+                while (AppTrace_Out != AppTrace_In) {
+                    AppTrace_Emit(&AppTrace_Ring[AppTrace_Out]);
+                    AppTrace_Out = (AppTrace_Out + 1u) & APP_TRACE_RING_MASK;
+                }
+                AppTrace_SnapReq = DEF_FALSE; // frozen until AppTrace_TrigArm() again
+            }
+        } else {
+            budget = APP_TRACE_DRAIN_BUDGET;
+
+            while ((AppTrace_Out != AppTrace_In) && (budget > 0u)) {
+                AppTrace_Emit(&AppTrace_Ring[AppTrace_Out]);
+                AppTrace_Out = (AppTrace_Out + 1u) & APP_TRACE_RING_MASK;
+                budget--;
+            }
+            if (AppTrace_DropCnt > 0u) { // space freed: account for the hole
+                CPU_CRITICAL_ENTER();
+                dropped = AppTrace_DropCnt;
+                AppTrace_DropCnt = 0;
+                CPU_CRITICAL_EXIT();
+                AppTrace_Record(TRACE_EVT_DROP, 0, dropped);
+            }
+        }
+        OSTimeDly((OS_TICK) 1, OS_OPT_TIME_DLY, &err);
+    }
+}
+
+/*
+ *********************************************************************************************************
+ *                                          AppTrace_TaskCreate()
+ *
+ * Description : Create the drain task.  Call once from the startup task after the UART is initialized.
+ *
+ * Arguments   : prio      priority for the drain task; pass APP_CFG_TASK_TRACE_PRIO unless the
+ *                         application owns that level already.
+ *********************************************************************************************************
+ */
+
+void AppTrace_TaskCreate(OS_PRIO prio) {
+    OS_ERR err;
+
+    OSTaskCreate((OS_TCB *) & AppTrace_TaskTCB, /* Create the trace drain task */
+            (CPU_CHAR *) "Trace",
+            (OS_TASK_PTR) AppTrace_Task,
+            (void *) 0,
+            (OS_PRIO) prio,
+            (CPU_STK *) & AppTrace_TaskStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_TRACE_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_TRACE_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & err);
+
+    if (err != OS_ERR_NONE) {
+        putsU1("Error starting Trace task ");
+    }
+}
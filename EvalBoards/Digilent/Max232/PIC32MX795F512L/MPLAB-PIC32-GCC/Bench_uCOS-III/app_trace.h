@@ -0,0 +1,106 @@
+/**************************************************************************
+ * File:         app_trace.h  Binary scheduling/IPC trace ring
+ * Processor:	 PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	Fixed-size binary event records written from the kernel
+ *		hooks (os_app_hooks.c) into a RAM ring and drained over
+ *		UART1 by a low-priority task, replacing print statements
+ *		that distort the timing being observed.
+ *
+ *		Two capture modes.  Streaming (AppTrace_Start): records are
+ *		drained continuously as before.  Triggered (AppTrace_TrigArm):
+ *		the ring keeps only the most recent window, freezes the
+ *		instant a kernel anomaly trigger fires (a timed wakeup
+ *		dispatched late or an over-long scheduler lock -- see
+ *		OSAnomalyHookPtr in os.h), and the frozen window streams out
+ *		once as a snapshot, so a transient glitch arrives on the host
+ *		with its surrounding timeline intact.
+ *
+ * Record format (the documented wire contract -- keep host tools in sync):
+ *
+ *	Each record is framed as 9 bytes on the UART:
+ *
+ *	    offset  size  field
+ *	    0       1     0xA5 sync byte
+ *	    1       4     Ts     CPU_TS timestamp, core timer ticks
+ *	                         (SYSCLK/2 = 25 ns), little-endian
+ *	    5       1     Id     event ID (TRACE_EVT_xxx below)
+ *	    6       1     Arg8   event-specific (usually a task priority)
+ *	    7       2     Arg16  event-specific, little-endian
+ *
+ *	Event IDs and their arguments:
+ *
+ *	    TRACE_EVT_TASK_SW      Arg8 = prio of the task switched IN,
+ *	                           Arg16 = low 16 bits of its TCB address
+ *	                           (distinguishes tasks sharing a priority)
+ *	    TRACE_EVT_TICK         Arg8/Arg16 = 0
+ *	    TRACE_EVT_TASK_CREATE  Arg8 = prio, Arg16 = low 16 TCB bits
+ *	    TRACE_EVT_TASK_DEL     Arg8 = prio, Arg16 = low 16 TCB bits
+ *	    TRACE_EVT_SEM_POST/PEND, TRACE_EVT_Q_POST/PEND
+ *	                           recorded by the application around its
+ *	                           own IPC calls (this kernel has no post
+ *	                           hooks); Arg16 = low 16 object addr bits
+ *	    TRACE_EVT_TRIG         anomaly trigger fired: Arg8 = the
+ *	                           OS_ANOMALY_xxx id (see os.h), Arg16 =
+ *	                           measured value >> 8 (TS units / 256,
+ *	                           saturated); always the final record
+ *	                           of a triggered snapshot
+ *	    TRACE_EVT_DROP         Arg16 = records lost since the last
+ *	                           DROP record (ring was full)
+ *	    TRACE_EVT_USER         free for ad-hoc instrumentation
+ *
+ *	Records are timestamped at the instant the slot is claimed, so a
+ *	timeline reconstructed offline is ordered even though the UART
+ *	drain lags far behind.
+ **************************************************************************/
+
+#ifndef  APP_TRACE_MODULE_PRESENT
+#define  APP_TRACE_MODULE_PRESENT
+
+/*
+ *******************************************************************************
+ *                                            Event IDs
+ *******************************************************************************
+ */
+
+#define  TRACE_EVT_TASK_SW          0x01
+#define  TRACE_EVT_TICK             0x02
+#define  TRACE_EVT_TASK_CREATE      0x03
+#define  TRACE_EVT_TASK_DEL         0x04
+#define  TRACE_EVT_SEM_POST         0x05
+#define  TRACE_EVT_SEM_PEND         0x06
+#define  TRACE_EVT_Q_POST           0x07
+#define  TRACE_EVT_Q_PEND           0x08
+#define  TRACE_EVT_TRIG             0x0D
+#define  TRACE_EVT_DROP             0x0E
+#define  TRACE_EVT_USER             0x0F
+
+/*
+ *******************************************************************************
+ *                                            Configuration
+ *******************************************************************************
+ */
+
+#define  APP_TRACE_RING_SIZE        256u    /* Records; power of 2; 8 bytes each */
+#define  APP_CFG_TASK_TRACE_PRIO      9u    /* Drain task: below everything that matters */
+
+#define  APP_TRACE_TRIG_DLY_LATE_TICKS  2u  /* Freeze: timed wakeup dispatched this many ticks late */
+#define  APP_TRACE_TRIG_LOCK_US      1000u  /* Freeze: scheduler lock held this long (microseconds) */
+
+/*
+ *******************************************************************************
+ *                                            PROTOTYPES
+ *******************************************************************************
+ */
+
+void        AppTrace_Init       (void);
+void        AppTrace_Start      (void);
+void        AppTrace_Stop       (void);
+void        AppTrace_TrigArm    (void);
+void        AppTrace_Record     (CPU_INT08U  evt_id,
+                                 CPU_INT08U  arg8,
+                                 CPU_INT16U  arg16);
+void        AppTrace_TaskCreate (OS_PRIO     prio);
+
+#endif
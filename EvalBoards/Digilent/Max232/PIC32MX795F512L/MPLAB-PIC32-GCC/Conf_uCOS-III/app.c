@@ -0,0 +1,120 @@
+/**************************************************************************
+ * File:         app.c       cross-board BSP performance conformance suite
+ * Date:         August 2013
+ * Status:       functional
+ * Processor:	 PIC32MX795F512L
+ * Toolchain:	 MPLAB-X
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	Max32 build of the shared conformance benchmark set
+ *		(CPU/Microchip/PIC32/ConfBench.c).  Every board in the
+ *		tree has a Conf project wrapping the SAME measurement
+ *		code against its own BSP; the machine-readable rows this
+ *		build prints over UART1 are the Max32 column of the
+ *		per-board baseline table.  A kernel change is conformant
+ *		when the deltas agree across all the boards' rows, not
+ *		just this one's.
+ *
+ *		See ConfBench.h for the row format; the deeper Max32-only
+ *		benchmarks (tick hook latency, ISR post queue sweep,
+ *		trace, shell) stay in the Bench project.
+ *
+ * Notes:
+ *       bsp.c holds pragma config
+ *       uart1.h holds BAUD_RATE 115200
+ *       os_cfg.h enables OS_CFG_SEM_EN / OS_CFG_Q_EN for this project
+ **************************************************************************/
+#include "ConfBench.h"	/* pulls <includes.h> (no guard: once only)  */
+#include <os_app_hooks.h>
+
+/*
+ *******************************************************************************
+ *                                                Task Stacks/TCB
+ *******************************************************************************
+ */
+
+static OS_TCB App_TaskStartTCB;
+static CPU_STK App_TaskStartStk[APP_CFG_TASK_START_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;
+
+/*
+ *******************************************************************************
+ *                                            Task PROTOTYPES
+ *******************************************************************************
+ */
+
+static void App_TaskStart(void *p_arg);
+
+/*
+ *********************************************************************************************************
+ *                                                main()
+ *
+ * Description : This is the standard entry point for C code.
+ *
+ * Arguments   : none
+ *********************************************************************************************************
+ */
+
+int main(void) {
+
+    OS_ERR os_err;
+
+    CPU_Init(); /* Initialize the uC/CPU services  */
+
+    BSP_IntDisAll();
+
+    OSInit(&os_err); /* Init uC/OS-III.                  */
+
+    App_OS_SetAllHooks();
+
+    // app_cfg.h holds priority, stack size, and limit for start task
+    OSTaskCreate((OS_TCB *) & App_TaskStartTCB, /* Create the start task            */
+            (CPU_CHAR *) "Start",
+            (OS_TASK_PTR) App_TaskStart,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_START_PRIO,
+            (CPU_STK *) & App_TaskStartStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_START_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_START_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & os_err);
+
+    OSStart(&os_err); /* Start multitasking (i.e. give control to uC/OS-III). */
+    /* Should not return here as RTOS takes control */
+    (void) &os_err;
+
+    return (0);
+}
+
+/*$PAGE*/
+
+/*
+ *********************************************************************************************************
+ *                                          STARTUP TASK
+ *
+ * Description : Runs the shared conformance suite once, then idles
+ *               blinking an LED so the board is visibly alive.
+ * Arguments   : p_arg   is the argument passed to 'AppStartTask()' by 'OSTaskCreate()'.
+ *********************************************************************************************************
+ */
+
+static void App_TaskStart(void *p_arg) {
+    OS_ERR err;
+
+    (void) p_arg;
+
+    BSP_InitIO(); /* Initialize BSP functions                                 */
+
+    initU1(); // Initialize UART1
+
+    OSTimeDlyHMSM(0, 0, 1, 0, OS_OPT_TIME_HMSM_STRICT, &err); // let the terminal connect
+
+    ConfBench_Run("max32");
+
+    while (DEF_TRUE) { /* Task body, always written as an infinite loop.            */
+        LED_Toggle(1);
+        OSTimeDly(OS_MS_TO_TICKS(500), OS_OPT_TIME_DLY, &err);
+    }
+}
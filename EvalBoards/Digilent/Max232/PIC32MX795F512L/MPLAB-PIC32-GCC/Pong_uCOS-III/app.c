@@ -35,6 +35,14 @@
  *      os_cfg.h enables/disables inclusion of  statistics task 
  **************************************************************************/
 #include <includes.h>
+#include "app_snake.h"
+#include "app_hud.h"
+#include "app_stat.h"
+#include "app_telem.h"
+#include "app_asset.h"
+#include "app_time.h"
+#include "app_err.h"
+#include <os_app_hooks.h>
 
 /*
  *******************************************************************************
@@ -66,6 +74,18 @@ static CPU_STK App_TaskPaddleLeftStk[APP_CFG_TASK_PADDLE_LEFT_STK_SIZE];
 static OS_TCB App_TaskPaddleRightTCB;
 static CPU_STK App_TaskPaddleRightStk[APP_CFG_TASK_PADDLE_RIGHT_STK_SIZE];
 
+#define APP_CFG_TASK_RENDER_STK_SIZE        TASK_STK_SIZE
+#define APP_CFG_TASK_RENDER_STK_SIZE_LIMIT  (TASK_STK_SIZE* (100u - APP_CFG_TASK_STK_SIZE_PCT_FULL)) / 100u
+
+static OS_TCB App_TaskRenderTCB;
+static CPU_STK App_TaskRenderStk[APP_CFG_TASK_RENDER_STK_SIZE];
+
+#define APP_CFG_TASK_PUMP_STK_SIZE          TASK_STK_SIZE
+#define APP_CFG_TASK_PUMP_STK_SIZE_LIMIT    (TASK_STK_SIZE* (100u - APP_CFG_TASK_STK_SIZE_PCT_FULL)) / 100u
+
+static OS_TCB App_TaskPumpTCB;
+static CPU_STK App_TaskPumpStk[APP_CFG_TASK_PUMP_STK_SIZE];
+
 /*
  *******************************************************************************
  *                                            Task PROTOTYPES
@@ -78,6 +98,39 @@ static void AppTaskCreate(void);
 static void App_TaskBall(void *data);
 static void App_TaskPaddleLeft(void *data);
 static void App_TaskPaddleRight(void *data);
+static void App_TaskRender(void *data);
+static void App_TaskPump(void *data);
+
+#if APP_CFG_KERNEL_RAM_RPT_EN > 0u
+static void App_KernelRAMReport(void);
+#endif
+#if APP_CFG_RAM_SECTION_RPT_EN > 0u
+static void App_RAMSectionReport(void);
+#endif
+#if APP_CFG_INT_MAP_RPT_EN > 0u
+static void App_IntMapReport(void);
+#endif
+#if APP_CFG_INT_DIS_HIST_RPT_EN > 0u
+static void App_IntDisHistReport(void);
+#endif
+#if APP_CFG_SCHED_BENCH_RPT_EN > 0u
+static void App_SchedBenchReport(void);
+#endif
+#if APP_CFG_FLASH_CFG_RPT_EN > 0u
+static void App_FlashCfgReport(void);
+#endif
+#if APP_CFG_INT_LAT_RPT_EN > 0u
+static void App_IntLatReport(void);
+#endif
+#if APP_CFG_BOOT_PROF_RPT_EN > 0u
+static void App_BootProfReport(void);
+#endif
+void UART_PrintNumU32(CPU_INT32U v);
+
+int Ball_Up(CPU_INT08U btns);
+int Ball_Down(CPU_INT08U btns);
+int Ball_Left(CPU_INT08U btns);
+int Ball_Right(CPU_INT08U btns);
 
 /*
  *******************************************************************************
@@ -88,16 +141,19 @@ static void App_TaskPaddleRight(void *data);
 #define APP_CFG_TASK_BALL_PRIO          4
 #define APP_CFG_TASK_PADDLE_LEFT_PRIO   5
 #define APP_CFG_TASK_PADDLE_RIGHT_PRIO  6
+#define APP_CFG_TASK_RENDER_PRIO        6   // below the game tasks: draws happen in slack time
+#define APP_CFG_TASK_PUMP_PRIO          6   // output pump shares the slack level with the render server
 
 // ***************************************************************************
 // GPIO defines     Switches on Digilent Basic Shield 
 // declared in bsp.h
 // ***************************************************************************
 
-#define RIGHT_UP_SW     BTN1 
-#define RIGHT_DOWN_SW   BTN2 
-#define LEFT_UP_SW      BTN3 
-#define LEFT_DOWN_SW	BTN4 
+// Bits within the BSP_ButtonsSnapshot() bitmask
+#define RIGHT_UP_SW     BSP_BTN1_MSK
+#define RIGHT_DOWN_SW   BSP_BTN2_MSK
+#define LEFT_UP_SW      BSP_BTN3_MSK
+#define LEFT_DOWN_SW    BSP_BTN4_MSK
 
 
 // ***************************************************************************
@@ -124,13 +180,60 @@ void Screen_Clear(void);
 void Screen_MoveCursor(int Xpos, int Ypos);
 int Screen_WriteChar(int x, int y, char c);
 int Screen_WriteNumber(int x, int y, int number);
+int Screen_WriteNumber3(int x, int y, int number);
 void Screen_OffCursor(void);
 void Screen_OnCursor(void);
+void Screen_PutsConst(const char *s);
 
-// ********************************************************************* */
-// Global Variables
-// *********************************************************************
-int x_delta, y_delta;
+// ***************************************************************************
+// Render server
+//   One task owns the UART cursor.  Producers never touch the scheduler
+//   lock; they post small draw commands to the render task's built-in
+//   message queue (OS_CFG_TASK_Q_EN) and the render task performs the
+//   cursor move + payload write at its own priority.  Commands live in a
+//   static ring sized to the queue depth, so a pool entry can only be
+//   recycled after the queue slot that references it has been consumed.
+// ***************************************************************************
+#define RENDER_Q_SIZE       32
+
+#define RENDER_CMD_CHAR     0   // draw one character
+#define RENDER_CMD_NUM2     1   // draw a 2 digit number
+#define RENDER_CMD_NUM3     2   // draw a 3 digit number
+
+typedef struct {
+    CPU_INT08U type;
+    CPU_INT08U x;
+    CPU_INT08U y;
+    char ch;
+    int value;
+} RENDER_CMD;
+
+static RENDER_CMD Render_CmdPool[RENDER_Q_SIZE];
+static CPU_INT08U Render_CmdIdx;
+static CPU_BOOLEAN Render_SrvReady = DEF_FALSE; // direct writes until the task runs
+
+// ***************************************************************************
+// Ball task mailbox
+//   The ball task is the single consumer of its built-in task queue
+//   (OS_CFG_TASK_Q_EN), so the paddle tasks coordinate with it purely by
+//   message: steering commands and cell-claim messages replace the shared
+//   x_delta/y_delta globals this file used to rely on.  Commands are small
+//   enough to pack into the message pointer itself, so posting allocates
+//   nothing and producers never contend for a pool or a scheduler lock.
+// ***************************************************************************
+#define BALL_Q_SIZE         8
+
+#define BALL_MSG_DIR        1   // steer the ball: a = x delta, b = y delta
+#define BALL_MSG_CLAIM_L    2   // left paddle claims its cells: b = top row
+#define BALL_MSG_CLAIM_R    3   // right paddle claims its cells: b = top row
+
+#define BALL_MSG_PACK(type, a, b)                                     \
+    ((void *)(CPU_ADDR)((CPU_INT32U)(type)                          | \
+                        (((CPU_INT32U)(a) & 0xFFu) <<  8)           | \
+                        (((CPU_INT32U)(b) & 0xFFu) << 16)))
+#define BALL_MSG_TYPE(msg)  ((CPU_INT32U)(CPU_ADDR)(msg) & 0xFFu)
+#define BALL_MSG_A(msg)     ((int)(CPU_INT08S)(((CPU_INT32U)(CPU_ADDR)(msg) >>  8) & 0xFFu))
+#define BALL_MSG_B(msg)     ((int)(CPU_INT08S)(((CPU_INT32U)(CPU_ADDR)(msg) >> 16) & 0xFFu))
 
 /*
  *********************************************************************************************************
@@ -146,11 +249,15 @@ int main(void) {
 
     OS_ERR os_err;
 
+    BSP_BootMark("main"); /* Count runs from reset, so this mark IS the crt0 cost */
+
     CPU_Init(); /* Initialize the uC/CPU services  */
 
     BSP_IntDisAll();
 
     OSInit(&os_err); /* Init uC/OS-III.                  */
+    App_OS_SetAllHooks(); /* The stat task hook publishes the display snapshot */
+    BSP_BootMark("os init");
 
     // app_cfg.h holds priority, stack size, and limit for start task
     OSTaskCreate((OS_TCB *) & App_TaskStartTCB, /* Create the start task            */
@@ -167,6 +274,7 @@ int main(void) {
             (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
             (OS_ERR *) & os_err);
 
+    BSP_BootMark("os start");
     OSStart(&os_err); /* Start multitasking (i.e. give control to uC/OS-III). */
     /* Should not return here as RTOS takes control */
     (void) &os_err;
@@ -191,44 +299,58 @@ static void App_TaskStart(void *p_arg) {
 #endif
     CPU_INT08U i;
     CPU_INT08U j;
+    CPU_INT08U led_pattern = 0x00;
 
     (void) p_arg;
     OS_ERR err;
 
+    BSP_BootMark("start task"); /* first context switch has happened        */
     BSP_InitIO(); /* Initialize BSP functions                                 */
 
 #if OS_CFG_STAT_TASK_EN > 0  // Set in os_cfg.h
     OSStatTaskCPUUsageInit(&err);
     if (err != OS_ERR_NONE) {
-        putsU1("Error starting OSStatTaskCPUUsageInit ");
+        AppErr_Record(err, APP_ERR_SITE_STAT_INIT); // counted, surfaced by the pump
     }
 #endif
 
     initU1(); // Initialize UART1
+    BSP_BootMark("uart up");
+
+#if APP_CFG_KERNEL_RAM_RPT_EN > 0u
+    App_KernelRAMReport(); // One-shot footprint report on the terminal
+#endif
+#if APP_CFG_INT_DIS_HIST_RPT_EN > 0u
+    App_IntDisHistReport(); // Critical-section latency histograms so far (boot path)
+#endif
+#if APP_CFG_SCHED_BENCH_RPT_EN > 0u
+    App_SchedBenchReport(); // Scheduler hot-path cycle counts (RAM vs flash placement)
+#endif
+#if APP_CFG_FLASH_CFG_RPT_EN > 0u
+    App_FlashCfgReport(); // What CHECON we actually got, plus a fetch benchmark
+#endif
 
     AppTaskCreate(); /* Create application tasks                                 */
+    BSP_BootMark("app tasks"); /* includes Screen_Init() and its two 2 s delays    */
+
+#if APP_CFG_BOOT_PROF_RPT_EN > 0u
+    App_BootProfReport();
+#endif
+#if APP_CFG_RAM_SECTION_RPT_EN > 0u
+    App_RAMSectionReport(); // After AppTaskCreate() so the stack walk sees every task
+#endif
+#if APP_CFG_INT_MAP_RPT_EN > 0u
+    App_IntMapReport(); // Latency classes and the vectors assigned one
+#endif
 
-    // ----- Task continues executing as infinite loop -----------
-    // ----- writing statistics to screen and blinking LEDs ------
+    // ----- Task continues as the LED heartbeat; the stats/HUD and
+    // ----- report output moved to the output pump (App_TaskPump) ---
     while (DEF_TRUE) { /* Task body, always written as an infinite loop.            */
 
-// If enabled writes:  CPU usage, number of tasks, stack free, stack used
-#if OS_CFG_STAT_TASK_EN > 0 // Set in os_cfg.h
-        OSSchedLock(&err); // Don't let another task run as it might change cursor position
-        Screen_MoveCursor(40, 2); // before  writing to the screen
-        UART_PrintNum(OSStatTaskCPUUsage);
-        Screen_MoveCursor(40, 3); // before  writing to the screen
-        UART_PrintNum(OSTaskQty);
-        Screen_MoveCursor(40, 4); // before  writing to the screen
-        UART_PrintNum3(App_TaskStartTCB.StkFree);
-        Screen_MoveCursor(40, 5); // before  writing to the screen
-        UART_PrintNum3(App_TaskStartTCB.StkUsed);
-        OSSchedUnlock(&err); // Ok for other tasks to run
-#endif
-
-        for (i = 1; i < 9; i++) {
-            LED_Toggle(i);
-            OSTimeDlyHMSM(0, 0, 0, 500, OS_OPT_TIME_HMSM_STRICT, &err);
+        for (i = 0; i < 8; i++) {
+            led_pattern ^= (CPU_INT08U)(1u << i);    // walk the toggle across the row
+            BSP_LEDPatternWrite(led_pattern);        // atomic LATSET/LATCLR writes, no RMW
+            OSTimeDly(OS_MS_TO_TICKS(500), OS_OPT_TIME_DLY, &err); /* constant-folded, no per-call conversion */
         }
 
     }
@@ -258,37 +380,76 @@ static void AppTaskCreate(void) {
 
     OSTimeDlyHMSM(0, 0, 2, 0, OS_OPT_TIME_HMSM_STRICT, &err); /* Wait two seconds */
     if (err != OS_ERR_NONE) {
-        putsU1("Error OSTimeDlyHMSM ");
+        AppErr_Record(err, APP_ERR_SITE_DLY);
     }
 
-    Screen_MoveCursor(8, 8);
-    putsU1("uC/OS-III, The Real-Time Kernel PIC32 \n"
-            " PONG\n");
+    Asset_Blit(Asset_Title);    /* pre-encoded banner streams from flash */
 
     OSTimeDlyHMSM(0, 0, 2, 0, OS_OPT_TIME_HMSM_STRICT, &err); /* Wait two seconds */
     if (err != OS_ERR_NONE) {
-        putsU1("Error OSTimeDlyHMSM ");
+        AppErr_Record(err, APP_ERR_SITE_DLY);
     }
     Screen_Init();
     Screen_OffCursor();
 
-    OSTaskCreate((OS_TCB *) & App_TaskBallTCB, /* Create the ball task       */
-            (CPU_CHAR *) "Ball",
-            (OS_TASK_PTR) App_TaskBall,
-            (void *) 0,
-            (OS_PRIO) APP_CFG_TASK_BALL_PRIO,
-            (CPU_STK *) & App_TaskBallStk[0],
-            (CPU_STK_SIZE) APP_CFG_TASK_BALL_STK_SIZE_LIMIT,
-            (CPU_STK_SIZE) APP_CFG_TASK_BALL_STK_SIZE,
-            (OS_MSG_QTY) 0u,
-            (OS_TICK) 0u,
-            (void *) 0,
-            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
-            (OS_ERR *) & os_err);
-
-    if (os_err != OS_ERR_NONE) {
-        putsU1("Error starting Ball task: ");
+#if APP_CFG_SNAKE_EN > 0u
+    Snake_TaskCreate(); /* Snake owns the terminal through the framebuffer  */
+#if APP_CFG_SNAKE_AI_EN > 0u
+    Snake_AITaskCreate(); /* AI opponent plans in the frame's slack time      */
+#endif
+#else
+    {
+        /* The five Pong tasks, created as one batch: a single scheduler  */
+        /* pass at the end instead of one dispatch per create             */
+        static OS_TASK_DESC task_tbl[] = {
+            { &App_TaskRenderTCB,      "Render",      App_TaskRender,      (void *) 0,
+              (OS_PRIO) APP_CFG_TASK_RENDER_PRIO,       &App_TaskRenderStk[0],
+              (CPU_STK_SIZE) APP_CFG_TASK_RENDER_STK_SIZE_LIMIT,
+              (CPU_STK_SIZE) APP_CFG_TASK_RENDER_STK_SIZE,
+              (OS_MSG_QTY) RENDER_Q_SIZE, /* built-in queue carries the draw commands */
+              (OS_TICK) 0u, (void *) 0,
+              (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR) },
+            { &App_TaskBallTCB,        "Ball",        App_TaskBall,        (void *) 0,
+              (OS_PRIO) APP_CFG_TASK_BALL_PRIO,         &App_TaskBallStk[0],
+              (CPU_STK_SIZE) APP_CFG_TASK_BALL_STK_SIZE_LIMIT,
+              (CPU_STK_SIZE) APP_CFG_TASK_BALL_STK_SIZE,
+              (OS_MSG_QTY) BALL_Q_SIZE, /* built-in queue carries steering and claims */
+              (OS_TICK) 0u, (void *) 0,
+              (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR) },
+            { &App_TaskPaddleLeftTCB,  "PaddleLeft",  App_TaskPaddleLeft,  (void *) 0,
+              (OS_PRIO) APP_CFG_TASK_PADDLE_LEFT_PRIO,  &App_TaskPaddleLeftStk[0],
+              (CPU_STK_SIZE) APP_CFG_TASK_PADDLE_LEFT_STK_SIZE_LIMIT,
+              (CPU_STK_SIZE) APP_CFG_TASK_PADDLE_LEFT_STK_SIZE,
+              (OS_MSG_QTY) 0u, (OS_TICK) 0u, (void *) 0,
+              (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR) },
+            { &App_TaskPaddleRightTCB, "PaddleRight", App_TaskPaddleRight, (void *) 0,
+              (OS_PRIO) APP_CFG_TASK_PADDLE_RIGHT_PRIO, &App_TaskPaddleRightStk[0],
+              (CPU_STK_SIZE) APP_CFG_TASK_PADDLE_RIGHT_STK_SIZE_LIMIT,
+              (CPU_STK_SIZE) APP_CFG_TASK_PADDLE_RIGHT_STK_SIZE,
+              (OS_MSG_QTY) 0u, (OS_TICK) 0u, (void *) 0,
+              (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR) },
+            { &App_TaskPumpTCB,        "OutPump",     App_TaskPump,        (void *) 0,
+              (OS_PRIO) APP_CFG_TASK_PUMP_PRIO,         &App_TaskPumpStk[0],
+              (CPU_STK_SIZE) APP_CFG_TASK_PUMP_STK_SIZE_LIMIT,
+              (CPU_STK_SIZE) APP_CFG_TASK_PUMP_STK_SIZE,
+              (OS_MSG_QTY) 0u, (OS_TICK) 0u, (void *) 0,
+              (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR) },
+        };
+        OS_OBJ_QTY n;
+
+        n = OSTaskCreateBatch((OS_TASK_DESC *) &task_tbl[0],
+                              (OS_OBJ_QTY) (sizeof(task_tbl) / sizeof(task_tbl[0])),
+                              (OS_ERR *) &os_err);
+        if (os_err != OS_ERR_NONE) { /* n is the index of the entry that failed */
+            AppErr_Record(os_err, APP_ERR_SITE_TASK_CREATE);
+            putsU1("Error starting task: "); /* boot path, single threaded: printing is safe */
+            putsU1((char *) task_tbl[n].NamePtr);
+        }
+        if (n > (OS_OBJ_QTY) 0) { /* the render server is entry 0 */
+            Render_SrvReady = DEF_TRUE;
+        }
     }
+#endif
 
 }
 
@@ -300,6 +461,65 @@ static void AppTaskCreate(void) {
 /* Local functions */
 // *********************************************************************
 
+// ***************************************************************************
+// VT100 escape-sequence builder
+//   Assembles the complete escape sequence plus payload into a caller
+//   supplied stack buffer, then the whole thing is submitted with one
+//   putsU1 call instead of 7+ individual putU1 calls per cursor move.
+//   VT100 sequences never contain a NUL, so the buffers are zero
+//   terminated and handed to putsU1 as ordinary strings.
+// ***************************************************************************
+#define VT100_SEQ_BUF_SIZE  24  // worst case: move (8) + payload + NUL
+
+// Two-ASCII-digit pairs for 0..99, precomputed into flash: each cursor
+// move coordinate becomes two table loads instead of a divide and a
+// modulo per axis, for static and dynamic positions alike.
+#define VT100_DIG_ROW(t)  {t,'0'},{t,'1'},{t,'2'},{t,'3'},{t,'4'},{t,'5'},{t,'6'},{t,'7'},{t,'8'},{t,'9'}
+static const char VT100_DigitPairTbl[100][2] = {
+    VT100_DIG_ROW('0'), VT100_DIG_ROW('1'), VT100_DIG_ROW('2'), VT100_DIG_ROW('3'), VT100_DIG_ROW('4'),
+    VT100_DIG_ROW('5'), VT100_DIG_ROW('6'), VT100_DIG_ROW('7'), VT100_DIG_ROW('8'), VT100_DIG_ROW('9')
+};
+
+// Append a 2 digit base 10 number to the sequence, returns chars written
+static int VT100_PutNum(char *p, int i) {
+    p[0] = VT100_DigitPairTbl[i][0];
+    p[1] = VT100_DigitPairTbl[i][1];
+    return 2;
+}
+
+// Build 'esc [ rr ; cc H' into buf, returns sequence length
+static int VT100_BuildCursorMove(char *buf, int Xpos, int Ypos) {
+    int n = 0;
+    buf[n++] = 0x1B;
+    buf[n++] = '[';
+    n += VT100_PutNum(&buf[n], Ypos);
+    buf[n++] = ';';
+    n += VT100_PutNum(&buf[n], Xpos);
+    buf[n++] = 'H';
+    return n;
+}
+
+// Post one draw command to the render task, dropping it if the queue is full
+static void Render_Post(CPU_INT08U type, int x, int y, char ch, int value) {
+    RENDER_CMD *cmd;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    cmd = &Render_CmdPool[Render_CmdIdx];
+    cmd->type  = type;
+    cmd->x     = (CPU_INT08U)x;
+    cmd->y     = (CPU_INT08U)y;
+    cmd->ch    = ch;
+    cmd->value = value;
+    OSTaskQPost(&App_TaskRenderTCB, (void *)cmd, sizeof(RENDER_CMD),
+            OS_OPT_POST_FIFO, &err);
+    if (err == OS_ERR_NONE) {
+        Render_CmdIdx = (Render_CmdIdx + 1) % RENDER_Q_SIZE;
+    }                           // on overflow the command is dropped and the slot reused
+    CPU_CRITICAL_EXIT();
+}
+
 // Prints a 2 digit base 10 number
 
 void UART_PrintNum(int i) {
@@ -315,63 +535,425 @@ void UART_PrintNum3(int i) {
     putU1(((i % 100) % 10) + '0');
 }
 
+// Prints an unsigned base 10 number without leading zeroes
+
+void UART_PrintNumU32(CPU_INT32U v) {
+    char buf[10]; // 4294967295 is 10 digits
+    int n = 0;
+
+    do {
+        buf[n++] = (char) (v % 10u + '0');
+        v /= 10u;
+    } while (v > 0u);
+    while (n > 0) {
+        putU1(buf[--n]);
+    }
+}
+
+#if APP_CFG_KERNEL_RAM_RPT_EN > 0u
+// ***************************************************************************
+// Kernel RAM footprint report
+//   Walks the const table built in os_cfg_app.c and prints one line per
+//   statically allocated kernel object, then the total (OSCfg_DataSizeRAM).
+//   Turns stack/pool size tuning into an edit-flash-read loop instead of
+//   digging the figures out of the linker map file.
+// ***************************************************************************
+static void App_KernelRAMReport(void) {
+    OS_OBJ_QTY i;
+
+    putsU1("uC/OS-III static RAM (bytes):\r\n");
+    for (i = 0; i < OSCfg_DataSizeRAMTblEntries; i++) {
+        putsU1("  ");
+        putsU1((char *) OSCfg_DataSizeRAMTbl[i].NamePtr);
+        putsU1(": ");
+        UART_PrintNumU32(OSCfg_DataSizeRAMTbl[i].SizeRAM);
+        putsU1("\r\n");
+    }
+    putsU1("  Total: ");
+    UART_PrintNumU32(OSCfg_DataSizeRAM);
+    putsU1("\r\n");
+}
+#endif
+
+#if APP_CFG_RAM_SECTION_RPT_EN > 0u
+// ***************************************************************************
+// RAM section footprint report
+//   Reads the linker section symbols (the same ones crt0.S uses to clear
+//   .bss and copy .data) and attributes the static RAM to its owners: the
+//   kernel figure is OSCfg_DataSizeRAM from os_cfg_app.c, the uC/LIB heap
+//   is its configured size, task stacks come from a walk of the kernel task
+//   list, and the remainder is app + driver data.  Measured from the linked
+//   image, so a "const that should be in flash" shows up as .data growth
+//   here instead of being assumed away.
+// ***************************************************************************
+extern char _data_begin[], _data_end[], _bss_begin[], _bss_end[];
+
+static void App_RAMSectionReport(void) {
+    CPU_INT32U data_size = (CPU_INT32U) (_data_end - _data_begin);
+    CPU_INT32U bss_size  = (CPU_INT32U) (_bss_end - _bss_begin);
+    CPU_INT32U total     = data_size + bss_size;
+    CPU_INT32U known     = OSCfg_DataSizeRAM;
+#if OS_CFG_DBG_EN > 0u
+    CPU_INT32U stk_size;
+    OS_TCB    *p_tcb;
+#endif
+
+    putsU1("RAM sections (bytes):\r\n  .data: ");
+    UART_PrintNumU32(data_size);
+    putsU1("  .bss: ");
+    UART_PrintNumU32(bss_size);
+    putsU1("  total: ");
+    UART_PrintNumU32(total);
+    putsU1("\r\n  kernel (OSCfg_DataSizeRAM): ");
+    UART_PrintNumU32(OSCfg_DataSizeRAM);
+#if LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED
+    putsU1("\r\n  uC/LIB heap: ");
+    UART_PrintNumU32((CPU_INT32U) LIB_MEM_CFG_HEAP_SIZE);
+    known += (CPU_INT32U) LIB_MEM_CFG_HEAP_SIZE;
+#endif
+#if OS_CFG_DBG_EN > 0u
+    putsU1("\r\n  task stacks (kernel task stacks are in the kernel figure):\r\n");
+    p_tcb = OSTaskDbgListPtr;
+    while (p_tcb != (OS_TCB *) 0) {
+        stk_size = (CPU_INT32U) p_tcb->StkSize * sizeof(CPU_STK);
+        putsU1("    ");
+        putsU1((char *) p_tcb->NamePtr);
+        putsU1(": ");
+        UART_PrintNumU32(stk_size);
+        putsU1("\r\n");
+        p_tcb = p_tcb->DbgNextPtr;
+    }
+    putsU1("  app + drivers (total - kernel - heap): ");
+#else
+    putsU1("\r\n  app + drivers (total - kernel - heap): ");
+#endif
+    UART_PrintNumU32(total - known);    // includes app task stacks and the driver rings
+    putsU1("\r\n");
+}
+#endif
+
+#if APP_CFG_INT_MAP_RPT_EN > 0u
+// ***************************************************************************
+// Interrupt latency-class map report
+//   Prints the class -> IPL scheme fixed in int.h and every vector that
+//   registered through INTLatencyClassAssign(), so the boot log shows which
+//   latency budget each ISR signed up for.  Vectors wired before the API
+//   existed (tick at 3, UART1/DMA at 2, the CS0 relay at 1) keep their
+//   hardcoded levels and do not appear in the assigned list.
+// ***************************************************************************
+static void App_IntMapReport(void) {
+    static const char * const class_name[INT_CLASS_QTY] = { "hard", "kernel", "background" };
+    const char  *name;
+    unsigned int vect;
+    unsigned int cls;
+    unsigned int i;
+
+    putsU1("Interrupt latency classes (IPL):\r\n  hard: ");
+    UART_PrintNumU32((CPU_INT32U) INTLatencyClassIPL(INT_CLASS_HARD));
+    putsU1("  kernel: ");
+    UART_PrintNumU32((CPU_INT32U) INTLatencyClassIPL(INT_CLASS_KERNEL));
+    putsU1("  background: ");
+    UART_PrintNumU32((CPU_INT32U) INTLatencyClassIPL(INT_CLASS_BACKGROUND));
+    putsU1("\r\n  assigned vectors:\r\n");
+    for (i = 0; i < INTLatencyClassMapQty(); i++) {
+        (void)INTLatencyClassMapGet(i, &vect, &cls, &name);
+        putsU1("    vec ");
+        UART_PrintNumU32((CPU_INT32U) vect);
+        putsU1(" ");
+        putsU1((char *) name);
+        putsU1(": ");
+        putsU1((char *) class_name[cls]);
+        putsU1("\r\n");
+    }
+}
+#endif
+
+#if APP_CFG_INT_DIS_HIST_RPT_EN > 0u
+// ***************************************************************************
+// Interrupts-disabled-time histogram report
+//   Snapshots each site's log2 histogram out of cpu_core.c and prints one
+//   "site: 2^i=count ..." line per site (empty buckets suppressed), so the
+//   kernel module behind a tail latency can be read straight off the
+//   terminal.  Bucket i counts critical sections of 2^i..2^(i+1)-1 core
+//   timer ticks (40 MHz).
+// ***************************************************************************
+static void App_IntDisHistReport(void) {
+    static const char *site_names[CPU_INT_DIS_MEAS_HIST_SITE_NBR] = {
+        "none", "os_core", "os_q", "os_sem", "os_task", "lib_mem", "bsp", "app"
+    };
+    CPU_INT32U bucket_tbl[CPU_INT_DIS_MEAS_HIST_BUCKET_NBR];
+    CPU_INT08U site;
+    CPU_INT08U i;
+
+    putsU1("Ints-disabled time histogram (core timer ticks):\r\n");
+    for (site = 0; site < CPU_INT_DIS_MEAS_HIST_SITE_NBR; site++) {
+        CPU_IntDisMeasHistGet(site, &bucket_tbl[0]);
+        putsU1("  ");
+        putsU1((char *) site_names[site]);
+        putsU1(":");
+        for (i = 0; i < CPU_INT_DIS_MEAS_HIST_BUCKET_NBR; i++) {
+            if (bucket_tbl[i] > 0u) {
+                putsU1(" 2^");
+                UART_PrintNumU32(i);
+                putsU1("=");
+                UART_PrintNumU32(bucket_tbl[i]);
+            }
+        }
+        putsU1("\r\n");
+    }
+}
+#endif
+
+#if APP_CFG_SCHED_BENCH_RPT_EN > 0u
+// ***************************************************************************
+// Scheduler hot-path cycle benchmark
+//   Times APP_SCHED_BENCH_ITER back-to-back calls of OS_PrioGetHighest()
+//   and OSSched() with the core timer and prints the totals.  Build once
+//   with the RAM-resident kernel placement (OS_RAM_FN in os_cpu.h) and
+//   once with it empty to read the flash wait-state cost off the terminal.
+//   Runs from the start task before the game tasks exist, so OSSched()
+//   finds nothing higher ready and returns without switching.
+// ***************************************************************************
+#define APP_SCHED_BENCH_ITER  1000u
+static void App_SchedBenchReport(void) {
+    CPU_TS_TMR ts_start;
+    CPU_TS_TMR ts_end;
+    CPU_INT32U i;
+    volatile OS_PRIO prio;
+
+    putsU1("Sched bench (core timer ticks / 1000 calls):\r\n  OS_PrioGetHighest: ");
+    ts_start = CPU_TS_TMR_RD();
+    for (i = 0; i < APP_SCHED_BENCH_ITER; i++) {
+        prio = OS_PrioGetHighest();
+    }
+    ts_end = CPU_TS_TMR_RD();
+    (void) prio;
+    UART_PrintNumU32((CPU_INT32U)(ts_end - ts_start));
+
+    putsU1("\r\n  OSSched: ");
+    ts_start = CPU_TS_TMR_RD();
+    for (i = 0; i < APP_SCHED_BENCH_ITER; i++) {
+        OSSched();
+    }
+    ts_end = CPU_TS_TMR_RD();
+    UART_PrintNumU32((CPU_INT32U)(ts_end - ts_start));
+    putsU1("\r\n");
+}
+#endif
+
+#if APP_CFG_FLASH_CFG_RPT_EN > 0u
+// ***************************************************************************
+// Prefetch cache / flash wait-state report
+//   Prints the CHECON configuration SYSTEMConfigPerformance() left us with
+//   and the BSP's instruction-fetch benchmark, so a board variant running a
+//   slow flash configuration shows up on the terminal at boot.
+// ***************************************************************************
+static void App_FlashCfgReport(void) {
+    putsU1("Flash cfg: wait states=");
+    UART_PrintNumU32((CPU_INT32U) BSP_FlashWaitStatesGet());
+    putsU1(" prefetch mode=");
+    UART_PrintNumU32((CPU_INT32U) BSP_FlashPrefetchGet());
+    putsU1(" fetch bench=");
+    UART_PrintNumU32(BSP_FlashFetchBench());
+    putsU1(" ticks/1000 loops\r\n");
+}
+#endif
+
+#if APP_CFG_INT_LAT_RPT_EN > 0u
+// One-shot dump of the BSP's per-vector interrupt latency monitor: one
+// line per vector that has fired, with count, worst case, and the log2
+// histogram (bucket n counts latencies in [2^n, 2^(n+1)) core timer
+// counts of 25 ns).  Scrolls the terminal, so it is a diagnostics-build
+// option, off by default.
+static void App_IntLatReport(void) {
+    CPU_INT32U max;
+    CPU_INT32U cnt;
+    CPU_INT16U hist[BSP_INT_LAT_HIST_SIZE];
+    CPU_INT08U vect;
+    CPU_INT08U i;
+
+    putsU1("\r\nint latency (core timer counts):\r\n");
+    for (vect = 0; vect < BSP_INT_LAT_VECT_QTY; vect++) {
+        if (BSP_IntLatGet(vect, &max, &cnt, &hist[0]) != DEF_TRUE) {
+            continue;
+        }
+        if (cnt == 0u) {
+            continue;
+        }
+        putsU1("v=");
+        UART_PrintNumU32((CPU_INT32U) vect);
+        putsU1(" cnt=");
+        UART_PrintNumU32(cnt);
+        putsU1(" max=");
+        UART_PrintNumU32(max);
+        putsU1(" hist:");
+        for (i = 0; i < BSP_INT_LAT_HIST_SIZE; i++) {
+            putsU1(" ");
+            UART_PrintNumU32((CPU_INT32U) hist[i]);
+        }
+        putsU1("\r\n");
+    }
+}
+#endif
+
+#if APP_CFG_BOOT_PROF_RPT_EN > 0u
+// Boot-stage timestamp report: one line per BSP_BootMark(), with the
+// absolute time since reset and the delta from the previous stage, in
+// core timer counts (25 ns) -- the baseline for startup-time work.
+static void App_BootProfReport(void) {
+    const CPU_CHAR *name;
+    CPU_INT32U count;
+    CPU_INT32U prev = 0;
+    CPU_INT08U ix;
+    CPU_INT08U n;
+
+    putsU1("\r\nboot stages (core timer counts since reset):\r\n");
+    for (ix = 0; ix < BSP_BootMarkQty(); ix++) {
+        if (BSP_BootMarkGet(ix, &name, &count) != DEF_TRUE) {
+            break;
+        }
+        putsU1("  ");
+        n = 0;
+        while (name[n] != '\0') {
+            putU1(name[n]);
+            n++;
+        }
+        while (n < 12) {
+            putU1(' ');
+            n++;
+        }
+        UART_PrintNumU32(count);
+        putsU1("  (+");
+        UART_PrintNumU32(count - prev);
+        putsU1(")\r\n");
+        prev = count;
+    }
+}
+#endif
+
 void Screen_Clear(void) {
-    putU1(0x1B);
-    putU1('c');
+    putsU1("\x1B" "c");
+}
+
+// Emit a flash-resident const string at the current cursor position with
+// zero RAM copies: the scatter descriptor hands the literal itself to
+// the TX interrupt (see putsU1_scat), so banners and border segments
+// occupy no ring space at all.
+void Screen_PutsConst(const char *s) {
+    putsU1_scat(s, 0);
 }
 
 void Screen_OffCursor(void) // Does seem to work
 {
-    putU1(0x1B);
-    putU1('[');
-    putU1('?');
-    putU1('2');
-    putU1('5');
-    putU1('l');
+    putsU1("\x1B[?25l");
 }
 
 void Screen_OnCursor(void) {
-    putU1(0x1B);
-    putU1('[');
-    putU1('?');
-    putU1('2');
-    putU1('5');
-    putU1('h');
+    putsU1("\x1B[?25h");
 }
 
 void Screen_MoveCursor(int Xpos, int Ypos) {
-    putU1(0x1B);
-    putU1('[');
-    UART_PrintNum(Ypos);
-    putU1(';');
-    UART_PrintNum(Xpos);
-    putU1('H');
+    char seq[VT100_SEQ_BUF_SIZE];
+    int n;
+
+    n = VT100_BuildCursorMove(seq, Xpos, Ypos);
+    seq[n] = '\0';
+    putsU1(seq);
 }
 
-int Screen_WriteChar(int x, int y, char c) {
-    OS_ERR err;
-    if ((x > SCREEN_X_END) || (x < SCREEN_X_START) ||
-            (y > SCREEN_Y_END) || (y < SCREEN_Y_START)) {
+// Execute one draw command -- only the render task calls this, so the
+// cursor cannot be stolen and no scheduler lock is needed.
+static void Render_Exec(RENDER_CMD *cmd) {
+    char seq[VT100_SEQ_BUF_SIZE];
+    int n;
+
+    n = VT100_BuildCursorMove(seq, cmd->x, cmd->y);
+    switch (cmd->type) {
+        case RENDER_CMD_CHAR:
+            seq[n++] = cmd->ch;
+            break;
+        case RENDER_CMD_NUM2:
+            n += VT100_PutNum(&seq[n], cmd->value);
+            break;
+        case RENDER_CMD_NUM3:
+            seq[n++] = cmd->value / 100u + '0';
+            seq[n++] = (cmd->value % 100) / 10u + '0';
+            seq[n++] = ((cmd->value % 100) % 10) + '0';
+            break;
+        default:
+            break;
+    }
+    seq[n] = '\0';
+    putsU1(seq); // one buffered submission
+}
+
+// Geometry bounds test as a macro so it participates in constant
+// folding: an axis passed as a literal is decided by the compiler, a
+// fully static call loses the whole test, and only truly dynamic
+// coordinates pay for it at run time.
+#define SCREEN_XY_VALID(x, y)   ((x) <= SCREEN_X_END && (x) >= SCREEN_X_START && \
+                                 (y) <= SCREEN_Y_END && (y) >= SCREEN_Y_START)
+
+// Inline cores: calls in this file resolve to these (see the defines
+// after the wrappers), so each site is specialized on whatever part of
+// its coordinates is known at compile time.  The out-of-line wrappers
+// keep the original linkage for app_hud.c, app_asset.c and app_snake.c.
+static inline int Screen_WriteCharInl(int x, int y, char c) {
+    if (!SCREEN_XY_VALID(x, y)) {
         return 1; // Error
     }
-    OSSchedLock(&err); // Don't let another task run as it might change cursor position
-    Screen_MoveCursor(x, y); // before the character is written to the screen
-    putU1(c);
-    OSSchedUnlock(&err); // Ok for other tasks to run
+    if (Render_SrvReady) {
+        Render_Post(RENDER_CMD_CHAR, x, y, c, 0);
+    } else { // render task not up yet -- draw directly (single threaded here)
+        Screen_MoveCursor(x, y);
+        putU1(c);
+    }
+    return 0;
 }
 
-int Screen_WriteNumber(int x, int y, int number) {
-    OS_ERR err;
-    if ((x > SCREEN_X_END) || (x < SCREEN_X_START) ||
-            (y > SCREEN_Y_END) || (y < SCREEN_Y_START)) {
+static inline int Screen_WriteNumberInl(int x, int y, int number) {
+    if (!SCREEN_XY_VALID(x, y)) {
+        return 1; // Error
+    }
+    if (Render_SrvReady) {
+        Render_Post(RENDER_CMD_NUM2, x, y, 0, number);
+    } else {
+        Screen_MoveCursor(x, y);
+        UART_PrintNum(number);
+    }
+    return 0;
+}
+
+static inline int Screen_WriteNumber3Inl(int x, int y, int number) {
+    if (!SCREEN_XY_VALID(x, y)) {
         return 1; // Error
     }
-    OSSchedLock(&err); // Don't let another task run as it might change cursor position
-    Screen_MoveCursor(x, y); // before writing the value to the screen
-    UART_PrintNum(number);
-    OSSchedUnlock(&err); // Ok for other tasks to run
+    if (Render_SrvReady) {
+        Render_Post(RENDER_CMD_NUM3, x, y, 0, number);
+    } else {
+        Screen_MoveCursor(x, y);
+        UART_PrintNum3(number);
+    }
+    return 0;
+}
+
+int Screen_WriteChar(int x, int y, char c) {
+    return Screen_WriteCharInl(x, y, c);
+}
+
+int Screen_WriteNumber(int x, int y, int number) {
+    return Screen_WriteNumberInl(x, y, number);
+}
+
+int Screen_WriteNumber3(int x, int y, int number) {
+    return Screen_WriteNumber3Inl(x, y, number);
 }
 
+// Everything below (the game tasks) goes through the inline cores
+#define Screen_WriteChar(x, y, c)        Screen_WriteCharInl((x), (y), (c))
+#define Screen_WriteNumber(x, y, n)      Screen_WriteNumberInl((x), (y), (n))
+#define Screen_WriteNumber3(x, y, n)     Screen_WriteNumber3Inl((x), (y), (n))
+
 void Screen_Init(void) {
     int i;
     Screen_OffCursor();
@@ -384,12 +966,183 @@ void Screen_Init(void) {
 /* Application Tasks*/
 // *********************************************************************
 
+// Render server: pends on its task queue for draw commands and executes
+// them one at a time.  Because this is the only task that writes cursor
+// sequences after startup, screen output needs no scheduler lock at all.
+static void App_TaskRender(void *data) {
+    RENDER_CMD *cmd;
+    OS_MSG_SIZE msg_size;
+    OS_ERR err;
+
+    (void) data;
+    while (DEF_TRUE) {
+        cmd = (RENDER_CMD *) OSTaskQPend((OS_TICK) 0,
+                OS_OPT_PEND_BLOCKING,
+                &msg_size,
+                (CPU_TS *) 0,
+                &err);
+        if (err == OS_ERR_NONE) {
+            Render_Exec(cmd);
+        }
+    }
+}
+
+// Output pump: the single low-priority producer of all background UART
+// output.  One wakeup per cycle renders the stats snapshot into HUD
+// updates (or one telemetry frame) and runs the deferred one-shot
+// dumps, so steady-state background output costs one context switch
+// per cycle instead of one per producer -- the saving shows up in the
+// per-task CPU rows this task maintains.  It runs in the render
+// server's slack level, and its bytes go out on the default TX lane,
+// which the high lane (game draws) always preempts (see UART1.h).
+static void App_TaskPump(void *data) {
+#if (OS_CFG_STAT_TASK_EN > 0) && (APP_CFG_SNAKE_EN == 0u)
+    APP_STAT_SNAP stat_snap;
+    // Incremental HUD fields: glyphs are cached, so an unchanged stat
+    // posts zero draw commands to the render server.  Locals persist --
+    // this task never returns.
+    HUD_FIELD hud_cpu, hud_tasks, hud_stk_free, hud_stk_used;
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    HUD_FIELD hud_lock_max, hud_lock_prio;
+#endif
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    HUD_FIELD hud_usage_tbl[8];
+    char hud_letter_tbl[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+#endif
+#endif
+#if APP_CFG_INT_LAT_RPT_EN > 0u
+    CPU_INT08U int_lat_rpt_ctr = 0;
+#endif
+#if (APP_CFG_SNAKE_EN == 0u) && (APP_CFG_TELEM_EN == 0u)
+    HUD_FIELD hud_err_cnt;                      // error summary row (app_err.h)
+    HUD_FIELD hud_err_code;
+#endif
+    CPU_INT32U err_total_prev = 0;
+    CPU_INT08U i;
+    OS_ERR err;
+
+    (void) data;
+    (void) i;
+
+#if (OS_CFG_STAT_TASK_EN > 0) && (APP_CFG_SNAKE_EN == 0u) && (APP_CFG_TELEM_EN == 0u)
+    HUD_FieldInit(&hud_cpu,      40, 2, 5);     /* 0..10000 (xx.xx %)       */
+    HUD_FieldInit(&hud_tasks,    40, 3, 2);
+    HUD_FieldInit(&hud_stk_free, 40, 4, 3);
+    HUD_FieldInit(&hud_stk_used, 40, 5, 3);
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    HUD_FieldInit(&hud_lock_max, 40, 6, 8);
+    HUD_FieldInit(&hud_lock_prio, 50, 6, 2);
+#endif
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    for (i = 0; i < 8; i++) {
+        HUD_FieldInit(&hud_usage_tbl[i], 58, 2 + i, 5);
+    }
+#endif
+#endif
+#if (APP_CFG_SNAKE_EN == 0u) && (APP_CFG_TELEM_EN == 0u)
+    HUD_FieldInit(&hud_err_cnt,  40, 7, 5);     /* OS_ERR events recorded   */
+    HUD_FieldInit(&hud_err_code, 46, 7, 5);     /* most recent error code   */
+#endif
+
+    while (DEF_TRUE) {
+
+// If enabled writes:  CPU usage, number of tasks, stack free, stack used
+// (skipped in snake builds: the snake task owns the screen through the
+// framebuffer and there is no render server to queue these writes to)
+#if (OS_CFG_STAT_TASK_EN > 0) && (APP_CFG_SNAKE_EN == 0u) // Set in os_cfg.h / app_cfg.h
+        // One lock-free copy of the snapshot the statistics task publishes
+        // each pass (app_stat.c): every field below is from the same pass
+        // -- the consistency this loop used to buy with OSSchedLock --
+        // and reading it never touches the scheduler at all
+        if (AppStat_SnapGet(&stat_snap)) {
+#if APP_CFG_TELEM_EN > 0u
+            // Headless mode: one binary frame per publish instead of the
+            // positioned-ASCII HUD writes below (spec in app_telem.h)
+            Telem_StatFrameSend(&stat_snap);
+#else
+            HUD_FieldUpdate(&hud_cpu,   (CPU_INT32U) stat_snap.CPUUsage);
+            HUD_FieldUpdate(&hud_tasks, (CPU_INT32U) stat_snap.TaskQty);
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+            // Worst scheduler blackout so far, in TS timer counts (25 ns
+            // each), and the priority of the task that caused it.  The
+            // app-level OSSchedLock windows around UART bursts are gone
+            // (the render server owns the UART now); this row proves the
+            // remaining lock windows stay small.
+            HUD_FieldUpdate(&hud_lock_max, (CPU_INT32U) stat_snap.SchedLockTimeMax);
+            if (stat_snap.SchedLockPrio != 0xFF) {
+                HUD_FieldUpdate(&hud_lock_prio, (CPU_INT32U) stat_snap.SchedLockPrio);
+            }
+#endif
+
+            // Per-task rows: first letter of the task name and its CPU
+            // percentage, plus this task's own stack numbers, all out of
+            // the same snapshot
+            for (i = 0; i < stat_snap.TaskN; i++) {
+                if (stat_snap.TaskTbl[i].TCBPtr == &App_TaskStartTCB) {
+                    HUD_FieldUpdate(&hud_stk_free, (CPU_INT32U) stat_snap.TaskTbl[i].StkFree);
+                    HUD_FieldUpdate(&hud_stk_used, (CPU_INT32U) stat_snap.TaskTbl[i].StkUsed);
+                }
+#if OS_CFG_TASK_PROFILE_EN > 0u
+                if (hud_letter_tbl[i] != stat_snap.TaskTbl[i].NameCh) {
+                    hud_letter_tbl[i] = stat_snap.TaskTbl[i].NameCh;
+                    Screen_WriteChar(56, 2 + i, stat_snap.TaskTbl[i].NameCh);
+                }
+                HUD_FieldUpdate(&hud_usage_tbl[i], (CPU_INT32U) stat_snap.TaskTbl[i].Usage);
+#endif
+            }
+#endif
+        }
+#endif
+
+#if APP_CFG_INT_LAT_RPT_EN > 0u
+        if (int_lat_rpt_ctr < 8u) {                  // one-shot dump once ~30 s of
+            int_lat_rpt_ctr++;                       // ... samples have accumulated
+            if (int_lat_rpt_ctr == 8u) {
+                App_IntLatReport();
+            }
+        }
+#endif
+
+#if APP_CFG_SNAKE_EN == 0u
+        // Error summary at counter cost: touched only when something
+        // was recorded since the last cycle (app_err.h)
+        if (AppErr_TotalGet() != err_total_prev) {
+            err_total_prev = AppErr_TotalGet();
+#if APP_CFG_TELEM_EN > 0u
+            Telem_ErrFrameSend();
+#else
+            HUD_FieldUpdate(&hud_err_cnt,  err_total_prev);
+            HUD_FieldUpdate(&hud_err_code, (CPU_INT32U) AppErr_LastGet((CPU_INT08U *) 0));
+#endif
+        }
+#endif
+
+        // One wakeup per cycle; same cadence the start task's old
+        // 8 x 500 ms LED walk gave the stats rendering
+        OSTimeDly(OS_MS_TO_TICKS(4000), OS_OPT_TIME_DLY, &err); // constant-folded
+    }
+}
+
+// Frame period in ticks; deadlines are absolute so frame time never drifts.
+// Since the ball moves by elapsed time (app_time.h), this period sets only
+// the display/input cadence -- raise it under load and gameplay speed holds.
+#define BALL_PERIOD_TICKS   ((75 * OS_CFG_TICK_RATE_HZ) / 1000)
+
+#define BALL_SPEED_LEVEL    GAME_SPEED_NORMAL // one cell per 75 ms, as before
+
 void App_TaskBall(void *data) {
     int x, y;
-    x_delta = 1;
-    y_delta = 0;
+    int x_delta = 1, y_delta = 0; // direction is task-private; changed only by queued commands
+    int claim_left_y = PADDLE_Y_START; // paddle extents, updated by cell-claim messages
+    int claim_right_y = PADDLE_Y_START;
     //int Ls, Rs, Left_Score = 0, Right_Score = 0;
+    void *msg;
+    OS_MSG_SIZE msg_size;
     OS_ERR err;
+    OS_TICK frame_deadline;
+    GAME_TIME_ACC ball_acc;
+    CPU_INT08U steps;
 
     //Screen_WriteNumber(SCORE_LEFT_X_START, SCORE_Y, Left_Score);
     //Screen_WriteNumber(SCORE_RIGHT_X_START, SCORE_Y, Right_Score);
@@ -397,60 +1150,161 @@ void App_TaskBall(void *data) {
     x = BALL_X_START;
     y = BALL_Y_START;
     Screen_WriteChar(x, y, '*');
+    frame_deadline = OSTimeGet(&err); // first deadline is one period from now
+    GameTime_AccInit(&ball_acc);
     while (DEF_TRUE) {
-        OSTimeDlyHMSM(0, 0, 0, 75, OS_OPT_TIME_HMSM_STRICT, &err); // Wait -- give another task a chance to run
+
+        // Fixed timestep: sleep until the absolute frame deadline, so the
+        // period stays 75ms no matter how long this frame took to render
+        OSTimeDlyUntil(&frame_deadline, (OS_TICK) BALL_PERIOD_TICKS, &err);
         Screen_WriteChar(x, y, ' '); // Erase old position
 
+        // Drain the private queue without blocking.  The last steering
+        // command of the frame wins; claim messages refresh the cells the
+        // paddles own so collisions are resolved here, message-driven,
+        // with no shared board state and no scheduler lock.
+        for (;;) {
+            msg = OSTaskQPend((OS_TICK) 0,
+                    OS_OPT_PEND_NON_BLOCKING,
+                    &msg_size,
+                    (CPU_TS *) 0,
+                    &err);
+            if (err != OS_ERR_NONE) {
+                break; // queue empty
+            }
+            switch (BALL_MSG_TYPE(msg)) {
+                case BALL_MSG_DIR:
+                    x_delta = BALL_MSG_A(msg);
+                    y_delta = BALL_MSG_B(msg);
+                    break;
+                case BALL_MSG_CLAIM_L:
+                    claim_left_y = BALL_MSG_B(msg);
+                    break;
+                case BALL_MSG_CLAIM_R:
+                    claim_right_y = BALL_MSG_B(msg);
+                    break;
+                default:
+                    break;
+            }
+        }
+
         //if ((Ls = (x > SCREEN_X_END)) || (Rs = (x < SCREEN_X_START))) Ball_Xdelta = -Ball_Xdelta; //Provides collisions
         //if ((y > SCREEN_Y_END) || (y < SCREEN_Y_START)) Ball_Ydelta = -Ball_Ydelta; //Provides collisions
-        if (Ball_Up())
-        {
-            x_delta = 0;
-            y_delta = 1;
-        } else if (Ball_Down())
-        {
-            x_delta = 0;
-            y_delta = -1;
-        } else if (Ball_Right())
-        {
-            x_delta = -1;
-            y_delta = 0;
-        } else if (Ball_Left())
-        {
-            x_delta = 1;
-            y_delta = 0;
-        }
 
-        x += x_delta; // Move to new position
-        y += y_delta;
+        // Advance by elapsed wall time, not by frame count: a late or
+        // stretched frame is paid back in extra cells here, one cell at
+        // a time so paddle collisions are still resolved per cell.
+        for (steps = GameTime_Steps(&ball_acc, BALL_SPEED_LEVEL); steps > 0u; steps--) {
+
+            // Cells claimed by a paddle act as walls
+            if ((x + x_delta == PADDLE_LEFT_X) &&
+                    (y >= claim_left_y) && (y < claim_left_y + PADDLE_LENGTH)) {
+                x_delta = -x_delta;
+            }
+            if ((x + x_delta == PADDLE_RIGHT_X) &&
+                    (y >= claim_right_y) && (y < claim_right_y + PADDLE_LENGTH)) {
+                x_delta = -x_delta;
+            }
+
+            x += x_delta; // Move to new position
+            y += y_delta;
+        }
         Screen_WriteChar(x, y, '*');
     }
 }
 
-int Ball_Up() {
-    if (RIGHT_UP_SW)
-        return 1;
-    else
-        return 0;
+// Paddle update period; button sampling happens here now, not in the ball
+#define PADDLE_PERIOD_MS    50
+
+// Left paddle task: draws and claims the left paddle column, then samples
+// its two buttons and posts steering commands to the ball task's queue.
+// Posting only on button CHANGE keeps the queue from flooding while a
+// button is held.
+static void App_TaskPaddleLeft(void *data) {
+    OS_ERR err;
+    CPU_INT08U btns;
+    CPU_INT08U btns_prev = 0;
+    int y = PADDLE_Y_START;
+    int i;
+
+    (void) data;
+    for (i = 0; i < PADDLE_LENGTH; i++) {
+        Screen_WriteChar(PADDLE_LEFT_X, y + i, '|');
+    }
+    OSTaskQPost(&App_TaskBallTCB, // tell the ball which cells we own
+            BALL_MSG_PACK(BALL_MSG_CLAIM_L, PADDLE_LEFT_X, y),
+            (OS_MSG_SIZE) 0,
+            OS_OPT_POST_FIFO,
+            &err);
+    while (DEF_TRUE) {
+        OSTimeDly(OS_MS_TO_TICKS(PADDLE_PERIOD_MS), OS_OPT_TIME_DLY, &err); // constant-folded
+        btns = BSP_ButtonsSnapshot();
+        if (btns != btns_prev) {
+            if (Ball_Right(btns)) {
+                OSTaskQPost(&App_TaskBallTCB,
+                        BALL_MSG_PACK(BALL_MSG_DIR, -1, 0),
+                        (OS_MSG_SIZE) 0, OS_OPT_POST_FIFO, &err);
+            } else if (Ball_Left(btns)) {
+                OSTaskQPost(&App_TaskBallTCB,
+                        BALL_MSG_PACK(BALL_MSG_DIR, 1, 0),
+                        (OS_MSG_SIZE) 0, OS_OPT_POST_FIFO, &err);
+            }
+            btns_prev = btns;
+        }
+    }
+}
+
+// Right paddle task: same pattern as the left paddle, owning the right
+// paddle column and the up/down steering buttons.
+static void App_TaskPaddleRight(void *data) {
+    OS_ERR err;
+    CPU_INT08U btns;
+    CPU_INT08U btns_prev = 0;
+    int y = PADDLE_Y_START;
+    int i;
+
+    (void) data;
+    for (i = 0; i < PADDLE_LENGTH; i++) {
+        Screen_WriteChar(PADDLE_RIGHT_X, y + i, '|');
+    }
+    OSTaskQPost(&App_TaskBallTCB, // tell the ball which cells we own
+            BALL_MSG_PACK(BALL_MSG_CLAIM_R, PADDLE_RIGHT_X, y),
+            (OS_MSG_SIZE) 0,
+            OS_OPT_POST_FIFO,
+            &err);
+    while (DEF_TRUE) {
+        OSTimeDly(OS_MS_TO_TICKS(PADDLE_PERIOD_MS), OS_OPT_TIME_DLY, &err); // constant-folded
+        btns = BSP_ButtonsSnapshot();
+        if (btns != btns_prev) {
+            if (Ball_Up(btns)) {
+                OSTaskQPost(&App_TaskBallTCB,
+                        BALL_MSG_PACK(BALL_MSG_DIR, 0, 1),
+                        (OS_MSG_SIZE) 0, OS_OPT_POST_FIFO, &err);
+            } else if (Ball_Down(btns)) {
+                OSTaskQPost(&App_TaskBallTCB,
+                        BALL_MSG_PACK(BALL_MSG_DIR, 0, -1),
+                        (OS_MSG_SIZE) 0, OS_OPT_POST_FIFO, &err);
+            }
+            btns_prev = btns;
+        }
+    }
+}
+
+// The Ball_* helpers decode bits from the per-frame BSP_ButtonsSnapshot()
+// value instead of each doing its own volatile PORT read.
+
+int Ball_Up(CPU_INT08U btns) {
+    return (btns & RIGHT_UP_SW) ? 1 : 0;
 }
 
-int Ball_Down(void) {
-    if (RIGHT_DOWN_SW)
-        return 1;
-    else
-        return 0;
+int Ball_Down(CPU_INT08U btns) {
+    return (btns & RIGHT_DOWN_SW) ? 1 : 0;
 }
 
-int Ball_Left() {
-    if (LEFT_UP_SW)
-        return 1;
-    else
-        return 0;
+int Ball_Left(CPU_INT08U btns) {
+    return (btns & LEFT_UP_SW) ? 1 : 0;
 }
 
-int Ball_Right() {
-    if (LEFT_DOWN_SW)
-        return 1;
-    else
-        return 0;
+int Ball_Right(CPU_INT08U btns) {
+    return (btns & LEFT_DOWN_SW) ? 1 : 0;
 }
\ No newline at end of file
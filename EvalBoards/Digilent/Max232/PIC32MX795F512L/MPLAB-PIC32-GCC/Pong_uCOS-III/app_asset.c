@@ -0,0 +1,74 @@
+/**************************************************************************
+ * File:         app_asset.c   Flash-resident screen asset blitter
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  See app_asset.h for the asset format.  Literal spans are
+ *               handed to the TX interrupt as scatter descriptors -- the
+ *               bytes transmit straight out of flash with no RAM copy --
+ *               and only the two opcodes expand through a small stack
+ *               buffer.  The blitter itself is a byte scan: no per-cell
+ *               computation, no divides beyond the two digits of a
+ *               cursor move.
+ **************************************************************************/
+#include <includes.h>
+#include "app_asset.h"
+
+// ----- Emit a cursor move for the MOVE opcode (same two-digit form the
+//       framebuffer renderer uses)
+static void Asset_EmitMove(int col, int row) {
+    char buf[9];
+    int n = 0;
+
+    buf[n++] = 0x1B;
+    buf[n++] = '[';
+    buf[n++] = row / 10 + '0';
+    buf[n++] = row % 10 + '0';
+    buf[n++] = ';';
+    buf[n++] = col / 10 + '0';
+    buf[n++] = col % 10 + '0';
+    buf[n++] = 'H';
+    buf[n] = '\0';
+    putsU1(buf);
+}
+
+// ----- Stream one asset (see app_asset.h).  Call from task level; the
+//       asset must be const (flash resident): literal spans are still
+//       referenced by the TX interrupt after this returns.
+void Asset_Blit(const char *p_asset) {
+    const char *p = p_asset;
+    const char *span;
+    unsigned char cnt;
+    char c;
+
+    while (*p != ASSET_OP_END) {
+        if (*p == ASSET_OP_MOVE) {
+            Asset_EmitMove((int) (unsigned char) p[1], (int) (unsigned char) p[2]);
+            p += 3;
+        } else if (*p == ASSET_OP_RLE) {
+            cnt = (unsigned char) p[1];
+            c = p[2];
+            while (cnt--)
+                putU1(c);
+            p += 3;
+        } else {
+            span = p;                       // literal span -- find its end
+            while ((unsigned char) *p > ASSET_OP_RLE)
+                p++;
+            putsU1_scat(span, (unsigned int) (p - span));   // straight from flash
+        }
+    }
+}
+
+// ----- Startup banner.  Replaces the Screen_MoveCursor + string pair in
+//       AppTaskCreate: the positioning rides inside the asset.
+const char Asset_Title[] = {
+    ASSET_OP_MOVE, 8, 8,
+    'u', 'C', '/', 'O', 'S', '-', 'I', 'I', 'I', ',', ' ',
+    'T', 'h', 'e', ' ', 'R', 'e', 'a', 'l', '-', 'T', 'i', 'm', 'e', ' ',
+    'K', 'e', 'r', 'n', 'e', 'l', ' ', 'P', 'I', 'C', '3', '2',
+    ASSET_OP_MOVE, 8, 9,
+    ASSET_OP_RLE, 4, ' ',
+    'P', 'O', 'N', 'G',
+    ASSET_OP_END
+};
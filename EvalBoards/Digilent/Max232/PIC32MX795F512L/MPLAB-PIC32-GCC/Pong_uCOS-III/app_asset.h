@@ -0,0 +1,33 @@
+/**************************************************************************
+ * File:         app_asset.h   Flash-resident screen asset blitter
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Static art (title, borders, game-over screen, menus) is
+ *               stored as pre-encoded VT100 byte streams in flash and
+ *               blitted by streaming, not computed cell by cell.  Plain
+ *               bytes in an asset are transmitted verbatim through the
+ *               zero-copy scatter path (putsU1_scat), so a full screen
+ *               renders at line rate with no RAM staging; two compact
+ *               opcodes keep the assets small:
+ *
+ *                   0x00             end of asset
+ *                   0x01 x y         move cursor to column x, row y (1-based)
+ *                   0x02 count char  emit char count times (RLE)
+ *
+ *               Everything from 0x03 up (which includes ESC, 0x1B) is a
+ *               literal byte, so hand-written or host-generated VT100
+ *               sequences embed unchanged.
+ **************************************************************************/
+
+#ifndef APP_ASSET_H
+#define APP_ASSET_H
+
+#define ASSET_OP_END   0x00
+#define ASSET_OP_MOVE  0x01
+#define ASSET_OP_RLE   0x02
+
+void Asset_Blit(const char *p_asset);   // stream one asset to the terminal
+
+extern const char Asset_Title[];        // startup banner, drawn by AppTaskCreate
+
+#endif
@@ -26,6 +26,66 @@
 
 #include <lib_cfg.h>
 
+/*
+*********************************************************************************************************
+*                                            GAME SELECTION
+*********************************************************************************************************
+*/
+
+                                                               /* Build the Snake game (app_snake.c) instead of the   */
+#define  APP_CFG_SNAKE_EN                                  0u  /* ... Pong tasks; see Snake_TaskCreate()              */
+
+                                                               /* Two-board link over UART2 (app_link.c): exchange    */
+#define  APP_CFG_LINK_EN                                   0u  /* ... input/entity deltas with the peer board         */
+
+                                                               /* Input recording/replay (app_replay.c) for           */
+#define  APP_CFG_REPLAY_EN                                 0u  /* ... reproducible A/B benchmark runs                 */
+#define  APP_CFG_REPLAY_MODE                               0u  /* 0 = record + dump on game over, 1 = playback        */
+
+                                                               /* AI opponent snake: budget-bounded incremental BFS   */
+#define  APP_CFG_SNAKE_AI_EN                               0u  /* ... in a lower-priority task (see app_snake.c)      */
+
+                                                               /* Per-frame budget instrumentation (app_frame.c):     */
+#define  APP_CFG_FRAME_PROF_EN                             0u  /* ... frame time/bytes/cells ring + over-budget rate  */
+
+                                                               /* Binary telemetry frames instead of the ASCII HUD    */
+#define  APP_CFG_TELEM_EN                                  0u  /* ... for headless runs; frame spec in app_telem.h    */
+
+                                                               /* Heartbeat-supervised PIC32 watchdog (app_wdt.c);    */
+#define  APP_CFG_WDT_EN                                    0u  /* ... a dead supervised task resets the board         */
+
+
+/*
+*********************************************************************************************************
+*                                            BOOT-TIME REPORTS
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_KERNEL_RAM_RPT_EN                         1u  /* Print the kernel RAM footprint table at boot        */
+
+                                                               /* Print the .data/.bss totals from the linker ...     */
+#define  APP_CFG_RAM_SECTION_RPT_EN                        1u  /* ... symbols, split by owner (kernel/heap/stacks)    */
+
+                                                               /* Print the interrupt latency-class map: the ...      */
+#define  APP_CFG_INT_MAP_RPT_EN                            1u  /* ... class IPLs and every vector assigned one        */
+
+                                                               /* Dump the per-site interrupts-disabled-time ...      */
+                                                               /* ... histograms; needs CPU_CFG_INT_DIS_MEAS_EN & ... */
+#define  APP_CFG_INT_DIS_HIST_RPT_EN                       0u  /* ... CPU_CFG_INT_DIS_MEAS_HIST_EN in cpu_cfg.h       */
+
+                                                               /* Time the scheduler hot paths with the core timer    */
+#define  APP_CFG_SCHED_BENCH_RPT_EN                        0u  /* ... (RAM-resident vs flash kernel placement)        */
+
+                                                               /* Print the prefetch cache (CHECON) settings and an   */
+#define  APP_CFG_FLASH_CFG_RPT_EN                          0u  /* ... instruction-fetch benchmark at boot             */
+
+                                                               /* Dump the per-vector interrupt latency table (max +  */
+#define  APP_CFG_INT_LAT_RPT_EN                            0u  /* ... histogram) ~30 s after boot; disturbs the screen*/
+
+                                                               /* Print the boot-stage timestamps (BSP_BootMarkGet()) */
+#define  APP_CFG_BOOT_PROF_RPT_EN                          0u  /* ... once the app tasks are up; disturbs the screen  */
+
+
 /*
 *********************************************************************************************************
 *                                            TASK PRIORITIES
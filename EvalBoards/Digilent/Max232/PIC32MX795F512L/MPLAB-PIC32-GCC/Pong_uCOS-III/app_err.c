@@ -0,0 +1,81 @@
+/**************************************************************************
+ * File:         app_err.c   Allocation-free OS_ERR event counters
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  See app_err.h.  The slot scan is at most APP_ERR_SLOT_QTY
+ *               compares inside one critical section; counters saturate
+ *               rather than wrap so a storm cannot disguise itself as a
+ *               quiet table.
+ **************************************************************************/
+#include <includes.h>
+#include "app_err.h"
+
+typedef struct app_err_slot {
+    OS_ERR     Code;                    // 0 (OS_ERR_NONE) marks a free slot
+    CPU_INT16U Cnt;
+} APP_ERR_SLOT;
+
+static APP_ERR_SLOT AppErr_SlotTbl[APP_ERR_SLOT_QTY];
+static CPU_INT32U   AppErr_Total;       // every recorded event
+static CPU_INT16U   AppErr_Overflow;    // events whose code found no free slot
+static OS_ERR       AppErr_LastCode;
+static CPU_INT08U   AppErr_LastSite;
+
+// ----- Count one OS_ERR occurrence.  Counter cost only: no UART, no
+//       allocation, no blocking; callable from any context.
+void AppErr_Record(OS_ERR err, CPU_INT08U site) {
+    CPU_INT08U ix;
+    CPU_SR_ALLOC();
+
+    if (err == OS_ERR_NONE) {
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+    AppErr_Total++;
+    AppErr_LastCode = err;
+    AppErr_LastSite = site;
+    for (ix = 0; ix < APP_ERR_SLOT_QTY; ix++) {
+        if (AppErr_SlotTbl[ix].Code == err) {
+            if (AppErr_SlotTbl[ix].Cnt < 0xFFFFu) {     // saturate, never wrap
+                AppErr_SlotTbl[ix].Cnt++;
+            }
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+        if (AppErr_SlotTbl[ix].Code == OS_ERR_NONE) {   // first sighting: claim the slot
+            AppErr_SlotTbl[ix].Code = err;
+            AppErr_SlotTbl[ix].Cnt  = 1;
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+    }
+    if (AppErr_Overflow < 0xFFFFu) {                    // table full: still counted
+        AppErr_Overflow++;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+// ----- Events recorded so far; cheap change detector for the pump
+CPU_INT32U AppErr_TotalGet(void) {
+    return (AppErr_Total);
+}
+
+// ----- Most recent code and (optionally) where it was recorded
+OS_ERR AppErr_LastGet(CPU_INT08U *p_site) {
+    if (p_site != (CPU_INT08U *) 0) {
+        *p_site = AppErr_LastSite;
+    }
+    return (AppErr_LastCode);
+}
+
+// ----- Read slot 'ix' back; DEF_FALSE once past the occupied slots
+CPU_BOOLEAN AppErr_SlotGet(CPU_INT08U ix, OS_ERR *p_code, CPU_INT16U *p_cnt) {
+    if ((ix >= APP_ERR_SLOT_QTY) ||
+        (AppErr_SlotTbl[ix].Code == OS_ERR_NONE)) {
+        return (DEF_FALSE);
+    }
+    *p_code = AppErr_SlotTbl[ix].Code;
+    *p_cnt  = AppErr_SlotTbl[ix].Cnt;
+    return (DEF_TRUE);
+}
@@ -0,0 +1,35 @@
+/**************************************************************************
+ * File:         app_err.h   Allocation-free OS_ERR event counters
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Error paths record the OS_ERR code and a site ID into a
+ *               static slot table -- a handful of stores under a short
+ *               critical section -- instead of pushing "Error ..."
+ *               strings into the UART from the failure path.  The output
+ *               pump reads the table back on its own cadence and renders
+ *               a HUD row (or a telemetry frame), so error visibility
+ *               costs a counter increment at the fault and nothing ever
+ *               blocks.  Safe from any context, ISRs included.
+ **************************************************************************/
+
+#ifndef APP_ERR_H
+#define APP_ERR_H
+
+// Distinct OS_ERR codes tracked exactly.  The os.h error space is sparse
+// (10000..36000, grouped by letter), so a direct table is out; runtime
+// error diversity is low, and codes arriving after the slots fill are
+// still counted in the overflow bucket.
+#define APP_ERR_SLOT_QTY         8u
+
+// Site IDs recorded with each event: where it happened, not just what
+#define APP_ERR_SITE_NONE        0u
+#define APP_ERR_SITE_STAT_INIT   1u    // OSStatTaskCPUUsageInit at boot
+#define APP_ERR_SITE_TASK_CREATE 2u    // AppTaskCreate batch create
+#define APP_ERR_SITE_DLY         3u    // timed delays (banner pacing, task loops)
+
+void        AppErr_Record(OS_ERR err, CPU_INT08U site);
+CPU_INT32U  AppErr_TotalGet(void);
+OS_ERR      AppErr_LastGet(CPU_INT08U *p_site);
+CPU_BOOLEAN AppErr_SlotGet(CPU_INT08U ix, OS_ERR *p_code, CPU_INT16U *p_cnt);
+
+#endif
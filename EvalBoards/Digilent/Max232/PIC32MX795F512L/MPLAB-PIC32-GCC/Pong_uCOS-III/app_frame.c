@@ -0,0 +1,121 @@
+/**************************************************************************
+ * File:         app_frame.c   Per-frame budget pacing instrumentation
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  The game loop calls Frame_End() once per frame with its
+ *               core-timer window and the render cost counters from
+ *               app_screen.c.  The ring holds the last FRAME_RING_SIZE
+ *               frames verbatim; the totals never wrap within a session
+ *               (32-bit frame count at 10 frames/s is years).  All costs
+ *               are a handful of stores per frame.
+ **************************************************************************/
+#include <includes.h>
+#include "app_screen.h"
+#include "app_frame.h"
+
+static FRAME_REC  Frame_Ring[FRAME_RING_SIZE];
+static CPU_INT16U Frame_RingIx;
+
+static CPU_INT32U Frame_Budget;                 // core timer counts per frame
+static CPU_INT32U Frame_Total;                  // frames recorded
+static CPU_INT32U Frame_Over;                   // frames that blew the budget
+static CPU_INT32U Frame_DurMax;                 // worst frame, core counts
+
+void UART_PrintNumU32(CPU_INT32U v);            // shared helper in app.c
+
+// ----- Reset the counters; 'budget_ct' is the frame budget in core
+//       timer counts (25 ns each)
+void Frame_Init(CPU_INT32U budget_ct) {
+    Frame_Budget = budget_ct;
+    Frame_Total  = 0;
+    Frame_Over   = 0;
+    Frame_DurMax = 0;
+    Frame_RingIx = 0;
+}
+
+// ----- Record one finished frame
+void Frame_End(CPU_INT32U start, CPU_INT32U end,
+               CPU_INT16U bytes, CPU_INT16U cells) {
+    CPU_INT32U dur = end - start;
+    FRAME_REC *p_rec = &Frame_Ring[Frame_RingIx];
+
+    p_rec->Start = start;
+    p_rec->End   = end;
+    p_rec->Bytes = bytes;
+    p_rec->Cells = cells;
+    Frame_RingIx = (Frame_RingIx + 1) & (FRAME_RING_SIZE - 1);
+
+    Frame_Total++;
+    if (dur > Frame_Budget) {
+        Frame_Over++;
+    }
+    if (dur > Frame_DurMax) {
+        Frame_DurMax = dur;
+    }
+}
+
+// ----- Frames over budget per thousand frames
+CPU_INT32U Frame_OverPerMille(void) {
+    if (Frame_Total == 0) {
+        return (0);
+    }
+    return ((Frame_Over * 1000u) / Frame_Total);
+}
+
+// ----- Render "ov/oo  maxus" into the framebuffer at (x,y): frames over
+//       budget per mille and the worst frame in microseconds.  Digits
+//       only -- the FB diff keeps unchanged glyphs off the wire.
+void Frame_HUDRender(int x, int y) {
+    CPU_INT32U v;
+    int i;
+    char buf[12];
+
+    v = Frame_OverPerMille();
+    for (i = 3; i >= 0; i--) {                  // 4 digits, zero padded
+        buf[i] = (char)(v % 10u + '0');
+        v /= 10u;
+    }
+    buf[4] = ' ';
+    v = Frame_DurMax / (BSP_CLK_FREQ / 2u / 1000000u);  // counts -> us
+    for (i = 10; i >= 5; i--) {                 // 6 digits
+        buf[i] = (char)(v % 10u + '0');
+        v /= 10u;
+    }
+    buf[11] = '\0';
+    FB_WriteStr(x, y, &buf[0]);
+}
+
+// ----- Dump the whole ring over UART1, oldest first, one frame per
+//       line: start, duration (core counts), bytes, cells
+void Frame_Dump(void) {
+    CPU_INT16U ix = Frame_RingIx;               // oldest entry
+    CPU_INT16U i;
+    FRAME_REC *p_rec;
+
+    putsU1("\r\nframe ring (start dur bytes cells):\r\n");
+    for (i = 0; i < FRAME_RING_SIZE; i++) {
+        p_rec = &Frame_Ring[ix];
+        ix = (ix + 1) & (FRAME_RING_SIZE - 1);
+        if ((p_rec->Start == 0) && (p_rec->End == 0)) {
+            continue;                           // never filled
+        }
+        UART_PrintNumU32(p_rec->Start);
+        putsU1(" ");
+        UART_PrintNumU32(p_rec->End - p_rec->Start);
+        putsU1(" ");
+        UART_PrintNumU32((CPU_INT32U) p_rec->Bytes);
+        putsU1(" ");
+        UART_PrintNumU32((CPU_INT32U) p_rec->Cells);
+        putsU1("\r\n");
+    }
+    putsU1("frames=");
+    UART_PrintNumU32(Frame_Total);
+    putsU1(" over=");
+    UART_PrintNumU32(Frame_Over);
+    putsU1(" over/oo=");
+    UART_PrintNumU32(Frame_OverPerMille());
+    putsU1(" max_ct=");
+    UART_PrintNumU32(Frame_DurMax);
+    putsU1("\r\n");
+}
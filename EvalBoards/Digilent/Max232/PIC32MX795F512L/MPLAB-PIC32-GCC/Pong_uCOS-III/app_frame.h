@@ -0,0 +1,33 @@
+/**************************************************************************
+ * File:         app_frame.h   Per-frame budget pacing instrumentation
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  One FRAME_REC per game frame -- core timer start/end,
+ *               UART bytes enqueued, framebuffer cells changed -- kept in
+ *               a small ring.  Running totals give frames-over-budget per
+ *               thousand, so renderer changes are judged on a number
+ *               instead of vibes.  A one-line summary renders into the
+ *               framebuffer HUD; the full ring dumps over UART1 for
+ *               offline analysis.
+ **************************************************************************/
+
+#ifndef APP_FRAME_H
+#define APP_FRAME_H
+
+#define FRAME_RING_SIZE     64      // frames kept for the dump, power of two
+
+typedef struct frame_rec {
+    CPU_INT32U Start;               // core timer at frame start (25 ns)
+    CPU_INT32U End;                 // core timer after the render
+    CPU_INT16U Bytes;               // UART bytes this frame enqueued
+    CPU_INT16U Cells;               // framebuffer cells that changed
+} FRAME_REC;
+
+void        Frame_Init(CPU_INT32U budget_ct);   // budget in core timer counts
+void        Frame_End(CPU_INT32U start, CPU_INT32U end,
+                      CPU_INT16U bytes, CPU_INT16U cells);
+CPU_INT32U  Frame_OverPerMille(void);           // frames over budget / 1000
+void        Frame_HUDRender(int x, int y);      // summary line into the FB
+void        Frame_Dump(void);                   // full ring over UART1
+
+#endif
@@ -0,0 +1,71 @@
+/**************************************************************************
+ * File:         app_hud.c   Incremental numeric HUD fields
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Glyph-diffing number fields for background telemetry.
+ *               Each update compares the new glyphs against the cached
+ *               ones and goes through Screen_WriteChar (and thus the
+ *               render server) only for positions that differ, so an
+ *               unchanged value costs zero draw commands and a +1 tick
+ *               usually costs one.  The +1 case increments the cached
+ *               glyph string directly -- ripple the '9's to '0' and bump
+ *               the next digit -- with no divides at all.
+ **************************************************************************/
+#include <includes.h>
+#include "app_hud.h"
+
+int Screen_WriteChar(int x, int y, char c);     // render-server entry in app.c
+
+// ----- Bind a field to a screen position; first update paints in full
+void HUD_FieldInit(HUD_FIELD *p_fld, int x, int y, int width) {
+    if (width > HUD_FIELD_WIDTH_MAX) {
+        width = HUD_FIELD_WIDTH_MAX;
+    }
+    p_fld->X     = (CPU_INT08U) x;
+    p_fld->Y     = (CPU_INT08U) y;
+    p_fld->Width = (CPU_INT08U) width;
+    p_fld->Val   = 0;
+    p_fld->Valid = DEF_FALSE;
+}
+
+// ----- Render 'val' into the field, transmitting changed digits only
+void HUD_FieldUpdate(HUD_FIELD *p_fld, CPU_INT32U val) {
+    char glyph[HUD_FIELD_WIDTH_MAX];
+    CPU_INT32U v;
+    int i;
+
+    if (p_fld->Valid && (val == p_fld->Val)) {
+        return;                                 // steady state: zero traffic
+    }
+
+    if (p_fld->Valid && (val == p_fld->Val + 1)) {
+        // Increment the cached glyphs in place: ripple from the right,
+        // no divide chain.  Usually rewrites exactly one digit.
+        for (i = p_fld->Width - 1; i >= 0; i--) {
+            if (p_fld->Glyph[i] != '9') {
+                p_fld->Glyph[i]++;
+                Screen_WriteChar(p_fld->X + i, p_fld->Y, p_fld->Glyph[i]);
+                break;
+            }
+            p_fld->Glyph[i] = '0';              // carry keeps rippling left
+            Screen_WriteChar(p_fld->X + i, p_fld->Y, '0');
+        }
+        p_fld->Val = val;
+        return;
+    }
+
+    v = val;                                    // full format, then diff it
+    for (i = p_fld->Width - 1; i >= 0; i--) {   // ... against the cache
+        glyph[i] = (char)(v % 10u + '0');
+        v /= 10u;
+    }
+    for (i = 0; i < p_fld->Width; i++) {
+        if (!p_fld->Valid || (glyph[i] != p_fld->Glyph[i])) {
+            p_fld->Glyph[i] = glyph[i];
+            Screen_WriteChar(p_fld->X + i, p_fld->Y, glyph[i]);
+        }
+    }
+    p_fld->Val   = val;
+    p_fld->Valid = DEF_TRUE;
+}
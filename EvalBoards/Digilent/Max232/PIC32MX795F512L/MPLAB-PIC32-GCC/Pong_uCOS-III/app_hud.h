@@ -0,0 +1,33 @@
+/**************************************************************************
+ * File:         app_hud.h   Incremental numeric HUD fields
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  A HUD field is a fixed-width, zero-padded number at a
+ *               fixed screen position that remembers the glyphs it last
+ *               rendered.  HUD_FieldUpdate() transmits only the digit
+ *               positions that changed -- nothing at all when the value
+ *               is unchanged, one glyph when a counter ticks up without
+ *               carry -- so steady-state telemetry costs near-zero link
+ *               bandwidth.  Values that changed by exactly 1 are
+ *               re-rendered by incrementing the cached glyphs in place,
+ *               skipping the divide/modulo chain entirely.
+ **************************************************************************/
+
+#ifndef APP_HUD_H
+#define APP_HUD_H
+
+#define HUD_FIELD_WIDTH_MAX  10     // enough for a full CPU_INT32U
+
+typedef struct hud_field {
+    CPU_INT08U  X;                  // leftmost digit column (1-based)
+    CPU_INT08U  Y;                  // row (1-based)
+    CPU_INT08U  Width;              // rendered width, zero padded
+    CPU_INT32U  Val;                // last rendered value
+    CPU_BOOLEAN Valid;              // glyph cache holds a rendered value
+    char        Glyph[HUD_FIELD_WIDTH_MAX]; // what is on screen now
+} HUD_FIELD;
+
+void HUD_FieldInit(HUD_FIELD *p_fld, int x, int y, int width);
+void HUD_FieldUpdate(HUD_FIELD *p_fld, CPU_INT32U val);
+
+#endif
@@ -0,0 +1,244 @@
+/**************************************************************************
+ * File:         app_link.c   Board-to-board game link over UART2
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Delta-state synchronization for two-board play.  The
+ *               sender queues complete frames into a software TX ring;
+ *               Link_Poll() copies ring bytes into the UART2 hardware
+ *               FIFO while it has room and pulls RX bytes through a
+ *               byte-at-a-time parser, so one call per game frame keeps
+ *               both directions moving with zero blocking waits.  Bad
+ *               CRCs drop the frame; sequence gaps on good frames are
+ *               counted so packet loss is visible without ever stalling
+ *               the game on a retransmit.
+ **************************************************************************/
+#include <includes.h>
+#include "app_link.h"
+
+// ***************************************************************************
+// UART2 setup.  Same 115200 8N1 as the terminal; BRGH=0, so
+// BRG = PBCLK / (16 * baud) - 1 with the peripheral bus at BSP_CLK_FREQ
+// (mOSCSetPBDIV(0) in BSP_InitIO leaves PBCLK = SYSCLK).
+// ***************************************************************************
+#define LINK_BAUD_RATE      115200
+#define LINK_BRG            ((BSP_CLK_FREQ / (16 * LINK_BAUD_RATE)) - 1)
+
+#define LINK_U2MODE_ON      0x8000      // UARTEN, 8N1, BRGH=0
+#define LINK_U2STA_EN       0x1400      // URXEN | UTXEN
+
+// Software TX ring.  Power of two; deep enough for several frames of
+// queued deltas when the game runs ahead of the wire for a frame or two.
+#define LINK_TX_BUF_SIZE    128
+#define LINK_TX_BUF_MASK    (LINK_TX_BUF_SIZE - 1)
+
+// Parsed-frame queue between the parser and Link_MsgGet()
+#define LINK_RX_Q_SIZE      4
+#define LINK_RX_Q_MASK      (LINK_RX_Q_SIZE - 1)
+
+// RX parser states
+#define LINK_RX_ST_SOF      0
+#define LINK_RX_ST_TYPE     1
+#define LINK_RX_ST_SEQ      2
+#define LINK_RX_ST_LEN      3
+#define LINK_RX_ST_DATA     4
+#define LINK_RX_ST_CRC_HI   5
+#define LINK_RX_ST_CRC_LO   6
+
+static CPU_INT08U Link_TxBuf[LINK_TX_BUF_SIZE];
+static CPU_INT16U Link_TxIn;
+static CPU_INT16U Link_TxOut;
+
+static LINK_MSG   Link_RxQ[LINK_RX_Q_SIZE];
+static CPU_INT08U Link_RxQIn;
+static CPU_INT08U Link_RxQOut;
+
+static CPU_INT08U Link_RxState = LINK_RX_ST_SOF;
+static LINK_MSG   Link_RxMsg;                   // frame being assembled
+static CPU_INT08U Link_RxDataIx;
+static CPU_INT16U Link_RxCRC;                   // received CRC, big endian
+static CPU_BOOLEAN Link_RxSeqValid = DEF_FALSE; // no frame seen yet
+
+static CPU_INT08U Link_TxSeq;
+static CPU_INT08U Link_RxSeqLast;
+
+static LINK_STATS Link_Stats;
+
+/*$PAGE*/
+
+// ***************************************************************************
+// TX path
+// ***************************************************************************
+
+// ----- Free space in the TX ring
+static CPU_INT16U Link_TxFree(void) {
+    return (LINK_TX_BUF_SIZE - 1 - ((Link_TxIn - Link_TxOut) & LINK_TX_BUF_MASK));
+}
+
+// ----- Queue one complete frame into the TX ring, or drop it whole if
+//       the ring cannot take it (a half-queued frame would desync the
+//       peer's parser).  Returns DEF_TRUE if queued.
+static CPU_BOOLEAN Link_FrameQueue(CPU_INT08U type, const CPU_INT08U *p_data, CPU_INT08U len) {
+    CPU_INT16U crc;
+    CPU_INT08U hdr[4];
+    CPU_INT08U i;
+
+    if (Link_TxFree() < (CPU_INT16U)(6 + len)) {
+        Link_Stats.TxDropCtr++;
+        return (DEF_FALSE);
+    }
+
+    hdr[0] = LINK_SOF;
+    hdr[1] = type;
+    hdr[2] = Link_TxSeq++;
+    hdr[3] = len;
+
+    crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL, (void *) &hdr[1], 3);
+    crc = CRC_CRC16_Calc(crc, (void *) p_data, len);
+    crc = CRC_CRC16_Final(crc);
+
+    for (i = 0; i < 4; i++) {
+        Link_TxBuf[Link_TxIn] = hdr[i];
+        Link_TxIn = (Link_TxIn + 1) & LINK_TX_BUF_MASK;
+    }
+    for (i = 0; i < len; i++) {
+        Link_TxBuf[Link_TxIn] = p_data[i];
+        Link_TxIn = (Link_TxIn + 1) & LINK_TX_BUF_MASK;
+    }
+    Link_TxBuf[Link_TxIn] = (CPU_INT08U)(crc >> 8);
+    Link_TxIn = (Link_TxIn + 1) & LINK_TX_BUF_MASK;
+    Link_TxBuf[Link_TxIn] = (CPU_INT08U)(crc & 0xFF);
+    Link_TxIn = (Link_TxIn + 1) & LINK_TX_BUF_MASK;
+
+    Link_Stats.TxFrameCtr++;
+    return (DEF_TRUE);
+}
+
+// ----- Queue a button-input event for the peer
+CPU_BOOLEAN Link_InputSend(CPU_INT08U btns) {
+    return (Link_FrameQueue(LINK_MSG_INPUT, &btns, 1));
+}
+
+// ----- Queue an entity position delta for the peer
+CPU_BOOLEAN Link_EntitySend(CPU_INT08U id, int x, int y) {
+    CPU_INT08U payload[3];
+
+    payload[0] = id;
+    payload[1] = (CPU_INT08U) x;
+    payload[2] = (CPU_INT08U) y;
+    return (Link_FrameQueue(LINK_MSG_ENTITY, &payload[0], 3));
+}
+
+/*$PAGE*/
+
+// ***************************************************************************
+// RX path
+// ***************************************************************************
+
+// ----- Feed one wire byte through the frame parser; a completed frame
+//       with a good CRC lands in the parsed-frame queue
+static void Link_RxByte(CPU_INT08U b) {
+    CPU_INT16U crc;
+
+    switch (Link_RxState) {
+        case LINK_RX_ST_SOF:
+            if (b == LINK_SOF) {
+                Link_RxState = LINK_RX_ST_TYPE;
+            }
+            break;
+        case LINK_RX_ST_TYPE:
+            Link_RxMsg.Type = b;
+            Link_RxState = LINK_RX_ST_SEQ;
+            break;
+        case LINK_RX_ST_SEQ:
+            Link_RxMsg.Seq = b;
+            Link_RxState = LINK_RX_ST_LEN;
+            break;
+        case LINK_RX_ST_LEN:
+            if (b > LINK_PAYLOAD_MAX) {         // impossible length: resync
+                Link_RxState = LINK_RX_ST_SOF;
+                break;
+            }
+            Link_RxMsg.Len = b;
+            Link_RxDataIx = 0;
+            Link_RxState = (b > 0) ? LINK_RX_ST_DATA : LINK_RX_ST_CRC_HI;
+            break;
+        case LINK_RX_ST_DATA:
+            Link_RxMsg.Data[Link_RxDataIx++] = b;
+            if (Link_RxDataIx >= Link_RxMsg.Len) {
+                Link_RxState = LINK_RX_ST_CRC_HI;
+            }
+            break;
+        case LINK_RX_ST_CRC_HI:
+            Link_RxCRC = (CPU_INT16U)(b << 8);
+            Link_RxState = LINK_RX_ST_CRC_LO;
+            break;
+        case LINK_RX_ST_CRC_LO:
+        default:
+            Link_RxCRC |= b;
+            Link_RxState = LINK_RX_ST_SOF;
+
+            crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL, (void *) &Link_RxMsg.Type, 1);
+            crc = CRC_CRC16_Calc(crc, (void *) &Link_RxMsg.Seq, 1);
+            crc = CRC_CRC16_Calc(crc, (void *) &Link_RxMsg.Len, 1);
+            crc = CRC_CRC16_Calc(crc, (void *) &Link_RxMsg.Data[0], Link_RxMsg.Len);
+            if (CRC_CRC16_Final(crc) != Link_RxCRC) {
+                Link_Stats.RxCRCErrCtr++;       // drop; the next SOF resyncs
+                break;
+            }
+
+            if (Link_RxSeqValid) {              // count gaps, never stall
+                Link_Stats.RxLostCtr += (CPU_INT08U)(Link_RxMsg.Seq - Link_RxSeqLast - 1);
+            }
+            Link_RxSeqLast  = Link_RxMsg.Seq;
+            Link_RxSeqValid = DEF_TRUE;
+
+            if (((Link_RxQIn + 1) & LINK_RX_Q_MASK) != Link_RxQOut) {
+                Link_RxQ[Link_RxQIn] = Link_RxMsg;
+                Link_RxQIn = (Link_RxQIn + 1) & LINK_RX_Q_MASK;
+            }
+            Link_Stats.RxFrameCtr++;
+            break;
+    }
+}
+
+// ----- Next parsed frame, DEF_FALSE when none is waiting
+CPU_BOOLEAN Link_MsgGet(LINK_MSG *p_msg) {
+    if (Link_RxQOut == Link_RxQIn) {
+        return (DEF_FALSE);
+    }
+    *p_msg = Link_RxQ[Link_RxQOut];
+    Link_RxQOut = (Link_RxQOut + 1) & LINK_RX_Q_MASK;
+    return (DEF_TRUE);
+}
+
+/*$PAGE*/
+
+// ***************************************************************************
+// Pump + setup
+// ***************************************************************************
+
+// ----- Pump both directions; bounded work, no waits.  Call once per
+//       game frame (or oftener -- it is cheap when idle).
+void Link_Poll(void) {
+    while (U2STAbits.URXDA) {                   // drain the RX FIFO
+        Link_RxByte((CPU_INT08U) U2RXREG);
+    }
+    while ((Link_TxOut != Link_TxIn) &&         // feed the TX FIFO
+           (!U2STAbits.UTXBF)) {
+        U2TXREG = Link_TxBuf[Link_TxOut];
+        Link_TxOut = (Link_TxOut + 1) & LINK_TX_BUF_MASK;
+    }
+}
+
+// ----- Snapshot the link counters
+void Link_StatsGet(LINK_STATS *p_stats) {
+    *p_stats = Link_Stats;
+}
+
+// ----- Bring up UART2, 115200 8N1, polled from Link_Poll()
+void Link_Init(void) {
+    U2BRG  = LINK_BRG;
+    U2STA  = LINK_U2STA_EN;
+    U2MODE = LINK_U2MODE_ON;
+}
@@ -0,0 +1,53 @@
+/**************************************************************************
+ * File:         app_link.h   Board-to-board game link over UART2
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Link layer for two-board head-to-head play.  UART1 keeps
+ *               the terminal; this module owns UART2 and exchanges small
+ *               binary delta frames -- input events and entity position
+ *               deltas, never full game state -- each carrying a sequence
+ *               number and a lib_crc CRC-16.  Everything runs from
+ *               Link_Poll(), called once per game frame: it drains the
+ *               RX FIFO into a parser and feeds the TX FIFO from a
+ *               software ring, so the game task never blocks on the wire.
+ **************************************************************************/
+
+#ifndef APP_LINK_H
+#define APP_LINK_H
+
+// ***************************************************************************
+// Frame format, cheapest thing that survives a noisy wire:
+//   SOF  type  seq  len  payload[len]  crc_hi  crc_lo
+// CRC-16 (lib_crc) covers type..payload.  Worst frame on the wire today
+// is 6 + 3 bytes; per-frame sync traffic stays well under a few dozen.
+// ***************************************************************************
+#define LINK_SOF            0xA5
+#define LINK_PAYLOAD_MAX    8
+
+#define LINK_MSG_INPUT      1   // payload: button mask          (1 byte)
+#define LINK_MSG_ENTITY     2   // payload: entity id, x, y      (3 bytes)
+
+typedef struct link_msg {
+    CPU_INT08U Type;
+    CPU_INT08U Seq;                     // sender's frame sequence number
+    CPU_INT08U Len;
+    CPU_INT08U Data[LINK_PAYLOAD_MAX];
+} LINK_MSG;
+
+// Link statistics, readable for a HUD or the terminal
+typedef struct link_stats {
+    CPU_INT32U TxFrameCtr;
+    CPU_INT32U RxFrameCtr;
+    CPU_INT32U RxCRCErrCtr;             // frames dropped on bad CRC
+    CPU_INT32U RxLostCtr;               // sequence gaps seen on good frames
+    CPU_INT32U TxDropCtr;               // frames dropped on a full TX ring
+} LINK_STATS;
+
+void        Link_Init(void);                            // bring up UART2
+void        Link_Poll(void);                            // pump RX + TX, never blocks
+CPU_BOOLEAN Link_MsgGet(LINK_MSG *p_msg);               // next parsed frame, if any
+CPU_BOOLEAN Link_InputSend(CPU_INT08U btns);            // queue an input event
+CPU_BOOLEAN Link_EntitySend(CPU_INT08U id, int x, int y); // queue a position delta
+void        Link_StatsGet(LINK_STATS *p_stats);
+
+#endif
@@ -0,0 +1,111 @@
+/**************************************************************************
+ * File:         app_replay.c   Game recording: snapshot + input replay
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Record mode captures the run's RNG seed and every button
+ *               change as a {frame, btns} event, then dumps the lot over
+ *               UART1 as C initializers: paste the dump into the playback
+ *               table below and rebuild with REPLAY_MODE_PLAY to replay
+ *               the identical run.  Playback never touches the buttons,
+ *               so two builds differing only in renderer or scheduler
+ *               changes produce frame-for-frame comparable output.
+ **************************************************************************/
+#include <includes.h>
+#include "app_replay.h"
+
+// ***************************************************************************
+// Record-mode state
+// ***************************************************************************
+static REPLAY_EVT  Replay_EvtTbl[REPLAY_EVT_MAX];
+static CPU_INT16U  Replay_EvtCtr;
+static CPU_INT32U  Replay_Seed;
+
+// ***************************************************************************
+// Playback recording.  Replace the seed and table with a pasted dump;
+// the checked-in default is a short demo run.
+// ***************************************************************************
+static const CPU_INT32U Replay_PlaySeed = 0x12345679u;
+static const REPLAY_EVT Replay_PlayTbl[] = {
+    {  20, 0x01, 0 },   // up
+    {  45, 0x08, 0 },   // right
+    {  70, 0x02, 0 },   // down
+    {  95, 0x04, 0 },   // left
+    { 120, 0x01, 0 },   // up
+    {   0, 0x00, 0 },   // terminator (frame 0 never matches after start)
+};
+
+void UART_PrintNumU32(CPU_INT32U v);            // shared helper in app.c
+
+/*$PAGE*/
+
+// ***************************************************************************
+// Record mode
+// ***************************************************************************
+
+// ----- Begin a recording; 'seed' is the run's Snake_Rand seed
+void Replay_RecStart(CPU_INT32U seed) {
+    Replay_Seed   = seed;
+    Replay_EvtCtr = 0;
+}
+
+// ----- Capture one button change.  A full table stops capturing; the
+//       run keeps playing, the recording is just truncated.
+void Replay_RecInput(CPU_INT16U frame, CPU_INT08U btns) {
+    if (Replay_EvtCtr >= REPLAY_EVT_MAX) {
+        return;
+    }
+    Replay_EvtTbl[Replay_EvtCtr].Frame  = frame;
+    Replay_EvtTbl[Replay_EvtCtr].Btns   = btns;
+    Replay_EvtTbl[Replay_EvtCtr].Unused = 0;
+    Replay_EvtCtr++;
+}
+
+// ----- Dump the recording over UART1 as C initializers, ready to paste
+//       over Replay_PlaySeed/Replay_PlayTbl above
+void Replay_Dump(void) {
+    CPU_INT16U i;
+
+    putsU1("\r\n// replay recording -- paste into app_replay.c\r\n");
+    putsU1("// seed = ");
+    UART_PrintNumU32(Replay_Seed);
+    putsU1("\r\n");
+    for (i = 0; i < Replay_EvtCtr; i++) {
+        putsU1("    { ");
+        UART_PrintNumU32((CPU_INT32U) Replay_EvtTbl[i].Frame);
+        putsU1(", ");
+        UART_PrintNumU32((CPU_INT32U) Replay_EvtTbl[i].Btns);
+        putsU1(", 0 },\r\n");
+    }
+    putsU1("// events: ");
+    UART_PrintNumU32((CPU_INT32U) Replay_EvtCtr);
+    putsU1("\r\n");
+}
+
+/*$PAGE*/
+
+// ***************************************************************************
+// Playback mode
+// ***************************************************************************
+
+static CPU_INT16U Replay_PlayIx;                // next event to apply
+static CPU_INT08U Replay_PlayHeld;              // buttons held right now
+
+// ----- Rewind the playback and return the recorded seed
+CPU_INT32U Replay_PlayStart(void) {
+    Replay_PlayIx   = 0;
+    Replay_PlayHeld = 0;
+    return (Replay_PlaySeed);
+}
+
+// ----- The button mask in effect at 'frame': applies every event whose
+//       frame has arrived, in order, and returns the latest mask.  Call
+//       with a monotonically increasing frame counter.
+CPU_INT08U Replay_PlayBtns(CPU_INT16U frame) {
+    while ((Replay_PlayTbl[Replay_PlayIx].Frame != 0) &&
+           (Replay_PlayTbl[Replay_PlayIx].Frame <= frame)) {
+        Replay_PlayHeld = Replay_PlayTbl[Replay_PlayIx].Btns;
+        Replay_PlayIx++;
+    }
+    return (Replay_PlayHeld);
+}
@@ -0,0 +1,40 @@
+/**************************************************************************
+ * File:         app_replay.h   Game recording: snapshot + input replay
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Reproducible runs for A/B benchmarking: a run is fully
+ *               described by its initial-state snapshot (RNG seed; the
+ *               rest of the start state is compile-time constant) plus
+ *               the frame-stamped button events, so a recording replays
+ *               the exact same frames under a changed renderer or
+ *               scheduler.  Events are 4 bytes each in a static RAM
+ *               buffer and dump as hex over UART1 for capture on the
+ *               host.  APP_CFG_REPLAY_MODE in app_cfg.h selects record
+ *               or playback for the build.
+ **************************************************************************/
+
+#ifndef APP_REPLAY_H
+#define APP_REPLAY_H
+
+// Recording capacity: 4 bytes per input event.  Button events only --
+// frames with no input change cost nothing, so 512 events covers minutes
+// of play in ~2 KB of spare RAM.
+#define REPLAY_EVT_MAX      512
+
+#define REPLAY_MODE_REC     0   // capture live buttons, dump on game over
+#define REPLAY_MODE_PLAY    1   // drive the game from Replay_Evt[] below
+
+typedef struct replay_evt {
+    CPU_INT16U Frame;               // game frame the buttons changed on
+    CPU_INT08U Btns;                // new BSP_ButtonsSnapshot() mask
+    CPU_INT08U Unused;              // keeps the event a clean 4 bytes
+} REPLAY_EVT;
+
+void        Replay_RecStart(CPU_INT32U seed);           // begin a recording
+void        Replay_RecInput(CPU_INT16U frame, CPU_INT08U btns);
+void        Replay_Dump(void);                          // hex dump over UART1
+
+CPU_INT32U  Replay_PlayStart(void);                     // returns recorded seed
+CPU_INT08U  Replay_PlayBtns(CPU_INT16U frame);          // buttons held at frame
+
+#endif
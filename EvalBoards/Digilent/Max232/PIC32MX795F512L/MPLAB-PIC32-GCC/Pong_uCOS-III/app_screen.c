@@ -0,0 +1,203 @@
+/**************************************************************************
+ * File:         app_screen.c   Off-screen framebuffer with differential render
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Tasks draw into FB_Frame[][] with FB_WriteChar/FB_WriteStr,
+ *               which are cheap RAM writes.  FB_Render() compares the
+ *               working frame against FB_Shadow[][] (the last frame that
+ *               went out over the UART), moves the cursor once per dirty
+ *               run, and sends only the cells that changed.  Runs separated
+ *               by fewer than FB_RUN_MERGE_GAP unchanged cells are merged,
+ *               since re-sending a short gap costs less than a cursor move.
+ **************************************************************************/
+#include <includes.h>
+#include "app_screen.h"
+
+// ***************************************************************************
+// Frame storage:  FB_Frame is what the tasks see, FB_Shadow is what the
+// terminal currently shows.  Row-major, 0-based internally; the public
+// API uses the same 1-based coordinates as Screen_WriteChar in app.c.
+// ***************************************************************************
+static char FB_Frame[FB_HEIGHT][FB_WIDTH];
+static char FB_Shadow[FB_HEIGHT][FB_WIDTH];
+
+// Run emission buffer: cursor move (8) + a full row (80) + NUL
+static char FB_SeqBuf[8 + FB_WIDTH + 1];
+
+// ----- Build 'esc [ rr ; cc H' into buf, returns length (row/col 1-based)
+static int FB_BuildCursorMove(char *buf, int col, int row) {
+    int n = 0;
+    buf[n++] = 0x1B;
+    buf[n++] = '[';
+    buf[n++] = row / 10 + '0';
+    buf[n++] = row % 10 + '0';
+    buf[n++] = ';';
+    buf[n++] = col / 10 + '0';
+    buf[n++] = col % 10 + '0';
+    buf[n++] = 'H';
+    return n;
+}
+
+// ----- Clear both frames and blank the terminal
+void FB_Init(void) {
+    int x, y;
+    for (y = 0; y < FB_HEIGHT; y++) {
+        for (x = 0; x < FB_WIDTH; x++) {
+            FB_Frame[y][x]  = ' ';
+            FB_Shadow[y][x] = ' ';
+        }
+    }
+    putsU1_hi("\x1B" "c");  // VT100 reset clears the real screen to match
+    putsU1_hi("\x1B[?25l"); // cursor off -- the renderer owns the cursor
+}
+
+// ----- Draw one character into the working frame (no UART traffic)
+void FB_WriteChar(int x, int y, char c) {
+    if ((x < 1) || (x > FB_WIDTH) || (y < 1) || (y > FB_HEIGHT))
+        return;
+    FB_Frame[y - 1][x - 1] = c;
+}
+
+// ----- Draw a string into the working frame, clipped at the right edge
+void FB_WriteStr(int x, int y, const char *s) {
+    while (*s && (x <= FB_WIDTH)) {
+        FB_WriteChar(x, y, *s);
+        x++;
+        s++;
+    }
+}
+
+// ----- Full-frame repaint for a reconnected terminal.  Clears the real
+//       screen, then walks the working frame emitting one cursor move per
+//       non-blank row segment; blank runs are skipped outright (most of
+//       the board) and a repeated character collapses into an ECMA-48
+//       REP sequence (esc [ n b) once that is no longer than the run.
+//       A mostly-blank 80x25 frame goes out in a few hundred bytes
+//       instead of ~2000 cursor-addressed characters -- well inside a
+//       couple hundred milliseconds at 115200.  Leaves the shadow frame
+//       in sync, so the next FB_Render() diff starts clean.
+#define FB_REP_MIN  6       // shortest run where 'c esc [ n b' pays off
+
+void FB_Repaint(void) {
+    int x, y, i, seg_end, probe, gap, run, n;
+
+    putsU1_hi("\x1B" "c");  // reset: unknown terminal state after reconnect
+    putsU1_hi("\x1B[?25l");
+
+    for (y = 0; y < FB_HEIGHT; y++) {
+        char *cur = &FB_Frame[y][0];
+        x = 0;
+        while (x < FB_WIDTH) {
+            if (cur[x] == ' ') {                // screen is blank after the
+                x++;                            // ... reset -- skip the run
+                continue;
+            }
+            seg_end = x;                        // extend the segment, merging
+            probe   = x;                        // across short blank gaps
+            while (probe < FB_WIDTH) {
+                if (cur[probe] != ' ') {
+                    seg_end = probe;
+                    probe++;
+                } else {
+                    gap = 0;
+                    while ((probe + gap < FB_WIDTH) && (cur[probe + gap] == ' '))
+                        gap++;
+                    if ((gap >= FB_RUN_MERGE_GAP) || (probe + gap >= FB_WIDTH))
+                        break;
+                    probe += gap;
+                }
+            }
+            n = FB_BuildCursorMove(FB_SeqBuf, x + 1, y + 1);
+            while (x <= seg_end) {
+                run = 1;                        // collapse repeated characters
+                while ((x + run <= seg_end) && (cur[x + run] == cur[x]))
+                    run++;
+                FB_SeqBuf[n++] = cur[x];
+                if (run >= FB_REP_MIN) {        // 'repeat it run-1 more times'
+                    FB_SeqBuf[n++] = 0x1B;
+                    FB_SeqBuf[n++] = '[';
+                    if (run - 1 >= 10)
+                        FB_SeqBuf[n++] = (run - 1) / 10 + '0';
+                    FB_SeqBuf[n++] = (run - 1) % 10 + '0';
+                    FB_SeqBuf[n++] = 'b';
+                } else {
+                    for (i = 1; i < run; i++)
+                        FB_SeqBuf[n++] = cur[x];
+                }
+                x += run;
+            }
+            FB_SeqBuf[n] = '\0';
+            putsU1_hi(FB_SeqBuf);
+        }
+        for (i = 0; i < FB_WIDTH; i++)          // terminal now shows this row
+            FB_Shadow[y][i] = cur[i];
+    }
+}
+
+// ----- Mark every cell dirty so the next FB_Render retransmits the frame
+void FB_ForceRedraw(void) {
+    int x, y;
+    for (y = 0; y < FB_HEIGHT; y++)
+        for (x = 0; x < FB_WIDTH; x++)
+            FB_Shadow[y][x] = FB_Frame[y][x] ^ 0x01;    // guaranteed different
+}
+
+// Cost of the most recent FB_Render(): wire bytes emitted and cells that
+// actually differed.  Read back with FB_RenderCostGet() by the frame
+// profiler; counting is two adds in paths that already ran.
+static int FB_CostBytes;
+static int FB_CostCells;
+
+// ----- Transmit only the cells that changed since the last render
+//       One cursor move per dirty run; nearby runs are merged.
+void FB_Render(void) {
+    int x, y, run_end, probe, gap, n;
+
+    FB_CostBytes = 0;
+    FB_CostCells = 0;
+    for (y = 0; y < FB_HEIGHT; y++) {
+        char *cur = &FB_Frame[y][0];
+        char *old = &FB_Shadow[y][0];
+        x = 0;
+        while (x < FB_WIDTH) {
+            if (cur[x] == old[x]) {         // skip clean cells
+                x++;
+                continue;
+            }
+            run_end = x;                    // extend the dirty run, merging
+            probe   = x;                    // across short clean gaps
+            while (probe < FB_WIDTH) {
+                if (cur[probe] != old[probe]) {
+                    run_end = probe;
+                    probe++;
+                } else {
+                    gap = 0;
+                    while ((probe + gap < FB_WIDTH) &&
+                           (cur[probe + gap] == old[probe + gap]))
+                        gap++;
+                    if ((gap >= FB_RUN_MERGE_GAP) || (probe + gap >= FB_WIDTH))
+                        break;
+                    probe += gap;           // gap is short -- keep the run going
+                }
+            }
+            n = FB_BuildCursorMove(FB_SeqBuf, x + 1, y + 1);
+            while (x <= run_end) {
+                if (cur[x] != old[x])       // merged gap cells are not changes
+                    FB_CostCells++;
+                FB_SeqBuf[n++] = cur[x];
+                old[x] = cur[x];            // shadow now matches the terminal
+                x++;
+            }
+            FB_SeqBuf[n] = '\0';
+            FB_CostBytes += n;
+            putsU1_hi(FB_SeqBuf);           // one submission per run
+        }
+    }
+}
+
+// ----- Cost counters from the most recent FB_Render()
+void FB_RenderCostGet(int *p_bytes, int *p_cells) {
+    *p_bytes = FB_CostBytes;
+    *p_cells = FB_CostCells;
+}
@@ -0,0 +1,34 @@
+/**************************************************************************
+ * File:         app_screen.h   Off-screen framebuffer for the VT100 display
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  80x25 shadow framebuffer that game tasks draw into with
+ *               plain memory writes.  FB_Render() diffs the working frame
+ *               against the last frame sent over the UART and emits only
+ *               the changed cells, coalescing runs of adjacent changes
+ *               into a single cursor move.  This turns UART cost from
+ *               O(writes) into O(actual screen change).
+ **************************************************************************/
+
+#ifndef APP_SCREEN_H
+#define APP_SCREEN_H
+
+// ***************************************************************************
+// Framebuffer geometry -- matches the SCREEN_* defines in app.c
+// ***************************************************************************
+#define FB_WIDTH    80
+#define FB_HEIGHT   25
+
+// Unchanged-cell gap below which two dirty runs on a row are merged into
+// one emission (re-sending the gap is cheaper than an 8-byte cursor move)
+#define FB_RUN_MERGE_GAP 4
+
+void FB_Init(void);                             // clear both frames, blank terminal
+void FB_WriteChar(int x, int y, char c);        // 1-based coords like Screen_WriteChar
+void FB_WriteStr(int x, int y, const char *s);  // clipped at the right edge
+void FB_Render(void);                           // transmit the differences only
+void FB_RenderCostGet(int *p_bytes, int *p_cells);  // cost of the last render
+void FB_ForceRedraw(void);                      // mark the whole frame dirty
+void FB_Repaint(void);                          // full repaint for a reconnect
+
+#endif
@@ -0,0 +1,592 @@
+/**************************************************************************
+ * File:         app_snake.c   Snake game module with O(1) body movement
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  The body lives in a ring buffer of packed (x,y) cells.
+ *               A movement step advances the head index, stores the new
+ *               head cell, draws it, and (unless the snake just ate)
+ *               advances the tail index and erases the old tail cell --
+ *               two FB_WriteChar calls and no per-segment work, so a
+ *               2000-cell snake moves as cheaply as a 3-cell one.  The
+ *               game task runs a fixed timestep off OSTimeDlyUntil and
+ *               pushes the frame out with FB_Render(), which only
+ *               transmits the cells that changed.
+ **************************************************************************/
+#include <includes.h>
+#include "UART1.h"
+#include "app_screen.h"
+#include "app_snake.h"
+#if APP_CFG_LINK_EN > 0u
+#include "app_link.h"
+#endif
+#if APP_CFG_REPLAY_EN > 0u
+#include "app_replay.h"
+#endif
+#if APP_CFG_FRAME_PROF_EN > 0u
+#include "app_frame.h"
+#endif
+
+// ***************************************************************************
+// Game tuning
+// ***************************************************************************
+#define SNAKE_PERIOD_TICKS  ((100 * OS_CFG_TICK_RATE_HZ) / 1000)    // 100 ms/step
+
+// Frame budget for the profiler in core timer counts (core timer runs at
+// SYSCLK / 2): 75 ms of the 100 ms step, leaving declared headroom for
+// the stat task and UART drain underneath.
+#define SNAKE_FRAME_BUDGET_CT   ((BSP_CLK_FREQ / 2 / 1000) * 75)
+#define SNAKE_FRAME_HUD_RATE    16      // frames between HUD summary refreshes
+#define SNAKE_START_LEN     4
+#define SNAKE_BODY_CH       'o'
+#define SNAKE_HEAD_CH       'O'
+#define SNAKE_FOOD_CH       '@'
+#define SNAKE_PEER_CH       '#'     // the other board's snake head
+#define SNAKE_AI_BODY_CH    'x'     // the AI opponent
+#define SNAKE_AI_HEAD_CH    'X'
+
+// Same priority slot the ball task uses; the Pong tasks are compiled out
+// when APP_CFG_SNAKE_EN selects this module (see AppTaskCreate in app.c).
+#define APP_CFG_TASK_SNAKE_PRIO         4
+#define APP_CFG_TASK_SNAKE_STK_SIZE     512
+#define APP_CFG_TASK_SNAKE_STK_LIMIT    (APP_CFG_TASK_SNAKE_STK_SIZE / 10u)
+
+// Steering buttons on the Basic Shield, one per direction
+#define SNAKE_UP_SW         BSP_BTN1_MSK
+#define SNAKE_DOWN_SW       BSP_BTN2_MSK
+#define SNAKE_LEFT_SW       BSP_BTN3_MSK
+#define SNAKE_RIGHT_SW      BSP_BTN4_MSK
+
+static OS_TCB  Snake_TaskTCB;
+static CPU_STK Snake_TaskStk[APP_CFG_TASK_SNAKE_STK_SIZE];
+
+static SNAKE Snake_Game;                // the player's snake
+#if APP_CFG_SNAKE_AI_EN > 0u
+static SNAKE Snake_AI;                  // the AI opponent's snake
+#endif
+static SNAKE_CELL Snake_Food;           // current food cell, shared by both
+
+static void Snake_Task(void *p_arg);
+
+/*$PAGE*/
+
+// ***************************************************************************
+// Body engine
+// ***************************************************************************
+
+// ----- Lay the snake out horizontally with its head at (x,y), heading
+//       (dx,dy), and draw it.  The only O(length) walk in the module.
+void Snake_BodyInit(SNAKE *s, int x, int y, int len, int dx, int dy) {
+    int i;
+
+    s->Head = 0;
+    s->Tail = 0;
+    s->Len  = 0;
+    s->DirX = dx;
+    s->DirY = dy;
+    Mem_Clr((void *) &s->Grid, (CPU_SIZE_T) sizeof (s->Grid));
+    for (i = len - 1; i >= 0; i--) {            // tail first, head last
+        s->Head            = (s->Head + 1) & SNAKE_BODY_MASK;
+        s->Body[s->Head]   = SNAKE_CELL_PACK(x - i * dx, y - i * dy);
+        s->Len++;
+        Snake_GridSet(&s->Grid, x - i * dx, y - i * dy);
+        FB_WriteChar(x - i * dx, y - i * dy,
+                     (i == 0) ? s->HeadCh : s->BodyCh);
+    }
+    s->Tail = (s->Tail + 1) & SNAKE_BODY_MASK;  // Body[Tail] = oldest cell
+}
+
+// ----- Newest body cell
+SNAKE_CELL Snake_HeadCell(const SNAKE *s) {
+    return (s->Body[s->Head]);
+}
+
+// ----- The cell one step ahead of the head on the current heading; the
+//       board wraps at the edges.  The game task uses this to test the
+//       coming cell for food before committing the move.
+SNAKE_CELL Snake_NextCell(const SNAKE *s) {
+    SNAKE_CELL head = s->Body[s->Head];
+    int x = SNAKE_CELL_X(head) + s->DirX;
+    int y = SNAKE_CELL_Y(head) + s->DirY;
+
+    if (x < 1)          x = FB_WIDTH;
+    if (x > FB_WIDTH)   x = 1;
+    if (y < 1)          y = FB_HEIGHT;
+    if (y > FB_HEIGHT)  y = 1;
+    return (SNAKE_CELL_PACK(x, y));
+}
+
+// ----- One movement step: head push + tail pop + exactly two cell draws.
+//       'grow' skips the tail pop, which is all it takes to lengthen the
+//       snake by one cell.
+void Snake_Step(SNAKE *s, int grow) {
+    SNAKE_CELL head = s->Body[s->Head];
+    SNAKE_CELL next = Snake_NextCell(s);
+
+    FB_WriteChar(SNAKE_CELL_X(head), SNAKE_CELL_Y(head), s->BodyCh);
+
+    s->Head          = (s->Head + 1) & SNAKE_BODY_MASK;
+    s->Body[s->Head] = next;
+    Snake_GridSet(&s->Grid, SNAKE_CELL_X(next), SNAKE_CELL_Y(next));
+    FB_WriteChar(SNAKE_CELL_X(next), SNAKE_CELL_Y(next), s->HeadCh);
+
+    if (grow && (s->Len < SNAKE_BODY_MAX - 1)) {
+        s->Len++;                               // tail stays -- one cell longer
+    } else {
+        SNAKE_CELL tail = s->Body[s->Tail];
+        Snake_GridClr(&s->Grid, SNAKE_CELL_X(tail), SNAKE_CELL_Y(tail));
+        FB_WriteChar(SNAKE_CELL_X(tail), SNAKE_CELL_Y(tail), ' ');
+        s->Tail = (s->Tail + 1) & SNAKE_BODY_MASK;
+    }
+}
+
+/*$PAGE*/
+
+// ***************************************************************************
+// Game task
+// ***************************************************************************
+
+// ----- Cheap LCG for food placement, seeded from the core timer so the
+//       sequence differs run to run.  The replay module re-seeds it so a
+//       recorded run reproduces the same food sequence.
+static CPU_INT32U Snake_RandSeed = 0;
+
+static void Snake_RandSeedSet(CPU_INT32U seed) {
+    Snake_RandSeed = seed | 1u;
+}
+
+static CPU_INT32U Snake_Rand(void) {
+    if (Snake_RandSeed == 0) {
+        Snake_RandSeed = ReadCoreTimer() | 1u;
+    }
+    Snake_RandSeed = Snake_RandSeed * 1103515245u + 12345u;
+    return (Snake_RandSeed >> 16);
+}
+
+// ----- Drop the food on a free board cell.  Each candidate is one bit
+//       test per snake against the occupancy grids, so a long snake
+//       costs retries, not a body scan per retry.
+static SNAKE_CELL Snake_FoodPlace(void) {
+    int x, y;
+
+    do {
+        x = (int)(Snake_Rand() % FB_WIDTH) + 1;
+        y = (int)(Snake_Rand() % FB_HEIGHT) + 1;
+    } while (Snake_GridTest(&Snake_Game.Grid, x, y)
+#if APP_CFG_SNAKE_AI_EN > 0u
+          || Snake_GridTest(&Snake_AI.Grid, x, y)
+#endif
+            );
+
+    FB_WriteChar(x, y, SNAKE_FOOD_CH);
+    Snake_Food = SNAKE_CELL_PACK(x, y);
+    return (Snake_Food);
+}
+
+// Snake game task: fixed timestep like the Pong ball task.  Buttons steer
+// one axis per press; reversing straight into the body is ignored.  This
+// task is the only screen writer in snake builds, so it also owns the
+// render call.
+static void Snake_Task(void *p_arg) {
+    OS_ERR err;
+    OS_TICK frame_deadline;
+    CPU_INT08U btns;
+    SNAKE_CELL next;
+    U1_KEY_EVT key_evt;
+    int dx, dy;
+    int grow;
+#if APP_CFG_LINK_EN > 0u
+    LINK_MSG link_msg;
+    SNAKE_CELL peer = 0;            // last drawn peer head, 0 = none yet
+    CPU_INT08U btns_sent = 0;
+#endif
+#if APP_CFG_REPLAY_EN > 0u
+    CPU_INT16U frame_ctr = 0;
+#if APP_CFG_REPLAY_MODE == 0u
+    CPU_INT08U btns_rec = 0;
+#endif
+#endif
+#if APP_CFG_FRAME_PROF_EN > 0u
+    CPU_INT32U prof_start;
+    CPU_INT08U prof_ctr = 0;
+    int prof_bytes, prof_cells;
+#endif
+
+    (void) p_arg;
+#if APP_CFG_REPLAY_EN > 0u
+#if APP_CFG_REPLAY_MODE == 0u
+    Snake_RandSeedSet(ReadCoreTimer());         // record this run's seed
+    Replay_RecStart(Snake_RandSeed);
+#else
+    Snake_RandSeedSet(Replay_PlayStart());      // replay the recorded run
+#endif
+#endif
+    U1_KeyInputEn(1);                           // arrows/WASD steer too
+    FB_Init();
+    Snake_Game.BodyCh = SNAKE_BODY_CH;
+    Snake_Game.HeadCh = SNAKE_HEAD_CH;
+    Snake_BodyInit(&Snake_Game,
+                   FB_WIDTH / 2, FB_HEIGHT / 2,
+                   SNAKE_START_LEN, 1, 0);
+    Snake_FoodPlace();
+    FB_Render();
+#if APP_CFG_LINK_EN > 0u
+    Link_Init();
+#endif
+#if APP_CFG_FRAME_PROF_EN > 0u
+    Frame_Init((CPU_INT32U) SNAKE_FRAME_BUDGET_CT);
+#endif
+
+    frame_deadline = OSTimeGet(&err);
+    while (DEF_TRUE) {
+        OSTimeDlyUntil(&frame_deadline, (OS_TICK) SNAKE_PERIOD_TICKS, &err);
+#if APP_CFG_FRAME_PROF_EN > 0u
+        prof_start = ReadCoreTimer();
+#endif
+
+#if (APP_CFG_REPLAY_EN > 0u) && (APP_CFG_REPLAY_MODE > 0u)
+        frame_ctr++;
+        btns = Replay_PlayBtns(frame_ctr);      // recording drives the game
+#else
+        btns = BSP_ButtonsSnapshot();
+        // Terminal keys decoded in the UART1 RX interrupt map onto the
+        // button masks, so the replay/link paths see one input source
+        while (U1_KeyEvtGet(&key_evt)) {        // last key this frame wins
+            switch (key_evt.Dir) {
+                case U1_KEY_UP:    btns = SNAKE_UP_SW;    break;
+                case U1_KEY_DOWN:  btns = SNAKE_DOWN_SW;  break;
+                case U1_KEY_LEFT:  btns = SNAKE_LEFT_SW;  break;
+                case U1_KEY_RIGHT: btns = SNAKE_RIGHT_SW; break;
+                default:                                  break;
+            }
+        }
+#endif
+#if (APP_CFG_REPLAY_EN > 0u) && (APP_CFG_REPLAY_MODE == 0u)
+        frame_ctr++;
+        if (btns != btns_rec) {                 // change events only
+            Replay_RecInput(frame_ctr, btns);
+            btns_rec = btns;
+        }
+#endif
+#if APP_CFG_LINK_EN > 0u
+        // Pump the wire, mirror our inputs (on change only) and show the
+        // peer's head.  All delta traffic; a quiet frame sends 0 bytes.
+        Link_Poll();
+        if (btns != btns_sent) {
+            Link_InputSend(btns);
+            btns_sent = btns;
+        }
+        while (Link_MsgGet(&link_msg)) {
+            if ((link_msg.Type == LINK_MSG_ENTITY) && (link_msg.Data[0] == 0)) {
+                if (peer != 0) {                // erase the old peer head
+                    FB_WriteChar(SNAKE_CELL_X(peer), SNAKE_CELL_Y(peer), ' ');
+                }
+                peer = SNAKE_CELL_PACK((int) link_msg.Data[1],
+                                       (int) link_msg.Data[2]);
+                FB_WriteChar(SNAKE_CELL_X(peer), SNAKE_CELL_Y(peer),
+                             SNAKE_PEER_CH);
+            }
+        }
+#endif
+        dx = Snake_Game.DirX;
+        dy = Snake_Game.DirY;
+        if (btns & SNAKE_UP_SW) {
+            dx = 0; dy = -1;
+        } else if (btns & SNAKE_DOWN_SW) {
+            dx = 0; dy = 1;
+        } else if (btns & SNAKE_LEFT_SW) {
+            dx = -1; dy = 0;
+        } else if (btns & SNAKE_RIGHT_SW) {
+            dx = 1; dy = 0;
+        }
+        if ((dx != -Snake_Game.DirX) || (dy != -Snake_Game.DirY)) {
+            Snake_Game.DirX = dx;               // reversals are ignored
+            Snake_Game.DirY = dy;
+        }
+
+        // All four buttons at once: repaint for a reconnected terminal
+        if (btns == (SNAKE_UP_SW | SNAKE_DOWN_SW | SNAKE_LEFT_SW | SNAKE_RIGHT_SW)) {
+            FB_Repaint();
+        }
+
+        next = Snake_NextCell(&Snake_Game);
+        grow = (next == Snake_Food);
+
+        // Self-collision is one bit test.  Stepping into the cell the
+        // tail is about to vacate is legal (its bit clears this frame).
+        if (Snake_GridTest(&Snake_Game.Grid,
+                           SNAKE_CELL_X(next), SNAKE_CELL_Y(next)) &&
+            ((next != Snake_Game.Body[Snake_Game.Tail]) || grow)) {
+#if APP_CFG_REPLAY_EN > 0u
+            frame_ctr = 0;
+#if APP_CFG_REPLAY_MODE == 0u
+            Replay_Dump();                      // the run is over -- dump it
+            Snake_RandSeedSet(ReadCoreTimer()); // and record the next one
+            Replay_RecStart(Snake_RandSeed);
+            btns_rec = 0;
+#else
+            Snake_RandSeedSet(Replay_PlayStart());  // loop the recording
+#endif
+#endif
+#if APP_CFG_FRAME_PROF_EN > 0u
+            Frame_Dump();                       // full ring for offline analysis
+#endif
+            FB_Init();                          // game over -- start fresh
+            Snake_BodyInit(&Snake_Game,
+                           FB_WIDTH / 2, FB_HEIGHT / 2,
+                           SNAKE_START_LEN, 1, 0);
+            Snake_FoodPlace();
+            FB_Render();
+            continue;
+        }
+
+        Snake_Step(&Snake_Game, grow);
+        if (grow) {                             // place after the step so the
+            Snake_FoodPlace();                  // free-cell test sees the body
+        }
+#if APP_CFG_LINK_EN > 0u
+        next = Snake_HeadCell(&Snake_Game);     // 9-byte head delta per step
+        Link_EntitySend(0, SNAKE_CELL_X(next), SNAKE_CELL_Y(next));
+        Link_Poll();                            // start it moving this frame
+#endif
+
+        FB_Render();                            // ship only what changed
+
+#if APP_CFG_FRAME_PROF_EN > 0u
+        FB_RenderCostGet(&prof_bytes, &prof_cells);
+        Frame_End(prof_start, ReadCoreTimer(),
+                  (CPU_INT16U) prof_bytes, (CPU_INT16U) prof_cells);
+        prof_ctr++;
+        if (prof_ctr >= SNAKE_FRAME_HUD_RATE) { // summary digits ride out in
+            prof_ctr = 0;                       // ... the next frame's diff
+            Frame_HUDRender(FB_WIDTH - 11, 1);
+        }
+#endif
+    }
+}
+
+#if APP_CFG_SNAKE_AI_EN > 0u
+/*$PAGE*/
+
+// ***************************************************************************
+// AI opponent
+//   A second snake chasing the same food, driven by a budget-bounded
+//   incremental BFS: the search keeps its frontier between slices and
+//   expands at most SNAKE_AI_NODE_BUDGET cells per slice, then yields
+//   with OSTimeDly.  CPU share is therefore bounded by
+//   (node budget x per-node cost) / slice period, tunable from the two
+//   defines below and verifiable on the per-task CPU accounting
+//   (OSStatTaskUsageNext) under the task name "SnakeAI".  Until a search
+//   finishes, the snake keeps its last heading -- an anytime planner
+//   that degrades to "keep going" under budget pressure, never a frame
+//   stall.
+// ***************************************************************************
+
+#define SNAKE_AI_SLICE_TICKS    ((10 * OS_CFG_TICK_RATE_HZ) / 1000) // 10 ms
+#define SNAKE_AI_NODE_BUDGET    128     // BFS expansions per slice
+#define SNAKE_AI_STEP_SLICES    10      // one movement step per 10 slices
+
+#define APP_CFG_TASK_SNAKE_AI_PRIO      5   // below the player's game task
+#define APP_CFG_TASK_SNAKE_AI_STK_SIZE  512
+#define APP_CFG_TASK_SNAKE_AI_STK_LIMIT (APP_CFG_TASK_SNAKE_AI_STK_SIZE / 10u)
+
+static OS_TCB  SnakeAI_TaskTCB;
+static CPU_STK SnakeAI_TaskStk[APP_CFG_TASK_SNAKE_AI_STK_SIZE];
+
+// Search state, persistent across slices (that is what makes the search
+// incremental): visited bitmap, parent direction per cell, FIFO frontier.
+static SNAKE_GRID  SnakeAI_Visited;
+static CPU_INT08U  SnakeAI_Parent[FB_HEIGHT][FB_WIDTH]; // dir index + 1, 0 = none
+static CPU_INT16U  SnakeAI_Q[FB_WIDTH * FB_HEIGHT];
+static CPU_INT16U  SnakeAI_QHead;
+static CPU_INT16U  SnakeAI_QTail;
+static CPU_BOOLEAN SnakeAI_Searching = DEF_FALSE;
+static SNAKE_CELL  SnakeAI_Target;
+
+static const int SnakeAI_DirX[4] = { 0, 0, -1, 1 };
+static const int SnakeAI_DirY[4] = { -1, 1, 0, 0 };
+
+// ----- Board wrap, same rule as Snake_NextCell
+static int SnakeAI_WrapX(int x) {
+    if (x < 1)         return (FB_WIDTH);
+    if (x > FB_WIDTH)  return (1);
+    return (x);
+}
+
+static int SnakeAI_WrapY(int y) {
+    if (y < 1)          return (FB_HEIGHT);
+    if (y > FB_HEIGHT)  return (1);
+    return (y);
+}
+
+// ----- Restart the search from the AI head toward the current food
+static void SnakeAI_SearchStart(void) {
+    SNAKE_CELL head = Snake_HeadCell(&Snake_AI);
+
+    Mem_Clr((void *) &SnakeAI_Visited, (CPU_SIZE_T) sizeof (SnakeAI_Visited));
+    Mem_Clr((void *) &SnakeAI_Parent[0][0], (CPU_SIZE_T) sizeof (SnakeAI_Parent));
+    SnakeAI_QHead = 0;
+    SnakeAI_QTail = 0;
+    SnakeAI_Q[SnakeAI_QTail++] = head;
+    Snake_GridSet(&SnakeAI_Visited, SNAKE_CELL_X(head), SNAKE_CELL_Y(head));
+    SnakeAI_Target    = Snake_Food;
+    SnakeAI_Searching = DEF_TRUE;
+}
+
+// ----- Walk the parent chain back from the target and point the snake
+//       along the first step of the found path
+static void SnakeAI_PathCommit(void) {
+    int x = SNAKE_CELL_X(SnakeAI_Target);
+    int y = SNAKE_CELL_Y(SnakeAI_Target);
+    SNAKE_CELL head = Snake_HeadCell(&Snake_AI);
+    CPU_INT08U dir = 0;
+    int px, py;
+
+    while (SNAKE_CELL_PACK(x, y) != head) {
+        dir = SnakeAI_Parent[y - 1][x - 1];
+        if (dir == 0) {                         // start cell reached
+            break;
+        }
+        dir--;                                  // stored as index + 1
+        px = SnakeAI_WrapX(x - SnakeAI_DirX[dir]);
+        py = SnakeAI_WrapY(y - SnakeAI_DirY[dir]);
+        x = px;
+        y = py;
+    }
+    Snake_AI.DirX = SnakeAI_DirX[dir];          // dir of the step leaving
+    Snake_AI.DirY = SnakeAI_DirY[dir];          // ... the head cell
+}
+
+// ----- One budgeted search slice: expand up to SNAKE_AI_NODE_BUDGET
+//       frontier cells, commit the path if the food is reached
+static void SnakeAI_SearchSlice(void) {
+    CPU_INT16U budget = SNAKE_AI_NODE_BUDGET;
+    SNAKE_CELL cell;
+    CPU_INT08U d;
+    int x, y, nx, ny;
+
+    while ((budget > 0) && (SnakeAI_QHead != SnakeAI_QTail)) {
+        budget--;
+        cell = SnakeAI_Q[SnakeAI_QHead++];
+        if (cell == SnakeAI_Target) {
+            SnakeAI_PathCommit();
+            SnakeAI_Searching = DEF_FALSE;
+            return;
+        }
+        x = SNAKE_CELL_X(cell);
+        y = SNAKE_CELL_Y(cell);
+        for (d = 0; d < 4; d++) {
+            nx = SnakeAI_WrapX(x + SnakeAI_DirX[d]);
+            ny = SnakeAI_WrapY(y + SnakeAI_DirY[d]);
+            if (Snake_GridTest(&SnakeAI_Visited, nx, ny) ||
+                Snake_GridTest(&Snake_Game.Grid, nx, ny) ||
+                Snake_GridTest(&Snake_AI.Grid, nx, ny)) {
+                continue;
+            }
+            Snake_GridSet(&SnakeAI_Visited, nx, ny);
+            SnakeAI_Parent[ny - 1][nx - 1] = d + 1;
+            SnakeAI_Q[SnakeAI_QTail++] = SNAKE_CELL_PACK(nx, ny);
+        }
+    }
+    if (SnakeAI_QHead == SnakeAI_QTail) {       // food unreachable right now;
+        SnakeAI_Searching = DEF_FALSE;          // keep heading, retry later
+    }
+}
+
+// AI opponent task.  Runs below the game task, so every search slice and
+// movement step happens in the frame'"'"'s slack time; the player'"'"'s input
+// sampling and render never wait on the planner.
+static void SnakeAI_Task(void *p_arg) {
+    OS_ERR err;
+    CPU_INT08U slice_ctr = 0;
+    SNAKE_CELL next;
+    int grow;
+
+    (void) p_arg;
+    OSTimeDly((OS_TICK) SNAKE_AI_SLICE_TICKS, OS_OPT_TIME_DLY, &err);
+    Snake_AI.BodyCh = SNAKE_AI_BODY_CH;         // game task has initialized
+    Snake_AI.HeadCh = SNAKE_AI_HEAD_CH;         // ... the board by now
+    Snake_BodyInit(&Snake_AI,
+                   FB_WIDTH / 4, FB_HEIGHT / 4,
+                   SNAKE_START_LEN, 1, 0);
+
+    while (DEF_TRUE) {
+        OSTimeDly((OS_TICK) SNAKE_AI_SLICE_TICKS, OS_OPT_TIME_DLY, &err);
+
+        if (!SnakeAI_Searching || (SnakeAI_Target != Snake_Food)) {
+            SnakeAI_SearchStart();              // food moved or path done
+        }
+        SnakeAI_SearchSlice();
+
+        slice_ctr++;
+        if (slice_ctr < SNAKE_AI_STEP_SLICES) {
+            continue;
+        }
+        slice_ctr = 0;
+
+        next = Snake_NextCell(&Snake_AI);
+        grow = (next == Snake_Food);
+        if ((Snake_GridTest(&Snake_Game.Grid,
+                            SNAKE_CELL_X(next), SNAKE_CELL_Y(next))) ||
+            (Snake_GridTest(&Snake_AI.Grid,
+                            SNAKE_CELL_X(next), SNAKE_CELL_Y(next)) &&
+             ((next != Snake_AI.Body[Snake_AI.Tail]) || grow))) {
+            Snake_BodyInit(&Snake_AI,           // crashed -- respawn
+                           FB_WIDTH / 4, FB_HEIGHT / 4,
+                           SNAKE_START_LEN, 1, 0);
+            continue;
+        }
+        Snake_Step(&Snake_AI, grow);
+        if (grow) {
+            Snake_FoodPlace();
+        }
+        SnakeAI_SearchStart();                  // replan from the new head
+    }
+}
+
+// ----- Create the AI opponent task; called from AppTaskCreate in app.c
+void Snake_AITaskCreate(void) {
+    OS_ERR os_err;
+
+    OSTaskCreate((OS_TCB *) & SnakeAI_TaskTCB,
+            (CPU_CHAR *) "SnakeAI",
+            (OS_TASK_PTR) SnakeAI_Task,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_SNAKE_AI_PRIO,
+            (CPU_STK *) & SnakeAI_TaskStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_SNAKE_AI_STK_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_SNAKE_AI_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & os_err);
+
+    if (os_err != OS_ERR_NONE) {
+        putsU1("Error starting SnakeAI task: ");
+    }
+}
+#endif
+
+// ----- Create the game task; called from AppTaskCreate in app.c
+void Snake_TaskCreate(void) {
+    OS_ERR os_err;
+
+    OSTaskCreate((OS_TCB *) & Snake_TaskTCB,
+            (CPU_CHAR *) "Snake",
+            (OS_TASK_PTR) Snake_Task,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_SNAKE_PRIO,
+            (CPU_STK *) & Snake_TaskStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_SNAKE_STK_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_SNAKE_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & os_err);
+
+    if (os_err != OS_ERR_NONE) {
+        putsU1("Error starting Snake task: ");
+    }
+}
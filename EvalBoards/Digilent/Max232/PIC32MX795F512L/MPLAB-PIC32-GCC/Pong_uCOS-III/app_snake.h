@@ -0,0 +1,84 @@
+/**************************************************************************
+ * File:         app_snake.h   Snake game module with O(1) body movement
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  The snake body is a ring buffer of packed (x,y) cells, so
+ *               one movement step is a head push, a tail pop and exactly
+ *               two framebuffer writes no matter how long the snake is.
+ *               Rendering goes through the diffed framebuffer in
+ *               app_screen.c, so UART traffic per frame is the two cells
+ *               that actually changed.  Selected at build time with
+ *               APP_CFG_SNAKE_EN in app_cfg.h (Pong tasks are compiled
+ *               out when the snake owns the screen).
+ **************************************************************************/
+
+#ifndef APP_SNAKE_H
+#define APP_SNAKE_H
+
+#include "app_screen.h"
+
+// ***************************************************************************
+// Body ring geometry.  Power of two, so advancing an index is a mask, and
+// large enough for every cell on the 80x25 board (2000 < 2048).
+// ***************************************************************************
+#define SNAKE_BODY_MAX      2048
+#define SNAKE_BODY_MASK     (SNAKE_BODY_MAX - 1)
+
+// A body cell packed into 16 bits: column in the low byte, row in the high
+// byte.  1-based screen coordinates, same convention as FB_WriteChar.
+typedef CPU_INT16U SNAKE_CELL;
+
+#define SNAKE_CELL_PACK(x, y)   ((SNAKE_CELL)(((y) << 8) | ((x) & 0xFF)))
+#define SNAKE_CELL_X(c)         ((int)((c) & 0xFF))
+#define SNAKE_CELL_Y(c)         ((int)((c) >> 8))
+
+// ***************************************************************************
+// Occupancy grid: one bit per board cell (80x25 -> 250 bytes), kept in
+// lock-step with the body ring so self-collision, wall and food checks
+// are single-bit tests instead of an O(length) body scan.  The accessors
+// are macros (this code base's stand-in for inlines) taking the same
+// 1-based coordinates as FB_WriteChar.
+// ***************************************************************************
+#define SNAKE_GRID_ROW_BYTES    ((FB_WIDTH + 7) / 8)
+
+typedef struct snake_grid {
+    CPU_INT08U Row[FB_HEIGHT][SNAKE_GRID_ROW_BYTES];
+} SNAKE_GRID;
+
+#define Snake_GridSet(g, x, y)                                          \
+    ((g)->Row[(y) - 1][((x) - 1) >> 3] |=                               \
+        (CPU_INT08U)(1u << (((x) - 1) & 7)))
+#define Snake_GridClr(g, x, y)                                          \
+    ((g)->Row[(y) - 1][((x) - 1) >> 3] &=                               \
+        (CPU_INT08U)~(1u << (((x) - 1) & 7)))
+#define Snake_GridTest(g, x, y)                                         \
+    (((g)->Row[(y) - 1][((x) - 1) >> 3] >> (((x) - 1) & 7)) & 1u)
+
+// ***************************************************************************
+// Snake state.  Body[Head] is the newest cell, Body[Tail] the oldest; the
+// indices only ever advance (mod SNAKE_BODY_MAX), so a move never touches
+// the cells in between.  Grid mirrors the body: a bit is set exactly when
+// a body cell occupies that board position.
+// ***************************************************************************
+typedef struct snake {
+    SNAKE_CELL  Body[SNAKE_BODY_MAX];
+    SNAKE_GRID  Grid;               // occupancy bitmap of the body cells
+    CPU_INT16U  Head;               // index of the newest cell
+    CPU_INT16U  Tail;               // index of the oldest cell
+    CPU_INT16U  Len;                // current body length, in cells
+    int         DirX;               // current heading, one axis at a time:
+    int         DirY;               // (+-1,0) or (0,+-1)
+    char        BodyCh;             // how this snake draws itself, so the
+    char        HeadCh;             // ... player and the AI tell apart
+} SNAKE;
+
+void       Snake_BodyInit(SNAKE *s, int x, int y, int len, int dx, int dy);
+SNAKE_CELL Snake_HeadCell(const SNAKE *s);
+SNAKE_CELL Snake_NextCell(const SNAKE *s);    // where the next step lands
+void       Snake_Step(SNAKE *s, int grow);      // one O(1) movement step
+void       Snake_TaskCreate(void);              // create the game task
+#if APP_CFG_SNAKE_AI_EN > 0u
+void       Snake_AITaskCreate(void);            // create the AI opponent task
+#endif
+
+#endif
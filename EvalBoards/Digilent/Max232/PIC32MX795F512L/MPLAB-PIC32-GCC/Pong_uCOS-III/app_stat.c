@@ -0,0 +1,75 @@
+/**************************************************************************
+ * File:         app_stat.c   Lock-free kernel statistics snapshot
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Double-buffered publish from the statistics task.  The
+ *               publisher only ever writes the buffer the index does not
+ *               point at, then flips the index (one aligned byte store,
+ *               atomic on MIPS32) and bumps the sequence counter.  A
+ *               reader's copy can only tear if two publishes land inside
+ *               one copy; the sequence check catches even one and the
+ *               reader just copies again.
+ **************************************************************************/
+#include <includes.h>
+#include "app_stat.h"
+
+static APP_STAT_SNAP        AppStat_Buf[2];
+static volatile CPU_INT08U  AppStat_PubIx;      // half the readers copy from
+static volatile CPU_INT32U  AppStat_SeqCtr;     // 0 until the first publish
+
+// ----- Fill and publish a snapshot.  Called once per statistics task
+//       pass from App_OS_StatTaskHook(), so every field comes from the
+//       same pass -- the consistency the display used to buy with
+//       OSSchedLock.
+void AppStat_Publish(void) {
+    APP_STAT_SNAP *p_snap = &AppStat_Buf[AppStat_PubIx ^ 1u];
+#if (OS_CFG_DBG_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+    OS_ERR err;
+    OS_TCB *p_tcb;
+    CPU_CHAR *t_name;
+    OS_CPU_USAGE t_usage;
+    CPU_INT08U n;
+#endif
+
+    p_snap->CPUUsage = OSStatTaskCPUUsage;
+    p_snap->TaskQty  = OSTaskQty;
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    p_snap->SchedLockTimeMax = OSSchedLockTimeMax;
+    p_snap->SchedLockPrio    = (OSSchedLockHolderPtr != (OS_TCB *) 0)
+                             ? OSSchedLockHolderPtr->Prio
+                             : 0xFF;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+    n = 0;
+    p_tcb = OSStatTaskUsageNext((OS_TCB *) 0, &t_name, &t_usage, &err);
+    while ((p_tcb != (OS_TCB *) 0) && (n < APP_STAT_TASK_MAX)) {
+        p_snap->TaskTbl[n].TCBPtr  = p_tcb;
+        p_snap->TaskTbl[n].NameCh  = t_name[0];
+        p_snap->TaskTbl[n].Usage   = t_usage;
+        p_snap->TaskTbl[n].StkFree = p_tcb->StkFree;
+        p_snap->TaskTbl[n].StkUsed = p_tcb->StkUsed;
+        n++;
+        p_tcb = OSStatTaskUsageNext(p_tcb, &t_name, &t_usage, &err);
+    }
+    p_snap->TaskN = n;
+#else
+    p_snap->TaskN = 0;
+#endif
+
+    AppStat_PubIx = AppStat_PubIx ^ 1u;         // publish: readers see it whole
+    AppStat_SeqCtr++;
+}
+
+// ----- Copy the latest snapshot without locks.  Returns DEF_FALSE until
+//       the statistics task has published once.
+CPU_BOOLEAN AppStat_SnapGet(APP_STAT_SNAP *p_snap) {
+    CPU_INT32U seq;
+
+    do {
+        seq     = AppStat_SeqCtr;
+        *p_snap = AppStat_Buf[AppStat_PubIx];
+    } while (seq != AppStat_SeqCtr);            // a publish landed mid-copy
+    return (seq != 0);
+}
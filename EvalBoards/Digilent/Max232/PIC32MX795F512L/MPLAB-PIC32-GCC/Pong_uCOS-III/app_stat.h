@@ -0,0 +1,42 @@
+/**************************************************************************
+ * File:         app_stat.h   Lock-free kernel statistics snapshot
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  The statistics task fills the spare half of a double
+ *               buffer from App_OS_StatTaskHook() and publishes it with
+ *               a single index store plus a sequence bump.  Readers copy
+ *               the published half and retry if the sequence moved under
+ *               them -- no scheduler lock, no critical section, so
+ *               displaying stats never perturbs scheduling.  Publishes
+ *               are one per second and a copy takes microseconds, so the
+ *               retry path essentially never runs.
+ **************************************************************************/
+
+#ifndef APP_STAT_H
+#define APP_STAT_H
+
+#define APP_STAT_TASK_MAX   8   // task rows captured (OS_CFG_PRIO_MAX tasks)
+
+typedef struct app_stat_task_ent {
+    OS_TCB       *TCBPtr;           // identifies the task to the display
+    CPU_CHAR      NameCh;           // first letter of the task name
+    OS_CPU_USAGE  Usage;            // 0..10000 (xx.xx %)
+    CPU_STK_SIZE  StkFree;          // stack entries, from the stat task scan
+    CPU_STK_SIZE  StkUsed;
+} APP_STAT_TASK_ENT;
+
+typedef struct app_stat_snap {
+    OS_CPU_USAGE      CPUUsage;     // total, 0..10000
+    OS_OBJ_QTY        TaskQty;
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    CPU_TS            SchedLockTimeMax;
+    CPU_INT08U        SchedLockPrio;    // holder priority, 0xFF = none
+#endif
+    CPU_INT08U        TaskN;        // entries filled in TaskTbl[]
+    APP_STAT_TASK_ENT TaskTbl[APP_STAT_TASK_MAX];
+} APP_STAT_SNAP;
+
+void        AppStat_Publish(void);              // stat task hook only
+CPU_BOOLEAN AppStat_SnapGet(APP_STAT_SNAP *p_snap); // DEF_FALSE before 1st publish
+
+#endif
@@ -0,0 +1,130 @@
+/**************************************************************************
+ * File:         app_telem.c   Binary telemetry frames for headless runs
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  See app_telem.h for the frame spec.  The frame is packed
+ *               byte-at-a-time into a static buffer (plain stores, no
+ *               formatting divides) and handed whole to putsU1_DMA, so
+ *               the DMA engine clocks it out while the caller sleeps on
+ *               the completion semaphore.  One frame per statistics
+ *               publish replaces the dozens of escape/digit bytes the
+ *               ASCII HUD costs per refresh.
+ **************************************************************************/
+#include <includes.h>
+#include "app_telem.h"
+#include "app_err.h"
+
+// Worst case: 4 header + 10 fixed payload + 7 per task + 2 CRC
+#define TELEM_FRAME_MAX  (4 + 10 + 7 * APP_STAT_TASK_MAX + 2)
+
+static CPU_INT08U Telem_FrameBuf[TELEM_FRAME_MAX];
+static CPU_INT08U Telem_TxSeq;
+
+// ----- Little-endian field stores into the frame buffer
+static CPU_INT08U *Telem_Put16(CPU_INT08U *p, CPU_INT16U val) {
+    *p++ = (CPU_INT08U)(val & 0xFF);
+    *p++ = (CPU_INT08U)(val >> 8);
+    return (p);
+}
+
+static CPU_INT08U *Telem_Put32(CPU_INT08U *p, CPU_INT32U val) {
+    *p++ = (CPU_INT08U)(val & 0xFF);
+    *p++ = (CPU_INT08U)((val >> 8) & 0xFF);
+    *p++ = (CPU_INT08U)((val >> 16) & 0xFF);
+    *p++ = (CPU_INT08U)(val >> 24);
+    return (p);
+}
+
+// ----- Pack one statistics snapshot and send it on the DMA TX path.
+//       Blocks until the DMA block completes (the buffer is reused for
+//       the next frame), which at one frame per second is invisible.
+void Telem_StatFrameSend(const APP_STAT_SNAP *p_snap) {
+    CPU_INT08U *p = &Telem_FrameBuf[4];
+    CPU_INT16U crc;
+    CPU_INT08U len;
+    CPU_INT08U i;
+
+    p = Telem_Put16(p, (CPU_INT16U) p_snap->CPUUsage);
+    p = Telem_Put16(p, (CPU_INT16U) p_snap->TaskQty);
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    p = Telem_Put32(p, (CPU_INT32U) p_snap->SchedLockTimeMax);
+    *p++ = p_snap->SchedLockPrio;
+#else
+    p = Telem_Put32(p, (CPU_INT32U) 0);
+    *p++ = 0xFF;                                // not measured in this build
+#endif
+    *p++ = p_snap->TaskN;
+    for (i = 0; i < p_snap->TaskN; i++) {
+        *p++ = (CPU_INT08U) p_snap->TaskTbl[i].NameCh;
+        p = Telem_Put16(p, (CPU_INT16U) p_snap->TaskTbl[i].Usage);
+        p = Telem_Put16(p, (CPU_INT16U) p_snap->TaskTbl[i].StkFree);
+        p = Telem_Put16(p, (CPU_INT16U) p_snap->TaskTbl[i].StkUsed);
+    }
+    len = (CPU_INT08U)(p - &Telem_FrameBuf[4]);
+
+    Telem_FrameBuf[0] = TELEM_SOF;
+    Telem_FrameBuf[1] = TELEM_TYPE_STAT;
+    Telem_FrameBuf[2] = Telem_TxSeq++;
+    Telem_FrameBuf[3] = len;
+
+    crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL, (void *) &Telem_FrameBuf[1], 3);
+    crc = CRC_CRC16_Calc(crc, (void *) &Telem_FrameBuf[4], len);
+    crc = CRC_CRC16_Final(crc);
+    p = Telem_Put16(p, crc);                    // LE, unlike the link's BE trailer
+
+#if U1_TX_DMA_EN
+    putsU1_DMA((const char *) &Telem_FrameBuf[0], (unsigned int)(4 + len + 2));
+#else
+    for (i = 0; i < (CPU_INT08U)(4 + len + 2); i++) {
+        putU1((char) Telem_FrameBuf[i]);        // ring path when DMA TX is configured out
+    }
+#endif
+}
+
+// ----- Pack the app_err.c counter table and send it.  Called by the
+//       output pump when the total changed -- never from an error path,
+//       which only bumps counters.
+void Telem_ErrFrameSend(void) {
+    CPU_INT08U *p = &Telem_FrameBuf[4];
+    CPU_INT08U *p_slot_n;
+    CPU_INT16U crc;
+    CPU_INT16U cnt;
+    OS_ERR code;
+    CPU_INT08U len;
+    CPU_INT08U site;
+    CPU_INT08U i;
+
+    p = Telem_Put32(p, AppErr_TotalGet());
+    p = Telem_Put16(p, (CPU_INT16U) AppErr_LastGet(&site));
+    *p++ = site;
+    p_slot_n  = p++;                            // slot count patched below
+    *p_slot_n = 0;
+    for (i = 0; i < APP_ERR_SLOT_QTY; i++) {
+        if (AppErr_SlotGet(i, &code, &cnt) != DEF_TRUE) {
+            break;
+        }
+        p = Telem_Put16(p, (CPU_INT16U) code);
+        p = Telem_Put16(p, cnt);
+        (*p_slot_n)++;
+    }
+    len = (CPU_INT08U)(p - &Telem_FrameBuf[4]);
+
+    Telem_FrameBuf[0] = TELEM_SOF;
+    Telem_FrameBuf[1] = TELEM_TYPE_ERR;
+    Telem_FrameBuf[2] = Telem_TxSeq++;
+    Telem_FrameBuf[3] = len;
+
+    crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL, (void *) &Telem_FrameBuf[1], 3);
+    crc = CRC_CRC16_Calc(crc, (void *) &Telem_FrameBuf[4], len);
+    crc = CRC_CRC16_Final(crc);
+    p = Telem_Put16(p, crc);                    // LE, like the stat frame
+
+#if U1_TX_DMA_EN
+    putsU1_DMA((const char *) &Telem_FrameBuf[0], (unsigned int)(4 + len + 2));
+#else
+    for (i = 0; i < (CPU_INT08U)(4 + len + 2); i++) {
+        putU1((char) Telem_FrameBuf[i]);
+    }
+#endif
+}
@@ -0,0 +1,56 @@
+/**************************************************************************
+ * File:         app_telem.h   Binary telemetry frames for headless runs
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Packs the app_stat.c snapshot into a fixed-layout binary
+ *               frame and sends it out the UART1 DMA TX path -- roughly
+ *               5x fewer bytes than the positioned-ASCII HUD and zero
+ *               divide/modulo formatting on target.  Intended for
+ *               headless deployments where no terminal renders the HUD;
+ *               enable with APP_CFG_TELEM_EN in app_cfg.h.
+ *
+ * Frame layout (all multi-byte fields LITTLE ENDIAN, MIPS32 native):
+ *
+ *     offset  size  field
+ *          0     1  SOF            0xD5 (never appears in VT100 output)
+ *          1     1  type           0x01 = statistics frame
+ *          2     1  seq            free-running, gaps = dropped frames
+ *          3     1  len            payload bytes that follow
+ *          4   len  payload        see below
+ *      4+len     2  CRC16          CRC-16/CCITT (poly 0x1021, init 0xFFFF,
+ *                                  lib_crc.c) over type..payload, LE
+ *
+ * TELEM_TYPE_STAT (0x01) payload:
+ *
+ *     offset  size  field
+ *          0     2  CPUUsage       total, 0..10000 (xx.xx %)
+ *          2     2  TaskQty
+ *          4     4  SchedLockTimeMax   TS counts, 0 when not measured
+ *          8     1  SchedLockPrio  holder priority, 0xFF = none/unmeasured
+ *          9     1  TaskN          per-task records that follow
+ *         10   7*N  task records:  NameCh u8, Usage u16 (0..10000),
+ *                                  StkFree u16, StkUsed u16
+ *
+ * TELEM_TYPE_ERR (0x02) payload (counter table from app_err.c):
+ *
+ *     offset  size  field
+ *          0     4  Total          OS_ERR events recorded since boot
+ *          4     2  LastCode       most recent OS_ERR value
+ *          6     1  LastSite       APP_ERR_SITE_xxx of that event
+ *          7     1  SlotN          slot records that follow
+ *          8   4*N  slot records:  Code u16, Cnt u16
+ **************************************************************************/
+
+#ifndef APP_TELEM_H
+#define APP_TELEM_H
+
+#include "app_stat.h"
+
+#define TELEM_SOF        0xD5
+#define TELEM_TYPE_STAT  0x01
+#define TELEM_TYPE_ERR   0x02
+
+void Telem_StatFrameSend(const APP_STAT_SNAP *p_snap);
+void Telem_ErrFrameSend(void);
+
+#endif
@@ -0,0 +1,57 @@
+/**************************************************************************
+ * File:         app_time.c   Frame-rate-independent game timing
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  See app_time.h.  Each mover owns a GAME_TIME_ACC and
+ *               asks once per frame how many whole cells its elapsed
+ *               wall time is worth; the fraction stays banked in the
+ *               accumulator, so no time is ever lost to rounding and a
+ *               long frame is made up on the next call.
+ **************************************************************************/
+#include <includes.h>
+#include "app_time.h"
+
+// Cells per 100 seconds for each GAME_SPEED_xxx level.  NORMAL is one
+// cell per 75 ms (1333/100 s), matching the original 75 ms ball delay;
+// the others step by ~sqrt(2) around it.
+static const CPU_INT32U GameTime_SpeedTbl[GAME_SPEED_QTY] = {
+    GAME_SPEED_FP( 667u),           // SLOWEST: one cell per 150 ms
+    GAME_SPEED_FP( 943u),           // SLOW
+    GAME_SPEED_FP(1333u),           // NORMAL:  one cell per  75 ms
+    GAME_SPEED_FP(1886u),           // FAST
+    GAME_SPEED_FP(2667u)            // FASTEST: one cell per  37.5 ms
+};
+
+// ----- Start (or re-zero) an accumulator; the first GameTime_Steps()
+//       measures from here
+void GameTime_AccInit(GAME_TIME_ACC *p_acc) {
+    p_acc->LastTs = CPU_TS_TMR_RD();
+    p_acc->AccFp  = 0;
+}
+
+// ----- Whole cells owed since the last call at the given speed level.
+//       One 32x32->64 multiply and two shifts; the unsigned timer
+//       subtraction is wrap-safe across the core timer's 107 s period.
+CPU_INT08U GameTime_Steps(GAME_TIME_ACC *p_acc, CPU_INT08U level) {
+    CPU_TS_TMR now;
+    CPU_INT32U elapsed;
+    CPU_INT32U steps;
+
+    if (level >= GAME_SPEED_QTY) {
+        level = GAME_SPEED_QTY - 1u;
+    }
+    now            = CPU_TS_TMR_RD();
+    elapsed        = (CPU_INT32U)(now - p_acc->LastTs);
+    p_acc->LastTs  = now;
+    p_acc->AccFp  += (CPU_INT32U)(((CPU_INT64U)elapsed * GameTime_SpeedTbl[level]) >> 16);
+
+    steps = p_acc->AccFp >> 16;
+    if (steps > GAME_TIME_STEPS_MAX) {  // resumed after a stall: don't teleport
+        steps        = GAME_TIME_STEPS_MAX;
+        p_acc->AccFp = 0;
+    } else {
+        p_acc->AccFp &= 0xFFFFu;        // keep only the fractional cell
+    }
+    return (CPU_INT08U)steps;
+}
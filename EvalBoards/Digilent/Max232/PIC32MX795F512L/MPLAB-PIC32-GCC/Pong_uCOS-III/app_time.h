@@ -0,0 +1,49 @@
+/**************************************************************************
+ * File:         app_time.h   Frame-rate-independent game timing
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Derives per-frame movement from elapsed core-timer time
+ *               instead of from the frame count, so entity speed is a
+ *               property of the game, not of the frame period: the ball
+ *               covers the same cells per second at any tick rate or
+ *               frame rate, and a frame rate lowered under load (saving
+ *               UART bandwidth) slows only the display, never gameplay.
+ *               Speeds come from a fixed-point table evaluated at
+ *               compile time; the per-frame cost is one multiply and
+ *               two shifts, no runtime divides.
+ **************************************************************************/
+
+#ifndef APP_TIME_H
+#define APP_TIME_H
+
+// Rate the accumulators count in: the core timer, SYSCLK/2 (25 ns)
+#define GAME_TIME_TS_HZ     (BSP_CLK_FREQ / 2u)
+
+// Q0.32 cells-per-core-timer-count for a speed given in cells per 100
+// seconds (the x100 lets speeds like "one cell per 75 ms" stay integer).
+// Both divides happen in the compiler; none reach the target.
+#define GAME_SPEED_FP(cells_per_100s) \
+        ((CPU_INT32U)((((CPU_INT64U)(cells_per_100s) << 32) / GAME_TIME_TS_HZ) / 100u))
+
+// Speed levels, indexing GameTime_SpeedTbl in app_time.c
+#define GAME_SPEED_SLOWEST      0u
+#define GAME_SPEED_SLOW         1u
+#define GAME_SPEED_NORMAL       2u  // one cell per 75 ms: the historical ball speed
+#define GAME_SPEED_FAST         3u
+#define GAME_SPEED_FASTEST      4u
+#define GAME_SPEED_QTY          5u
+
+// Whole cells handed out in one call; anything banked beyond this (a
+// debugger halt, seconds of overload) is discarded rather than letting
+// an entity teleport across the board when the game resumes.
+#define GAME_TIME_STEPS_MAX     4u
+
+typedef struct game_time_acc {
+    CPU_TS_TMR LastTs;              // core timer at the previous GameTime_Steps()
+    CPU_INT32U AccFp;               // Q16.16 cells banked; whole cells consumed
+} GAME_TIME_ACC;
+
+void        GameTime_AccInit(GAME_TIME_ACC *p_acc);
+CPU_INT08U  GameTime_Steps(GAME_TIME_ACC *p_acc, CPU_INT08U level);
+
+#endif
@@ -0,0 +1,60 @@
+/**************************************************************************
+ * File:         app_wdt.c   Watchdog service with heartbeat obligations
+ * Processor:    PIC32MX795F512L
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  See app_wdt.h.  The checker is deliberately dumb: a
+ *               linear scan of at most WDT_HB_MAX registered entries,
+ *               one signed tick-difference compare each, once per
+ *               statistics pass.  The WDT is serviced only when the
+ *               scan finds every heartbeat live, so any supervised task
+ *               that wedges (or a missed statistics pass itself, i.e. a
+ *               wedged kernel) ends in a hardware reset.
+ **************************************************************************/
+#include <includes.h>
+#include "app_wdt.h"
+
+static WDT_HB    *Wdt_HbTbl[WDT_HB_MAX];
+static CPU_INT08U Wdt_HbQty;
+
+// ----- Enable the watchdog.  WDTCON bit 15 turns the WDT on when the
+//       device configuration has not force-enabled it; the period comes
+//       from the WDTPS configuration bits (set them to cover the longest
+//       legitimate gap between statistics passes, >= 2 s is safe here).
+void Wdt_Init(void) {
+    WDTCONSET = 0x8000;
+}
+
+// ----- Register one obligation.  Call from the owning task before its
+//       first beat; registration is permanent (deployments do not
+//       unsupervise tasks).
+void Wdt_HeartbeatReg(WDT_HB *p_hb, CPU_CHAR *p_name, OS_TICK period) {
+    CPU_SR_ALLOC();
+
+    p_hb->NamePtr  = p_name;
+    p_hb->Period   = period;
+    p_hb->Deadline = OSTickCtr + period;
+    CPU_CRITICAL_ENTER();
+    if (Wdt_HbQty < WDT_HB_MAX) {
+        Wdt_HbTbl[Wdt_HbQty] = p_hb;
+        Wdt_HbQty++;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+// ----- Verify every registered heartbeat and service the WDT when all
+//       are live.  Called from App_OS_StatTaskHook() -- the statistics
+//       task already wakes every pass, so supervision costs no task, no
+//       stack and no extra wakeups.  Returns the first dead heartbeat
+//       (for a diagnostic dump while the WDT runs out) or NULL.
+WDT_HB *Wdt_CheckAndService(void) {
+    CPU_INT08U i;
+
+    for (i = 0; i < Wdt_HbQty; i++) {
+        if ((CPU_INT32S)(Wdt_HbTbl[i]->Deadline - OSTickCtr) < 0) {
+            return (Wdt_HbTbl[i]);          // missed beat: let the WDT expire
+        }
+    }
+    WDTCONSET = 0x01;                       // WDTCLR: all live, restart the dog
+    return ((WDT_HB *) 0);
+}
@@ -0,0 +1,35 @@
+/**************************************************************************
+ * File:         app_wdt.h   Watchdog service with heartbeat obligations
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:  Unattended recovery from hung tasks without a dedicated
+ *               monitor task.  Each supervised task registers a
+ *               heartbeat obligation with a period and refreshes it from
+ *               its main loop (one addition and one store); the checker
+ *               rides the statistics task pass (App_OS_StatTaskHook) and
+ *               services the PIC32 watchdog ONLY while every registered
+ *               heartbeat is live -- one tick-count compare per
+ *               heartbeat.  A task that stops beating lets the WDT
+ *               expire and reset the board.
+ **************************************************************************/
+
+#ifndef APP_WDT_H
+#define APP_WDT_H
+
+#define WDT_HB_MAX  8               // registered heartbeats (one per supervised task)
+
+typedef struct wdt_hb {
+    CPU_CHAR   *NamePtr;            // for the post-mortem dump
+    OS_TICK     Period;             // max ticks between beats, incl. scheduling slack
+    volatile OS_TICK Deadline;      // OSTickCtr value the next beat must arrive by
+} WDT_HB;
+
+void Wdt_Init(void);                            // enable the WDT; call once from App_TaskStart
+void Wdt_HeartbeatReg(WDT_HB *p_hb, CPU_CHAR *p_name, OS_TICK period);
+WDT_HB *Wdt_CheckAndService(void);              // stat-hook only; NULL = all live, WDT serviced
+
+// ----- Refresh an obligation from the owning task's loop.  Cheap enough
+//       for any loop: one read, one add, one store.
+#define Wdt_Heartbeat(p_hb)     ((p_hb)->Deadline = OSTickCtr + (p_hb)->Period)
+
+#endif
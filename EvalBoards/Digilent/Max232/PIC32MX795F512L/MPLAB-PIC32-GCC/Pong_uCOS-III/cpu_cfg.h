@@ -92,8 +92,8 @@
 */
 
                                                                 /* Configure CPU timestamp features (see Note #1) :     */
-#define  CPU_CFG_TS_32_EN                       DEF_DISABLED
-#define  CPU_CFG_TS_64_EN                       DEF_DISABLED
+#define  CPU_CFG_TS_32_EN                       DEF_ENABLED
+#define  CPU_CFG_TS_64_EN                       DEF_ENABLED
                                                                 /*   DEF_DISABLED  CPU timestamps DISABLED              */
                                                                 /*   DEF_ENABLED   CPU timestamps ENABLED               */
 
@@ -101,6 +101,11 @@
                                                                 /* ... (see Note #2) :                                  */
 #define  CPU_CFG_TS_TMR_SIZE                    CPU_WORD_SIZE_32
 
+                                                                /* Configure inline core-timer read for ...             */
+                                                                /* ... CPU_TS_TMR_RD() (see 'cpu.h  TIMESTAMP ...       */
+                                                                /* ... TIMER INLINE READ'; #define'd = enabled) :       */
+#define  CPU_CFG_TS_TMR_RD_INLINE_EN
+
 #define  CPU_CFG_STK_GROWTH                     CPU_STK_GROWTH_HI_TO_LO
 
 /*
@@ -133,6 +138,10 @@
 #define  CPU_CFG_INT_DIS_MEAS_EN                                /* ... measurements feature (see Note #1a).             */
 #endif
 
+#if 0                                                           /* Configure per-site log2 histogram of ints dis'd ...  */
+#define  CPU_CFG_INT_DIS_MEAS_HIST_EN                           /* ... times (see 'cpu_core.h  CPU INTERRUPTS ...       */
+#endif                                                          /* ... DISABLED TIME MEASUREMENT HISTOGRAM').           */
+
                                                                 /* Configure number of interrupts disabled overhead ... */
 #define  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR                    1u   /* ... time measurements (see Note #1b).                */
 
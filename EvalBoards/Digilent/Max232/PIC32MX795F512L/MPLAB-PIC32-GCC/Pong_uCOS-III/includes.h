@@ -10,6 +10,9 @@
 *********************************************************************************************************
 */
 
+#ifndef  INCLUDES_MODULE_PRESENT
+#define  INCLUDES_MODULE_PRESENT
+
 #include    <stdio.h>
 #include    <stdarg.h>
 #include    <stddef.h>
@@ -21,6 +24,7 @@
 #include    <cpu.h>
 #include    <lib_def.h>
 #include    <lib_ascii.h>
+#include    <lib_crc.h>
 #include    <lib_math.h>
 #include    <lib_mem.h>
 #include    <lib_str.h>
@@ -34,3 +38,4 @@
 
 #include    <bsp.h>
 
+#endif                                                          /* INCLUDES_MODULE_PRESENT                 */
@@ -82,7 +82,7 @@
 */
 
                                                         /* Configure assembly-optimized function(s) [see Note #1] :     */
-#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_DISABLED
+#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_ENABLED
                                                         /*   DEF_DISABLED     Assembly-optimized function(s) DISABLED   */
                                                         /*   DEF_ENABLED      Assembly-optimized function(s) ENABLED    */
 
@@ -29,6 +29,8 @@
 
 #include <os.h>
 #include <os_app_hooks.h>
+#include "app_stat.h"
+#include "app_wdt.h"
 
 /*$PAGE*/
 /*
@@ -181,7 +183,12 @@ void  App_OS_IdleTaskHook (void)
 
 void  App_OS_StatTaskHook (void)
 {
-
+#if OS_CFG_STAT_TASK_EN > 0u
+    AppStat_Publish();                                      /* Lock-free snapshot for the display (app_stat.c)      */
+#endif
+#if APP_CFG_WDT_EN > 0u
+    (void)Wdt_CheckAndService();                            /* Service the WDT only while all heartbeats are live   */
+#endif
 }
 
 /*$PAGE*/
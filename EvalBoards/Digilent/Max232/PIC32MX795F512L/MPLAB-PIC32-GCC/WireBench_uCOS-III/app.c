@@ -0,0 +1,488 @@
+/**************************************************************************
+ * File:         app.c       UART link-protocol loopback benchmark
+ * Date:         August 2013
+ * Status:       functional
+ * Processor:	 PIC32MX795F512L
+ * Toolchain:	 MPLAB-X
+ * Board:        MAX32 from Digilent
+ * RTOS:         uCOS-III from Micrium
+ * Description:	Wire-level numbers for the serial stack, measured before
+ *		any protocol built on it is trusted.  Loop UART2's TX pin
+ *		back to its RX pin (or wire TX/RX to a second board
+ *		running this same build) and the suite sweeps baud rate,
+ *		payload size and send rate through the full UARTn driver
+ *		stack -- TX ring, TX/RX interrupts, RX ring, task-level
+ *		parser -- using the game link's frame format (app_link.h
+ *		in the Pong project): SOF, type, seq, len, payload, and a
+ *		lib_crc CRC-16 over type..payload.
+ *
+ *		Per sweep point the table reports:
+ *		  - frames received vs sent, CRC errors, sequence gaps
+ *		  - RX bytes the driver dropped on a full ring (overruns)
+ *		  - goodput in payload bytes/s and line utilization
+ *		  - per-frame CPU cost of the TX queue path and of the
+ *		    RX parse path, in core timer ticks (25 ns)
+ *
+ *		UART1 stays the console and carries the results table.
+ *		UART2's interrupt is already wired to the UARTn driver
+ *		through vector 31 (see UARTn.c and bsp_a.S).
+ *
+ * Notes:
+ *       bsp.c holds pragma config
+ *       uart1.h holds BAUD_RATE 115200 (console)
+ *       the port under test and sweep depth live in app_cfg.h
+ **************************************************************************/
+#include "UARTn.h"    /* the port under test; pulls <includes.h> (no guard: once only) */
+#include <os_app_hooks.h>
+
+/*
+ *******************************************************************************
+ *                                                Task Stacks/TCB
+ *******************************************************************************
+ */
+
+static OS_TCB App_TaskStartTCB;
+static CPU_STK App_TaskStartStk[APP_CFG_TASK_START_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;
+
+static OS_TCB App_TaskWireRxTCB;
+static CPU_STK App_TaskWireRxStk[APP_CFG_TASK_WIRE_RX_STK_SIZE] OS_CPU_STK_ALIGN_ATTR;
+
+/*
+ *******************************************************************************
+ *                                            Task PROTOTYPES
+ *******************************************************************************
+ */
+
+static void App_TaskStart(void *p_arg);
+static void App_TaskWireRx(void *p_arg);
+
+/*
+ *******************************************************************************
+ *                                            Wire format
+ *******************************************************************************
+ */
+
+// Same frame as the game link so these numbers transfer directly:
+//   SOF  type  seq  len  payload[len]  crc_hi  crc_lo
+#define WIRE_SOF            0xA5
+#define WIRE_MSG_BENCH      3           // types 1/2 are the game link's
+#define WIRE_PAYLOAD_MAX    56          // largest frame (62 bytes) still fits
+                                        // ... the driver's 64-byte RX ring whole
+#define WIRE_OVERHEAD       6           // SOF, type, seq, len, crc hi/lo
+
+// RX parser states, as in the game link's parser
+#define WIRE_RX_ST_SOF      0
+#define WIRE_RX_ST_TYPE     1
+#define WIRE_RX_ST_SEQ      2
+#define WIRE_RX_ST_LEN      3
+#define WIRE_RX_ST_DATA     4
+#define WIRE_RX_ST_CRC_HI   5
+#define WIRE_RX_ST_CRC_LO   6
+
+// ***************************************************************************
+// Per-point statistics
+//   Every frame is timed individually so each row shows min (the
+//   uncontended hot path), avg, and max (the tail blocking on a full
+//   TX ring or an interposed tick interrupt adds).
+// ***************************************************************************
+typedef struct {
+    CPU_INT32U Min;
+    CPU_INT32U Max;
+    CPU_INT32U Total;
+    CPU_INT32U Cnt;
+} WIRE_STATS;
+
+static void Wire_StatsInit(WIRE_STATS *p_stats) {
+    p_stats->Min = 0xFFFFFFFFu;
+    p_stats->Max = 0u;
+    p_stats->Total = 0u;
+    p_stats->Cnt = 0u;
+}
+
+static void Wire_StatsUpdate(WIRE_STATS *p_stats, CPU_INT32U val) {
+    if (val < p_stats->Min) {
+        p_stats->Min = val;
+    }
+    if (val > p_stats->Max) {
+        p_stats->Max = val;
+    }
+    p_stats->Total += val;
+    p_stats->Cnt++;
+}
+
+// ***************************************************************************
+// Point state shared between the sender and the RX parser task.  The
+// start task resets it only while the wire is silent (the parser task is
+// then blocked in getUn with nothing in flight), so no locking is needed.
+// ***************************************************************************
+static volatile CPU_INT32U Wire_RxFrameCtr;     // good frames this point
+static volatile CPU_INT32U Wire_RxByteCtr;      // their payload bytes
+static volatile CPU_INT32U Wire_RxCrcErrCtr;    // frames dropped on bad CRC
+static volatile CPU_INT32U Wire_RxLostCtr;      // sequence gaps on good frames
+static volatile CPU_TS_TMR Wire_RxLastTs;       // core timer at the last good frame
+static volatile CPU_INT32U Wire_RxTarget;       // frame count that ends the point
+static volatile CPU_BOOLEAN Wire_RxSeqValid;    // first frame of a point seen
+
+static WIRE_STATS Wire_ParseStats;              // per-frame parse cost (RX task only)
+
+static OS_SEM Wire_DoneSem;                     // parser -> sender: point complete
+
+// Sweep tables.  Pace is the delay between frames in OS ticks; 0 sends
+// back-to-back so the TX ring, not the sender, paces the wire.
+static const CPU_INT32U Wire_BaudTbl[] = {57600, 115200, 230400, 460800};
+static const CPU_INT08U Wire_LenTbl[]  = {4, 16, 56};
+static const CPU_INT32U Wire_PaceTbl[] = {0, 1, 4};
+
+/*
+ *********************************************************************************************************
+ *                                                main()
+ *
+ * Description : This is the standard entry point for C code.
+ *
+ * Arguments   : none
+ *********************************************************************************************************
+ */
+
+int main(void) {
+
+    OS_ERR os_err;
+
+    CPU_Init(); /* Initialize the uC/CPU services  */
+
+    BSP_IntDisAll();
+
+    OSInit(&os_err); /* Init uC/OS-III.                  */
+
+    App_OS_SetAllHooks();
+
+    OSSemCreate(&Wire_DoneSem, "Wire Done", 0, &os_err);
+
+    // app_cfg.h holds priority, stack size, and limit for start task
+    OSTaskCreate((OS_TCB *) & App_TaskStartTCB, /* Create the start task            */
+            (CPU_CHAR *) "Start",
+            (OS_TASK_PTR) App_TaskStart,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_START_PRIO,
+            (CPU_STK *) & App_TaskStartStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_START_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_START_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & os_err);
+
+    OSStart(&os_err); /* Start multitasking (i.e. give control to uC/OS-III). */
+    /* Should not return here as RTOS takes control */
+    (void) &os_err;
+
+    return (0);
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* UART output helpers */
+// *********************************************************************
+
+// Prints an unsigned base 10 number without leading zeroes
+
+static void UART_PrintNumU32(CPU_INT32U v) {
+    char buf[10]; // 4294967295 is 10 digits
+    int n = 0;
+
+    do {
+        buf[n++] = (char) (v % 10u + '0');
+        v /= 10u;
+    } while (v > 0u);
+    while (n > 0) {
+        putU1(buf[--n]);
+    }
+}
+
+// Prints "name=value " for the compact per-point result rows
+
+static void Wire_PrintField(const char *name, CPU_INT32U v) {
+    putsU1((char *) name);
+    putU1('=');
+    UART_PrintNumU32(v);
+    putU1(' ');
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Benchmark */
+// *********************************************************************
+
+// Reprogram the baud rate generator in place (BRGH=1 formula as in
+// initUn()).  initUn() itself must run only once: calling it again would
+// recreate the port's TX semaphore.  Register name kept in step with
+// APP_CFG_WIRE_PORT.
+
+static void Wire_BaudSet(CPU_INT32U baud) {
+    U2BRG = (BSP_CLK_FREQ / 4 / baud) - 1;
+}
+
+// One sweep point: send APP_CFG_WIRE_FRAMES frames of 'len' payload
+// bytes at 'baud', 'pace' ticks apart, and print what came back.
+
+static void Wire_PointRun(CPU_INT32U baud, CPU_INT08U len, CPU_INT32U pace) {
+    CPU_INT08U frame[WIRE_OVERHEAD + WIRE_PAYLOAD_MAX];
+    WIRE_STATS tx_stats;
+    CPU_INT32U drops;
+    CPU_INT32U elapsed;
+    CPU_INT32U f;
+    CPU_INT32U i;
+    CPU_TS_TMR t_start;
+    CPU_TS_TMR t0;
+    CPU_INT16U crc;
+    OS_ERR err;
+
+    Wire_BaudSet(baud);
+
+    while (getUn_timeout((int) APP_CFG_WIRE_PORT, (OS_TICK) 2) >= 0) {
+        ; // drain stale bytes so the point starts on a silent wire
+    }
+    Wire_RxFrameCtr = 0u;
+    Wire_RxByteCtr = 0u;
+    Wire_RxCrcErrCtr = 0u;
+    Wire_RxLostCtr = 0u;
+    Wire_RxSeqValid = DEF_FALSE;
+    Wire_RxTarget = APP_CFG_WIRE_FRAMES;
+    Wire_StatsInit(&Wire_ParseStats);
+    Wire_StatsInit(&tx_stats);
+    drops = Un_RxDropCtr[APP_CFG_WIRE_PORT - 1u];
+
+    frame[0] = WIRE_SOF; // fixed pattern; only seq and CRC change per frame
+    frame[1] = WIRE_MSG_BENCH;
+    frame[3] = len;
+    for (i = 0; i < len; i++) {
+        frame[4 + i] = (CPU_INT08U) i;
+    }
+
+    t_start = CPU_TS_TMR_RD();
+    for (f = 0; f < APP_CFG_WIRE_FRAMES; f++) {
+        frame[2] = (CPU_INT08U) f;
+        crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL, (void *) &frame[1], 3u + len);
+        crc = CRC_CRC16_Final(crc);
+        frame[4 + len] = (CPU_INT08U) (crc >> 8);
+        frame[5 + len] = (CPU_INT08U) (crc & 0xFF);
+
+        t0 = CPU_TS_TMR_RD(); // TX queue cost; at saturation this includes
+        for (i = 0; i < (CPU_INT32U) (WIRE_OVERHEAD + len); i++) { // ... blocking on the full ring
+            putUn((int) APP_CFG_WIRE_PORT, (char) frame[i]);
+        }
+        Wire_StatsUpdate(&tx_stats, (CPU_INT32U) (CPU_TS_TMR_RD() - t0));
+
+        if (pace > 0u) {
+            OSTimeDly((OS_TICK) pace, OS_OPT_TIME_DLY, &err);
+        }
+    }
+
+    OSSemPend(&Wire_DoneSem, OS_MS_TO_TICKS(APP_CFG_WIRE_TIMEOUT_MS),
+            OS_OPT_PEND_BLOCKING, (CPU_TS *) 0, &err); // lost frames end the point by timeout
+
+    drops = Un_RxDropCtr[APP_CFG_WIRE_PORT - 1u] - drops;
+
+    putsU1("  ");
+    Wire_PrintField("baud", baud);
+    Wire_PrintField("len", (CPU_INT32U) len);
+    Wire_PrintField("pace", pace);
+    Wire_PrintField("rx", Wire_RxFrameCtr);
+    Wire_PrintField("crcerr", Wire_RxCrcErrCtr);
+    Wire_PrintField("gap", Wire_RxLostCtr);
+    Wire_PrintField("drop", drops);
+    if (Wire_RxFrameCtr > 0u) {
+        elapsed = (CPU_INT32U) (Wire_RxLastTs - t_start); // first byte queued -> last frame parsed
+        // Goodput is payload bytes over the whole point; utilization is
+        // the 10-bit wire bytes (payload + 6 framing) against the baud
+        // rate.  64-bit intermediates: bytes * 40e6 overflows 32 bits.
+        Wire_PrintField("goodput",
+                (CPU_INT32U) (((CPU_INT64U) Wire_RxByteCtr * (BSP_CLK_FREQ / 2u)) / elapsed));
+        Wire_PrintField("util",
+                (CPU_INT32U) (((CPU_INT64U) Wire_RxFrameCtr * (len + WIRE_OVERHEAD) * 10u * 100u
+                               * (BSP_CLK_FREQ / 2u)) / elapsed / baud));
+    }
+    putsU1("\r\n      txq/frame ");
+    UART_PrintNumU32(tx_stats.Min);
+    putU1('/');
+    UART_PrintNumU32(tx_stats.Total / tx_stats.Cnt);
+    putU1('/');
+    UART_PrintNumU32(tx_stats.Max);
+    if (Wire_ParseStats.Cnt > 0u) {
+        putsU1("  parse/frame ");
+        UART_PrintNumU32(Wire_ParseStats.Min);
+        putU1('/');
+        UART_PrintNumU32(Wire_ParseStats.Total / Wire_ParseStats.Cnt);
+        putU1('/');
+        UART_PrintNumU32(Wire_ParseStats.Max);
+    }
+    putsU1("\r\n");
+}
+
+/*$PAGE*/
+
+/*
+ *********************************************************************************************************
+ *                                          STARTUP TASK
+ *
+ * Description : Runs the whole sweep once, prints the table, then idles
+ *               blinking an LED so the board is visibly alive.
+ * Arguments   : p_arg   is the argument passed to 'AppStartTask()' by 'OSTaskCreate()'.
+ *********************************************************************************************************
+ */
+
+static void App_TaskStart(void *p_arg) {
+    CPU_INT32U b;
+    CPU_INT32U l;
+    CPU_INT32U p;
+    OS_ERR err;
+
+    (void) p_arg;
+
+    BSP_InitIO(); /* Initialize BSP functions                                 */
+
+    initU1(); // Initialize UART1 (console)
+
+    initUn((int) APP_CFG_WIRE_PORT, Wire_BaudTbl[0]); // port under test; once only (see Wire_BaudSet)
+
+    OSTaskCreate((OS_TCB *) & App_TaskWireRxTCB, /* Create the RX parser */
+            (CPU_CHAR *) "WireRx",
+            (OS_TASK_PTR) App_TaskWireRx,
+            (void *) 0,
+            (OS_PRIO) APP_CFG_TASK_WIRE_RX_PRIO,
+            (CPU_STK *) & App_TaskWireRxStk[0],
+            (CPU_STK_SIZE) APP_CFG_TASK_WIRE_RX_STK_SIZE_LIMIT,
+            (CPU_STK_SIZE) APP_CFG_TASK_WIRE_RX_STK_SIZE,
+            (OS_MSG_QTY) 0u,
+            (OS_TICK) 0u,
+            (void *) 0,
+            (OS_OPT) (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+            (OS_ERR *) & err);
+
+    if (err != OS_ERR_NONE) {
+        putsU1("Error starting WireRx task ");
+    }
+
+    OSTimeDlyHMSM(0, 0, 1, 0, OS_OPT_TIME_HMSM_STRICT, &err); // let the terminal connect
+
+    putsU1("\r\nUART loopback benchmark: jumper the test port's TX to its RX\r\n");
+    putsU1("frames/point=");
+    UART_PrintNumU32((CPU_INT32U) APP_CFG_WIRE_FRAMES);
+    putsU1("  costs in core timer ticks (SYSCLK/2 = 25 ns), pace in OS ticks\r\n");
+
+    for (b = 0; b < sizeof (Wire_BaudTbl) / sizeof (Wire_BaudTbl[0]); b++) {
+        for (l = 0; l < sizeof (Wire_LenTbl) / sizeof (Wire_LenTbl[0]); l++) {
+            for (p = 0; p < sizeof (Wire_PaceTbl) / sizeof (Wire_PaceTbl[0]); p++) {
+                Wire_PointRun(Wire_BaudTbl[b], Wire_LenTbl[l], Wire_PaceTbl[p]);
+            }
+        }
+    }
+
+    putsU1("done\r\n");
+
+    while (DEF_TRUE) { /* Task body, always written as an infinite loop.            */
+        LED_Toggle(1);
+        OSTimeDly(OS_MS_TO_TICKS(500), OS_OPT_TIME_DLY, &err);
+    }
+}
+
+/*$PAGE*/
+
+/* ********************************************************************* */
+/* Application Tasks */
+// *********************************************************************
+
+// RX parser: drains the port through getUn() and walks every byte
+// through the link frame parser.  The parse cost excludes the blocking
+// read -- it is the CPU the protocol itself costs per frame, the number
+// that scales with frame rate.  Counters are only ever written here.
+
+static void App_TaskWireRx(void *p_arg) {
+    CPU_INT08U data[WIRE_PAYLOAD_MAX];
+    CPU_INT08U state = WIRE_RX_ST_SOF;
+    CPU_INT32U cost = 0u;                       // parse cost of the frame in flight
+    CPU_INT08U seq = 0u;
+    CPU_INT08U seq_last = 0u;
+    CPU_INT08U len = 0u;
+    CPU_INT08U ix = 0u;
+    CPU_INT16U crc_rx = 0u;
+    CPU_INT16U crc;
+    CPU_TS_TMR t0;
+    CPU_INT08U b;
+    OS_ERR err;
+
+    (void) p_arg;
+    while (DEF_TRUE) {
+        b = (CPU_INT08U) getUn((int) APP_CFG_WIRE_PORT);
+        t0 = CPU_TS_TMR_RD();
+        switch (state) {
+            case WIRE_RX_ST_SOF:
+                if (b == WIRE_SOF) {
+                    state = WIRE_RX_ST_TYPE;
+                    cost = 0u;
+                }
+                break;
+            case WIRE_RX_ST_TYPE:
+                state = (b == WIRE_MSG_BENCH) ? WIRE_RX_ST_SEQ : WIRE_RX_ST_SOF;
+                break;
+            case WIRE_RX_ST_SEQ:
+                seq = b;
+                state = WIRE_RX_ST_LEN;
+                break;
+            case WIRE_RX_ST_LEN:
+                if (b > WIRE_PAYLOAD_MAX) {     // impossible length: resync
+                    state = WIRE_RX_ST_SOF;
+                    break;
+                }
+                len = b;
+                ix = 0u;
+                state = (len > 0u) ? WIRE_RX_ST_DATA : WIRE_RX_ST_CRC_HI;
+                break;
+            case WIRE_RX_ST_DATA:
+                data[ix++] = b;
+                if (ix >= len) {
+                    state = WIRE_RX_ST_CRC_HI;
+                }
+                break;
+            case WIRE_RX_ST_CRC_HI:
+                crc_rx = (CPU_INT16U) b << 8;
+                state = WIRE_RX_ST_CRC_LO;
+                break;
+            case WIRE_RX_ST_CRC_LO:
+            default:
+                crc_rx |= b;
+                state = WIRE_RX_ST_SOF;
+                {
+                    CPU_INT08U hdr[3];
+
+                    hdr[0] = WIRE_MSG_BENCH;
+                    hdr[1] = seq;
+                    hdr[2] = len;
+                    crc = CRC_CRC16_Calc(CRC_CRC16_INIT_VAL, (void *) &hdr[0], 3u);
+                    crc = CRC_CRC16_Calc(crc, (void *) &data[0], len);
+                    crc = CRC_CRC16_Final(crc);
+                }
+                if (crc != crc_rx) {
+                    Wire_RxCrcErrCtr++;
+                    break;
+                }
+                if (Wire_RxSeqValid) {          // gaps = frames lost whole on the wire
+                    Wire_RxLostCtr += (CPU_INT08U) (seq - seq_last - 1u);
+                }
+                Wire_RxSeqValid = DEF_TRUE;
+                seq_last = seq;
+                Wire_RxFrameCtr++;
+                Wire_RxByteCtr += len;
+                Wire_RxLastTs = CPU_TS_TMR_RD();
+                cost += (CPU_INT32U) (Wire_RxLastTs - t0);
+                Wire_StatsUpdate(&Wire_ParseStats, cost);
+                if (Wire_RxFrameCtr == Wire_RxTarget) {
+                    OSSemPost(&Wire_DoneSem, OS_OPT_POST_1, &err);
+                }
+                continue;                       // cost already closed out above
+        }
+        cost += (CPU_INT32U) (CPU_TS_TMR_RD() - t0);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                          (c) Copyright 2004-2010; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       APPLICATION CONFIGURATION
+*
+*
+* Filename      : app_cfg.h
+* Version       : V1.00
+* Programmer(s) : FT
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_MODULE_PRESENT
+#define  APP_CFG_MODULE_PRESENT
+
+#include <lib_cfg.h>
+
+/*
+*********************************************************************************************************
+*                                        BENCHMARK CONFIGURATION
+*********************************************************************************************************
+*/
+
+                                                               /* UARTn port under test: its TX pin is looped back    */
+#define  APP_CFG_WIRE_PORT                                 2u  /* ... to its RX pin (or wired to a second board)      */
+
+#define  APP_CFG_WIRE_FRAMES                             128u  /* Frames sent per sweep point                         */
+
+                                                               /* Give-up timeout waiting for a sweep point's last    */
+#define  APP_CFG_WIRE_TIMEOUT_MS                        2000u  /* ... frame (lost frames end the point this way)      */
+
+#define  APP_CFG_TRACE_EN                                  0u  /* No trace stream: UART1 carries the results table    */
+
+
+/*
+*********************************************************************************************************
+*                                            TASK PRIORITIES
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_PRIO                           1u
+#define  APP_CFG_TASK_WIRE_RX_PRIO                         2u
+
+
+/*
+*********************************************************************************************************
+*                                            TASK STACK SIZES
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_STK_SIZE                     384u //256u // mjb 512u
+#define  APP_CFG_TASK_WIRE_RX_STK_SIZE                   256u
+
+
+
+/*
+*********************************************************************************************************
+*                                            TASK STACK SIZES LIMIT
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_STK_SIZE_PCT_FULL             90u
+
+#define  APP_CFG_TASK_START_STK_SIZE_LIMIT       (APP_CFG_TASK_START_STK_SIZE * (100u - APP_CFG_TASK_START_STK_SIZE_PCT_FULL))   / 100u
+#define  APP_CFG_TASK_WIRE_RX_STK_SIZE_LIMIT     (APP_CFG_TASK_WIRE_RX_STK_SIZE * (100u - APP_CFG_TASK_START_STK_SIZE_PCT_FULL)) / 100u
+
+#endif
@@ -14,6 +14,10 @@
 #include "osc.h"
 #include "system.h"
 #include "timer.h"
+/* CP0 Count stamped at interrupt entry by the port's CoreTimerIntHandler (os_cpu_a.S).     */
+/* The Max32 BSP builds a latency monitor on it; here it is only the symbol the port needs. */
+volatile  CPU_INT32U  BSP_IntEntryCount;
+
 
 /*
 *********************************************************************************************************
@@ -302,6 +306,7 @@ void  BSP_TickISR_Handler (void)
 {
     UpdateCoreTimer(BSP_TMR_RELOAD);                                          /* Prepare for the next core timer interrupt  */
     mCTClearIntFlag();                                                        /* Clear the core timer interrupt             */
+    OSTimeTick();                                                             /* Process the tick (see CoreTimerIntHandler) */
 }
 
 /*
@@ -338,6 +343,130 @@ void  BSP_DefaultHandler (void)
 {
 }
 
+/*
+*********************************************************************************************************
+*                                    BSP_ADCISR_Handler()
+*
+* Description: Dispatch the AD1 conversion-done interrupt.  The application installs its handler with
+*              BSP_ADCISR_HandlerSet() (see the Lab4-TempControl scan acquisition); until one is
+*              installed the interrupt falls through to BSP_DefaultHandler().
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+static  void  (*BSP_ADCISR_Fnct)(void);
+
+void  BSP_ADCISR_HandlerSet (void (*fnct)(void))
+{
+    BSP_ADCISR_Fnct = fnct;
+}
+
+void  BSP_ADCISR_Handler (void)
+{
+    if (BSP_ADCISR_Fnct != (void (*)(void))0) {
+        (*BSP_ADCISR_Fnct)();
+    } else {
+        BSP_DefaultHandler();
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                 BSP_IC1ISR_Handler() / BSP_IC2ISR_Handler()
+*
+* Description: The input-capture vectors are routed to these handlers by bsp_a.S.  The encoder
+*              counting driver in bspLab6.c provides the real implementations; projects built
+*              against this BSP do not use the capture modules, so the interrupts fall through
+*              to BSP_DefaultHandler().
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_IC1ISR_Handler (void)
+{
+    BSP_DefaultHandler();
+}
+
+void  BSP_IC2ISR_Handler (void)
+{
+    BSP_DefaultHandler();
+}
+
+/*
+*********************************************************************************************************
+*                                        OUTPUT-COMPARE PWM DRIVER
+*
+* Description: Hardware PWM on the OC modules, Timer2 time base.  Pulse timing comes entirely from the
+*              peripheral, so motor drive waveforms stay exact regardless of kernel load; tasks only
+*              update the duty cycle.  On the UNO32 shield header, OC1..OC4 sit on RD0..RD3 (pins
+*              3/5/6/9) -- the same pins the robot labs drive their H-bridges from.
+*
+*              BSP_PWM_DutySet() writes only OCxRS, which the module latches into OCxR at each period
+*              rollover, so duty updates are glitch-free: no shortened or stretched pulses, ever.
+*
+* Arguments  : freq_hz    BSP_PWM_Init(): PWM carrier frequency (Timer2, 1:4 prescale; 20 kHz gives
+*                         900 duty steps at 72 MHz).
+*
+*              oc_nbr     Output-compare module to drive, 1..4.
+*
+*              duty_pct   Duty cycle, 0..100 (percent of the period).
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  BSP_PWM_Period;                  /* PR2 value the duty cycle is scaled against  */
+
+static  volatile  CPU_INT32U  *BSP_PWM_OCRSTbl[] = { &OC1RS, &OC2RS, &OC3RS, &OC4RS };
+static  volatile  CPU_INT32U  *BSP_PWM_OCRTbl[]  = { &OC1R,  &OC2R,  &OC3R,  &OC4R  };
+static  volatile  CPU_INT32U  *BSP_PWM_OCCONTbl[] = { &OC1CON, &OC2CON, &OC3CON, &OC4CON };
+
+void  BSP_PWM_Init (CPU_INT32U  freq_hz)
+{
+    BSP_PWM_Period = (CPU_INT16U)(BSP_CLK_FREQ / (4 * freq_hz) - 1);     /* Timer2, 1:4 prescale     */
+    TMR2  = 0;
+    PR2   = BSP_PWM_Period;
+    T2CON = 0x8010;                                                      /* ON, TCKPS = 1:4          */
+}
+
+void  BSP_PWM_Start (CPU_INT08U  oc_nbr,
+                     CPU_INT08U  duty_pct)
+{
+    CPU_INT32U  cmp;
+
+
+    if ((oc_nbr < 1) || (oc_nbr > 4)) {
+        return;
+    }
+    cmp = ((CPU_INT32U)BSP_PWM_Period + 1) * duty_pct / 100;
+   *BSP_PWM_OCRTbl[oc_nbr - 1]   = cmp;                                  /* First period's pulse     */
+   *BSP_PWM_OCRSTbl[oc_nbr - 1]  = cmp;
+   *BSP_PWM_OCCONTbl[oc_nbr - 1] = 0x8006;                               /* ON, OCM = PWM, Timer2    */
+}
+
+void  BSP_PWM_DutySet (CPU_INT08U  oc_nbr,
+                       CPU_INT08U  duty_pct)
+{
+    if ((oc_nbr < 1) || (oc_nbr > 4)) {
+        return;
+    }
+   *BSP_PWM_OCRSTbl[oc_nbr - 1] = ((CPU_INT32U)BSP_PWM_Period + 1) * duty_pct / 100;
+}
+
+void  BSP_PWM_Stop (CPU_INT08U  oc_nbr)
+{
+    if ((oc_nbr < 1) || (oc_nbr > 4)) {
+        return;
+    }
+   *BSP_PWM_OCCONTbl[oc_nbr - 1] = 0;                                    /* Pin reverts to the LAT   */
+}
+
 /*
 *********************************************************************************************************
 *                                    OSProbe_TmrInit()
@@ -33,6 +33,15 @@ void        LED_On              (CPU_INT08U led);
 
 void        BSP_TickISR_Handler (void);
 void        BSP_Except_Handler  (void);
+void        BSP_ADCISR_Handler  (void);
+void        BSP_ADCISR_HandlerSet (void (*fnct)(void));
+void        BSP_IC1ISR_Handler  (void);
+void        BSP_IC2ISR_Handler  (void);
+
+void        BSP_PWM_Init        (CPU_INT32U  freq_hz);
+void        BSP_PWM_Start       (CPU_INT08U  oc_nbr, CPU_INT08U duty_pct);
+void        BSP_PWM_DutySet     (CPU_INT08U  oc_nbr, CPU_INT08U duty_pct);
+void        BSP_PWM_Stop        (CPU_INT08U  oc_nbr);
 
 void        BSP_InitIO          (void);
 void        BSP_IntDisableALL   (void);
@@ -14,6 +14,10 @@
 #include "osc.h"
 #include "system.h"
 #include "timer.h"
+/* CP0 Count stamped at interrupt entry by the port's CoreTimerIntHandler (os_cpu_a.S).     */
+/* The Max32 BSP builds a latency monitor on it; here it is only the symbol the port needs. */
+volatile  CPU_INT32U  BSP_IntEntryCount;
+
 
 /*
  *********************************************************************************************************
@@ -43,6 +47,7 @@
 
 #define  BSP_TMR_RELOAD          (BSP_CLK_FREQ / (2 * OS_CFG_TICK_RATE_HZ))
 #define  BSP_DLY_CONST            BSP_CLK_FREQ / 1000000 
+#define  BSP_US_TO_CT_CONST      (BSP_CLK_FREQ / 2000000)                 /* Core timer ticks per uS (SYSCLK / 2)     */
 
 #define  PB3_MASK                 _PORTD_RD13_MASK
 #define  PB2_MASK                 _PORTD_RD7_MASK
@@ -230,6 +235,26 @@ void  LED_Toggle (CPU_INT08U led)
     }
 }
 
+/*
+*********************************************************************************************************
+*                                          BSP_LEDPatternWrite()
+*
+* Description : Drive all eight LEDs from one bitmask.  The UNO32 LEDs all sit on PORTE bits 0-7, so
+*               the whole row updates in exactly two atomic bus writes (LATESET then LATECLR) with no
+*               read-modify-write window to race against ISRs touching the same LAT.
+*
+* Arguments   : pattern    Bit 0 = LED 1 ... bit 7 = LED 8; 1 = on, 0 = off.
+*
+* Returns     : None
+*********************************************************************************************************
+*/
+
+void  BSP_LEDPatternWrite (CPU_INT08U  pattern)
+{
+    mPORTESetBits((CPU_INT32U)pattern);
+    mPORTEClearBits((CPU_INT32U)(~pattern) & 0xFF);
+}
+
 /*
 *********************************************************************************************************
 *                                       LED_Init()
@@ -307,6 +332,7 @@ void  BSP_TickISR_Handler (void)
 {
     UpdateCoreTimer(BSP_TMR_RELOAD);                                          /* Prepare for the next core timer interrupt  */
     mCTClearIntFlag();                                                        /* Clear the core timer interrupt             */
+    OSTimeTick();                                                             /* Process the tick (see CoreTimerIntHandler) */
 }
 
 /*
@@ -343,6 +369,128 @@ void  BSP_DefaultHandler (void)
 {
 }
 
+/*
+*********************************************************************************************************
+*                                    BSP_ADCISR_Handler()
+*
+* Description: Dispatch the AD1 conversion-done interrupt.  The application installs its handler with
+*              BSP_ADCISR_HandlerSet() (see the Lab4-TempControl scan acquisition); until one is
+*              installed the interrupt falls through to BSP_DefaultHandler().
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+static  void  (*BSP_ADCISR_Fnct)(void);
+
+void  BSP_ADCISR_HandlerSet (void (*fnct)(void))
+{
+    BSP_ADCISR_Fnct = fnct;
+}
+
+void  BSP_ADCISR_Handler (void)
+{
+    if (BSP_ADCISR_Fnct != (void (*)(void))0) {
+        (*BSP_ADCISR_Fnct)();
+    } else {
+        BSP_DefaultHandler();
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                    ENCODER EDGE COUNTING (IC1/IC2)
+*
+* Description: Wheel-encoder edge counting in hardware.  The slotted encoder discs drive IC1 (RD8,
+*              UNO32 pin 2, left motor) and IC2 (RD9, UNO32 pin 7, right motor).  Each input-capture
+*              module latches every rising edge into its 4-deep capture FIFO with no CPU involvement,
+*              so no edge is lost to a higher-priority task running long -- the ISR only has to drain
+*              the FIFO and extend the count into a 32-bit running total.  Timer3 free-runs as the
+*              shared capture timebase.  This replaces polling the encoder pins from a task, which
+*              burned a task's worth of CPU on busy sampling and still dropped edges under load.
+*
+* Arguments  : enc_nbr      BSP_ENC_LEFT (IC1) or BSP_ENC_RIGHT (IC2).
+*
+* Returns    : BSP_EncCntGet(): edges accumulated since BSP_EncInit() / BSP_EncCntClr().  Reading a
+*              32-bit count is a single atomic load on the MIPS32 core, so no critical section is
+*              needed around it.
+*********************************************************************************************************
+*/
+
+static  volatile  CPU_INT32U  BSP_EncCnt[2];
+
+void  BSP_EncInit (void)
+{
+    IC1CON = 0;                                                               /* Stop the capture modules while configuring */
+    IC2CON = 0;
+
+    TRISDbits.TRISD8 = 1;                                                     /* IC1: RD8, UNO32 pin 2                      */
+    TRISDbits.TRISD9 = 1;                                                     /* IC2: RD9, UNO32 pin 7                      */
+
+    T3CON  = 0;                                                               /* Timer3 free-runs as the capture timebase   */
+    TMR3   = 0;
+    PR3    = 0xFFFF;
+    T3CON  = 0x8070;                                                          /* ON, 1:256 prescale                         */
+
+    BSP_EncCnt[0] = 0;
+    BSP_EncCnt[1] = 0;
+
+    IC1CON = 0x8003;                                                          /* ON, Timer3 source, every rising edge,      */
+    IC2CON = 0x8003;                                                          /* ... interrupt on each capture event        */
+
+    mIC1ClearIntFlag();
+    mIC1SetIntPriority(3);
+    mIC1IntEnable(1);
+
+    mIC2ClearIntFlag();
+    mIC2SetIntPriority(3);
+    mIC2IntEnable(1);
+}
+
+void  BSP_IC1ISR_Handler (void)
+{
+    CPU_INT32U  capture;
+
+
+    while (IC1CONbits.ICBNE) {                                                /* Drain the capture FIFO; a burst of edges   */
+        capture = IC1BUF;                                                     /* ... may have queued more than one entry    */
+        BSP_EncCnt[0]++;
+    }
+    (void)capture;
+    mIC1ClearIntFlag();
+}
+
+void  BSP_IC2ISR_Handler (void)
+{
+    CPU_INT32U  capture;
+
+
+    while (IC2CONbits.ICBNE) {
+        capture = IC2BUF;
+        BSP_EncCnt[1]++;
+    }
+    (void)capture;
+    mIC2ClearIntFlag();
+}
+
+CPU_INT32U  BSP_EncCntGet (CPU_INT08U  enc_nbr)
+{
+    if ((enc_nbr < BSP_ENC_LEFT) || (enc_nbr > BSP_ENC_RIGHT)) {
+        return (0);
+    }
+    return (BSP_EncCnt[enc_nbr - 1]);
+}
+
+void  BSP_EncCntClr (CPU_INT08U  enc_nbr)
+{
+    if ((enc_nbr < BSP_ENC_LEFT) || (enc_nbr > BSP_ENC_RIGHT)) {
+        return;
+    }
+    BSP_EncCnt[enc_nbr - 1] = 0;
+}
+
 /*
 *********************************************************************************************************
 *                                    OSProbe_TmrInit()
@@ -401,6 +549,65 @@ void  BSP_Dly (CPU_INT32U  us)
     }    
 }    
     
+/*
+*********************************************************************************************************
+*                                               BSP_DlyUs()
+*
+* Description: Busy-wait for a calibrated number of microseconds using the CP0 Count register.  Unlike
+*              BSP_Dly(), which spins on an uncalibrated NOP loop, this counts actual core timer ticks
+*              (SYSCLK / 2), so a 10uS device settling time costs 10uS -- not a whole OS tick.
+*
+* Arguments  : us           The number of uS to delay (up to ~100 seconds before 32-bit wrap).
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+void  BSP_DlyUs (CPU_INT32U  us)
+{
+    CPU_INT32U  start;
+    CPU_INT32U  cnts;
+
+
+    start = ReadCoreTimer();
+    cnts  = us * BSP_US_TO_CT_CONST;
+
+    while ((CPU_INT32U)(ReadCoreTimer() - start) < cnts) {
+        ;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                   BSP_DeadlineSet() / BSP_DeadlineExpired()
+*
+* Description: Non-blocking companion to BSP_DlyUs().  BSP_DeadlineSet() arms a deadline a given number
+*              of microseconds in the future; BSP_DeadlineExpired() polls it, so driver code can overlap
+*              a settling time with useful work.  The unsigned Count arithmetic is wrap-safe.
+*
+* Arguments  : p_dl         The deadline to arm / poll.
+*
+*              us           BSP_DeadlineSet(): microseconds until expiry (up to ~100 seconds).
+*
+* Returns    : BSP_DeadlineExpired(): DEF_TRUE once the deadline has passed, DEF_FALSE before.
+*********************************************************************************************************
+*/
+
+void  BSP_DeadlineSet (BSP_DEADLINE  *p_dl,
+                       CPU_INT32U     us)
+{
+    p_dl->Start = ReadCoreTimer();
+    p_dl->Cnts  = us * BSP_US_TO_CT_CONST;
+}
+
+CPU_BOOLEAN  BSP_DeadlineExpired (BSP_DEADLINE  *p_dl)
+{
+    if ((CPU_INT32U)(ReadCoreTimer() - p_dl->Start) >= p_dl->Cnts) {
+        return (DEF_TRUE);
+    }
+    return (DEF_FALSE);
+}
+
 /*
 *********************************************************************************************************
 *                                             BSP_IntDisAll()
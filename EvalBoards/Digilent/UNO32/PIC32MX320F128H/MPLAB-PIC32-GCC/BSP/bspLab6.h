@@ -27,16 +27,37 @@
 *********************************************************************************************************
 */    
 
-void        LED_Toggle          (CPU_INT08U led);
+void        LED_Toggle          (CPU_INT08U led);
+void        BSP_LEDPatternWrite (CPU_INT08U pattern);
 void        LED_Off             (CPU_INT08U led);
 void        LED_On              (CPU_INT08U led);
 
 void        BSP_TickISR_Handler (void);
 void        BSP_Except_Handler  (void);
+void        BSP_ADCISR_Handler  (void);
+void        BSP_ADCISR_HandlerSet (void (*fnct)(void));
+void        BSP_IC1ISR_Handler  (void);
+void        BSP_IC2ISR_Handler  (void);
+
+#define     BSP_ENC_LEFT        1u              /* IC1: RD8, UNO32 pin 2                        */
+#define     BSP_ENC_RIGHT       2u              /* IC2: RD9, UNO32 pin 7                        */
+
+void        BSP_EncInit         (void);
+CPU_INT32U  BSP_EncCntGet       (CPU_INT08U enc_nbr);
+void        BSP_EncCntClr       (CPU_INT08U enc_nbr);
 
 void        BSP_InitIO          (void);
 void        BSP_IntDisableALL   (void);
 
 void        BSP_Dly             (CPU_INT32U  us);
+void        BSP_DlyUs           (CPU_INT32U  us);
+
+typedef struct {
+    CPU_INT32U  Start;                          /* core timer value when the deadline was armed */
+    CPU_INT32U  Cnts;                           /* core timer ticks until expiry                */
+} BSP_DEADLINE;
+
+void        BSP_DeadlineSet     (BSP_DEADLINE *p_dl, CPU_INT32U us);
+CPU_BOOLEAN BSP_DeadlineExpired (BSP_DEADLINE *p_dl);
 
 
@@ -0,0 +1,37 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*
+*                                 (c) Copyright 2006, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+*                                           MASTER INCLUDE FILE
+*********************************************************************************************************
+*/
+
+#include    <stdio.h>
+#include    <stdarg.h>
+#include    <stddef.h>
+#include    <stdlib.h>
+#include    <string.h>
+#include    <ctype.h>
+
+#include    <app_cfg.h>
+#include    <cpu.h>
+#include    <lib_def.h>
+#include    <lib_ascii.h>
+#include    <lib_crc.h>
+#include    <lib_math.h>
+#include    <lib_mem.h>
+#include    <lib_str.h>
+#include    <os.h>
+#include    <os_cfg_app.h>
+
+#include    <p32xxxx.h>
+#include    "int.h"
+#include    "CoreTimer.h"
+#include    "ports.h"
+
+#include    <bsp.h>
+
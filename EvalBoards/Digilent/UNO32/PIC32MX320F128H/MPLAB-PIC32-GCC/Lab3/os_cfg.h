@@ -37,9 +37,13 @@
 #define OS_CFG_DBG_EN                   1u   /* Enable (1) debug code/variables                                       */
 #define OS_CFG_ISR_POST_DEFERRED_EN     0u   /* Enable (1) or Disable (0) Deferred ISR posts                          */
 #define OS_CFG_OBJ_TYPE_CHK_EN          0u   /* Enable (1) or Disable (0) object type checking                        */
+#define OS_CFG_OBJ_REG_EN               0u   /* Enable (1) or Disable (0) the kernel object registry                  */
+#define OS_CFG_OBJ_REG_MAX             16u   /*     Maximum number of registered objects (IDs fit in a byte)          */
 #define OS_CFG_TS_EN                    0u   /* Enable (1) or Disable (0) time stamping                               */
+#define OS_CFG_TS_OBJ_SEL_EN            0u   /*     Allow objects to opt out of time stamping (OSxxxTSCfg())          */
 
 #define OS_CFG_PEND_MULTI_EN            1u   /* Enable (1) or Disable (0) code generation for multi-pend feature      */
+#define OS_CFG_PEND_PRIO_TBL_EN         0u   /* Enable (1) or Disable (0) constant-time pend-list insertion           */
 
 #define OS_CFG_PRIO_MAX                 8u   /* Defines the maximum number of task priorities (see OS_PRIO data type) */
 
@@ -70,6 +74,10 @@
 #define OS_CFG_Q_DEL_EN                 1u   /*     Include code for OSQDel()                                         */
 #define OS_CFG_Q_FLUSH_EN               1u   /*     Include code for OSQFlush()                                       */
 #define OS_CFG_Q_PEND_ABORT_EN          1u   /*     Include code for OSQPendAbort()                                   */
+#define OS_CFG_SQ_EN                    0u   /* Enable (1) or Disable (0) code generation for ZERO-COPY SLOT QUEUES   */
+#define OS_CFG_PIPE_EN                  0u   /* Enable (1) or Disable (0) code generation for BYTE-STREAM PIPES       */
+#define OS_CFG_EDF_EN                   0u   /* Enable (1) or Disable (0) code generation for the EDF SCHED CLASS     */
+#define OS_CFG_MTASK_EN                 0u   /* Enable (1) or Disable (0) code generation for R-T-C MINITASKS         */
 
 
                                              /* ----------------------------- SEMAPHORES ---------------------------- */
@@ -90,6 +98,10 @@
 #define OS_CFG_TASK_PROFILE_EN          1u   /* Include variables in OS_TCB for profiling                             */
 #define OS_CFG_TASK_REG_TBL_SIZE        1u   /* Number of task specific registers                                     */
 #define OS_CFG_TASK_SEM_PEND_ABORT_EN   1u   /* Include code for OSTaskSemPendAbort()                                 */
+#define OS_CFG_TASK_SLAB_EN             0u   /* Include code for OSTaskSlabXxxx(), recyclable TCB+stack pools         */
+#define OS_CFG_TASK_STK_REDZONE_EN      0u   /* Include code for stack redzone checking                               */
+#define OS_CFG_TASK_STK_REDZONE_DEPTH   8u   /* Size, in CPU_STK elements, of the redzone                             */
+#define OS_CFG_TASK_STK_LIMIT_CHK_EN    1u   /* Check StkPtr against StkLimitPtr at every task switch                 */
 #define OS_CFG_TASK_SUSPEND_EN          1u   /* Include code for OSTaskSuspend() and OSTaskResume()                   */
 
 
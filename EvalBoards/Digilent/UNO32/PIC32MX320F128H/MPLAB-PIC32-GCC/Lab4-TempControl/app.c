@@ -258,6 +258,109 @@ int readTemperature(int ch) {
     return val;
 }
 
+// ------------------------------------------------------------
+// Autonomous scan acquisition
+// ------------------------------------------------------------
+// The MX320 has no DMA controller, so the ADC's own scan engine stands in:
+// auto-sample/auto-convert walks AN2 (pot), AN4 and AN8 (thermistors) with
+// no CPU involvement, parks results in the 16-word ADC1BUF, and interrupts
+// every ADC_SCAN_SMPI samples (two full scans).  The ISR folds each scan
+// into an oversample accumulator; every 2^ADC_SCAN_OVS_LOG2 scans it
+// decimates (average by shift) into a per-channel ring and posts AdcScanSem.
+// Sample spacing is paced entirely by the ADC clock, so it carries none of
+// the task-scheduling jitter of the polled readADC() path.
+//
+// Pacing: Tad = 2*(ADCS+1)*Tpb; ADCS=255, Tpb=25ns -> Tad=12.8us.
+// Sample 31 Tad + convert 12 Tad = 43 Tad = 550us per sample, ~1.8 ksps
+// aggregate, interrupt every 3.3ms, decimated output ~150 Hz per channel.
+
+#define ADC_SCAN_CH_NBR     3       // AN2, AN4, AN8 in ascending scan order
+#define ADC_SCAN_SMPI       6       // samples per interrupt = 2 full scans
+#define ADC_SCAN_OVS_LOG2   2       // average 2^2 scans per decimated sample
+#define ADC_RING_SIZE       16      // decimated samples kept per channel (power of two)
+
+#define ADC_SCAN_CSSL       ((1 << POT) | (1 << ADC_CH_THERMISTOR_ONE) | (1 << ADC_CH_THERMISTOR_TWO))
+#define ADC_SCAN_SAMC       31      // auto-sample time, Tad
+#define ADC_SCAN_ADCS       255     // Tad = 2*(ADCS+1)*Tpb
+#define ADC_SCAN_CON3_BITS  ((ADC_SCAN_SAMC << 8) | ADC_SCAN_ADCS)
+
+OS_SEM AdcScanSem;
+
+static volatile CPU_INT16U AdcRing[ADC_SCAN_CH_NBR][ADC_RING_SIZE];
+static volatile CPU_INT08U AdcRingIn;
+static CPU_INT32U AdcOvsAcc[ADC_SCAN_CH_NBR];
+static CPU_INT08U AdcOvsScans;
+
+// Scan-buffer position of an ANx channel (ascending AN order), -1 if not scanned
+static int adcScanIdx(int ch) {
+    switch (ch) {
+        case POT:                   return 0;
+        case ADC_CH_THERMISTOR_ONE: return 1;
+        case ADC_CH_THERMISTOR_TWO: return 2;
+        default:                    return -1;
+    }
+}
+
+// AD1 interrupt: fold the completed scans into the oversample accumulators.
+// Runs via BSP_ADCISR_Handler (bsp_a.S vector 27) at priority 2.
+static void ADC_ScanISR(void) {
+    volatile unsigned int *buf = &ADC1BUF0;    // ADC1BUFx SFRs are 0x10 apart
+    int s, ch;
+    OS_ERR err;
+
+    for (s = 0; s < ADC_SCAN_SMPI / ADC_SCAN_CH_NBR; s++) {
+        for (ch = 0; ch < ADC_SCAN_CH_NBR; ch++) {
+            AdcOvsAcc[ch] += buf[(s * ADC_SCAN_CH_NBR + ch) * 4];
+        }
+    }
+    AdcOvsScans += ADC_SCAN_SMPI / ADC_SCAN_CH_NBR;
+
+    if (AdcOvsScans >= (1u << ADC_SCAN_OVS_LOG2)) {     // decimate by shift
+        for (ch = 0; ch < ADC_SCAN_CH_NBR; ch++) {
+            AdcRing[ch][AdcRingIn] = (CPU_INT16U)(AdcOvsAcc[ch] >> ADC_SCAN_OVS_LOG2);
+            AdcOvsAcc[ch] = 0;
+        }
+        AdcRingIn = (AdcRingIn + 1) & (ADC_RING_SIZE - 1);
+        AdcOvsScans = 0;
+        OSSemPost(&AdcScanSem, OS_OPT_POST_1, &err);    // fresh decimated group ready
+    }
+    mAD1ClearIntFlag();
+}
+
+// Start the free-running scan.  Replaces initADC() for this app; the ADC
+// owns its own pacing from here on and tasks never touch SAMP/DONE again.
+void initADCScan(void) {
+    AD1PCFG = AINPUTS;              // analog input pins (AN2, AN4, AN8)
+    AD1CSSL = ADC_SCAN_CSSL;        // channels included in the scan
+    AD1CON1 = 0x00E4;               // SSRC=7 auto convert, ASAM auto sample
+    AD1CON2 = (1 << 10)             // CSCNA: scan CH0 through AD1CSSL
+            | ((ADC_SCAN_SMPI - 1) << 2);   // interrupt every 6th sample
+    AD1CON3 = ADC_SCAN_CON3_BITS;
+    BSP_ADCISR_HandlerSet(ADC_ScanISR);
+    mAD1ClearIntFlag();
+    mAD1SetIntPriority(2);
+    mAD1IntEnable(1);
+    AD1CON1SET = 0x8000;            // ADC on -- scanning starts immediately
+}
+
+// Wait for the next decimated group, then return that channel's newest
+// sample.  Returns -1 on an unscanned channel or if the scan stalls.
+int readTemperatureScan(int ch) {
+    OS_ERR err;
+    CPU_TS ts;
+    int idx;
+
+    idx = adcScanIdx(ch);
+    if (idx < 0) {
+        return -1;
+    }
+    OSSemPend(&AdcScanSem, OS_CFG_TICK_RATE_HZ, OS_OPT_PEND_BLOCKING, &ts, &err);   // at most 1 s
+    if (err != OS_ERR_NONE) {
+        return -1;      // scan stalled -- same error convention as readTemperature()
+    }
+    return (int)AdcRing[idx][(AdcRingIn - 1u) & (ADC_RING_SIZE - 1)];
+}
+
 
 /*
  *********************************************************************************************************
@@ -282,6 +385,7 @@ int main(void) {
     OSInit(&os_err); /* Init uC/OS-III.                                     */
 
     OSSemCreate(&AdcSem, "ADC Semaphore", 1, &os_err); // Create and init to 1
+    OSSemCreate(&AdcScanSem, "ADC Scan Semaphore", 0, &os_err); // Posted by the scan ISR
 
     OSTaskCreate((OS_TCB *) & App_TaskStartTCB, /* Create the start task    */
             (CPU_CHAR *) "Start",
@@ -336,7 +440,7 @@ void App_TaskStart(void *p_arg) {
 
     initU1(); // Initialize UART1
 
-    initADC(AINPUTS); // Initialize the Analog to Digital Converter
+    initADCScan(); // Start the autonomous ADC scan (replaces polled initADC(AINPUTS))
 
     initSys();  // Initialize the temperature control system parameters passes to each control task
 
@@ -561,7 +665,7 @@ void App_TaskControl(void *pdata) {
         deviceOn(fan);
         OSTimeDlyHMSM(0, 0, updatePeriod, 0, OS_OPT_TIME_HMSM_STRICT, &err);
         deviceOff(fan);//
-        val = readTemperature(ch);
+        val = readTemperatureScan(ch); // newest decimated sample from the scan ring
         val = val >> 3; // ADC value is 10 bits but only 7 bits needed for lookup table
         measuredTemp = AD2Temp[val];
 
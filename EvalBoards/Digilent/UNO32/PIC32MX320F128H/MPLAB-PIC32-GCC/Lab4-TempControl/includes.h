@@ -21,6 +21,7 @@
 #include    <cpu.h>
 #include    <lib_def.h>
 #include    <lib_ascii.h>
+#include    <lib_crc.h>
 #include    <lib_math.h>
 #include    <lib_mem.h>
 #include    <lib_str.h>
@@ -202,12 +202,11 @@ int  main (void)
     //OSSemCreate(&Bump_sem_left,"Control lSem",1,&os_err);
     //OSSemCreate(&Bump_sem_right,"Control rSem",1,&os_err);
 
-    //OC1CON=0x8000 | 0x06;
-    //OC2CON=0x8000 | 0x06;
-
-    //T2CON = 0x8000 | 0x50;
-
-    //PR2 = 2250;
+    BSP_PWM_Init(20000);              // 20 kHz carrier on Timer2 -- above audible
+    BSP_PWM_Start(1, 0);              // OC1..OC4 on RD0..RD3: both H-bridge legs per motor
+    BSP_PWM_Start(2, 0);
+    BSP_PWM_Start(3, 0);
+    BSP_PWM_Start(4, 0);
 
     PB_Init_BS();
     //Device_Init();
@@ -674,25 +673,31 @@ void App_Bump(void *pdata)
     }
 }
 
+// Motor drive now runs on the hardware output-compare PWM (BSP_PWM_xxx in
+// bsp.c): the OC modules generate the pulses, so pulse timing is exact no
+// matter what the kernel is doing, and these helpers reduce to two
+// glitch-free duty updates.  Drive one H-bridge leg, idle the other.
+#define MOTOR_SPEED_PCT  80     // cruise duty cycle -- tune per chassis
+
 void left_forward(void)
 {
-    mPORTDSetBits(IOPORT_BIT_0);  // pin 3 left forward
-    mPORTDClearBits(IOPORT_BIT_1);// pin 5
+    BSP_PWM_DutySet(1, MOTOR_SPEED_PCT); // OC1, pin 3 left forward
+    BSP_PWM_DutySet(2, 0);               // OC2, pin 5
 }
 void left_backward(void)
 {
-    mPORTDClearBits(IOPORT_BIT_0);       // left backswards
-    mPORTDSetBits(IOPORT_BIT_1);
+    BSP_PWM_DutySet(1, 0);               // left backwards
+    BSP_PWM_DutySet(2, MOTOR_SPEED_PCT);
 }
 void right_forward(void)
 {
-    mPORTDSetBits(IOPORT_BIT_2);       //  pin 6 right forward
-    mPORTDClearBits(IOPORT_BIT_3);     //  pin 9
+    BSP_PWM_DutySet(3, MOTOR_SPEED_PCT); // OC3, pin 6 right forward
+    BSP_PWM_DutySet(4, 0);               // OC4, pin 9
 }
 void right_backward(void)
 {
-    mPORTDClearBits(IOPORT_BIT_2);       // right backwards
-    mPORTDSetBits(IOPORT_BIT_3);
+    BSP_PWM_DutySet(3, 0);               // right backwards
+    BSP_PWM_DutySet(4, MOTOR_SPEED_PCT);
 }
 
 void init_sensors(void)
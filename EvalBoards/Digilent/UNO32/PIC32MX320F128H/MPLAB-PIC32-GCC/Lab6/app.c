@@ -347,6 +347,8 @@ void App_TaskStart(void *p_arg) {
 
     PB_Init_BS(); // Initialize pushbuttons and CN interrupt
 
+    BSP_EncInit(); // Encoder edges now count in IC1/IC2 hardware; read with BSP_EncCntGet()
+
     AppTaskCreate(); /* Create application tasks                                 */
 
     while (DEF_TRUE) { /* Task body, always written as an infinite loop.            */
@@ -302,8 +302,50 @@ void  BSP_TickISR_Handler (void)
 {
     UpdateCoreTimer(BSP_TMR_RELOAD);                                          /* Prepare for the next core timer interrupt  */
     mCTClearIntFlag();                                                        /* Clear the core timer interrupt             */
+    OSTimeTick();                                                             /* Process the tick (see CoreTimerIntHandler) */
 }
 
+/*
+*********************************************************************************************************
+*                                       CPU_TS_TmrInit()
+*
+* Description: uC/CPU timestamp timer initialization.  The free-running MIPS core timer (Count
+*              register, SYSCLK / 2 = 36 MHz) is used as the timestamp timer; it is already started
+*              and kept running by the kernel tick (see Tmr_Init() / BSP_TickISR_Handler(), which
+*              program only the Compare register), so only the frequency needs to be published here.
+*
+* Arguments  : None
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void  CPU_TS_TmrInit (void)
+{
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)(BSP_CLK_FREQ / 2));                   /* Core timer increments every 2 SYSCLK cycles*/
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                       CPU_TS_TmrRd()
+*
+* Description: Read the uC/CPU timestamp timer, i.e. the 32-bit core timer Count register.
+*
+* Arguments  : None
+*
+* Returns    : Current core timer count
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return ((CPU_TS_TMR)ReadCoreTimer());
+}
+#endif
+
 /*
 *********************************************************************************************************
 *                                    BSP_Except_Handler()
@@ -372,6 +414,60 @@ CPU_INT32U  OSProbe_TmrRd (void)
     return  (ReadTimer1());
 }  
 
+/*
+*********************************************************************************************************
+*                              BSP_T1IntInit() / BSP_T1ISR_Handler()
+*
+* Description: Periodic Timer1 interrupt source.  BSP_T1IntInit() programs Timer1 (prescaler 1:64,
+*              peripheral clock) to interrupt at 'freq_hz' and registers 'fnct' to be called from the
+*              interrupt (vector 4, see bsp_a.S); the application's load generator uses it to apply a
+*              tunable interrupt load (see app_load.c).  A 'freq_hz' of 0 stops Timer1 and disables
+*              the interrupt.  Timer1 is shared with the uC/Probe plug-in timer (see OSProbe_TmrInit());
+*              the two cannot be used at the same time.
+*
+* Arguments  : freq_hz      Desired interrupt frequency, in Hz (0 = stop).  Frequencies below
+*                           PBCLK / (64 * 65536) (~17 Hz at 72 MHz) are clamped to the 16-bit period.
+*
+*              fnct         Function called from the Timer1 interrupt, or NULL for count-only use.
+*
+* Returns    : None
+*********************************************************************************************************
+*/
+
+static  CPU_FNCT_VOID  BSP_T1ISR_FnctPtr;
+
+void  BSP_T1IntInit (CPU_INT32U     freq_hz,
+                     CPU_FNCT_VOID  fnct)
+{
+    CPU_INT32U  period;
+
+
+    if (freq_hz == 0u) {
+        ConfigIntTimer1(T1_INT_OFF | T1_INT_PRIOR_2);                         /* Stop the timer and silence its interrupt   */
+        CloseTimer1();
+        BSP_T1ISR_FnctPtr = (CPU_FNCT_VOID)0;
+        return;
+    }
+    period = ((BSP_CLK_FREQ / 64u) / freq_hz);                                /* PBCLK = SYSCLK (see BSP_InitIO())          */
+    if (period > 65536u) {
+        period = 65536u;
+    }
+    if (period > 0u) {
+        period--;
+    }
+    BSP_T1ISR_FnctPtr = fnct;
+    OpenTimer1((T1_ON | T1_PS_1_64 | T1_SOURCE_INT), period);
+    ConfigIntTimer1((T1_INT_ON | T1_INT_PRIOR_2));
+}
+
+void  BSP_T1ISR_Handler (void)
+{
+    mT1ClearIntFlag();                                                        /* Clear the Timer1 interrupt                 */
+    if (BSP_T1ISR_FnctPtr != (CPU_FNCT_VOID)0) {
+        (*BSP_T1ISR_FnctPtr)();
+    }
+}
+
 /*
 *********************************************************************************************************
 *                                                BSP_Dly()
@@ -34,6 +34,9 @@ void        LED_On              (CPU_INT08U led);
 void        BSP_TickISR_Handler (void);
 void        BSP_Except_Handler  (void);
 
+void        BSP_T1IntInit       (CPU_INT32U  freq_hz, CPU_FNCT_VOID fnct);
+void        BSP_T1ISR_Handler   (void);
+
 void        BSP_InitIO          (void);
 void        BSP_IntDisableALL   (void);
 
@@ -0,0 +1,58 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                          (c) Copyright 2004-2010; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       APPLICATION CONFIGURATION
+*
+*
+* Filename      : app_cfg.h
+* Version       : V1.00
+* Programmer(s) : FT
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_MODULE_PRESENT
+#define  APP_CFG_MODULE_PRESENT
+
+#include <lib_cfg.h>
+
+/*
+*********************************************************************************************************
+*                                            TASK PRIORITIES
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_PRIO                           1u
+
+
+/*
+*********************************************************************************************************
+*                                            TASK STACK SIZES
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_STK_SIZE                     256u // mjb 512u
+
+
+
+/*
+*********************************************************************************************************
+*                                            TASK STACK SIZES LIMIT
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_START_STK_SIZE_PCT_FULL             90u
+
+#define  APP_CFG_TASK_START_STK_SIZE_LIMIT       (APP_CFG_TASK_START_STK_SIZE * (100u - APP_CFG_TASK_START_STK_SIZE_PCT_FULL))   / 100u
+
+#endif
@@ -14,6 +14,7 @@
 */
 
 #include <includes.h>
+#include "app_load.h"
 
 /*
 *********************************************************************************************************
@@ -137,6 +138,9 @@ static  void  App_TaskStart (void *p_arg)
 
 static  void  App_TaskCreate (void)
 {
+#if APP_CFG_LOAD_EN > 0u
+    App_LoadInit();                                             /* Create the synthetic load generator (app_load.c)     */
+#endif
 }
 
 
@@ -34,6 +34,12 @@
 
 #define  APP_CFG_TASK_START_PRIO                           1u
 
+#define  APP_CFG_TASK_LOAD_CTRL_PRIO                       3u
+#define  APP_CFG_TASK_LOAD_IPC_RX_PRIO                     4u
+#define  APP_CFG_TASK_LOAD_IPC_TX_PRIO                     5u
+#define  APP_CFG_TASK_LOAD_MEM_PRIO                        6u
+#define  APP_CFG_TASK_LOAD_BURN_PRIO                       7u   /* Burn task 'i' runs at this priority + i              */
+
 
 /*
 *********************************************************************************************************
@@ -43,6 +49,8 @@
 
 #define  APP_CFG_TASK_START_STK_SIZE                     256u // mjb 512u
 
+#define  APP_CFG_TASK_LOAD_STK_SIZE                      256u
+
 
 
 /*
@@ -55,5 +63,38 @@
 
 #define  APP_CFG_TASK_START_STK_SIZE_LIMIT       (APP_CFG_TASK_START_STK_SIZE * (100u - APP_CFG_TASK_START_STK_SIZE_PCT_FULL))   / 100u
 
+/*
+*********************************************************************************************************
+*                                     SYNTHETIC LOAD GENERATOR
+*
+* Note(s) : (1) See app_load.c.  The _PCT / _BURST / _RATE values are only the INITIAL settings of the
+*               runtime tunables (App_LoadBurnPct and friends); the control task ramps the burn duty
+*               by APP_CFG_LOAD_RAMP_STEP_PCT every APP_CFG_LOAD_RAMP_SEC seconds up to the _MAX_PCT
+*               cap, recording a statistics snapshot per step.
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_LOAD_EN                                   1u   /* Master enable for the load generator                 */
+
+#define  APP_CFG_LOAD_BURN_TASK_QTY                        2u   /* Synthetic CPU-burn tasks                             */
+#define  APP_CFG_LOAD_BURN_PERIOD_MS                      10u   /* Burn task wakeup period                              */
+#define  APP_CFG_LOAD_BURN_PCT                            10u   /* Initial burn duty, percent of the period, per task   */
+
+#define  APP_CFG_LOAD_IPC_Q_SIZE                          16u   /* Message queue depth between the IPC task pair        */
+#define  APP_CFG_LOAD_IPC_PERIOD_MS                        5u   /* Producer wakeup period                               */
+#define  APP_CFG_LOAD_IPC_BURST                            4u   /* Initial messages posted per producer period          */
+
+#define  APP_CFG_LOAD_MEM_PERIOD_MS                        7u   /* Memory churn task wakeup period                      */
+#define  APP_CFG_LOAD_MEM_BLK_QTY                         16u   /* Blocks in the churn pool                             */
+#define  APP_CFG_LOAD_MEM_BLK_SIZE                        64u   /* Block size, in bytes                                 */
+#define  APP_CFG_LOAD_MEM_BURST                            8u   /* Initial blocks cycled (get+touch+free) per period    */
+
+#define  APP_CFG_LOAD_T1_RATE_HZ                        1000u   /* Initial Timer1 interrupt load (see BSP_T1IntInit())  */
+
+#define  APP_CFG_LOAD_RAMP_SEC                             5u   /* Seconds between load steps / statistics snapshots    */
+#define  APP_CFG_LOAD_RAMP_STEP_PCT                       10u   /* Burn duty added per step (0 = no automatic ramp)     */
+#define  APP_CFG_LOAD_RAMP_MAX_PCT                        90u   /* Burn duty cap, per task                              */
+#define  APP_CFG_LOAD_STAT_TBL_SIZE                       16u   /* Retained per-step statistics snapshots               */
+
 #endif
 
@@ -0,0 +1,499 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                  SYNTHETIC LOAD GENERATOR
+*
+* Filename      : app_load.c
+*
+* Note(s)       : (1) See app_load.h for the module overview and app_cfg.h for the APP_CFG_LOAD_xxx
+*                     settings.  The intent is to find the board's scheduling cliff on the bench: ramp
+*                     the burn duty until deadlines start slipping, then read which step broke first
+*                     out of App_LoadStatTbl[] -- rising TaskJitterTbl[] entries and a growing
+*                     IPCFullCtr are the early warnings, long before the CPU usage figure saturates.
+*
+*                 (2) All four load sources are independent:
+*
+*                     (a) Burn tasks spin on the timestamp timer for a duty-cycle slice of each period.
+*                     (b) An IPC producer/consumer pair storms a message queue in bursts.
+*                     (c) A churn task cycles get/touch/free bursts against a Mem_Pool.
+*                     (d) Timer1 interrupts at App_LoadT1RateHz (see BSP_T1IntInit()).
+*********************************************************************************************************
+*/
+
+#include <includes.h>
+#include "app_load.h"
+
+#if APP_CFG_LOAD_EN > 0u
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+                                                                /* Timestamp timer counts per burn task period          */
+#define  APP_LOAD_BURN_PERIOD_CNTS    (((BSP_CLK_FREQ / 2u) / 1000u) * APP_CFG_LOAD_BURN_PERIOD_MS)
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+CPU_INT32U  volatile  App_LoadBurnPct   = APP_CFG_LOAD_BURN_PCT;
+CPU_INT32U  volatile  App_LoadIPCBurst  = APP_CFG_LOAD_IPC_BURST;
+CPU_INT32U  volatile  App_LoadMemBurst  = APP_CFG_LOAD_MEM_BURST;
+CPU_INT32U  volatile  App_LoadT1RateHz  = APP_CFG_LOAD_T1_RATE_HZ;
+
+APP_LOAD_STAT         App_LoadStatTbl[APP_CFG_LOAD_STAT_TBL_SIZE];
+CPU_INT32U            App_LoadStatIx;
+
+/*
+*********************************************************************************************************
+*                                            LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB      App_LoadCtrlTCB;
+static  CPU_STK     App_LoadCtrlStk[APP_CFG_TASK_LOAD_STK_SIZE];
+
+static  OS_TCB      App_LoadBurnTCBTbl[APP_CFG_LOAD_BURN_TASK_QTY];
+static  CPU_STK     App_LoadBurnStkTbl[APP_CFG_LOAD_BURN_TASK_QTY][APP_CFG_TASK_LOAD_STK_SIZE];
+
+static  OS_TCB      App_LoadIPCTxTCB;
+static  CPU_STK     App_LoadIPCTxStk[APP_CFG_TASK_LOAD_STK_SIZE];
+static  OS_TCB      App_LoadIPCRxTCB;
+static  CPU_STK     App_LoadIPCRxStk[APP_CFG_TASK_LOAD_STK_SIZE];
+
+static  OS_TCB      App_LoadMemTCB;
+static  CPU_STK     App_LoadMemStk[APP_CFG_TASK_LOAD_STK_SIZE];
+
+static  OS_Q        App_LoadQ;                                  /* Queue stormed by the IPC task pair                   */
+static  OS_MSG      App_LoadQMsgTbl[APP_CFG_LOAD_IPC_Q_SIZE];   /* Its dedicated message storage (see OSQCreate())      */
+
+static  MEM_POOL    App_LoadMemPool;                            /* Pool churned by the memory task                      */
+static  CPU_INT32U  App_LoadMemStorage[(APP_CFG_LOAD_MEM_BLK_QTY * APP_CFG_LOAD_MEM_BLK_SIZE) / sizeof(CPU_INT32U)];
+
+static  CPU_INT32U  volatile  App_LoadT1IntCtr;                 /* Raw counters sampled (and differenced) per step      */
+static  CPU_INT32U  volatile  App_LoadIPCTxCtr;
+static  CPU_INT32U  volatile  App_LoadIPCRxCtr;
+static  CPU_INT32U  volatile  App_LoadIPCFullCtr;
+static  CPU_INT32U  volatile  App_LoadMemCycleCtr;
+static  CPU_INT32U  volatile  App_LoadMemFailCtr;
+
+static  CPU_INT32U  volatile  App_LoadBurnSink;                 /* Keeps the burn loop's work observable                */
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  App_LoadTaskCtrl  (void  *p_arg);
+static  void  App_LoadTaskBurn  (void  *p_arg);
+static  void  App_LoadTaskIPCTx (void  *p_arg);
+static  void  App_LoadTaskIPCRx (void  *p_arg);
+static  void  App_LoadTaskMem   (void  *p_arg);
+
+static  void  App_LoadT1Int     (void);
+static  void  App_LoadStatSnap  (CPU_INT32U  step_nbr);
+
+/*
+*********************************************************************************************************
+*                                           App_LoadInit()
+*
+* Description : Create the load generator's kernel objects and tasks and start the Timer1 interrupt
+*               load.  Call once from App_TaskCreate().
+*
+* Argument(s) : none
+*
+* Return(s)   : none
+*
+* Caller(s)   : App_TaskCreate()
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  App_LoadInit (void)
+{
+    OS_ERR      os_err;
+    LIB_ERR     lib_err;
+    CPU_SIZE_T  octets_reqd;
+    CPU_INT32U  i;
+
+
+    OSQCreate   ((OS_Q        *)&App_LoadQ,
+                 (CPU_CHAR    *)"LoadQ",
+                 (OS_MSG_QTY   )APP_CFG_LOAD_IPC_Q_SIZE,
+                 (OS_MSG      *)&App_LoadQMsgTbl[0],
+                 (OS_MSG_QTY   )APP_CFG_LOAD_IPC_Q_SIZE,
+                 (OS_ERR      *)&os_err);
+
+    Mem_PoolCreate((MEM_POOL   *)&App_LoadMemPool,
+                   (void       *)&App_LoadMemStorage[0],
+                   (CPU_SIZE_T  )sizeof(App_LoadMemStorage),
+                   (CPU_SIZE_T  )APP_CFG_LOAD_MEM_BLK_QTY,
+                   (CPU_SIZE_T  )APP_CFG_LOAD_MEM_BLK_SIZE,
+                   (CPU_SIZE_T  )sizeof(CPU_INT32U),
+                   (CPU_SIZE_T *)&octets_reqd,
+                   (LIB_ERR    *)&lib_err);
+
+    for (i = 0u; i < APP_CFG_LOAD_BURN_TASK_QTY; i++) {
+        OSTaskCreate((OS_TCB      *)&App_LoadBurnTCBTbl[i],
+                     (CPU_CHAR    *)"LoadBurn",
+                     (OS_TASK_PTR  )App_LoadTaskBurn,
+                     (void        *)i,
+                     (OS_PRIO      )(APP_CFG_TASK_LOAD_BURN_PRIO + i),
+                     (CPU_STK     *)&App_LoadBurnStkTbl[i][0],
+                     (CPU_STK_SIZE )(APP_CFG_TASK_LOAD_STK_SIZE / 10u),
+                     (CPU_STK_SIZE )APP_CFG_TASK_LOAD_STK_SIZE,
+                     (OS_MSG_QTY   )0u,
+                     (OS_TICK      )0u,
+                     (void        *)0,
+                     (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                     (OS_ERR      *)&os_err);
+    }
+
+    OSTaskCreate((OS_TCB      *)&App_LoadIPCTxTCB,
+                 (CPU_CHAR    *)"LoadIPCTx",
+                 (OS_TASK_PTR  )App_LoadTaskIPCTx,
+                 (void        *)0,
+                 (OS_PRIO      )APP_CFG_TASK_LOAD_IPC_TX_PRIO,
+                 (CPU_STK     *)&App_LoadIPCTxStk[0],
+                 (CPU_STK_SIZE )(APP_CFG_TASK_LOAD_STK_SIZE / 10u),
+                 (CPU_STK_SIZE )APP_CFG_TASK_LOAD_STK_SIZE,
+                 (OS_MSG_QTY   )0u,
+                 (OS_TICK      )0u,
+                 (void        *)0,
+                 (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR      *)&os_err);
+
+    OSTaskCreate((OS_TCB      *)&App_LoadIPCRxTCB,
+                 (CPU_CHAR    *)"LoadIPCRx",
+                 (OS_TASK_PTR  )App_LoadTaskIPCRx,
+                 (void        *)0,
+                 (OS_PRIO      )APP_CFG_TASK_LOAD_IPC_RX_PRIO,
+                 (CPU_STK     *)&App_LoadIPCRxStk[0],
+                 (CPU_STK_SIZE )(APP_CFG_TASK_LOAD_STK_SIZE / 10u),
+                 (CPU_STK_SIZE )APP_CFG_TASK_LOAD_STK_SIZE,
+                 (OS_MSG_QTY   )0u,
+                 (OS_TICK      )0u,
+                 (void        *)0,
+                 (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR      *)&os_err);
+
+    OSTaskCreate((OS_TCB      *)&App_LoadMemTCB,
+                 (CPU_CHAR    *)"LoadMem",
+                 (OS_TASK_PTR  )App_LoadTaskMem,
+                 (void        *)0,
+                 (OS_PRIO      )APP_CFG_TASK_LOAD_MEM_PRIO,
+                 (CPU_STK     *)&App_LoadMemStk[0],
+                 (CPU_STK_SIZE )(APP_CFG_TASK_LOAD_STK_SIZE / 10u),
+                 (CPU_STK_SIZE )APP_CFG_TASK_LOAD_STK_SIZE,
+                 (OS_MSG_QTY   )0u,
+                 (OS_TICK      )0u,
+                 (void        *)0,
+                 (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR      *)&os_err);
+
+    OSTaskCreate((OS_TCB      *)&App_LoadCtrlTCB,
+                 (CPU_CHAR    *)"LoadCtrl",
+                 (OS_TASK_PTR  )App_LoadTaskCtrl,
+                 (void        *)0,
+                 (OS_PRIO      )APP_CFG_TASK_LOAD_CTRL_PRIO,
+                 (CPU_STK     *)&App_LoadCtrlStk[0],
+                 (CPU_STK_SIZE )(APP_CFG_TASK_LOAD_STK_SIZE / 10u),
+                 (CPU_STK_SIZE )APP_CFG_TASK_LOAD_STK_SIZE,
+                 (OS_MSG_QTY   )0u,
+                 (OS_TICK      )0u,
+                 (void        *)0,
+                 (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR      *)&os_err);
+
+    BSP_T1IntInit(App_LoadT1RateHz, App_LoadT1Int);             /* Start the interrupt load last                        */
+}
+
+/*
+*********************************************************************************************************
+*                                          App_LoadTaskBurn()
+*
+* Description : Synthetic CPU load: every APP_CFG_LOAD_BURN_PERIOD_MS, spin on the timestamp timer for
+*               App_LoadBurnPct percent of the period, then sleep the rest.  The spin does real work
+*               into App_LoadBurnSink so it cannot be optimized away.
+*
+* Argument(s) : p_arg    the task's index (0..APP_CFG_LOAD_BURN_TASK_QTY-1), unused beyond identity.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadTaskBurn (void *p_arg)
+{
+    OS_ERR      err;
+    CPU_TS_TMR  ts_start;
+    CPU_INT32U  burn_cnts;
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        burn_cnts = (APP_LOAD_BURN_PERIOD_CNTS / 100u) * App_LoadBurnPct;
+        ts_start  =  CPU_TS_TmrRd();
+        while ((CPU_INT32U)(CPU_TS_TmrRd() - ts_start) < burn_cnts) {
+            App_LoadBurnSink = App_LoadBurnSink * 1103515245u + 12345u;
+        }
+        OSTimeDly(OS_MS_TO_TICKS(APP_CFG_LOAD_BURN_PERIOD_MS), OS_OPT_TIME_DLY, &err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                         App_LoadTaskIPCTx()
+*
+* Description : IPC storm producer: every APP_CFG_LOAD_IPC_PERIOD_MS, post App_LoadIPCBurst messages to
+*               the load queue.  A full queue is counted, not retried -- back-to-back refusals are the
+*               signal that the consumer no longer keeps up.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadTaskIPCTx (void *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  i;
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        for (i = 0u; i < App_LoadIPCBurst; i++) {
+            OSQPost((OS_Q      *)&App_LoadQ,
+                    (void      *)(App_LoadIPCTxCtr + 1u),
+                    (OS_MSG_SIZE)sizeof(CPU_INT32U),
+                    (OS_OPT     )OS_OPT_POST_FIFO,
+                    (OS_ERR    *)&err);
+            if (err == OS_ERR_NONE) {
+                App_LoadIPCTxCtr++;
+            } else {
+                App_LoadIPCFullCtr++;
+            }
+        }
+        OSTimeDly(OS_MS_TO_TICKS(APP_CFG_LOAD_IPC_PERIOD_MS), OS_OPT_TIME_DLY, &err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                         App_LoadTaskIPCRx()
+*
+* Description : IPC storm consumer: drain the load queue as fast as the scheduler lets it run.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadTaskIPCRx (void *p_arg)
+{
+    OS_ERR       err;
+    OS_MSG_SIZE  msg_size;
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        (void)OSQPend((OS_Q        *)&App_LoadQ,
+                      (OS_TICK      )0u,
+                      (OS_OPT       )OS_OPT_PEND_BLOCKING,
+                      (OS_MSG_SIZE *)&msg_size,
+                      (CPU_TS      *)0,
+                      (OS_ERR      *)&err);
+        if (err == OS_ERR_NONE) {
+            App_LoadIPCRxCtr++;
+        }
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          App_LoadTaskMem()
+*
+* Description : Memory churn: every APP_CFG_LOAD_MEM_PERIOD_MS, get App_LoadMemBurst blocks from the
+*               pool, write each one's first word, then free them in reverse order.  Failed gets are
+*               counted and the burst continues with what it got.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadTaskMem (void *p_arg)
+{
+    OS_ERR       err;
+    LIB_ERR      lib_err;
+    void        *blk_tbl[APP_CFG_LOAD_MEM_BLK_QTY];
+    CPU_INT32U   burst;
+    CPU_INT32U   got;
+    CPU_INT32U   i;
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        burst = App_LoadMemBurst;
+        if (burst > APP_CFG_LOAD_MEM_BLK_QTY) {
+            burst = APP_CFG_LOAD_MEM_BLK_QTY;
+        }
+        got = 0u;
+        for (i = 0u; i < burst; i++) {
+            blk_tbl[got] = Mem_PoolBlkGet((MEM_POOL  *)&App_LoadMemPool,
+                                          (CPU_SIZE_T )APP_CFG_LOAD_MEM_BLK_SIZE,
+                                          (LIB_ERR   *)&lib_err);
+            if (blk_tbl[got] == (void *)0) {
+                App_LoadMemFailCtr++;
+            } else {
+                *(CPU_INT32U *)blk_tbl[got] = got;
+                got++;
+            }
+        }
+        while (got > 0u) {
+            got--;
+            Mem_PoolBlkFree((MEM_POOL *)&App_LoadMemPool,
+                            (void     *)blk_tbl[got],
+                            (LIB_ERR  *)&lib_err);
+        }
+        App_LoadMemCycleCtr++;
+        OSTimeDly(OS_MS_TO_TICKS(APP_CFG_LOAD_MEM_PERIOD_MS), OS_OPT_TIME_DLY, &err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          App_LoadT1Int()
+*
+* Description : Timer1 interrupt load body, called from BSP_T1ISR_Handler() at App_LoadT1RateHz.  The
+*               load is the interrupt overhead itself (vectoring, context save, dispatch); the body
+*               only counts.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadT1Int (void)
+{
+    App_LoadT1IntCtr++;
+}
+
+/*
+*********************************************************************************************************
+*                                          App_LoadStatSnap()
+*
+* Description : Close a ramp step: difference the raw counters against the previous snapshot and record
+*               the per-task CPU usage, worst jitter and stack headroom into App_LoadStatTbl[].
+*
+* Note(s)     : (1) JitterMax accumulates from task creation (see OSTaskJitterGet()); each snapshot
+*                   therefore reports the worst case SO FAR, which is the number that matters when
+*                   hunting the step where deadlines first slipped.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadStatSnap (CPU_INT32U  step_nbr)
+{
+    static  OS_CTX_SW_CTR   ctx_sw_prev;
+    static  CPU_INT32U      t1_prev;
+    static  CPU_INT32U      ipc_tx_prev;
+    static  CPU_INT32U      ipc_rx_prev;
+    static  CPU_INT32U      ipc_full_prev;
+    static  CPU_INT32U      mem_cycle_prev;
+    static  CPU_INT32U      mem_fail_prev;
+    APP_LOAD_STAT          *p_stat;
+    OS_TCB                 *p_tcb;
+    CPU_STK_SIZE            stk_free;
+    CPU_STK_SIZE            stk_used;
+    OS_ERR                  err;
+    CPU_INT32U              i;
+
+
+    p_stat = &App_LoadStatTbl[App_LoadStatIx % APP_CFG_LOAD_STAT_TBL_SIZE];
+    App_LoadStatIx++;
+
+    p_stat->StepNbr   = step_nbr;
+    p_stat->BurnPct   = App_LoadBurnPct;
+    p_stat->IPCBurst  = App_LoadIPCBurst;
+    p_stat->MemBurst  = App_LoadMemBurst;
+    p_stat->T1RateHz  = App_LoadT1RateHz;
+#if OS_CFG_STAT_TASK_EN > 0u
+    p_stat->CPUUsage  = OSStatTaskCPUUsage;
+#endif
+    p_stat->CtxSwCtr  = OSTaskCtxSwCtr      - ctx_sw_prev;
+    p_stat->T1IntCtr  = App_LoadT1IntCtr    - t1_prev;
+    p_stat->IPCTxCtr  = App_LoadIPCTxCtr    - ipc_tx_prev;
+    p_stat->IPCRxCtr  = App_LoadIPCRxCtr    - ipc_rx_prev;
+    p_stat->IPCFullCtr  = App_LoadIPCFullCtr  - ipc_full_prev;
+    p_stat->MemCycleCtr = App_LoadMemCycleCtr - mem_cycle_prev;
+    p_stat->MemFailCtr  = App_LoadMemFailCtr  - mem_fail_prev;
+
+    ctx_sw_prev    = OSTaskCtxSwCtr;
+    t1_prev        = App_LoadT1IntCtr;
+    ipc_tx_prev    = App_LoadIPCTxCtr;
+    ipc_rx_prev    = App_LoadIPCRxCtr;
+    ipc_full_prev  = App_LoadIPCFullCtr;
+    mem_cycle_prev = App_LoadMemCycleCtr;
+    mem_fail_prev  = App_LoadMemFailCtr;
+
+    for (i = 0u; i < APP_LOAD_TASK_QTY; i++) {                  /* Burn tasks first, then tx, rx, mem (see app_load.h)  */
+        if (i < APP_CFG_LOAD_BURN_TASK_QTY) {
+            p_tcb = &App_LoadBurnTCBTbl[i];
+        } else if (i == APP_CFG_LOAD_BURN_TASK_QTY) {
+            p_tcb = &App_LoadIPCTxTCB;
+        } else if (i == (APP_CFG_LOAD_BURN_TASK_QTY + 1u)) {
+            p_tcb = &App_LoadIPCRxTCB;
+        } else {
+            p_tcb = &App_LoadMemTCB;
+        }
+#if OS_CFG_TASK_PROFILE_EN > 0u
+        p_stat->TaskUsageTbl[i] = p_tcb->CPUUsage;
+#endif
+#if OS_CFG_TASK_JITTER_EN > 0u
+        OSTaskJitterGet(p_tcb, &p_stat->TaskJitterTbl[i], (OS_CTR *)0, &err);
+#endif
+        OSTaskStkChk(p_tcb, &stk_free, &stk_used, &err);
+        if (err == OS_ERR_NONE) {
+            p_stat->TaskStkFreeTbl[i] = stk_free;
+        }
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          App_LoadTaskCtrl()
+*
+* Description : Ramp controller: every APP_CFG_LOAD_RAMP_SEC seconds, snapshot the statistics, then
+*               raise the burn duty by APP_CFG_LOAD_RAMP_STEP_PCT until APP_CFG_LOAD_RAMP_MAX_PCT is
+*               reached.  Once at the cap the load holds steady and snapshots keep accumulating.  It
+*               also applies debugger changes to App_LoadT1RateHz at each step boundary.
+*********************************************************************************************************
+*/
+
+static  void  App_LoadTaskCtrl (void *p_arg)
+{
+    OS_ERR      err;
+    CPU_INT32U  step_nbr;
+    CPU_INT32U  t1_rate;
+
+
+    (void)p_arg;
+
+    step_nbr = 0u;
+    t1_rate  = App_LoadT1RateHz;
+
+    while (DEF_TRUE) {
+        OSTimeDly((OS_TICK)(APP_CFG_LOAD_RAMP_SEC * OSCfg_TickRate_Hz), OS_OPT_TIME_DLY, &err);
+
+        App_LoadStatSnap(step_nbr);
+        step_nbr++;
+
+#if APP_CFG_LOAD_RAMP_STEP_PCT > 0u
+        if (App_LoadBurnPct + APP_CFG_LOAD_RAMP_STEP_PCT <= APP_CFG_LOAD_RAMP_MAX_PCT) {
+            App_LoadBurnPct += APP_CFG_LOAD_RAMP_STEP_PCT;
+        }
+#endif
+        if (t1_rate != App_LoadT1RateHz) {                      /* Reprogram Timer1 when the knob moved                 */
+            t1_rate  = App_LoadT1RateHz;
+            BSP_T1IntInit(t1_rate, App_LoadT1Int);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                  SYNTHETIC LOAD GENERATOR
+*
+* Filename      : app_load.h
+*
+* Note(s)       : (1) Capacity-testing tool: a configurable set of synthetic tasks applies CPU burn,
+*                     message-queue traffic, Timer1 interrupt load and Mem_Pool churn while a control
+*                     task records per-task CPU usage, timed-wakeup jitter and stack headroom as the
+*                     load ramps.  Everything of interest lives in globals (the App_Load* tunables and
+*                     App_LoadStatTbl[]) so the run can be steered and inspected from the debugger or
+*                     uC/Probe -- the board has no serial console.
+*
+*                 (2) The initial settings and the ramp schedule come from app_cfg.h (APP_CFG_LOAD_xxx).
+*********************************************************************************************************
+*/
+
+#ifndef  APP_LOAD_MODULE_PRESENT
+#define  APP_LOAD_MODULE_PRESENT
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+                                                                /* Tasks covered by a snapshot: the burn tasks ...      */
+                                                                /* ... then IPC producer, IPC consumer, mem churn       */
+#define  APP_LOAD_TASK_QTY            (APP_CFG_LOAD_BURN_TASK_QTY + 3u)
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_load_stat {                                /* Statistics snapshot, one per ramp step               */
+    CPU_INT32U    StepNbr;                                      /* Ramp step this snapshot closes (0 = baseline)        */
+    CPU_INT32U    BurnPct;                                      /* Tunables in effect during the step                   */
+    CPU_INT32U    IPCBurst;
+    CPU_INT32U    MemBurst;
+    CPU_INT32U    T1RateHz;
+    OS_CPU_USAGE  CPUUsage;                                     /* OSStatTaskCPUUsage at the end of the step            */
+    OS_CTX_SW_CTR CtxSwCtr;                                     /* Context switches during the step                     */
+    CPU_INT32U    T1IntCtr;                                     /* Timer1 interrupts taken during the step              */
+    CPU_INT32U    IPCTxCtr;                                     /* Messages posted / received / refused (queue full)    */
+    CPU_INT32U    IPCRxCtr;
+    CPU_INT32U    IPCFullCtr;
+    CPU_INT32U    MemCycleCtr;                                  /* Pool get+touch+free bursts completed / gets failed   */
+    CPU_INT32U    MemFailCtr;
+                                                                /* Per load task, indexed burn 0..n-1, tx, rx, mem:     */
+    OS_CPU_USAGE  TaskUsageTbl[APP_LOAD_TASK_QTY];              /* ... CPU usage (0-100%)                               */
+    CPU_TS        TaskJitterTbl[APP_LOAD_TASK_QTY];             /* ... worst wake-to-dispatch jitter seen (TS counts)   */
+    CPU_STK_SIZE  TaskStkFreeTbl[APP_LOAD_TASK_QTY];            /* ... free stack entries                               */
+} APP_LOAD_STAT;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*
+* Note(s) : (1) The tunables may be changed at any time from the debugger; the load tasks pick the new
+*               values up on their next cycle.  Setting APP_CFG_LOAD_RAMP_STEP_PCT to 0 disables the
+*               automatic ramp, leaving the knobs entirely under manual control.
+*********************************************************************************************************
+*/
+
+extern  CPU_INT32U  volatile  App_LoadBurnPct;                  /* CPU burn duty per burn task, percent of its period   */
+extern  CPU_INT32U  volatile  App_LoadIPCBurst;                 /* Messages posted per producer period                  */
+extern  CPU_INT32U  volatile  App_LoadMemBurst;                 /* Blocks cycled per churn period                       */
+extern  CPU_INT32U  volatile  App_LoadT1RateHz;                 /* Timer1 interrupt rate (applied on the next step)     */
+
+extern  APP_LOAD_STAT         App_LoadStatTbl[APP_CFG_LOAD_STAT_TBL_SIZE];
+extern  CPU_INT32U            App_LoadStatIx;                   /* Next App_LoadStatTbl[] entry to be written (wraps)   */
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  App_LoadInit (void);                                      /* Create the load tasks, queue, pool and Timer1 load   */
+
+#endif
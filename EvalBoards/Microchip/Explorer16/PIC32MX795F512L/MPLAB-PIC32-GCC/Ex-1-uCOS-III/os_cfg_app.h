@@ -57,7 +57,16 @@
 #define  OS_CFG_STAT_TASK_STK_SIZE       384u // mjb 512u               /* Stack size (number of CPU_STK elements)                */
 
 
-                                                            /* ------------------------ TICKS ----------------------- */
+                                                            /* ------------------- EDF CLASS ------------------------ */
+#define  OS_CFG_EDF_PRIO_HI           OS_CFG_PRIO_MAX-5u   /* Reserved band: earliest-deadline job runs here         */
+#define  OS_CFG_EDF_PRIO_LO           OS_CFG_PRIO_MAX-4u   /* ... the other registered EDF tasks park here           */
+
+                                                            /* ---------------- MINITASK DISPATCHER ----------------- */
+#define  OS_CFG_MTASK_DISP_TASK_PRIO  OS_CFG_PRIO_MAX-3u   /* Priority of the shared minitask dispatcher task        */
+#define  OS_CFG_MTASK_DISP_TASK_STK_SIZE 128u              /* Stack size (number of CPU_STK elements)                */
+
+
+/* ------------------------ TICKS ----------------------- */
 #define  OS_CFG_TICK_RATE_HZ            1000u               /* Tick rate in Hertz (10 to 1000 Hz)                     */
 #define  OS_CFG_TICK_TASK_PRIO  OS_CFG_PRIO_MAX-4u          /* Priority                                               */
 #define  OS_CFG_TICK_TASK_STK_SIZE       384u // mjb 512u               /* Stack size (number of CPU_STK elements)                */
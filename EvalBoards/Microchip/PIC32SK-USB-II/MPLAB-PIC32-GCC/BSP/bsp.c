@@ -228,6 +228,7 @@ void  BSP_TickISR_Handler (void)
 {
     UpdateCoreTimer(BSP_TMR_RELOAD);                                          /* Prepare for the next core timer interrupt  */
     mCTClearIntFlag();                                                        /* Clear the core timer interrupt             */
+    OSTimeTick();                                                             /* Process the tick (see CoreTimerIntHandler) */
 }
 
 /*
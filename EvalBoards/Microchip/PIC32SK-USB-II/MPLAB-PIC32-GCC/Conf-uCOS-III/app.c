@@ -0,0 +1,119 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-III
+*                                         The Real-Time Kernel
+*
+*                             (c) Copyright 1998-2012, Micrium, Weston, FL
+*                                          All Rights Reserved
+*
+*
+*                                            PIC32 Sample code
+*
+* File : APP.C
+*
+* Note : PIC32SK-USB-II build of the cross-board BSP performance conformance suite.  The suite itself is
+*        the shared CPU/Microchip/PIC32/ConfBench.c: every board's Conf project compiles the SAME
+*        measurement code against its own BSP and prints machine-readable rows over UART1 (see
+*        ConfBench.h for the row format).  A kernel change is conformant when the deltas agree
+*        across all the boards' rows, not just the board it was tuned on.
+*********************************************************************************************************
+*/
+
+#include "ConfBench.h"                                                    /* Pulls <includes.h> (no guard: once only)                 */
+
+/*
+*********************************************************************************************************
+*                                                VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB    App_TaskStartTCB;
+static  CPU_STK   App_TaskStartStk[APP_CFG_TASK_START_STK_SIZE];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  App_TaskStart   (void  *p_arg);
+
+/*
+*********************************************************************************************************
+*                                                main()
+*
+* Description : This is the standard entry point for C code.
+*
+* Arguments   : none
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    OS_ERR   os_err;
+
+    CPU_Init();                                                           /* Initialize the uC/CPU services                           */
+
+    BSP_IntDisAll();
+
+    OSInit(&os_err);                                                      /* Init uC/OS-III.                                          */
+
+    OSTaskCreate((OS_TCB      *)&App_TaskStartTCB,                        /* Create the start task                                    */
+                 (CPU_CHAR    *)"Start",
+                 (OS_TASK_PTR  )App_TaskStart,
+                 (void        *)0,
+                 (OS_PRIO      )APP_CFG_TASK_START_PRIO,
+                 (CPU_STK     *)&App_TaskStartStk[0],
+                 (CPU_STK_SIZE )APP_CFG_TASK_START_STK_SIZE_LIMIT,
+                 (CPU_STK_SIZE )APP_CFG_TASK_START_STK_SIZE,
+                 (OS_MSG_QTY   )0u,
+                 (OS_TICK      )0u,
+                 (void        *)0,
+                 (OS_OPT       )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR      *)&os_err);
+
+    OSStart(&os_err);                                                     /* Start multitasking (i.e. give control to uC/OS-III).     */
+
+    (void)&os_err;
+
+    return (0);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          STARTUP TASK
+*
+* Description : Runs the shared conformance suite once, then idles blinking an LED so the board is
+*               visibly alive.
+* Arguments   : p_arg   is the argument passed to 'AppStartTask()' by 'OSTaskCreate()'.
+*********************************************************************************************************
+*/
+
+static  void  App_TaskStart (void *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    BSP_InitIO();                                                       /* Initialize BSP functions                                 */
+
+    Mem_Init();                                                 /* Initialize memory managment module                   */
+    Math_Init();                                                /* Initialize mathematical module                       */
+
+    initU1();                                                   /* The suite's rows go out over UART1                   */
+
+    OSTimeDlyHMSM(0u, 0u, 1u, 0u,                               /* Let the terminal connect                             */
+                  OS_OPT_TIME_HMSM_STRICT,
+                  &err);
+
+    ConfBench_Run("pic32sk");
+
+    while (DEF_TRUE) {                                          /* Task body, always written as an infinite loop.       */
+        LED_Toggle(1);
+        OSTimeDlyHMSM(0u, 0u, 0, 100u,
+                      OS_OPT_TIME_HMSM_STRICT,
+                      &err);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+************************************************************************************************************************
+*                                                     uC/OS-III
+*                                                The Real-Time Kernel
+*
+*                                       (c) Copyright 2009, Micrium, Weston, FL
+*                                                 All Rights Reserved
+*                                                    www.Micrium.com
+*
+*                                       OS CONFIGURATION (APPLICATION SPECIFICS)
+*
+* File    : OS_CFG_APP.H
+* By      : JJL
+* Version : V3.01.0
+*
+* LICENSING TERMS:
+* ---------------
+*       uC/OS-III  is provided in source form to registered licensees.  It is illegal to distribute this source
+*       code to any third party unless you receive written permission by an authorized Micrium officer.
+*
+*       Knowledge of the source code may NOT be used to develop a similar product.
+*
+*       Please help us continue to provide the  Embedded  community with the  finest software  available.   Your
+*       honesty is greatly appreciated.
+*
+*       You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_APP_H
+#define OS_CFG_APP_H
+
+/*
+************************************************************************************************************************
+*                                                      CONSTANTS
+************************************************************************************************************************
+*/
+
+                                                            /* --------------------- MISCELLANEOUS ------------------ */
+#define  OS_CFG_MSG_POOL_SIZE            100u               /* Maximum number of messages                             */
+#define  OS_CFG_ISR_STK_SIZE             512u               /* Stack size of ISR stack (number of CPU_STK elements)   */
+#define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY  10u               /* Stack limit position in percentage to empty            */
+
+
+                                                            /* ---------------------- IDLE TASK --------------------- */
+#define  OS_CFG_IDLE_TASK_STK_SIZE       512u               /* Stack size (number of CPU_STK elements)                */
+
+
+                                                            /* ------------------ ISR HANDLER TASK ------------------ */
+#define  OS_CFG_INT_Q_SIZE                10u               /* Size of ISR handler task queue                         */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE      512u               /* Stack size (number of CPU_STK elements)                */
+
+
+                                                            /* ------------------- STATISTIC TASK ------------------- */
+#define  OS_CFG_STAT_TASK_PRIO  OS_CFG_PRIO_MAX-2u          /* Priority                                               */
+#define  OS_CFG_STAT_TASK_RATE_HZ         10u               /* Rate of execution (10 Hz Typ.)                         */
+#define  OS_CFG_STAT_TASK_STK_SIZE       512u               /* Stack size (number of CPU_STK elements)                */
+
+
+                                                            /* ------------------- EDF CLASS ------------------------ */
+#define  OS_CFG_EDF_PRIO_HI           OS_CFG_PRIO_MAX-5u   /* Reserved band: earliest-deadline job runs here         */
+#define  OS_CFG_EDF_PRIO_LO           OS_CFG_PRIO_MAX-4u   /* ... the other registered EDF tasks park here           */
+
+                                                            /* ---------------- MINITASK DISPATCHER ----------------- */
+#define  OS_CFG_MTASK_DISP_TASK_PRIO  OS_CFG_PRIO_MAX-3u   /* Priority of the shared minitask dispatcher task        */
+#define  OS_CFG_MTASK_DISP_TASK_STK_SIZE 128u              /* Stack size (number of CPU_STK elements)                */
+
+
+/* ------------------------ TICKS ----------------------- */
+#define  OS_CFG_TICK_RATE_HZ            1000u               /* Tick rate in Hertz (10 to 1000 Hz)                     */
+#define  OS_CFG_TICK_TASK_PRIO  OS_CFG_PRIO_MAX-4u          /* Priority                                               */
+#define  OS_CFG_TICK_TASK_STK_SIZE       512u               /* Stack size (number of CPU_STK elements)                */
+#define  OS_CFG_TICK_WHEEL_SIZE           17u               /* Number of 'spokes' in tick  wheel; SHOULD be prime     */
+
+
+                                                            /* ----------------------- TIMERS ----------------------- */
+#define  OS_CFG_TMR_TASK_PRIO   OS_CFG_PRIO_MAX-2u          /* Priority of 'Timer Task'                               */
+#define  OS_CFG_TMR_TASK_RATE_HZ          10u               /* Rate for timers (10 Hz Typ.)                           */
+#define  OS_CFG_TMR_TASK_STK_SIZE        512u               /* Stack size (number of CPU_STK elements)                */
+#define  OS_CFG_TMR_WHEEL_SIZE            17u               /* Number of 'spokes' in timer wheel; SHOULD be prime     */
+
+#endif
+
@@ -166,6 +166,14 @@ typedef            void      (*CPU_FNCT_PTR )(void *p_obj);     /* See Note #2b.
 
 #define  CPU_CFG_ENDIAN_TYPE            CPU_ENDIAN_TYPE_LITTLE  /* Defines CPU data    word-memory order (see Note #2). */
 
+                                                                /* MIPS32 4K has a single-cycle clz instruction;        */
+                                                                /* ... CPU_CntLeadZeros() is implemented in cpu_a.s.    */
+#define  CPU_CFG_LEAD_ZEROS_ASM_PRESENT
+
+                                                                /* MIPS32 4K supports ll/sc;  atomic operations are     */
+                                                                /* ... implemented in cpu_a.s.                          */
+#define  CPU_CFG_ATOMIC_ASM_PRESENT
+
 
 /*
 *********************************************************************************************************
@@ -324,6 +332,43 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    TIMESTAMP TIMER INLINE READ
+*
+* Note(s) : (1) When 'CPU_CFG_TS_TMR_RD_INLINE_EN' is #define'd in 'cpu_cfg.h' (see 'cpu_cfg.h  CPU 
+*               TIMESTAMP CONFIGURATION'; defined-or-not, NOT DEF_ENABLED/DEF_DISABLED -- see 'CPU 
+*               INCLUDE FILES  Note #3'), CPU_TS_TMR_RD() reads the free-running MIPS32 core timer 
+*               (CP0 Count, register $9) with a single inlined 'mfc0' instruction instead of calling 
+*               the BSP's CPU_TS_TmrRd() function.  This removes the call/return overhead from every 
+*               timestamped kernel operation (see 'os_cpu.h  OS_TS_GET()') so timestamping may be left 
+*               enabled in production builds.
+*
+*               (a) The inline read REQUIREs that the BSP's timestamp timer actually is the core timer 
+*                   (see 'bsp.c  CPU_TS_TmrRd()'); both MUST read the same counter.
+*
+*           (2) When NOT #define'd, CPU_TS_TMR_RD() defaults to the BSP's CPU_TS_TmrRd() function 
+*               (see 'cpu_core.h  FUNCTION PROTOTYPES').
+*********************************************************************************************************
+*/
+
+#ifdef   CPU_CFG_TS_TMR_RD_INLINE_EN                            /* See Notes #1 & #2.                                   */
+static  inline  CPU_INT32U  CPU_TS_TmrRdInline (void)  __attribute__((always_inline));
+
+static  inline  CPU_INT32U  CPU_TS_TmrRdInline (void)
+{
+    CPU_INT32U  cnts;
+
+
+    __asm__ __volatile__ ("mfc0   %0, $9" : "=r" (cnts));       /* Read CP0 Count (core timer).                         */
+
+    return (cnts);
+}
+
+#define  CPU_TS_TMR_RD()            ((CPU_TS_TMR)CPU_TS_TmrRdInline())
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -333,6 +378,29 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 CPU_SR  CPU_SR_Save   (void);
 void    CPU_SR_Restore(CPU_SR  cpu_sr);
 
+CPU_DATA  CPU_CntLeadZeros(CPU_DATA  val);              /* See cpu_a.s -- single clz instruction.       */
+
+                                                        /* See cpu_a.s -- ll/sc retry loop; returns the */
+                                                        /* ... value read before the (attempted) swap.  */
+CPU_INT32U  CPU_AtomicCmpSwap32(CPU_INT32U  volatile  *p_val,
+                                CPU_INT32U             cmp_val,
+                                CPU_INT32U             new_val);
+
+                                                        /* See cpu_a.s -- ll/sc retry loops; both return the    */
+                                                        /* ... value read before the update.                    */
+CPU_INT32U  CPU_AtomicAdd32    (CPU_INT32U  volatile  *p_val,
+                                CPU_INT32U             delta);
+
+CPU_INT32U  CPU_AtomicXchg32   (CPU_INT32U  volatile  *p_val,
+                                CPU_INT32U             new_val);
+
+                                                        /* See cpu_a.s -- ll/sc singly-linked list push/pop;    */
+                                                        /* ... nodes link through their first word.             */
+void       *CPU_AtomicListPop  (void        * volatile *p_head);
+
+void        CPU_AtomicListPush (void        * volatile *p_head,
+                                void                   *p_node);
+
 
 /*$PAGE*/
 /*
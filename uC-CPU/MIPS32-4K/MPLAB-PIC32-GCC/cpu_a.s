@@ -41,6 +41,12 @@
 
     .global  CPU_SR_Save
     .global  CPU_SR_Restore
+    .global  CPU_CntLeadZeros
+    .global  CPU_AtomicCmpSwap32
+    .global  CPU_AtomicAdd32
+    .global  CPU_AtomicXchg32
+    .global  CPU_AtomicListPop
+    .global  CPU_AtomicListPush
 
 /*
 *********************************************************************************************************
@@ -95,3 +101,190 @@ CPU_SR_Restore:
 
     .end CPU_SR_Restore
 
+
+/*
+**********************************************************************************************************
+*                                        COUNT LEADING ZEROS
+*
+* Description : Counts the number of contiguous, most-significant, leading zero bits in a data value,
+*               using the MIPS32 single-cycle 'clz' instruction.  This replaces the byte-wise lookup
+*               table implementation in cpu_core.c (see CPU_CFG_LEAD_ZEROS_ASM_PRESENT in cpu.h) and
+*               sits on the critical path of OS_PrioGetHighest() in every scheduling decision.
+*
+* Prototype   : CPU_DATA  CPU_CntLeadZeros(CPU_DATA  val);
+**********************************************************************************************************
+*/
+
+    .ent CPU_CntLeadZeros
+CPU_CntLeadZeros:
+
+    jr    $31
+    clz   $2, $4                               /* Count leading zeros of a0 into the return register   */
+
+    .end CPU_CntLeadZeros
+
+
+/*
+**********************************************************************************************************
+*                                    ATOMIC COMPARE-AND-SWAP (32-BIT)
+*
+* Description : Atomically compares the 32-bit value at p_val (a0) with cmp_val (a1) and, if they are
+*               equal, stores new_val (a2).  Built on the MIPS32 ll/sc pair so the operation never
+*               disables interrupts; if the reservation is lost the sequence simply retries.
+*
+* Prototype   : CPU_INT32U  CPU_AtomicCmpSwap32(CPU_INT32U  volatile  *p_val,
+*                                               CPU_INT32U             cmp_val,
+*                                               CPU_INT32U             new_val);
+*
+* Returns     : The value read from p_val BEFORE the (attempted) swap.  The swap took place if, and
+*               only if, the returned value equals cmp_val.
+**********************************************************************************************************
+*/
+
+    .ent CPU_AtomicCmpSwap32
+CPU_AtomicCmpSwap32:
+
+CPU_AtomicCmpSwap32_Retry:
+
+    ll    $2, 0($4)                            /* Load the current value, opening a reservation        */
+    bne   $2, $5, CPU_AtomicCmpSwap32_Done     /* Value no longer matches cmp_val; do NOT swap         */
+    move  $8, $6
+    sc    $8, 0($4)                            /* Try to store new_val; $8 == 0 if reservation lost    */
+    beq   $8, $0, CPU_AtomicCmpSwap32_Retry
+    nop
+
+CPU_AtomicCmpSwap32_Done:
+
+    jr    $31
+    nop
+
+    .end CPU_AtomicCmpSwap32
+
+
+/*
+**********************************************************************************************************
+*                                        ATOMIC ADD (32-BIT)
+*
+* Description : Atomically adds delta (a1) to the 32-bit value at p_val (a0).  Built on the MIPS32
+*               ll/sc pair so the operation never disables interrupts; if the reservation is lost the
+*               sequence simply retries.
+*
+* Prototype   : CPU_INT32U  CPU_AtomicAdd32(CPU_INT32U  volatile  *p_val,
+*                                           CPU_INT32U             delta);
+*
+* Returns     : The value read from p_val BEFORE the add.
+**********************************************************************************************************
+*/
+
+    .ent CPU_AtomicAdd32
+CPU_AtomicAdd32:
+
+CPU_AtomicAdd32_Retry:
+
+    ll    $2, 0($4)                            /* Load the current value, opening a reservation        */
+    addu  $8, $2, $5                           /* Compute current value + delta                        */
+    sc    $8, 0($4)                            /* Try to store the sum;  $8 == 0 if reservation lost   */
+    beq   $8, $0, CPU_AtomicAdd32_Retry
+    nop
+
+    jr    $31
+    nop
+
+    .end CPU_AtomicAdd32
+
+
+/*
+**********************************************************************************************************
+*                                      ATOMIC EXCHANGE (32-BIT)
+*
+* Description : Atomically replaces the 32-bit value at p_val (a0) with new_val (a1).  Built on the
+*               MIPS32 ll/sc pair so the operation never disables interrupts; if the reservation is
+*               lost the sequence simply retries.
+*
+* Prototype   : CPU_INT32U  CPU_AtomicXchg32(CPU_INT32U  volatile  *p_val,
+*                                            CPU_INT32U             new_val);
+*
+* Returns     : The value read from p_val BEFORE the exchange.
+**********************************************************************************************************
+*/
+
+    .ent CPU_AtomicXchg32
+CPU_AtomicXchg32:
+
+CPU_AtomicXchg32_Retry:
+
+    ll    $2, 0($4)                            /* Load the current value, opening a reservation        */
+    move  $8, $5
+    sc    $8, 0($4)                            /* Try to store new_val;  $8 == 0 if reservation lost   */
+    beq   $8, $0, CPU_AtomicXchg32_Retry
+    nop
+
+    jr    $31
+    nop
+
+    .end CPU_AtomicXchg32
+
+
+/*
+**********************************************************************************************************
+*                                 ATOMIC SINGLY-LINKED LIST POP / PUSH
+*
+* Description : Lock-free pop/push of a singly-linked free list whose nodes link through their first
+*               word (e.g. the OS_MEM free list; see os_mem.c).  Built on the MIPS32 ll/sc pair so
+*               neither operation ever disables interrupts.
+*
+*               The pop dereferences the list head BETWEEN the 'll' and the 'sc'.  This is what makes
+*               the sequence safe against the classic compare-and-swap ABA hazard: any interrupt or
+*               context switch that could have popped and re-pushed the same head node executes an
+*               'eret', which clears the LL bit, so our 'sc' fails and the sequence retries with a
+*               fresh head and a fresh 'next' pointer.  Plain loads and stores by this CPU between the
+*               'll' and 'sc' do not clear the LL bit on the 4K core.
+*
+* Prototypes  : void  *CPU_AtomicListPop (void  * volatile  *p_head);
+*
+*               void   CPU_AtomicListPush(void  * volatile  *p_head,
+*                                         void              *p_node);
+*
+* Returns     : CPU_AtomicListPop() returns the node removed from the head of the list, or a NULL
+*               pointer if the list is empty.
+**********************************************************************************************************
+*/
+
+    .ent CPU_AtomicListPop
+CPU_AtomicListPop:
+
+CPU_AtomicListPop_Retry:
+
+    ll    $2, 0($4)                            /* Load the head node, opening a reservation            */
+    beq   $2, $0, CPU_AtomicListPop_Done       /* List empty; return NULL                              */
+    nop
+    lw    $8, 0($2)                            /* next = head->next (safe; see the ABA note above)     */
+    sc    $8, 0($4)                            /* Try to store next as the new head                    */
+    beq   $8, $0, CPU_AtomicListPop_Retry      /* Reservation lost; retry with a fresh head            */
+    nop
+
+CPU_AtomicListPop_Done:
+
+    jr    $31
+    nop
+
+    .end CPU_AtomicListPop
+
+
+    .ent CPU_AtomicListPush
+CPU_AtomicListPush:
+
+CPU_AtomicListPush_Retry:
+
+    ll    $8, 0($4)                            /* Load the current head, opening a reservation         */
+    sw    $8, 0($5)                            /* node->next = current head                            */
+    move  $9, $5
+    sc    $9, 0($4)                            /* Try to store the node as the new head                */
+    beq   $9, $0, CPU_AtomicListPush_Retry     /* Reservation lost; retry                              */
+    nop
+
+    jr    $31
+    nop
+
+    .end CPU_AtomicListPush
+
@@ -455,11 +455,11 @@ CPU_TS32  CPU_TS_Get32 (void)
 
 
 #if (CPU_CFG_TS_TMR_SIZE >= CPU_WORD_SIZE_32)
-    ts = (CPU_TS32)CPU_TS_TmrRd();                                  /* Get cur ts tmr val (in 32-bit ts cnts).          */
+    ts = (CPU_TS32)CPU_TS_TMR_RD();                                  /* Get cur ts tmr val (in 32-bit ts cnts).          */
 
 #else
     CPU_INT_DIS();
-    tmr_cur            = (CPU_TS_TMR) CPU_TS_TmrRd();               /* Get cur ts tmr val (in ts tmr cnts).             */
+    tmr_cur            = (CPU_TS_TMR) CPU_TS_TMR_RD();               /* Get cur ts tmr val (in ts tmr cnts).             */
     tmr_delta          = (CPU_TS_TMR)(tmr_cur - CPU_TS_32_TmrPrev); /* Calc      delta ts tmr cnts.                     */
     CPU_TS_32_Accum   += (CPU_TS32  ) tmr_delta;                    /* Inc ts by delta ts tmr cnts (see Note #2).       */
     CPU_TS_32_TmrPrev  = (CPU_TS_TMR) tmr_cur;                      /* Save cur ts tmr cnts for next update.            */
@@ -522,6 +522,24 @@ CPU_TS32  CPU_TS_Get32 (void)
 *               (3) After initialization, 'CPU_TS_64_Accum' & 'CPU_TS_64_TmrPrev' MUST ALWAYS
 *                   be accessed AND updated exclusively with interrupts disabled -- but NOT
 *                   with critical sections.
+*
+*                   See also Note #4 for the wrap-tracking path used with a 32-bit timestamp timer.
+*
+*               (4) In case the CPU timestamp timer is exactly 32 bits wide, the 64-bit CPU timestamp
+*                   is formed from a timer wrap counter maintained by CPU_TS_Update() & the timer's
+*                   instantaneous count -- WITHOUT disabling interrupts on the read path :
+*
+*                   (a) The read path snapshots the wrap counter & the timer count last sampled by
+*                       CPU_TS_Update(), reads the timer, & retries until the snapshot is observed
+*                       unchanged, guaranteeing a consistent wrap counter/timer pair.
+*
+*                   (b) A current timer count BELOW the last sampled count means the timer wrapped
+*                       since the last update; the wrap counter is then incremented locally (the
+*                       shared counter itself is only ever updated by CPU_TS_Update()).
+*
+*                   (c) CPU_TS_Update() MUST be called at least once per timer wrap period --
+*                       approximately 107 seconds with the 40-MHz PIC32 core timer -- for timestamps
+*                       to remain monotonic (see 'os_cpu_c.c  OSTimeTickHook()').
 *********************************************************************************************************
 */
 
@@ -529,7 +547,11 @@ CPU_TS32  CPU_TS_Get32 (void)
 CPU_TS64  CPU_TS_Get64 (void)
 {
     CPU_TS64    ts;
-#if (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64)
+#if (CPU_CFG_TS_TMR_SIZE == CPU_WORD_SIZE_32)
+    CPU_TS32    wrap_cnt;
+    CPU_TS_TMR  tmr_prev;
+    CPU_TS_TMR  tmr_cur;
+#elif (CPU_CFG_TS_TMR_SIZE < CPU_WORD_SIZE_64)
     CPU_TS_TMR  tmr_cur;
     CPU_TS_TMR  tmr_delta;
     CPU_SR_ALLOC();
@@ -537,11 +559,24 @@ CPU_TS64  CPU_TS_Get64 (void)
 
 
 #if (CPU_CFG_TS_TMR_SIZE >= CPU_WORD_SIZE_64)
-    ts = (CPU_TS64)CPU_TS_TmrRd();                                  /* Get cur ts tmr val (in 64-bit ts cnts).          */
+    ts = (CPU_TS64)CPU_TS_TMR_RD();                                  /* Get cur ts tmr val (in 64-bit ts cnts).          */
+
+#elif (CPU_CFG_TS_TMR_SIZE == CPU_WORD_SIZE_32)
+    do {                                                            /* Snapshot wrap cnt & prev tmr cnts (see Note #4a).*/
+        wrap_cnt = (CPU_TS32  )CPU_TS_64_WrapCnt;
+        tmr_prev = (CPU_TS_TMR)CPU_TS_64_TmrPrev;
+        tmr_cur  = (CPU_TS_TMR)CPU_TS_TMR_RD();                      /* Get cur ts tmr val (in ts tmr cnts).             */
+    } while ((wrap_cnt != CPU_TS_64_WrapCnt) ||                     /* Retry until snapshot observed unchanged.         */
+             (tmr_prev != CPU_TS_64_TmrPrev));
+
+    if (tmr_cur < tmr_prev) {                                       /* Tmr wrapped since last update (see Note #4b).    */
+        wrap_cnt++;
+    }
+    ts = ((CPU_TS64)wrap_cnt << 32) | (CPU_TS64)tmr_cur;
 
 #else
     CPU_INT_DIS();
-    tmr_cur            = (CPU_TS_TMR) CPU_TS_TmrRd();               /* Get cur ts tmr val (in ts tmr cnts).             */
+    tmr_cur            = (CPU_TS_TMR) CPU_TS_TMR_RD();               /* Get cur ts tmr val (in ts tmr cnts).             */
     tmr_delta          = (CPU_TS_TMR)(tmr_cur - CPU_TS_64_TmrPrev); /* Calc      delta ts tmr cnts.                     */
     CPU_TS_64_Accum   += (CPU_TS64  ) tmr_delta;                    /* Inc ts by delta ts tmr cnts (see Note #2).       */
     CPU_TS_64_TmrPrev  = (CPU_TS_TMR) tmr_cur;                      /* Save cur ts tmr cnts for next update.            */
@@ -583,13 +618,29 @@ CPU_TS64  CPU_TS_Get64 (void)
 #if (CPU_CFG_TS_EN == DEF_ENABLED)
 void  CPU_TS_Update (void)
 {
+#if ((CPU_CFG_TS_64_EN    == DEF_ENABLED)  && \
+     (CPU_CFG_TS_TMR_SIZE == CPU_WORD_SIZE_32))
+    CPU_TS_TMR  tmr_cur;
+    CPU_SR_ALLOC();
+#endif
+
+
 #if ((CPU_CFG_TS_32_EN    == DEF_ENABLED)  && \
      (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_32))
    (void)CPU_TS_Get32();
 #endif
 
 #if ((CPU_CFG_TS_64_EN    == DEF_ENABLED)  && \
-     (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64))
+     (CPU_CFG_TS_TMR_SIZE == CPU_WORD_SIZE_32))
+    CPU_INT_DIS();                                              /* Track ts tmr wrap (see 'CPU_TS_Get64()  Note #4').   */
+    tmr_cur = (CPU_TS_TMR)CPU_TS_TMR_RD();
+    if (tmr_cur < CPU_TS_64_TmrPrev) {                          /* Tmr wrapped since last update?                       */
+        CPU_TS_64_WrapCnt++;
+    }
+    CPU_TS_64_TmrPrev = tmr_cur;
+    CPU_INT_EN();
+#elif ((CPU_CFG_TS_64_EN  == DEF_ENABLED)  && \
+       (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64))
    (void)CPU_TS_Get64();
 #endif
 }
@@ -835,7 +886,7 @@ void  CPU_IntDisMeasStart (void)
 {
     CPU_IntDisMeasCtr++;
     if (CPU_IntDisNestCtr == 0u) {                                  /* If ints NOT yet dis'd, ...                       */
-        CPU_IntDisMeasStart_cnts = CPU_TS_TmrRd();                  /* ... get ints dis'd start time.                   */
+        CPU_IntDisMeasStart_cnts = CPU_TS_TMR_RD();                  /* ... get ints dis'd start time.                   */
     }
     CPU_IntDisNestCtr++;
 }
@@ -1014,6 +1065,12 @@ void  CPU_IntDisMeasStart (void)
 *                               overhead is performed asynchronously in appropriate API functions.
 *
 *                               See also 'CPU_IntDisMeasMaxCalc()  Note #1b'.
+*
+*               (2) The histogram bucket index is the floor of the log2 of the measured duration, 
+*                   calculated with a single CPU_CntLeadZeros() (one 'clz' instruction on MIPS32); the 
+*                   measurement overhead is NOT subtracted from histogrammed durations (cp. Note #1b2B).
+*
+*                   See also 'cpu_core.h  CPU INTERRUPTS DISABLED TIME MEASUREMENT HISTOGRAM'.
 *********************************************************************************************************
 */
 
@@ -1021,11 +1078,14 @@ void  CPU_IntDisMeasStart (void)
 void  CPU_IntDisMeasStop (void)
 {
     CPU_TS_TMR  time_ints_disd_cnts;
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+    CPU_INT08U  bucket;
+#endif
 
 
     CPU_IntDisNestCtr--;
     if (CPU_IntDisNestCtr == 0u) {                                  /* If ints NO longer dis'd,        ...              */
-        CPU_IntDisMeasStop_cnts = CPU_TS_TmrRd();                   /* ... get  ints dis'd stop time & ...              */
+        CPU_IntDisMeasStop_cnts = CPU_TS_TMR_RD();                   /* ... get  ints dis'd stop time & ...              */
                                                                     /* ... calc ints dis'd tot  time (see Note #1b2A).  */
         time_ints_disd_cnts     = CPU_IntDisMeasStop_cnts -
                                   CPU_IntDisMeasStart_cnts;
@@ -1036,6 +1096,103 @@ void  CPU_IntDisMeasStop (void)
         if (CPU_IntDisMeasMax_cnts    < time_ints_disd_cnts) {
             CPU_IntDisMeasMax_cnts    = time_ints_disd_cnts;
         }
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN                                /* Bucket dur by its log2 & attribute it to the ... */
+                                                                    /* ... cur tagged site (see Note #2).               */
+        if (time_ints_disd_cnts > 0u) {
+            bucket = (CPU_INT08U)((CPU_INT_DIS_MEAS_HIST_BUCKET_NBR - 1u)
+                   -              (CPU_INT08U)CPU_CntLeadZeros((CPU_DATA)time_ints_disd_cnts));
+        } else {
+            bucket = 0u;
+        }
+        CPU_IntDisMeasHistTbl[CPU_IntDisMeasSiteCur][bucket]++;
+        CPU_IntDisMeasSiteCur = CPU_INT_DIS_MEAS_SITE_NONE;
+#endif
+    }
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasHistGet()
+*
+* Description : Snapshot one site's interrupts disabled time histogram.
+*
+* Argument(s) : site_id         Site identifier whose histogram to snapshot (see 'cpu_core.h  CPU 
+*                                   INTERRUPTS DISABLED TIME MEASUREMENT HISTOGRAM  Note #2').
+*
+*               p_bucket_tbl    Pointer to a caller-supplied table of 
+*                                   CPU_INT_DIS_MEAS_HIST_BUCKET_NBR CPU_INT32U's that will receive 
+*                                   the bucket counts.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application (e.g. a UART histogram dump).
+*
+* Note(s)     : (1) The snapshot is copied with interrupts disabled so a consistent set of buckets is 
+*                   returned; one site's copy is 128 octets & therefore bounded.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void  CPU_IntDisMeasHistGet (CPU_INT08U   site_id,
+                             CPU_INT32U  *p_bucket_tbl)
+{
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+    if (p_bucket_tbl == (CPU_INT32U *)0) {
+        return;
+    }
+    if (site_id >= CPU_INT_DIS_MEAS_HIST_SITE_NBR) {
+        return;
+    }
+
+    CPU_INT_DIS();                                              /* See Note #1.                                         */
+    for (i = 0u; i < CPU_INT_DIS_MEAS_HIST_BUCKET_NBR; i++) {
+        p_bucket_tbl[i] = CPU_IntDisMeasHistTbl[site_id][i];
+    }
+    CPU_INT_EN();
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasHistClr()
+*
+* Description : Clear the interrupts disabled time histograms of ALL sites.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasInit(),
+*               Application.
+*
+* Note(s)     : (1) Each site's buckets are cleared in their own critical section so interrupts are 
+*                   never disabled for more than one site's worth of clearing.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void  CPU_IntDisMeasHistClr (void)
+{
+    CPU_INT08U  site;
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+    for (site = 0u; site < CPU_INT_DIS_MEAS_HIST_SITE_NBR; site++) {
+        CPU_INT_DIS();                                          /* See Note #1.                                         */
+        for (i = 0u; i < CPU_INT_DIS_MEAS_HIST_BUCKET_NBR; i++) {
+            CPU_IntDisMeasHistTbl[site][i] = 0u;
+        }
+        CPU_INT_EN();
     }
 }
 #endif
@@ -1255,6 +1412,131 @@ CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          CPU_AtomicAdd32()
+*
+* Description : Atomically add a value to a shared 32-bit value.
+*
+* Argument(s) : p_val       Pointer to the shared value to update.
+*
+*               delta       Value to add.
+*
+* Return(s)   : Value of the shared value BEFORE the add.
+*
+* Caller(s)   : Application.
+*
+*               This function is an INTERNAL CPU module function but MAY be called by application function(s).
+*
+* Note(s)     : (1) This is the generic C-source version, used only when the CPU port does NOT provide
+*                   native atomic instructions (CPU_CFG_ATOMIC_ASM_PRESENT NOT #define'd in 'cpu.h'/
+*                   'cpu_cfg.h').  It falls back on a short critical section & is therefore atomic
+*                   with respect to both tasks & ISRs, at the cost of briefly disabling interrupts.
+*********************************************************************************************************
+*/
+
+#ifndef     CPU_CFG_ATOMIC_ASM_PRESENT
+CPU_INT32U  CPU_AtomicAdd32 (CPU_INT32U  volatile  *p_val,
+                             CPU_INT32U             delta)
+{
+    CPU_INT32U  val;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    val    = *p_val;
+   *p_val  =  val + delta;
+    CPU_CRITICAL_EXIT();
+
+    return (val);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_AtomicXchg32()
+*
+* Description : Atomically exchange a shared 32-bit value with a new value.
+*
+* Argument(s) : p_val       Pointer to the shared value to update.
+*
+*               new_val     Value to store.
+*
+* Return(s)   : Value of the shared value BEFORE the exchange.
+*
+* Caller(s)   : Application.
+*
+*               This function is an INTERNAL CPU module function but MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'CPU_AtomicAdd32()  Note #1'.
+*********************************************************************************************************
+*/
+
+#ifndef     CPU_CFG_ATOMIC_ASM_PRESENT
+CPU_INT32U  CPU_AtomicXchg32 (CPU_INT32U  volatile  *p_val,
+                              CPU_INT32U             new_val)
+{
+    CPU_INT32U  val;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    val    = *p_val;
+   *p_val  =  new_val;
+    CPU_CRITICAL_EXIT();
+
+    return (val);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_AtomicCmpSwap32()
+*
+* Description : Atomically compare a shared 32-bit value with an expected value &, if they are equal,
+*               store a new value.
+*
+* Argument(s) : p_val       Pointer to the shared value to update.
+*
+*               cmp_val     Value the shared value is expected to hold.
+*
+*               new_val     Value to store, if the shared value equals 'cmp_val'.
+*
+* Return(s)   : Value of the shared value BEFORE the (attempted) swap.  The swap took place if, & only
+*               if, the returned value equals 'cmp_val'.
+*
+* Caller(s)   : Application.
+*
+*               This function is an INTERNAL CPU module function but MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'CPU_AtomicAdd32()  Note #1'.
+*********************************************************************************************************
+*/
+
+#ifndef     CPU_CFG_ATOMIC_ASM_PRESENT
+CPU_INT32U  CPU_AtomicCmpSwap32 (CPU_INT32U  volatile  *p_val,
+                                 CPU_INT32U             cmp_val,
+                                 CPU_INT32U             new_val)
+{
+    CPU_INT32U  val;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    val = *p_val;
+    if (val == cmp_val) {
+       *p_val = new_val;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (val);
+}
+#endif
+
+
 
 /*$PAGE*/
 /*
@@ -1351,7 +1633,11 @@ static  void  CPU_TS_Init (void)
 #endif
 
 #if  ((CPU_CFG_TS_64_EN    == DEF_ENABLED)  && \
-      (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64))
+      (CPU_CFG_TS_TMR_SIZE == CPU_WORD_SIZE_32))
+    CPU_TS_64_WrapCnt = 0u;                                     /* Init 64-bit ts tmr wrap cnt.                         */
+    CPU_TS_64_TmrPrev = ts_tmr_cnts;                            /* Init 64-bit ts prev tmr val.                         */
+#elif ((CPU_CFG_TS_64_EN   == DEF_ENABLED)  && \
+       (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64))
     CPU_TS_64_Accum   = 0u;                                     /* Init 64-bit accum'd ts.                              */
     CPU_TS_64_TmrPrev = ts_tmr_cnts;                            /* Init 64-bit ts prev tmr val.                         */
 #endif
@@ -1413,6 +1699,10 @@ static  void  CPU_IntDisMeasInit (void)
     CPU_IntDisMeasMaxCur_cnts = 0u;
     CPU_IntDisMeasMax_cnts    = 0u;
     CPU_IntDisMeasOvrhd_cnts  = 0u;
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+    CPU_IntDisMeasHistClr();
+    CPU_IntDisMeasSiteCur     = CPU_INT_DIS_MEAS_SITE_NONE;
+#endif
 
                                                                 /* ----------- CALC INT DIS TIME MEAS OVRHD ----------- */
     time_meas_tot_cnts = 0u;
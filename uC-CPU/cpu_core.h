@@ -245,6 +245,43 @@ typedef  CPU_INT32U  CPU_TS_TMR;
 typedef  CPU_INT32U  CPU_TS_TMR_FREQ;
 
 
+/*
+*********************************************************************************************************
+*                         CPU INTERRUPTS DISABLED TIME MEASUREMENT HISTOGRAM
+*
+* Note(s) : (1) When 'CPU_CFG_INT_DIS_MEAS_HIST_EN' is #define'd in 'cpu_cfg.h' (in addition to 
+*               'CPU_CFG_INT_DIS_MEAS_EN'), every measured critical section is also counted into a 
+*               log2-bucketed histogram : bucket 'i' counts critical sections whose interrupts 
+*               disabled time 'dur' (in timestamp timer counts) satisfied  2^i <= dur < 2^(i+1).
+*
+*           (2) Histogram counts are attributed to a small 'site' identifier so tail latencies can be 
+*               traced back to the kernel module that produced them :
+*
+*               (a) Instrumented code tags the CURRENT outermost critical section by invoking 
+*                   CPU_INT_DIS_MEAS_SITE_SET() AFTER entering the critical section; the tag is 
+*                   consumed & reset to CPU_INT_DIS_MEAS_SITE_NONE when the outermost critical 
+*                   section exits.
+*
+*               (b) Un-tagged critical sections are attributed to CPU_INT_DIS_MEAS_SITE_NONE.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+#define  CPU_INT_DIS_MEAS_HIST_BUCKET_NBR                 32u   /* One bucket per power-of-2 dur (see Note #1).         */
+#define  CPU_INT_DIS_MEAS_HIST_SITE_NBR                    8u   /* Nbr of attributable sites     (see Note #2).         */
+
+                                                                /* Site id's (see Note #2a) :                           */
+#define  CPU_INT_DIS_MEAS_SITE_NONE                        0u   /* ... un-attributed critical sections.                 */
+#define  CPU_INT_DIS_MEAS_SITE_OS_CORE                     1u   /* ... os_core.c  (scheduler).                          */
+#define  CPU_INT_DIS_MEAS_SITE_OS_Q                        2u   /* ... os_q.c     (message queues).                     */
+#define  CPU_INT_DIS_MEAS_SITE_OS_SEM                      3u   /* ... os_sem.c   (semaphores).                         */
+#define  CPU_INT_DIS_MEAS_SITE_OS_TASK                     4u   /* ... os_task.c  (task management).                    */
+#define  CPU_INT_DIS_MEAS_SITE_LIB_MEM                     5u   /* ... lib_mem.c  (heap/pools).                         */
+#define  CPU_INT_DIS_MEAS_SITE_BSP                         6u   /* ... BSP code.                                        */
+#define  CPU_INT_DIS_MEAS_SITE_APP                         7u   /* ... application code.                                */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -263,7 +300,12 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_TS_32_TmrPrev;               /* 32-bit ts pre
 #endif
 
 #if ((CPU_CFG_TS_64_EN    == DEF_ENABLED)  && \
-     (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64))
+     (CPU_CFG_TS_TMR_SIZE ==  CPU_WORD_SIZE_32))
+                                                                /* See 'CPU_TS_Get64()  Note #4'.                       */
+CPU_CORE_EXT  volatile  CPU_TS32     CPU_TS_64_WrapCnt;         /* 64-bit ts tmr wrap cnt.                              */
+CPU_CORE_EXT  volatile  CPU_TS_TMR   CPU_TS_64_TmrPrev;         /* 64-bit ts prev tmr (in ts tmr cnts).                 */
+#elif ((CPU_CFG_TS_64_EN  == DEF_ENABLED)  && \
+       (CPU_CFG_TS_TMR_SIZE <  CPU_WORD_SIZE_64))
 CPU_CORE_EXT  CPU_TS64         CPU_TS_64_Accum;                 /* 64-bit accum'd ts  (in ts tmr cnts).                 */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_TS_64_TmrPrev;               /* 64-bit ts prev tmr (in ts tmr cnts).                 */
 #endif
@@ -282,6 +324,13 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasStop_cnts;         /* ...  stop  ti
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasOvrhd_cnts;        /* ...        time meas ovrhd.                          */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMaxCur_cnts;       /* ...     resetable max time dis'd.                    */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-resetable max time dis'd.                    */
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN                            /* Ints dis'd time log2 histogram (see Note #2) : ...   */
+                                                                /* ... one bucket per power-of-2 dur (in ts tmr cnts),  */
+CPU_CORE_EXT  CPU_INT32U       CPU_IntDisMeasHistTbl[CPU_INT_DIS_MEAS_HIST_SITE_NBR]
+                                                    [CPU_INT_DIS_MEAS_HIST_BUCKET_NBR];
+CPU_CORE_EXT  CPU_INT08U       CPU_IntDisMeasSiteCur;           /* ... attributed to the cur tagged site.               */
+#endif
 #endif
 
 
@@ -292,6 +341,29 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-reset
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                     CPU_INT_DIS_MEAS_SITE_SET()
+*
+* Description : Tag the current outermost critical section with a histogram site identifier.
+*
+* Argument(s) : site_id     Site identifier (one of the CPU_INT_DIS_MEAS_SITE_xxx identifiers; see 
+*                               'CPU INTERRUPTS DISABLED TIME MEASUREMENT HISTOGRAM  Note #2').
+*
+* Caller(s)   : various, AFTER CPU_CRITICAL_ENTER()/OS_CRITICAL_ENTER().
+*
+* Note(s)     : (1) Compiles to a single byte store when the histogram is enabled & to nothing 
+*                   otherwise, so call sites need NOT be conditionally compiled.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+#define  CPU_INT_DIS_MEAS_SITE_SET(site_id)     do { CPU_IntDisMeasSiteCur = (CPU_INT08U)(site_id); } while (0)
+#else
+#define  CPU_INT_DIS_MEAS_SITE_SET(site_id)     do { } while (0)                /* See Note #1.                         */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         CPU_SW_EXCEPTION()
@@ -496,6 +568,14 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-reset
 *
 *               (b) 'cpu_core.h'/'cpu_core.c', if CPU_CFG_LEAD_ZEROS_ASM_PRESENT  NOT #define'd in 'cpu.h'/
 *                                                 'cpu_cfg.h' to enable C-source-version function otherwise
+*
+*           (3) CPU_Atomic???() prototyped/defined respectively in :
+*
+*               (a) 'cpu.h'/'cpu_a.asm',       if CPU_CFG_ATOMIC_ASM_PRESENT          #define'd in 'cpu.h'/
+*                                                 'cpu_cfg.h' to enable assembly-version functions
+*
+*               (b) 'cpu_core.h'/'cpu_core.c', if CPU_CFG_ATOMIC_ASM_PRESENT      NOT #define'd in 'cpu.h'/
+*                                                 'cpu_cfg.h' to enable C-source-version functions otherwise
 *********************************************************************************************************
 */
 
@@ -551,6 +631,13 @@ CPU_TS_TMR       CPU_IntDisMeasMaxGet     (void);
 void             CPU_IntDisMeasStart      (void);
 
 void             CPU_IntDisMeasStop       (void);
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void             CPU_IntDisMeasHistGet    (CPU_INT08U        site_id,
+                                           CPU_INT32U       *p_bucket_tbl);
+
+void             CPU_IntDisMeasHistClr    (void);
+#endif
 #endif
 
 
@@ -560,6 +647,20 @@ CPU_DATA         CPU_CntLeadZeros         (CPU_DATA          val);      /* See N
 #endif
 
 
+
+#ifndef  CPU_CFG_ATOMIC_ASM_PRESENT                                     /* ------------ CPU ATOMIC OP FNCTS ----------- */
+CPU_INT32U       CPU_AtomicAdd32          (CPU_INT32U  volatile  *p_val,   /* See Note #3.                             */
+                                           CPU_INT32U             delta);
+
+CPU_INT32U       CPU_AtomicXchg32         (CPU_INT32U  volatile  *p_val,
+                                           CPU_INT32U             new_val);
+
+CPU_INT32U       CPU_AtomicCmpSwap32      (CPU_INT32U  volatile  *p_val,
+                                           CPU_INT32U             cmp_val,
+                                           CPU_INT32U             new_val);
+#endif
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -710,6 +811,10 @@ void  CPU_TS_TmrInit(void);
 
 #if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
 CPU_TS_TMR  CPU_TS_TmrRd(void);
+
+#ifndef  CPU_TS_TMR_RD                                          /* Dflt to the BSP rd fnct unless the port provides ... */
+#define  CPU_TS_TMR_RD()            CPU_TS_TmrRd()              /* ... an inline rd (see 'cpu.h  TIMESTAMP TIMER ...    */
+#endif                                                          /* ... INLINE READ').                                   */
 #endif
 
 
@@ -929,6 +1034,13 @@ CPU_INT64U  CPU_TS64_to_uSec(CPU_TS64  ts_cnts);
 #endif
 
 
+#ifndef  CPU_CFG_ATOMIC_ASM_PRESENT
+#if 0                                                           /* Optionally configured in 'cpu_cfg.h'; DO NOT MODIFY. */
+#error  "CPU_CFG_ATOMIC_ASM_PRESENT            not #define'd in 'cpu.h'/'cpu_cfg.h'"
+#endif
+#endif
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -0,0 +1,322 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                          (c) Copyright 2004-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               uC/LIB is provided in source form to registered licensees ONLY.  It is
+*               illegal to distribute this source code to any third party unless you receive
+*               written permission by an authorized Micrium representative.  Knowledge of
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  ASSEMBLY-OPTIMIZED MEMORY OPERATIONS
+*
+*                                              MIPS32 4K
+*                                                MPLAB
+*
+* Filename      : lib_mem_a.s
+* Version       : V1.35.00
+* Programmer(s) : MG
+*********************************************************************************************************
+* Note(s)       : (1) This file replaces the portable-C Mem_Copy() in lib_mem.c when the project
+*                     defines LIB_MEM_CFG_OPTIMIZE_ASM_EN as DEF_ENABLED in 'lib_cfg.h'.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           PUBLIC FUNCTIONS
+*********************************************************************************************************
+*/
+
+    .global  Mem_Copy
+    .global  Mem_Set
+
+/*
+*********************************************************************************************************
+*                                      CODE GENERATION DIRECTIVES
+*********************************************************************************************************
+*/
+
+    .section .text,code
+
+/*
+**********************************************************************************************************
+*                                             Mem_Copy()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer, using word-wide
+*               accesses wherever possible.
+*
+*               (1) When the two buffers share the same word-alignment offset, the copy runs with
+*                   aligned 'lw'/'sw' pairs, unrolled four words (16 octets) per iteration.
+*
+*               (2) When the alignment offsets differ -- where the portable-C Mem_Copy() falls back to
+*                   an octet loop -- the destination is aligned first, then the MIPS32 'lwl'/'lwr'
+*                   unaligned-load pair feeds aligned 'sw' stores, again four words per iteration, so
+*                   misaligned copies still move one word per load/store pair.
+*
+* Prototype   : void  Mem_Copy(       void        *pdest,
+*                              const  void        *psrc,
+*                                     CPU_SIZE_T   size);
+*
+* Note(s)     : (1) Null copies allowed (i.e. zero-length copies); null pointers ignored, as in the
+*                   portable-C implementation.
+*
+*               (2) Memory buffers NOT checked for overlapping (see lib_mem.c 'Mem_Copy()  Note #2').
+*
+*               (3) 'lwl'/'lwr' write disjoint byte lanes of the destination register, so the order in
+*                   which the pair is issued does not matter; the offsets below assume the little-endian
+*                   byte ordering of the PIC32.
+**********************************************************************************************************
+*/
+
+    .ent Mem_Copy
+Mem_Copy:
+
+    beq   $6, $0, Mem_Copy_Done                /* Null copy; nothing to do                             */
+    nop
+    beq   $4, $0, Mem_Copy_Done                /* Null pdest; nothing to do                            */
+    nop
+    beq   $5, $0, Mem_Copy_Done                /* Null psrc;  nothing to do                            */
+    nop
+
+    xor   $8, $4, $5                           /* Compare the buffers' word-alignment offsets          */
+    andi  $8, $8, 3
+    bne   $8, $0, Mem_Copy_Unalgn              /* Offsets differ; use the lwl/lwr path                 */
+    andi  $9, $4, 3                            /* Destination alignment offset (used by both paths)    */
+
+    beq   $9, $0, Mem_Copy_AlgnWords           /* Destination already word-aligned?                    */
+    nop
+
+Mem_Copy_AlgnLead:
+
+    lbu   $10, 0($5)                           /* Copy leading octets until pdest is word-aligned      */
+    addiu $5, $5, 1
+    sb    $10, 0($4)
+    addiu $4, $4, 1
+    addiu $6, $6, -1
+    beq   $6, $0, Mem_Copy_Done
+    andi  $9, $4, 3
+    bne   $9, $0, Mem_Copy_AlgnLead
+    nop
+
+Mem_Copy_AlgnWords:
+
+    sltiu $8, $6, 16
+    bne   $8, $0, Mem_Copy_AlgnWord            /* Fewer than 16 octets left; skip the unrolled loop    */
+    nop
+
+Mem_Copy_Algn4x:
+
+    lw    $10,  0($5)                          /* Copy 4 words per iteration with aligned accesses     */
+    lw    $11,  4($5)
+    lw    $12,  8($5)
+    lw    $13, 12($5)
+    sw    $10,  0($4)
+    sw    $11,  4($4)
+    sw    $12,  8($4)
+    sw    $13, 12($4)
+    addiu $5, $5, 16
+    addiu $4, $4, 16
+    addiu $6, $6, -16
+    sltiu $8, $6, 16
+    beq   $8, $0, Mem_Copy_Algn4x
+    nop
+
+Mem_Copy_AlgnWord:
+
+    sltiu $8, $6, 4
+    bne   $8, $0, Mem_Copy_Tail                /* Fewer than 4 octets left; finish with octets         */
+    nop
+    lw    $10, 0($5)                           /* Copy the remaining whole words one at a time         */
+    addiu $5, $5, 4
+    sw    $10, 0($4)
+    addiu $4, $4, 4
+    b     Mem_Copy_AlgnWord
+    addiu $6, $6, -4
+
+Mem_Copy_Unalgn:
+
+    beq   $9, $0, Mem_Copy_UnalgnWords         /* Destination already word-aligned?                    */
+    nop
+
+Mem_Copy_UnalgnLead:
+
+    lbu   $10, 0($5)                           /* Copy leading octets until pdest is word-aligned      */
+    addiu $5, $5, 1
+    sb    $10, 0($4)
+    addiu $4, $4, 1
+    addiu $6, $6, -1
+    beq   $6, $0, Mem_Copy_Done
+    andi  $9, $4, 3
+    bne   $9, $0, Mem_Copy_UnalgnLead
+    nop
+
+Mem_Copy_UnalgnWords:
+
+    sltiu $8, $6, 16
+    bne   $8, $0, Mem_Copy_UnalgnWord          /* Fewer than 16 octets left; skip the unrolled loop    */
+    nop
+
+Mem_Copy_Unalgn4x:
+
+    lwr   $10,  0($5)                          /* Copy 4 words per iteration; lwl/lwr load the         */
+    lwl   $10,  3($5)                          /* ... unaligned source words (see Note #3) and         */
+    lwr   $11,  4($5)                          /* ... aligned sw stores them                           */
+    lwl   $11,  7($5)
+    lwr   $12,  8($5)
+    lwl   $12, 11($5)
+    lwr   $13, 12($5)
+    lwl   $13, 15($5)
+    sw    $10,  0($4)
+    sw    $11,  4($4)
+    sw    $12,  8($4)
+    sw    $13, 12($4)
+    addiu $5, $5, 16
+    addiu $4, $4, 16
+    addiu $6, $6, -16
+    sltiu $8, $6, 16
+    beq   $8, $0, Mem_Copy_Unalgn4x
+    nop
+
+Mem_Copy_UnalgnWord:
+
+    sltiu $8, $6, 4
+    bne   $8, $0, Mem_Copy_Tail                /* Fewer than 4 octets left; finish with octets         */
+    nop
+    lwr   $10, 0($5)                           /* Copy the remaining whole words one at a time         */
+    lwl   $10, 3($5)
+    addiu $5, $5, 4
+    sw    $10, 0($4)
+    addiu $4, $4, 4
+    b     Mem_Copy_UnalgnWord
+    addiu $6, $6, -4
+
+Mem_Copy_Tail:
+
+    beq   $6, $0, Mem_Copy_Done
+    nop
+
+Mem_Copy_TailLoop:
+
+    lbu   $10, 0($5)                           /* Finish the copy with trailing octets                 */
+    addiu $5, $5, 1
+    sb    $10, 0($4)
+    addiu $6, $6, -1
+    bne   $6, $0, Mem_Copy_TailLoop
+    addiu $4, $4, 1
+
+Mem_Copy_Done:
+
+    jr    $31
+    nop
+
+    .end Mem_Copy
+
+
+/*
+**********************************************************************************************************
+*                                             Mem_Set()
+*
+* Description : Fill data buffer with specified data octet, using word-wide stores wherever possible.
+*               The fill octet is broadcast into all four byte lanes of a register, the destination is
+*               byte-filled up to the next word boundary, and the body of the buffer is then stored
+*               four words (16 octets) per iteration.  Stack clearing at task creation
+*               (OS_OPT_TASK_STK_CLR) and pool initialization funnel through here via Mem_Clr().
+*
+* Prototype   : void  Mem_Set(void        *pmem,
+*                             CPU_INT08U   data_val,
+*                             CPU_SIZE_T   size);
+*
+* Note(s)     : (1) Null sets allowed (i.e. zero-length sets); null pointers ignored, as in the
+*                   portable-C implementation.
+**********************************************************************************************************
+*/
+
+    .ent Mem_Set
+Mem_Set:
+
+    beq   $6, $0, Mem_Set_Done                 /* Null set; nothing to do                              */
+    nop
+    beq   $4, $0, Mem_Set_Done                 /* Null pmem; nothing to do                             */
+    nop
+
+    andi  $5, $5, 0xFF                         /* Broadcast the fill octet into all four byte lanes    */
+    sll   $8, $5, 8
+    or    $5, $5, $8
+    sll   $8, $5, 16
+    or    $5, $5, $8
+
+    andi  $9, $4, 3                            /* Destination alignment offset                         */
+    beq   $9, $0, Mem_Set_Words
+    nop
+
+Mem_Set_Lead:
+
+    sb    $5, 0($4)                            /* Fill leading octets until pmem is word-aligned       */
+    addiu $4, $4, 1
+    addiu $6, $6, -1
+    beq   $6, $0, Mem_Set_Done
+    andi  $9, $4, 3
+    bne   $9, $0, Mem_Set_Lead
+    nop
+
+Mem_Set_Words:
+
+    sltiu $8, $6, 16
+    bne   $8, $0, Mem_Set_Word                 /* Fewer than 16 octets left; skip the unrolled loop    */
+    nop
+
+Mem_Set_4x:
+
+    sw    $5,  0($4)                           /* Fill 4 words per iteration with aligned stores       */
+    sw    $5,  4($4)
+    sw    $5,  8($4)
+    sw    $5, 12($4)
+    addiu $4, $4, 16
+    addiu $6, $6, -16
+    sltiu $8, $6, 16
+    beq   $8, $0, Mem_Set_4x
+    nop
+
+Mem_Set_Word:
+
+    sltiu $8, $6, 4
+    bne   $8, $0, Mem_Set_Tail                 /* Fewer than 4 octets left; finish with octets         */
+    nop
+    sw    $5, 0($4)                            /* Fill the remaining whole words one at a time         */
+    addiu $4, $4, 4
+    b     Mem_Set_Word
+    addiu $6, $6, -4
+
+Mem_Set_Tail:
+
+    beq   $6, $0, Mem_Set_Done
+    nop
+
+Mem_Set_TailLoop:
+
+    sb    $5, 0($4)                            /* Finish the fill with trailing octets                 */
+    addiu $6, $6, -1
+    bne   $6, $0, Mem_Set_TailLoop
+    addiu $4, $4, 1
+
+Mem_Set_Done:
+
+    jr    $31
+    nop
+
+    .end Mem_Set
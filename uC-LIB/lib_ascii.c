@@ -85,9 +85,24 @@
 /*
 *********************************************************************************************************
 *                                            LOCAL DEFINES
+*
+* Note(s) : (1) Character classification bits of 'ASCII_CharClassTbl[]' (see 'LOCAL TABLES  Note #1').
 *********************************************************************************************************
 */
 
+                                                                /* ---------- CHAR CLASS BITS (see Note #1) ----------- */
+#define  ASCII_CHAR_CLASS_CTRL                 DEF_BIT_00
+#define  ASCII_CHAR_CLASS_SPACE                DEF_BIT_01
+#define  ASCII_CHAR_CLASS_BLANK                DEF_BIT_02
+#define  ASCII_CHAR_CLASS_PUNCT                DEF_BIT_03
+#define  ASCII_CHAR_CLASS_DIG                  DEF_BIT_04
+#define  ASCII_CHAR_CLASS_DIG_OCT              DEF_BIT_05
+#define  ASCII_CHAR_CLASS_DIG_HEX              DEF_BIT_06
+#define  ASCII_CHAR_CLASS_UPPER                DEF_BIT_07
+#define  ASCII_CHAR_CLASS_LOWER                DEF_BIT_08
+#define  ASCII_CHAR_CLASS_PRINT                DEF_BIT_09
+#define  ASCII_CHAR_CLASS_GRAPH                DEF_BIT_10
+
 
 /*
 *********************************************************************************************************
@@ -106,9 +121,125 @@
 /*
 *********************************************************************************************************
 *                                            LOCAL TABLES
+*
+* Note(s) : (1) Each entry of 'ASCII_CharClassTbl[]' holds the classification bits of one character
+*               (see 'LOCAL DEFINES'), computed from the 'ASCII_IS_xxx()' macro definitions in
+*               'lib_ascii.h'; each classification function is thereby a single indexed load & bit
+*               test instead of a chain of compares & branches.
+*
+*           (2) 'ASCII_CaseLowerTbl[]'/'ASCII_CaseUpperTbl[]' map each character to its lowercase/
+*               uppercase equivalent, or to itself where no equivalent exists.
+*
+*           (3) All three tables are 'const' & therefore reside in code space (flash); total cost is
+*               1024 octets of flash & no RAM.
 *********************************************************************************************************
 */
 
+static  const  CPU_INT16U  ASCII_CharClassTbl[256] = {
+    0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u,   /* 0x00..0x07 */
+    0x0001u, 0x0007u, 0x0003u, 0x0003u, 0x0003u, 0x0003u, 0x0001u, 0x0001u,   /* 0x08..0x0F */
+    0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u,   /* 0x10..0x17 */
+    0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u, 0x0001u,   /* 0x18..0x1F */
+    0x0206u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u,   /* 0x20..0x27 */
+    0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u,   /* 0x28..0x2F */
+    0x0670u, 0x0670u, 0x0670u, 0x0670u, 0x0670u, 0x0670u, 0x0670u, 0x0670u,   /* 0x30..0x37 */
+    0x0650u, 0x0650u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u,   /* 0x38..0x3F */
+    0x0608u, 0x06C0u, 0x06C0u, 0x06C0u, 0x06C0u, 0x06C0u, 0x06C0u, 0x0680u,   /* 0x40..0x47 */
+    0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u,   /* 0x48..0x4F */
+    0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u, 0x0680u,   /* 0x50..0x57 */
+    0x0680u, 0x0680u, 0x0680u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0608u,   /* 0x58..0x5F */
+    0x0608u, 0x0740u, 0x0740u, 0x0740u, 0x0740u, 0x0740u, 0x0740u, 0x0700u,   /* 0x60..0x67 */
+    0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u,   /* 0x68..0x6F */
+    0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u, 0x0700u,   /* 0x70..0x77 */
+    0x0700u, 0x0700u, 0x0700u, 0x0608u, 0x0608u, 0x0608u, 0x0608u, 0x0001u,   /* 0x78..0x7F */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0x80..0x87 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0x88..0x8F */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0x90..0x97 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0x98..0x9F */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xA0..0xA7 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xA8..0xAF */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xB0..0xB7 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xB8..0xBF */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xC0..0xC7 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xC8..0xCF */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xD0..0xD7 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xD8..0xDF */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xE0..0xE7 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xE8..0xEF */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u,   /* 0xF0..0xF7 */
+    0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u, 0x0000u   /* 0xF8..0xFF */
+};
+
+static  const  CPU_INT08U  ASCII_CaseLowerTbl[256] = {
+    0x00u, 0x01u, 0x02u, 0x03u, 0x04u, 0x05u, 0x06u, 0x07u,   /* 0x00..0x07 */
+    0x08u, 0x09u, 0x0Au, 0x0Bu, 0x0Cu, 0x0Du, 0x0Eu, 0x0Fu,   /* 0x08..0x0F */
+    0x10u, 0x11u, 0x12u, 0x13u, 0x14u, 0x15u, 0x16u, 0x17u,   /* 0x10..0x17 */
+    0x18u, 0x19u, 0x1Au, 0x1Bu, 0x1Cu, 0x1Du, 0x1Eu, 0x1Fu,   /* 0x18..0x1F */
+    0x20u, 0x21u, 0x22u, 0x23u, 0x24u, 0x25u, 0x26u, 0x27u,   /* 0x20..0x27 */
+    0x28u, 0x29u, 0x2Au, 0x2Bu, 0x2Cu, 0x2Du, 0x2Eu, 0x2Fu,   /* 0x28..0x2F */
+    0x30u, 0x31u, 0x32u, 0x33u, 0x34u, 0x35u, 0x36u, 0x37u,   /* 0x30..0x37 */
+    0x38u, 0x39u, 0x3Au, 0x3Bu, 0x3Cu, 0x3Du, 0x3Eu, 0x3Fu,   /* 0x38..0x3F */
+    0x40u, 0x61u, 0x62u, 0x63u, 0x64u, 0x65u, 0x66u, 0x67u,   /* 0x40..0x47 */
+    0x68u, 0x69u, 0x6Au, 0x6Bu, 0x6Cu, 0x6Du, 0x6Eu, 0x6Fu,   /* 0x48..0x4F */
+    0x70u, 0x71u, 0x72u, 0x73u, 0x74u, 0x75u, 0x76u, 0x77u,   /* 0x50..0x57 */
+    0x78u, 0x79u, 0x7Au, 0x5Bu, 0x5Cu, 0x5Du, 0x5Eu, 0x5Fu,   /* 0x58..0x5F */
+    0x60u, 0x61u, 0x62u, 0x63u, 0x64u, 0x65u, 0x66u, 0x67u,   /* 0x60..0x67 */
+    0x68u, 0x69u, 0x6Au, 0x6Bu, 0x6Cu, 0x6Du, 0x6Eu, 0x6Fu,   /* 0x68..0x6F */
+    0x70u, 0x71u, 0x72u, 0x73u, 0x74u, 0x75u, 0x76u, 0x77u,   /* 0x70..0x77 */
+    0x78u, 0x79u, 0x7Au, 0x7Bu, 0x7Cu, 0x7Du, 0x7Eu, 0x7Fu,   /* 0x78..0x7F */
+    0x80u, 0x81u, 0x82u, 0x83u, 0x84u, 0x85u, 0x86u, 0x87u,   /* 0x80..0x87 */
+    0x88u, 0x89u, 0x8Au, 0x8Bu, 0x8Cu, 0x8Du, 0x8Eu, 0x8Fu,   /* 0x88..0x8F */
+    0x90u, 0x91u, 0x92u, 0x93u, 0x94u, 0x95u, 0x96u, 0x97u,   /* 0x90..0x97 */
+    0x98u, 0x99u, 0x9Au, 0x9Bu, 0x9Cu, 0x9Du, 0x9Eu, 0x9Fu,   /* 0x98..0x9F */
+    0xA0u, 0xA1u, 0xA2u, 0xA3u, 0xA4u, 0xA5u, 0xA6u, 0xA7u,   /* 0xA0..0xA7 */
+    0xA8u, 0xA9u, 0xAAu, 0xABu, 0xACu, 0xADu, 0xAEu, 0xAFu,   /* 0xA8..0xAF */
+    0xB0u, 0xB1u, 0xB2u, 0xB3u, 0xB4u, 0xB5u, 0xB6u, 0xB7u,   /* 0xB0..0xB7 */
+    0xB8u, 0xB9u, 0xBAu, 0xBBu, 0xBCu, 0xBDu, 0xBEu, 0xBFu,   /* 0xB8..0xBF */
+    0xC0u, 0xC1u, 0xC2u, 0xC3u, 0xC4u, 0xC5u, 0xC6u, 0xC7u,   /* 0xC0..0xC7 */
+    0xC8u, 0xC9u, 0xCAu, 0xCBu, 0xCCu, 0xCDu, 0xCEu, 0xCFu,   /* 0xC8..0xCF */
+    0xD0u, 0xD1u, 0xD2u, 0xD3u, 0xD4u, 0xD5u, 0xD6u, 0xD7u,   /* 0xD0..0xD7 */
+    0xD8u, 0xD9u, 0xDAu, 0xDBu, 0xDCu, 0xDDu, 0xDEu, 0xDFu,   /* 0xD8..0xDF */
+    0xE0u, 0xE1u, 0xE2u, 0xE3u, 0xE4u, 0xE5u, 0xE6u, 0xE7u,   /* 0xE0..0xE7 */
+    0xE8u, 0xE9u, 0xEAu, 0xEBu, 0xECu, 0xEDu, 0xEEu, 0xEFu,   /* 0xE8..0xEF */
+    0xF0u, 0xF1u, 0xF2u, 0xF3u, 0xF4u, 0xF5u, 0xF6u, 0xF7u,   /* 0xF0..0xF7 */
+    0xF8u, 0xF9u, 0xFAu, 0xFBu, 0xFCu, 0xFDu, 0xFEu, 0xFFu   /* 0xF8..0xFF */
+};
+
+static  const  CPU_INT08U  ASCII_CaseUpperTbl[256] = {
+    0x00u, 0x01u, 0x02u, 0x03u, 0x04u, 0x05u, 0x06u, 0x07u,   /* 0x00..0x07 */
+    0x08u, 0x09u, 0x0Au, 0x0Bu, 0x0Cu, 0x0Du, 0x0Eu, 0x0Fu,   /* 0x08..0x0F */
+    0x10u, 0x11u, 0x12u, 0x13u, 0x14u, 0x15u, 0x16u, 0x17u,   /* 0x10..0x17 */
+    0x18u, 0x19u, 0x1Au, 0x1Bu, 0x1Cu, 0x1Du, 0x1Eu, 0x1Fu,   /* 0x18..0x1F */
+    0x20u, 0x21u, 0x22u, 0x23u, 0x24u, 0x25u, 0x26u, 0x27u,   /* 0x20..0x27 */
+    0x28u, 0x29u, 0x2Au, 0x2Bu, 0x2Cu, 0x2Du, 0x2Eu, 0x2Fu,   /* 0x28..0x2F */
+    0x30u, 0x31u, 0x32u, 0x33u, 0x34u, 0x35u, 0x36u, 0x37u,   /* 0x30..0x37 */
+    0x38u, 0x39u, 0x3Au, 0x3Bu, 0x3Cu, 0x3Du, 0x3Eu, 0x3Fu,   /* 0x38..0x3F */
+    0x40u, 0x41u, 0x42u, 0x43u, 0x44u, 0x45u, 0x46u, 0x47u,   /* 0x40..0x47 */
+    0x48u, 0x49u, 0x4Au, 0x4Bu, 0x4Cu, 0x4Du, 0x4Eu, 0x4Fu,   /* 0x48..0x4F */
+    0x50u, 0x51u, 0x52u, 0x53u, 0x54u, 0x55u, 0x56u, 0x57u,   /* 0x50..0x57 */
+    0x58u, 0x59u, 0x5Au, 0x5Bu, 0x5Cu, 0x5Du, 0x5Eu, 0x5Fu,   /* 0x58..0x5F */
+    0x60u, 0x41u, 0x42u, 0x43u, 0x44u, 0x45u, 0x46u, 0x47u,   /* 0x60..0x67 */
+    0x48u, 0x49u, 0x4Au, 0x4Bu, 0x4Cu, 0x4Du, 0x4Eu, 0x4Fu,   /* 0x68..0x6F */
+    0x50u, 0x51u, 0x52u, 0x53u, 0x54u, 0x55u, 0x56u, 0x57u,   /* 0x70..0x77 */
+    0x58u, 0x59u, 0x5Au, 0x7Bu, 0x7Cu, 0x7Du, 0x7Eu, 0x7Fu,   /* 0x78..0x7F */
+    0x80u, 0x81u, 0x82u, 0x83u, 0x84u, 0x85u, 0x86u, 0x87u,   /* 0x80..0x87 */
+    0x88u, 0x89u, 0x8Au, 0x8Bu, 0x8Cu, 0x8Du, 0x8Eu, 0x8Fu,   /* 0x88..0x8F */
+    0x90u, 0x91u, 0x92u, 0x93u, 0x94u, 0x95u, 0x96u, 0x97u,   /* 0x90..0x97 */
+    0x98u, 0x99u, 0x9Au, 0x9Bu, 0x9Cu, 0x9Du, 0x9Eu, 0x9Fu,   /* 0x98..0x9F */
+    0xA0u, 0xA1u, 0xA2u, 0xA3u, 0xA4u, 0xA5u, 0xA6u, 0xA7u,   /* 0xA0..0xA7 */
+    0xA8u, 0xA9u, 0xAAu, 0xABu, 0xACu, 0xADu, 0xAEu, 0xAFu,   /* 0xA8..0xAF */
+    0xB0u, 0xB1u, 0xB2u, 0xB3u, 0xB4u, 0xB5u, 0xB6u, 0xB7u,   /* 0xB0..0xB7 */
+    0xB8u, 0xB9u, 0xBAu, 0xBBu, 0xBCu, 0xBDu, 0xBEu, 0xBFu,   /* 0xB8..0xBF */
+    0xC0u, 0xC1u, 0xC2u, 0xC3u, 0xC4u, 0xC5u, 0xC6u, 0xC7u,   /* 0xC0..0xC7 */
+    0xC8u, 0xC9u, 0xCAu, 0xCBu, 0xCCu, 0xCDu, 0xCEu, 0xCFu,   /* 0xC8..0xCF */
+    0xD0u, 0xD1u, 0xD2u, 0xD3u, 0xD4u, 0xD5u, 0xD6u, 0xD7u,   /* 0xD0..0xD7 */
+    0xD8u, 0xD9u, 0xDAu, 0xDBu, 0xDCu, 0xDDu, 0xDEu, 0xDFu,   /* 0xD8..0xDF */
+    0xE0u, 0xE1u, 0xE2u, 0xE3u, 0xE4u, 0xE5u, 0xE6u, 0xE7u,   /* 0xE0..0xE7 */
+    0xE8u, 0xE9u, 0xEAu, 0xEBu, 0xECu, 0xEDu, 0xEEu, 0xEFu,   /* 0xE8..0xEF */
+    0xF0u, 0xF1u, 0xF2u, 0xF3u, 0xF4u, 0xF5u, 0xF6u, 0xF7u,   /* 0xF0..0xF7 */
+    0xF8u, 0xF9u, 0xFAu, 0xFBu, 0xFCu, 0xFDu, 0xFEu, 0xFFu   /* 0xF8..0xFF */
+};
+
 
 /*
 *********************************************************************************************************
@@ -156,7 +287,8 @@ CPU_BOOLEAN  ASCII_IsAlpha (CPU_CHAR  c)
     CPU_BOOLEAN  alpha;
 
 
-    alpha = ASCII_IS_ALPHA(c);
+    alpha = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c],
+                            (ASCII_CHAR_CLASS_UPPER | ASCII_CHAR_CLASS_LOWER));
 
     return (alpha);
 }
@@ -186,7 +318,8 @@ CPU_BOOLEAN  ASCII_IsAlphaNum (CPU_CHAR  c)
     CPU_BOOLEAN  alpha_num;
 
 
-    alpha_num = ASCII_IS_ALPHA_NUM(c);
+    alpha_num = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c],
+                            (ASCII_CHAR_CLASS_UPPER | ASCII_CHAR_CLASS_LOWER | ASCII_CHAR_CLASS_DIG));
 
     return (alpha_num);
 }
@@ -217,7 +350,7 @@ CPU_BOOLEAN  ASCII_IsLower (CPU_CHAR  c)
     CPU_BOOLEAN  lower;
 
 
-    lower = ASCII_IS_LOWER(c);
+    lower = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_LOWER);
 
     return (lower);
 }
@@ -247,7 +380,7 @@ CPU_BOOLEAN  ASCII_IsUpper (CPU_CHAR  c)
     CPU_BOOLEAN  upper;
 
 
-    upper = ASCII_IS_UPPER(c);
+    upper = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_UPPER);
 
     return (upper);
 }
@@ -278,7 +411,7 @@ CPU_BOOLEAN  ASCII_IsDig (CPU_CHAR  c)
     CPU_BOOLEAN  dig;
 
 
-    dig = ASCII_IS_DIG(c);
+    dig = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_DIG);
 
     return (dig);
 }
@@ -307,7 +440,7 @@ CPU_BOOLEAN  ASCII_IsDigOct (CPU_CHAR  c)
     CPU_BOOLEAN  dig_oct;
 
 
-    dig_oct = ASCII_IS_DIG_OCT(c);
+    dig_oct = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_DIG_OCT);
 
     return (dig_oct);
 }
@@ -337,7 +470,7 @@ CPU_BOOLEAN  ASCII_IsDigHex (CPU_CHAR  c)
     CPU_BOOLEAN  dig_hex;
 
 
-    dig_hex = ASCII_IS_DIG_HEX(c);
+    dig_hex = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_DIG_HEX);
 
     return (dig_hex);
 }
@@ -371,7 +504,7 @@ CPU_BOOLEAN  ASCII_IsBlank (CPU_CHAR  c)
     CPU_BOOLEAN  blank;
 
 
-    blank = ASCII_IS_BLANK(c);
+    blank = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_BLANK);
 
     return (blank);
 }
@@ -405,7 +538,7 @@ CPU_BOOLEAN  ASCII_IsSpace (CPU_CHAR  c)
     CPU_BOOLEAN  space;
 
 
-    space = ASCII_IS_SPACE(c);
+    space = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_SPACE);
 
     return (space);
 }
@@ -440,7 +573,7 @@ CPU_BOOLEAN  ASCII_IsPrint (CPU_CHAR  c)
     CPU_BOOLEAN  print;
 
 
-    print = ASCII_IS_PRINT(c);
+    print = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_PRINT);
 
     return (print);
 }
@@ -474,7 +607,7 @@ CPU_BOOLEAN  ASCII_IsGraph (CPU_CHAR  c)
     CPU_BOOLEAN  graph;
 
 
-    graph = ASCII_IS_GRAPH(c);
+    graph = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_GRAPH);
 
     return (graph);
 }
@@ -505,7 +638,7 @@ CPU_BOOLEAN  ASCII_IsPunct (CPU_CHAR  c)
     CPU_BOOLEAN  punct;
 
 
-    punct = ASCII_IS_PUNCT(c);
+    punct = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_PUNCT);
 
     return (punct);
 }
@@ -539,7 +672,7 @@ CPU_BOOLEAN  ASCII_IsCtrl (CPU_CHAR  c)
     CPU_BOOLEAN  ctrl;
 
 
-    ctrl = ASCII_IS_CTRL(c);
+    ctrl = DEF_BIT_IS_SET_ANY(ASCII_CharClassTbl[(CPU_INT08U)c], ASCII_CHAR_CLASS_CTRL);
 
     return (ctrl);
 }
@@ -578,7 +711,7 @@ CPU_CHAR  ASCII_ToLower (CPU_CHAR  c)
     CPU_CHAR  lower;
 
 
-    lower = ASCII_TO_LOWER(c);
+    lower = (CPU_CHAR)ASCII_CaseLowerTbl[(CPU_INT08U)c];
 
     return (lower);
 }
@@ -616,7 +749,7 @@ CPU_CHAR  ASCII_ToUpper (CPU_CHAR  c)
     CPU_CHAR  upper;
 
 
-    upper = ASCII_TO_UPPER(c);
+    upper = (CPU_CHAR)ASCII_CaseUpperTbl[(CPU_INT08U)c];
 
     return (upper);
 }
@@ -0,0 +1,280 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                          (c) Copyright 2004-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               uC/LIB is provided in source form to registered licensees ONLY.  It is 
+*               illegal to distribute this source code to any third party unless you receive 
+*               written permission by an authorized Micrium representative.  Knowledge of 
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest 
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     CYCLIC REDUNDANCY CHECKS
+*
+* Filename      : lib_crc.c
+* Version       : V1.35.00
+* Programmer(s) : MB
+*********************************************************************************************************
+* Note(s)       : (1) NO compiler-supplied standard library functions are used in library or product software.
+*
+*                     (a) ALL standard library functions are implemented in the custom library modules :
+*
+*                         (1) \<Custom Library Directory>\lib_*.*
+*
+*                         (2) \<Custom Library Directory>\Ports\<cpu>\<compiler>\lib*_a.*
+*
+*                               where
+*                                       <Custom Library Directory>      directory path for custom library software
+*                                       <cpu>                           directory name for specific processor (CPU)
+*                                       <compiler>                      directory name for specific compiler
+*
+*                     (b) Product-specific library functions are implemented in individual products.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    LIB_CRC_MODULE
+#include  <lib_crc.h>
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*
+* Note(s) : (1) The byte-at-a-time table-driven CRC computes each input octet in a single table look-up, 
+*               a shift & an exclusive-OR, instead of the eight conditional shift/XOR iterations of the 
+*               bit-at-a-time method.  Each 256-entry table is 'const' & therefore placed in flash by 
+*               the PIC32 linker scripts; together they cost 1.5 kB of flash & zero RAM.
+*
+*           (2) (a) 'CRC_CRC16_Tbl[i]' is the CRC-16/CCITT polynomial 0x1021 remainder of the single 
+*                   octet 'i' shifted into the most-significant byte (see 'lib_crc.h  DEFINES  Note #1a').
+*
+*               (b) 'CRC_CRC32_Tbl[i]' is the reflected CRC-32 polynomial 0xEDB88320 remainder of the 
+*                   single octet 'i' (see 'lib_crc.h  DEFINES  Note #1b').
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT16U  CRC_CRC16_Tbl[256] = {               /* See Note #2a.                                        */
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,   /* 0x00..0x07 */
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,   /* 0x08..0x0F */
+    0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,   /* 0x10..0x17 */
+    0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,   /* 0x18..0x1F */
+    0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,   /* 0x20..0x27 */
+    0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,   /* 0x28..0x2F */
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,   /* 0x30..0x37 */
+    0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,   /* 0x38..0x3F */
+    0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,   /* 0x40..0x47 */
+    0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,   /* 0x48..0x4F */
+    0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,   /* 0x50..0x57 */
+    0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,   /* 0x58..0x5F */
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,   /* 0x60..0x67 */
+    0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,   /* 0x68..0x6F */
+    0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,   /* 0x70..0x77 */
+    0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,   /* 0x78..0x7F */
+    0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,   /* 0x80..0x87 */
+    0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,   /* 0x88..0x8F */
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,   /* 0x90..0x97 */
+    0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,   /* 0x98..0x9F */
+    0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,   /* 0xA0..0xA7 */
+    0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,   /* 0xA8..0xAF */
+    0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,   /* 0xB0..0xB7 */
+    0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,   /* 0xB8..0xBF */
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,   /* 0xC0..0xC7 */
+    0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,   /* 0xC8..0xCF */
+    0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,   /* 0xD0..0xD7 */
+    0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,   /* 0xD8..0xDF */
+    0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,   /* 0xE0..0xE7 */
+    0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,   /* 0xE8..0xEF */
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,   /* 0xF0..0xF7 */
+    0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u    /* 0xF8..0xFF */
+};
+
+/*$PAGE*/
+static  const  CPU_INT32U  CRC_CRC32_Tbl[256] = {               /* See Note #2b.                                        */
+    0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu, 0xE963A535u, 0x9E6495A3u,   /* 0x00..0x07 */
+    0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u, 0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u,   /* 0x08..0x0F */
+    0x1DB71064u, 0x6AB020F2u, 0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,   /* 0x10..0x17 */
+    0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u, 0xFA0F3D63u, 0x8D080DF5u,   /* 0x18..0x1F */
+    0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u, 0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu,   /* 0x20..0x27 */
+    0x35B5A8FAu, 0x42B2986Cu, 0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,   /* 0x28..0x2F */
+    0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u, 0xCFBA9599u, 0xB8BDA50Fu,   /* 0x30..0x37 */
+    0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u, 0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du,   /* 0x38..0x3F */
+    0x76DC4190u, 0x01DB7106u, 0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,   /* 0x40..0x47 */
+    0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du, 0x91646C97u, 0xE6635C01u,   /* 0x48..0x4F */
+    0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu, 0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u,   /* 0x50..0x57 */
+    0x65B0D9C6u, 0x12B7E950u, 0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,   /* 0x58..0x5F */
+    0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u, 0xA4D1C46Du, 0xD3D6F4FBu,   /* 0x60..0x67 */
+    0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u, 0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u,   /* 0x68..0x6F */
+    0x5005713Cu, 0x270241AAu, 0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,   /* 0x70..0x77 */
+    0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u, 0xB7BD5C3Bu, 0xC0BA6CADu,   /* 0x78..0x7F */
+    0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au, 0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u,   /* 0x80..0x87 */
+    0xE3630B12u, 0x94643B84u, 0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,   /* 0x88..0x8F */
+    0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu, 0x196C3671u, 0x6E6B06E7u,   /* 0x90..0x97 */
+    0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu, 0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u,   /* 0x98..0x9F */
+    0xD6D6A3E8u, 0xA1D1937Eu, 0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,   /* 0xA0..0xA7 */
+    0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u, 0x316E8EEFu, 0x4669BE79u,   /* 0xA8..0xAF */
+    0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u, 0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu,   /* 0xB0..0xB7 */
+    0xC5BA3BBEu, 0xB2BD0B28u, 0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,   /* 0xB8..0xBF */
+    0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu, 0x72076785u, 0x05005713u,   /* 0xC0..0xC7 */
+    0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u, 0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u,   /* 0xC8..0xCF */
+    0x86D3D2D4u, 0xF1D4E242u, 0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,   /* 0xD0..0xD7 */
+    0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u, 0x616BFFD3u, 0x166CCF45u,   /* 0xD8..0xDF */
+    0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u, 0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu,   /* 0xE0..0xE7 */
+    0xAED16A4Au, 0xD9D65ADCu, 0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,   /* 0xE8..0xEF */
+    0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu,   /* 0xF0..0xF7 */
+    0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u, 0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du    /* 0xF8..0xFF */
+};
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CRC_CRC16_Calc()
+*
+* Description : Calculate or continue a CRC-16/CCITT over a data buffer.
+*
+* Argument(s) : crc         Current CRC value : CRC_CRC16_INIT_VAL         for the first fragment of a 
+*                                                                              frame;
+*                                               previous return value      for each subsequent fragment 
+*                                                                              (see 'lib_crc.h  DEFINES  
+*                                                                              Note #2').
+*
+*               p_data      Pointer to the data buffer.
+*
+*               data_len    Number of octets to include in the CRC.
+*
+* Return(s)   : Updated CRC value.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) One table look-up per octet (see 'LOCAL TABLES  Note #1').
+*********************************************************************************************************
+*/
+
+CPU_INT16U  CRC_CRC16_Calc (CPU_INT16U         crc,
+                            const  void       *p_data,
+                            CPU_SIZE_T         data_len)
+{
+    const  CPU_INT08U  *p_octet;
+
+
+    p_octet = (const CPU_INT08U *)p_data;
+    while (data_len > 0u) {                                     /* See Note #1.                                         */
+        crc = (CPU_INT16U)((crc << 8) ^ CRC_CRC16_Tbl[((crc >> 8) ^ *p_octet) & 0xFFu]);
+        p_octet++;
+        data_len--;
+    }
+
+    return (crc);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CRC_CRC16_Final()
+*
+* Description : Finalize a CRC-16/CCITT value.
+*
+* Argument(s) : crc         CRC value returned by the last CRC_CRC16_Calc() call of a frame.
+*
+* Return(s)   : Final CRC-16/CCITT value.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) CRC-16/CCITT applies no final XOR; this function exists for API symmetry with 
+*                   CRC_CRC32_Final() so frame code can treat both CRCs identically.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  CRC_CRC16_Final (CPU_INT16U  crc)
+{
+    return (crc);                                               /* See Note #1.                                         */
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CRC_CRC32_Calc()
+*
+* Description : Calculate or continue a CRC-32 (IEEE 802.3) over a data buffer.
+*
+* Argument(s) : crc         Current CRC value : CRC_CRC32_INIT_VAL         for the first fragment of a 
+*                                                                              frame;
+*                                               previous return value      for each subsequent fragment 
+*                                                                              (see 'lib_crc.h  DEFINES  
+*                                                                              Note #2').
+*
+*               p_data      Pointer to the data buffer.
+*
+*               data_len    Number of octets to include in the CRC.
+*
+* Return(s)   : Updated CRC value.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) One table look-up per octet (see 'LOCAL TABLES  Note #1').
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CRC_CRC32_Calc (CPU_INT32U         crc,
+                            const  void       *p_data,
+                            CPU_SIZE_T         data_len)
+{
+    const  CPU_INT08U  *p_octet;
+
+
+    p_octet = (const CPU_INT08U *)p_data;
+    while (data_len > 0u) {                                     /* See Note #1.                                         */
+        crc = (crc >> 8) ^ CRC_CRC32_Tbl[(crc ^ *p_octet) & 0xFFu];
+        p_octet++;
+        data_len--;
+    }
+
+    return (crc);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CRC_CRC32_Final()
+*
+* Description : Finalize a CRC-32 (IEEE 802.3) value.
+*
+* Argument(s) : crc         CRC value returned by the last CRC_CRC32_Calc() call of a frame.
+*
+* Return(s)   : Final CRC-32 value.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) CRC-32 complements the remainder on output (see 'lib_crc.h  DEFINES  Note #1b').
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CRC_CRC32_Final (CPU_INT32U  crc)
+{
+    return (crc ^ CRC_CRC32_XOR_OUT_VAL);                       /* See Note #1.                                         */
+}
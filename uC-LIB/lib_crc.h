@@ -0,0 +1,166 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                          (c) Copyright 2004-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               uC/LIB is provided in source form to registered licensees ONLY.  It is 
+*               illegal to distribute this source code to any third party unless you receive 
+*               written permission by an authorized Micrium representative.  Knowledge of 
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest 
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     CYCLIC REDUNDANCY CHECKS
+*
+* Filename      : lib_crc.h
+* Version       : V1.35.00
+* Programmer(s) : MB
+*********************************************************************************************************
+* Note(s)       : (1) NO compiler-supplied standard library functions are used in library or product software.
+*
+*                     (a) ALL standard library functions are implemented in the custom library modules :
+*
+*                         (1) \<Custom Library Directory>\lib_*.*
+*
+*                         (2) \<Custom Library Directory>\Ports\<cpu>\<compiler>\lib*_a.*
+*
+*                               where
+*                                       <Custom Library Directory>      directory path for custom library software
+*                                       <cpu>                           directory name for specific processor (CPU)
+*                                       <compiler>                      directory name for specific compiler
+*
+*                     (b) Product-specific library functions are implemented in individual products.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This CRC library header file is protected from multiple pre-processor inclusion through 
+*               use of the CRC library module present pre-processor macro definition.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_CRC_MODULE_PRESENT                                 /* See Note #1.                                         */
+#define  LIB_CRC_MODULE_PRESENT
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*
+* Note(s) : (1) See 'lib_math.h  INCLUDE FILES' for include file requirements & directory configuration.
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+#include  <lib_def.h>
+
+
+/*
+*********************************************************************************************************
+*                                               EXTERNS
+*********************************************************************************************************
+*/
+
+#ifdef   LIB_CRC_MODULE
+#define  LIB_CRC_EXT
+#else
+#define  LIB_CRC_EXT  extern
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) (a) CRC-16/CCITT-FALSE : polynomial 0x1021, most-significant-bit-first, initial value 
+*                   0xFFFF, no final XOR, no reflection.
+*
+*               (b) CRC-32 (IEEE 802.3) : polynomial 0x04C11DB7 (reflected 0xEDB88320), 
+*                   least-significant-bit-first, initial value 0xFFFFFFFF, final XOR 0xFFFFFFFF.
+*
+*           (2) A CRC is computed over multiple data fragments by seeding the first CRC_CRC16_Calc()/ 
+*               CRC_CRC32_Calc() call with the initial value, seeding each subsequent call with the 
+*               previous call's return value & passing the last call's return value through 
+*               CRC_CRC16_Final()/CRC_CRC32_Final().
+*********************************************************************************************************
+*/
+
+#define  CRC_CRC16_INIT_VAL                           0xFFFFu   /* See Note #1a.                                        */
+
+#define  CRC_CRC32_INIT_VAL                       0xFFFFFFFFu   /* See Note #1b.                                        */
+#define  CRC_CRC32_XOR_OUT_VAL                    0xFFFFFFFFu
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+                                                                /* ----------------- CRC-16/CCITT FNCTS --------------- */
+CPU_INT16U  CRC_CRC16_Calc (CPU_INT16U         crc,
+                            const  void       *p_data,
+                            CPU_SIZE_T         data_len);
+
+CPU_INT16U  CRC_CRC16_Final(CPU_INT16U         crc);
+
+                                                                /* -------------------- CRC-32 FNCTS ------------------ */
+CPU_INT32U  CRC_CRC32_Calc (CPU_INT32U         crc,
+                            const  void       *p_data,
+                            CPU_SIZE_T         data_len);
+
+CPU_INT32U  CRC_CRC32_Final(CPU_INT32U         crc);
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of lib crc module include.                       */
+
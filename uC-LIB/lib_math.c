@@ -280,3 +280,324 @@ RAND_NBR  Math_RandSeed (RAND_NBR  seed)
     return (rand_nbr);
 }
 
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       Math_RandSetSeedLocal()
+*
+* Description : Set a caller-owned pseudo-random number generator seed.
+*
+* Argument(s) : p_seed      Pointer to the caller-owned seed to set.
+*
+*               seed        Initial value to set for the pseudo-random number sequence.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) A zero seed is the fixed point of the xorshift generator (see 'Math_RandSeedLocal()  
+*                   Note #1') & would produce an all-zero sequence; a zero seed is therefore silently 
+*                   replaced by RAND_SEED_INIT_VAL.
+*********************************************************************************************************
+*/
+
+void  Math_RandSetSeedLocal (RAND_NBR  *p_seed,
+                             RAND_NBR   seed)
+{
+    if (seed == 0u) {                                           /* Zero sticks at zero (see Note #1).                   */
+        seed  = (RAND_NBR)RAND_SEED_INIT_VAL;
+    }
+
+   *p_seed = seed;
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        Math_RandSeedLocal()
+*
+* Description : Calculate the next pseudo-random number from a caller-owned seed.
+*
+* Argument(s) : p_seed      Pointer to the caller-owned seed; updated to the returned value.
+*
+* Return(s)   : Next pseudo-random number in the sequence after *'p_seed', in the range [1, 2^32 - 1].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The generator is Marsaglia's xorshift32 (G. Marsaglia, 'Xorshift RNGs', Journal of 
+*                   Statistical Software 8(14), 2003) : three shift-&-xor steps per draw, full period 
+*                   2^32 - 1 over the non-zero 32-bit values, & better statistical quality than the 
+*                   Math_Rand() LCG.
+*
+*               (2) (a) Each caller owns its seed, so -- unlike Math_Rand(), which updates the shared 
+*                       'Math_RandSeedCur' -- NO critical section is needed & concurrent tasks never 
+*                       serialize through interrupt-disable windows.
+*
+*                   (b) The caller MUST NOT share one seed between tasks without its own serialization.
+*********************************************************************************************************
+*/
+
+RAND_NBR  Math_RandSeedLocal (RAND_NBR  *p_seed)
+{
+    RAND_NBR  rand_nbr;
+
+
+    rand_nbr  = *p_seed;
+    if (rand_nbr == 0u) {                                       /* Zero sticks at zero (see Note #1); re-seed.          */
+        rand_nbr  = (RAND_NBR)RAND_SEED_INIT_VAL;
+    }
+
+    rand_nbr ^= (rand_nbr << 13);                               /* Xorshift32 (see Note #1).                            */
+    rand_nbr ^= (rand_nbr >> 17);
+    rand_nbr ^= (rand_nbr <<  5);
+
+   *p_seed    =  rand_nbr;
+
+    return (rand_nbr);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          Math_Q16FromInt()
+*
+* Description : Convert a signed integer into a Q16.16 fixed-point number.
+*
+* Argument(s) : nbr         Integer to convert.
+*
+* Return(s)   : Q16.16 representation of 'nbr', clamped to MATH_Q16_MIN/MATH_Q16_MAX if 'nbr' lies 
+*                   outside the representable range [-32768, 32768).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q16  Math_Q16FromInt (CPU_INT32S  nbr)
+{
+    if (nbr >= (CPU_INT32S) 32768L) {                           /* Clamp to the representable Q16.16 range.             */
+        return ((MATH_Q16)MATH_Q16_MAX);
+    }
+    if (nbr <  (CPU_INT32S)-32768L) {
+        return ((MATH_Q16)MATH_Q16_MIN);
+    }
+
+    return ((MATH_Q16)(nbr << MATH_Q16_FRAC_BITS));
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           Math_Q16ToInt()
+*
+* Description : Convert a Q16.16 fixed-point number into a signed integer, rounded to nearest.
+*
+* Argument(s) : q           Q16.16 number to convert.
+*
+* Return(s)   : 'q' rounded to the nearest integer (halves round toward positive infinity).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) As with the remainder of this module, right shifts of signed operands are assumed 
+*                   to be arithmetic shifts; this holds for MIPS32 & every compiler this library has 
+*                   been ported to.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  Math_Q16ToInt (MATH_Q16  q)
+{
+    if (q > (MATH_Q16)(MATH_Q16_MAX - MATH_Q16_HALF)) {         /* Rounding bias would overflow; result is 32768.       */
+        return ((CPU_INT32S)32768L);
+    }
+
+    return ((CPU_INT32S)((q + MATH_Q16_HALF) >> MATH_Q16_FRAC_BITS));
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            Math_Q16Mul()
+*
+* Description : Multiply two Q16.16 fixed-point numbers.
+*
+* Argument(s) : q_a         First  multiplicand.
+*
+*               q_b         Second multiplicand.
+*
+* Return(s)   : Q16.16 product, saturated to MATH_Q16_MIN/MATH_Q16_MAX on overflow.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The full 64-bit product is formed in a single widening multiply & shifted back 
+*                   down; on the PIC32 this compiles to one MULT plus shifts -- no software 
+*                   floating-point library calls.
+*********************************************************************************************************
+*/
+
+MATH_Q16  Math_Q16Mul (MATH_Q16  q_a,
+                       MATH_Q16  q_b)
+{
+    CPU_INT64S  prod;
+
+
+    prod = ((CPU_INT64S)q_a * (CPU_INT64S)q_b) >> MATH_Q16_FRAC_BITS;   /* See Note #1.                                 */
+
+    if (prod > (CPU_INT64S)MATH_Q16_MAX) {                      /* Saturate on overflow.                                */
+        return ((MATH_Q16)MATH_Q16_MAX);
+    }
+    if (prod < (CPU_INT64S)MATH_Q16_MIN) {
+        return ((MATH_Q16)MATH_Q16_MIN);
+    }
+
+    return ((MATH_Q16)prod);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            Math_Q16Div()
+*
+* Description : Divide two Q16.16 fixed-point numbers.
+*
+* Argument(s) : q_num       Numerator.
+*
+*               q_den       Denominator.
+*
+* Return(s)   : Q16.16 quotient, saturated to MATH_Q16_MIN/MATH_Q16_MAX on overflow or on division 
+*                   by zero (saturation sign follows the numerator's sign).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q16  Math_Q16Div (MATH_Q16  q_num,
+                       MATH_Q16  q_den)
+{
+    CPU_INT64S  quot;
+
+
+    if (q_den == (MATH_Q16)0) {                                 /* Division by zero saturates (no trap on MIPS32).      */
+        if (q_num < (MATH_Q16)0) {
+            return ((MATH_Q16)MATH_Q16_MIN);
+        }
+        return ((MATH_Q16)MATH_Q16_MAX);
+    }
+
+    quot = (((CPU_INT64S)q_num << MATH_Q16_FRAC_BITS) / (CPU_INT64S)q_den);
+
+    if (quot > (CPU_INT64S)MATH_Q16_MAX) {                      /* Saturate on overflow.                                */
+        return ((MATH_Q16)MATH_Q16_MAX);
+    }
+    if (quot < (CPU_INT64S)MATH_Q16_MIN) {
+        return ((MATH_Q16)MATH_Q16_MIN);
+    }
+
+    return ((MATH_Q16)quot);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            Math_Q16Sqrt()
+*
+* Description : Compute the square root of a Q16.16 fixed-point number.
+*
+* Argument(s) : q           Q16.16 number whose square root is desired.
+*
+* Return(s)   : Q16.16 square root of 'q'; 0 if 'q' is negative.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) sqrt(q / 2^16) * 2^16 == sqrt(q * 2^16), so the Q16.16 square root is the integer 
+*                   square root of the argument widened to 48 bits.  The integer square root uses the 
+*                   classic digit-by-digit (binary restoring) method : one conditional subtract & two 
+*                   shifts per result bit, 24 iterations total -- no multiplies, divides or 
+*                   floating-point.
+*********************************************************************************************************
+*/
+
+MATH_Q16  Math_Q16Sqrt (MATH_Q16  q)
+{
+    CPU_INT64U  rem;
+    CPU_INT64U  root;
+    CPU_INT64U  bit;
+
+
+    if (q <= (MATH_Q16)0) {
+        return ((MATH_Q16)0);
+    }
+
+    rem  = (CPU_INT64U)q << MATH_Q16_FRAC_BITS;                 /* See Note #1.                                         */
+    root = (CPU_INT64U)0u;
+    bit  = (CPU_INT64U)1u << 46;                                /* Highest even bit position <= 47 bits.                */
+
+    while (bit > rem) {
+        bit >>= 2;
+    }
+
+    while (bit != (CPU_INT64U)0u) {                             /* Digit-by-digit method (see Note #1).                 */
+        if (rem >= (root + bit)) {
+            rem  -=  root + bit;
+            root  = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return ((MATH_Q16)root);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            Math_Q16Lerp()
+*
+* Description : Linearly interpolate between two Q16.16 fixed-point numbers.
+*
+* Argument(s) : q_a         Value returned when 'q_frac' is 0.
+*
+*               q_b         Value returned when 'q_frac' is MATH_Q16_ONE.
+*
+*               q_frac      Interpolation fraction; values outside [0, MATH_Q16_ONE] extrapolate.
+*
+* Return(s)   : q_a + (q_b - q_a) * q_frac, saturated to MATH_Q16_MIN/MATH_Q16_MAX on overflow.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The difference & product are formed in 64 bits so that operands of opposite sign 
+*                   (whose difference overflows 32 bits) interpolate correctly.
+*********************************************************************************************************
+*/
+
+MATH_Q16  Math_Q16Lerp (MATH_Q16  q_a,
+                        MATH_Q16  q_b,
+                        MATH_Q16  q_frac)
+{
+    CPU_INT64S  diff;
+    CPU_INT64S  res;
+
+
+    diff = (CPU_INT64S)q_b - (CPU_INT64S)q_a;                   /* See Note #1.                                         */
+    res  = (CPU_INT64S)q_a + ((diff * (CPU_INT64S)q_frac) >> MATH_Q16_FRAC_BITS);
+
+    if (res > (CPU_INT64S)MATH_Q16_MAX) {                       /* Saturate on overflow.                                */
+        return ((MATH_Q16)MATH_Q16_MAX);
+    }
+    if (res < (CPU_INT64S)MATH_Q16_MIN) {
+        return ((MATH_Q16)MATH_Q16_MIN);
+    }
+
+    return ((MATH_Q16)res);
+}
@@ -171,6 +171,24 @@
 #define  RAND_LCG_PARAM_B                              12345u   /* See Note #1b1A3.                                     */
 
 
+/*
+*********************************************************************************************************
+*                                     FIXED-POINT Q16.16 DEFINES
+*
+* Note(s) : (1) Q16.16 fixed-point numbers store a real value scaled by 2^16 in a signed 32-bit
+*               integer :  16 integer bits (range [-32768, 32768)) & 16 fractional bits
+*               (resolution 1/65536).
+*********************************************************************************************************
+*/
+
+#define  MATH_Q16_FRAC_BITS                               16u   /* Nbr of fractional bits (see Note #1).                */
+
+#define  MATH_Q16_ONE                (MATH_Q16)(0x00010000L)    /* 1.0     in Q16.16.                                   */
+#define  MATH_Q16_HALF               (MATH_Q16)(0x00008000L)    /* 0.5     in Q16.16.                                   */
+#define  MATH_Q16_MAX                (MATH_Q16)(0x7FFFFFFFL)    /* Largest  representable value (~ 32767.99998).        */
+#define  MATH_Q16_MIN                (MATH_Q16)(0x80000000L)    /* Smallest representable value (  -32768.0    ).       */
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -187,6 +205,17 @@
 typedef  CPU_INT32U  RAND_NBR;
 
 
+/*
+*********************************************************************************************************
+*                                    FIXED-POINT Q16.16 DATA TYPE
+*
+* Note(s) : (1) See 'FIXED-POINT Q16.16 DEFINES  Note #1'.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT32S  MATH_Q16;
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -209,6 +238,28 @@ RAND_NBR  Math_Rand       (void);
 
 RAND_NBR  Math_RandSeed   (RAND_NBR  seed);
 
+void      Math_RandSetSeedLocal(RAND_NBR  *p_seed,              /* Caller-owned xorshift32 seed; no critical sections.  */
+                                RAND_NBR   seed);
+
+RAND_NBR  Math_RandSeedLocal   (RAND_NBR  *p_seed);
+
+                                                                /* --------------- FIXED-POINT Q16.16 FNCTS ----------- */
+MATH_Q16    Math_Q16FromInt(CPU_INT32S  nbr);
+
+CPU_INT32S  Math_Q16ToInt  (MATH_Q16    q);
+
+MATH_Q16    Math_Q16Mul    (MATH_Q16    q_a,
+                            MATH_Q16    q_b);
+
+MATH_Q16    Math_Q16Div    (MATH_Q16    q_num,
+                            MATH_Q16    q_den);
+
+MATH_Q16    Math_Q16Sqrt   (MATH_Q16    q);
+
+MATH_Q16    Math_Q16Lerp   (MATH_Q16    q_a,
+                            MATH_Q16    q_b,
+                            MATH_Q16    q_frac);
+
 
 /*$PAGE*/
 /*
@@ -64,6 +64,12 @@
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)                               /* See 'Mem_HeapAllocEx()  Note #2'.            */
+#define  LIB_MEM_HEAP_CLASS_SIZE_MIN_LOG2                  3u
+#define  LIB_MEM_HEAP_CLASS_SIZE_MIN  ((CPU_SIZE_T)DEF_BIT(LIB_MEM_HEAP_CLASS_SIZE_MIN_LOG2))
+#define  LIB_MEM_HEAP_CLASS_NBR                           13u
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -99,6 +105,8 @@ MEM_POOL     Mem_PoolHeap;                                              /* Mem h
 #ifndef  LIB_MEM_CFG_HEAP_BASE_ADDR
 CPU_INT08U   Mem_Heap[LIB_MEM_CFG_HEAP_SIZE];                           /* Mem heap.                                    */
 #endif
+
+static  void  *Mem_HeapFreeListTbl[LIB_MEM_HEAP_CLASS_NBR];             /* Segregated free lists, one per size class.   */
 #endif
 
 
@@ -159,7 +167,8 @@ static  void         *Mem_PoolSegAlloc      (MEM_POOL    *pmem_pool,
 void  Mem_Init (void)
 {
 #if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
-    MEM_POOL  *pmem_pool;
+    MEM_POOL    *pmem_pool;
+    CPU_SIZE_T   i;
 
                                                                         /* --------- INIT MEM HEAP SEG / POOL --------- */
     pmem_pool                   = (MEM_POOL   *)&Mem_PoolHeap;
@@ -174,6 +183,8 @@ void  Mem_Init (void)
     pmem_pool->BlkSize          = (CPU_SIZE_T  ) 0u;
     pmem_pool->BlkNbr           = (CPU_SIZE_T  ) 0u;
     pmem_pool->BlkIx            = (MEM_POOL_IX ) 0u;
+    pmem_pool->BlkNbrUsedMax    = (CPU_SIZE_T  ) 0u;
+    pmem_pool->AllocFailCtr     = (CPU_SIZE_T  ) 0u;
 
 #ifdef  LIB_MEM_CFG_HEAP_BASE_ADDR
     pmem_pool->SegAddr          = (void       *) LIB_MEM_CFG_HEAP_BASE_ADDR;
@@ -188,6 +199,11 @@ void  Mem_Init (void)
 
                                                                         /* ------------ INIT MEM POOL TBL ------------- */
     Mem_PoolTbl = &Mem_PoolHeap;
+
+                                                                        /* --------- INIT HEAP FREE LIST TBL ---------- */
+    for (i = 0u; i < LIB_MEM_HEAP_CLASS_NBR; i++) {
+        Mem_HeapFreeListTbl[i] = (void *)0;
+    }
 #endif
 }
 
@@ -259,6 +275,7 @@ void  Mem_Clr (void        *pmem,
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_OPTIMIZE_ASM_EN != DEF_ENABLED)
 void  Mem_Set (void        *pmem,
                CPU_INT08U   data_val,
                CPU_SIZE_T   size)
@@ -311,6 +328,7 @@ void  Mem_Set (void        *pmem,
         size_rem   -= sizeof(CPU_INT08U);
     }
 }
+#endif
 
 
 /*$PAGE*/
@@ -434,6 +452,119 @@ void  Mem_Copy (       void        *pdest,
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             Mem_Move()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer, with full support for
+*               overlapping memory buffers.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of data buffer octets to copy (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Null moves allowed (i.e. zero-length moves).
+*
+*               (2) Since Mem_Copy() already copies correctly whenever the source memory buffer is at a
+*                   higher address value than the destination memory buffer (see 'Mem_Copy()  Note #2b'),
+*                   Mem_Move() delegates that direction -- & all non-overlapping moves -- to Mem_Copy(),
+*                   inheriting its 'CPU_ALIGN'-sized-word &/or assembly-optimized copy loops.
+*
+*                   Only a destination memory buffer that starts INSIDE the source memory buffer
+*                   requires the copy to run from the end of the memory buffers towards their start, so
+*                   that data octets are read before they are overwritten.
+*
+*               (3) For best CPU performance, the backward copy is also optimized to copy data buffer
+*                   using 'CPU_ALIGN'-sized data words (see 'Mem_Copy()  Note #3').
+*
+*               (4) Modulo arithmetic is used to determine whether a memory buffer ends on a 'CPU_ALIGN'
+*                   address boundary (see 'Mem_Copy()  Note #4').
+*********************************************************************************************************
+*/
+/*$PAGE*/
+void  Mem_Move (       void        *pdest,
+                const  void        *psrc,
+                       CPU_SIZE_T   size)
+{
+           CPU_SIZE_T    size_rem;
+           CPU_ALIGN    *pmem_align_dest;
+    const  CPU_ALIGN    *pmem_align_src;
+           CPU_INT08U   *pmem_08_dest;
+    const  CPU_INT08U   *pmem_08_src;
+           CPU_INT08U    mem_align_modulo_dest;
+           CPU_INT08U    mem_align_modulo_src;
+           CPU_BOOLEAN   mem_aligned;
+
+
+    if (size < 1) {                                             /* See Note #1.                                         */
+        return;
+    }
+    if (pdest == (void *)0) {
+        return;
+    }
+    if (psrc  == (void *)0) {
+        return;
+    }
+
+    pmem_08_src = (const CPU_INT08U *)psrc;
+    pmem_08_dest = (     CPU_INT08U *)pdest;
+    if ((pmem_08_dest <= pmem_08_src) ||                        /* Fwd copy safe unless pdest starts inside psrc ...    */
+        (pmem_08_dest >= (pmem_08_src + size))) {               /* ... (see Note #2).                                   */
+        Mem_Copy(pdest, psrc, size);
+        return;
+    }
+
+
+    size_rem              =  size;
+                                                                /* Copy bwd, starting @ end of mem bufs (see Note #2).  */
+    pmem_08_dest         += size;
+    pmem_08_src          += size;
+                                                                /* See Note #4.                                         */
+    mem_align_modulo_dest = (CPU_INT08U)((CPU_ADDR)pmem_08_dest % sizeof(CPU_ALIGN));
+    mem_align_modulo_src  = (CPU_INT08U)((CPU_ADDR)pmem_08_src  % sizeof(CPU_ALIGN));
+
+    mem_aligned           = (mem_align_modulo_dest == mem_align_modulo_src) ? DEF_YES : DEF_NO;
+
+    if (mem_aligned == DEF_YES) {                               /* If mem bufs' alignment offset equal, ...             */
+                                                                /* ... optimize copy for mem buf alignment.             */
+        while ((size_rem              >  0) &&                  /* Start mem buf copy with trailing octets    ...       */
+               (mem_align_modulo_dest >  0u)) {                 /* ... until prev CPU_ALIGN word boundary.              */
+            pmem_08_dest--;
+            pmem_08_src--;
+           *pmem_08_dest           = *pmem_08_src;
+            size_rem              -=  sizeof(CPU_INT08U);
+            mem_align_modulo_dest--;
+        }
+
+        pmem_align_dest = (      CPU_ALIGN *)pmem_08_dest;      /* See Note #3.                                         */
+        pmem_align_src  = (const CPU_ALIGN *)pmem_08_src;
+        while (size_rem >= sizeof(CPU_ALIGN)) {                 /* While mem bufs aligned on CPU_ALIGN word boundaries, */
+            pmem_align_dest--;
+            pmem_align_src--;
+           *pmem_align_dest = *pmem_align_src;                  /* ... copy psrc to pdest with CPU_ALIGN-sized words.   */
+            size_rem       -=  sizeof(CPU_ALIGN);
+        }
+
+        pmem_08_dest = (      CPU_INT08U *)pmem_align_dest;
+        pmem_08_src  = (const CPU_INT08U *)pmem_align_src;
+    }
+
+    while (size_rem > 0) {                                      /* For unaligned mem bufs or leading octets,  ...       */
+        pmem_08_dest--;
+        pmem_08_src--;
+       *pmem_08_dest = *pmem_08_src;                            /* ... copy psrc to pdest by octets.                    */
+        size_rem    -=  sizeof(CPU_INT08U);
+    }
+}
+
+
 
 /*$PAGE*/
 /*
@@ -566,6 +697,122 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
 }
 
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            Mem_CmpDiff()
+*
+* Description : Locate the first difference between two memory buffers.
+*
+* Argument(s) : p1_mem      Pointer to first  memory buffer.
+*
+*               p2_mem      Pointer to second memory buffer.
+*
+*               size        Number of data buffer octets to compare (see Note #1).
+*
+* Return(s)   : Offset, from the start of the memory buffers, of the first differing data octet, if 
+*                   any data octet(s) differ;
+*
+*               0,      if either memory buffer pointer is passed a NULL pointer;
+*
+*              'size',  if ALL 'size' data octets are identical.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Null compares allowed (i.e. zero-length compares); 'size' (i.e. 0) returned to 
+*                   indicate identical null compare.
+*
+*               (2) Unlike Mem_Cmp(), the comparison starts from the BEGINNING of the memory buffers 
+*                   (cp. 'Mem_Cmp()  Note #2') since callers -- e.g. frame buffer diffs -- resume 
+*                   processing at the returned offset.
+*
+*               (3) For best CPU performance, optimized to compare data buffers using 'CPU_ALIGN'-sized 
+*                   data words (see 'Mem_Cmp()  Notes #3 & #4'); the word that compares unequal is 
+*                   re-scanned octet-wise to locate the exact differing octet.
+*********************************************************************************************************
+*/
+/*$PAGE*/
+CPU_SIZE_T  Mem_CmpDiff (const  void        *p1_mem,
+                         const  void        *p2_mem,
+                                CPU_SIZE_T   size)
+{
+           CPU_SIZE_T    ix;
+    const  CPU_ALIGN    *p1_mem_align;
+    const  CPU_ALIGN    *p2_mem_align;
+    const  CPU_INT08U   *p1_mem_08;
+    const  CPU_INT08U   *p2_mem_08;
+           CPU_INT08U    i;
+           CPU_INT08U    mem_align_modulo_1;
+           CPU_INT08U    mem_align_modulo_2;
+           CPU_BOOLEAN   mem_aligned;
+
+
+    if (size < 1) {                                             /* See Note #1.                                         */
+        return (size);
+    }
+    if (p1_mem == (void *)0) {
+        return ((CPU_SIZE_T)0u);
+    }
+    if (p2_mem == (void *)0) {
+        return ((CPU_SIZE_T)0u);
+    }
+
+
+    ix                 = (CPU_SIZE_T)0u;
+                                                                /* Start @ beginning of mem bufs (see Note #2).         */
+    p1_mem_08          = (const CPU_INT08U *)p1_mem;
+    p2_mem_08          = (const CPU_INT08U *)p2_mem;
+                                                                /* See 'Mem_Cmp()  Note #4'.                            */
+    mem_align_modulo_1 = (CPU_INT08U)((CPU_ADDR)p1_mem_08 % sizeof(CPU_ALIGN));
+    mem_align_modulo_2 = (CPU_INT08U)((CPU_ADDR)p2_mem_08 % sizeof(CPU_ALIGN));
+
+    mem_aligned        = (mem_align_modulo_1 == mem_align_modulo_2) ? DEF_YES : DEF_NO;
+
+    if (mem_aligned == DEF_YES) {                               /* If mem bufs' alignment offset equal, ...             */
+                                                                /* ... optimize cmp for mem buf alignment.              */
+        if (mem_align_modulo_1 != 0u) {                         /* If leading octets avail,                   ...       */
+            i = sizeof(CPU_ALIGN) - mem_align_modulo_1;
+            while ((ix < size) &&                               /* ... cmp leading octets                     ...       */
+                   (i  > 0u)) {                                 /* ... until next CPU_ALIGN word boundary.              */
+                if (*p1_mem_08 != *p2_mem_08) {                 /* If ANY data octet(s) NOT identical, rtn offset.      */
+                    return (ix);
+                }
+                p1_mem_08++;
+                p2_mem_08++;
+                ix += sizeof(CPU_INT08U);
+                i--;
+            }
+        }
+
+        p1_mem_align = (const CPU_ALIGN *)p1_mem_08;            /* Cmp aligned mem bufs (see 'Mem_Cmp()  Note #3a').    */
+        p2_mem_align = (const CPU_ALIGN *)p2_mem_08;
+
+        while ((ix + sizeof(CPU_ALIGN)) <= size) {
+            if (*p1_mem_align != *p2_mem_align) {               /* 1st differing word located octet-wise (see Note #3). */
+                break;
+            }
+            p1_mem_align++;
+            p2_mem_align++;
+            ix += sizeof(CPU_ALIGN);
+        }
+
+        p1_mem_08 = (const CPU_INT08U *)p1_mem_align;
+        p2_mem_08 = (const CPU_INT08U *)p2_mem_align;
+    }
+
+    while (ix < size) {                                         /* Cmp unaligned mem bufs or trailing octets.           */
+        if (*p1_mem_08 != *p2_mem_08) {                         /* If ANY data octet(s) NOT identical, rtn offset.      */
+            return (ix);
+        }
+        p1_mem_08++;
+        p2_mem_08++;
+        ix += sizeof(CPU_INT08U);
+    }
+
+    return (size);                                              /* Mem bufs identical.                                  */
+}
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -659,6 +906,7 @@ void  *Mem_HeapAlloc (CPU_SIZE_T   size,
                                        align);
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (size_req < 1) {                                             /* If req'd size ovf, ...                           */
+        pmem_pool_heap->AllocFailCtr++;
         CPU_CRITICAL_EXIT();
        *poctets_reqd = size;                                        /* ... rtn add'l heap size needed.                  */
        *perr         = LIB_MEM_ERR_HEAP_OVF;
@@ -667,6 +915,7 @@ void  *Mem_HeapAlloc (CPU_SIZE_T   size,
 #endif
 
     if (size_req > size_rem) {                                      /* If req'd size > rem heap size, ...               */
+        pmem_pool_heap->AllocFailCtr++;
         CPU_CRITICAL_EXIT();
        *poctets_reqd = size_req - size_rem;                         /* ... rtn add'l heap size needed.                  */
        *perr         = LIB_MEM_ERR_HEAP_EMPTY;
@@ -690,6 +939,192 @@ void  *Mem_HeapAlloc (CPU_SIZE_T   size,
 #endif
 
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          Mem_HeapAllocEx()
+*
+* Description : Allocate a memory block from the heap that MAY later be returned with Mem_HeapFree().
+*
+* Argument(s) : size            Number of octets to allocate (see Note #1).
+*
+*               poctets_reqd    Optional pointer to a variable to ... :
+*
+*                                   (a) Return the number of octets required to successfully
+*                                           allocate the memory block, if any error(s);
+*                                   (b) Return 0, otherwise.
+*
+*               perr            Pointer to variable that will receive the return error code from this
+*                               function :
+*
+*                                   LIB_MEM_ERR_NONE                Memory block successfully allocated.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory size.
+*                                   LIB_MEM_ERR_HEAP_OVF            Size exceeds the largest size class.
+*                                   LIB_MEM_ERR_HEAP_EMPTY          NO memory available from heap.
+*
+* Return(s)   : Pointer to memory block, if NO error(s).
+*
+*               Pointer to NULL,         otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Unlike Mem_HeapAlloc(), whose blocks are carved from the heap segment permanently,
+*                   blocks allocated by Mem_HeapAllocEx() MAY be returned with Mem_HeapFree() & re-used
+*                   by later allocations, so transient buffers can share heap memory instead of each
+*                   being statically sized for its worst case.
+*
+*               (2) Freed blocks are kept on segregated free lists, one per power-of-2 size class
+*                   between 'LIB_MEM_HEAP_CLASS_SIZE_MIN' & 'LIB_MEM_HEAP_CLASS_SIZE_MIN' left-shifted
+*                   ('LIB_MEM_HEAP_CLASS_NBR' - 1) bits :
+*
+*                   (a) Allocation rounds the requested size up to the next size class & pops that
+*                       class's free list; only if the list is empty is a new block carved from the
+*                       heap segment via Mem_HeapAlloc().  Both paths -- & Mem_HeapFree()'s push --
+*                       run in constant time (the size class is found with CPU_CntLeadZeros()), so
+*                       the allocator is suitable for use on real-time task paths.
+*
+*                   (b) Freed blocks are NEVER split or coalesced; a block returns to the free list
+*                       of the class it was allocated from.  This bounds internal fragmentation to
+*                       the class rounding (< 2x) & avoids the boundary-tag walks of a coalescing
+*                       allocator, keeping the worst case to a few instructions.
+*
+*                   (c) Each block is prefixed by one 'CPU_ALIGN' header word holding its size class
+*                       index; the returned pointer therefore remains 'CPU_ALIGN'-aligned.  While a
+*                       block is on a free list, its first data word links to the next free block.
+*********************************************************************************************************
+*/
+/*$PAGE*/
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
+void  *Mem_HeapAllocEx (CPU_SIZE_T   size,
+                        CPU_SIZE_T  *poctets_reqd,
+                        LIB_ERR     *perr)
+{
+    CPU_ALIGN   *pmem_hdr;
+    void        *pmem_blk;
+    CPU_SIZE_T   size_class;
+    CPU_DATA     class_ix;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                     /* ------------- VALIDATE RTN ERR PTR ------------- */
+    if (perr == (LIB_ERR *)0) {
+        CPU_SW_EXCEPTION((void *)0);
+    }
+
+    if (size < 1) {
+       *perr = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return ((void *)0);
+    }
+#endif
+
+                                                                    /* Calc size class (see Note #2a).                  */
+    if (size <= LIB_MEM_HEAP_CLASS_SIZE_MIN) {
+        class_ix = 0u;
+    } else {
+        class_ix = (CPU_DATA)(CPU_CFG_DATA_SIZE * DEF_OCTET_NBR_BITS)
+                 -  CPU_CntLeadZeros((CPU_DATA)(size - 1u))
+                 - (CPU_DATA)LIB_MEM_HEAP_CLASS_SIZE_MIN_LOG2;
+    }
+    if (class_ix >= LIB_MEM_HEAP_CLASS_NBR) {                       /* Size exceeds the largest size class?             */
+        if (poctets_reqd != (CPU_SIZE_T *)0) {
+           *poctets_reqd  = size;
+        }
+       *perr = LIB_MEM_ERR_HEAP_OVF;
+        return ((void *)0);
+    }
+
+    CPU_CRITICAL_ENTER();
+    pmem_blk = Mem_HeapFreeListTbl[class_ix];
+    if (pmem_blk != (void *)0) {                                    /* Re-use a freed blk of the same class, ...        */
+        Mem_HeapFreeListTbl[class_ix] = *(void **)pmem_blk;
+        CPU_CRITICAL_EXIT();
+       *perr = LIB_MEM_ERR_NONE;
+        return (pmem_blk);
+    }
+    CPU_CRITICAL_EXIT();
+
+    size_class = LIB_MEM_HEAP_CLASS_SIZE_MIN << class_ix;           /* ... else carve a new blk from the heap seg.      */
+    pmem_hdr   = (CPU_ALIGN *)Mem_HeapAlloc(size_class + sizeof(CPU_ALIGN),
+                                            sizeof(CPU_ALIGN),
+                                            poctets_reqd,
+                                            perr);
+    if (pmem_hdr == (CPU_ALIGN *)0) {
+        return ((void *)0);
+    }
+
+   *pmem_hdr = (CPU_ALIGN)class_ix;                                 /* See Note #2c.                                    */
+
+    return ((void *)&pmem_hdr[1]);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            Mem_HeapFree()
+*
+* Description : Free a memory block allocated by Mem_HeapAllocEx(), making it available to later
+*               Mem_HeapAllocEx() calls of the same size class.
+*
+* Argument(s) : pmem_blk    Pointer to memory block to free (MUST have been returned by
+*                               Mem_HeapAllocEx(); see Note #1).
+*
+*               perr        Pointer to variable that will receive the return error code from this
+*                           function :
+*
+*                               LIB_MEM_ERR_NONE                Memory block successfully freed.
+*                               LIB_MEM_ERR_NULL_PTR            'pmem_blk' passed a NULL pointer.
+*                               LIB_MEM_ERR_HEAP_BLK_INVALID    Block's size class header corrupt or
+*                                                                   block NOT from Mem_HeapAllocEx().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Blocks allocated by Mem_HeapAlloc() MUST NOT be passed to Mem_HeapFree(); they
+*                   carry no size class header & remain allocated for the lifetime of the system.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
+void  Mem_HeapFree (void     *pmem_blk,
+                    LIB_ERR  *perr)
+{
+    CPU_ALIGN  *pmem_hdr;
+    CPU_DATA    class_ix;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                     /* ------------- VALIDATE RTN ERR PTR ------------- */
+    if (perr == (LIB_ERR *)0) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (pmem_blk == (void *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    pmem_hdr = &((CPU_ALIGN *)pmem_blk)[-1];                        /* See 'Mem_HeapAllocEx()  Note #2c'.               */
+    class_ix = (CPU_DATA)*pmem_hdr;
+    if (class_ix >= LIB_MEM_HEAP_CLASS_NBR) {
+       *perr = LIB_MEM_ERR_HEAP_BLK_INVALID;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+   *(void **)pmem_blk             = Mem_HeapFreeListTbl[class_ix];  /* Push blk onto its class's free list.             */
+    Mem_HeapFreeListTbl[class_ix] = pmem_blk;
+    CPU_CRITICAL_EXIT();
+
+   *perr = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -751,6 +1186,8 @@ void  Mem_PoolClr (MEM_POOL  *pmem_pool,
     pmem_pool->BlkSize          = (CPU_SIZE_T  )0u;
     pmem_pool->BlkNbr           = (CPU_SIZE_T  )0u;
     pmem_pool->BlkIx            = (MEM_POOL_IX )0u;
+    pmem_pool->BlkNbrUsedMax    = (CPU_SIZE_T  )0u;
+    pmem_pool->AllocFailCtr     = (CPU_SIZE_T  )0u;
     pmem_pool->SegAddr          = (void       *)0;
     pmem_pool->SegAddrNextAvail = (void       *)0;
     pmem_pool->SegSizeTot       = (CPU_SIZE_T  )0u;
@@ -1260,6 +1697,8 @@ void  Mem_PoolCreate (MEM_POOL    *pmem_pool,
     pmem_pool->BlkSize       = (CPU_SIZE_T  ) blk_size;
     pmem_pool->BlkNbr        = (CPU_SIZE_T  ) blk_nbr;
     pmem_pool->BlkIx         = (MEM_POOL_IX ) blk_nbr;
+    pmem_pool->BlkNbrUsedMax = (CPU_SIZE_T  ) 0u;
+    pmem_pool->AllocFailCtr  = (CPU_SIZE_T  ) 0u;
 
 
     CPU_CRITICAL_EXIT();
@@ -1347,6 +1786,7 @@ void  *Mem_PoolBlkGet (MEM_POOL    *pmem_pool,
    (void)&size;                                                     /* Prevent possible 'variable unused' warning.      */
 
     if (pmem_pool->BlkIx < 1) {                                     /* Validate mem pool as NOT empty.                  */
+        pmem_pool->AllocFailCtr++;
         CPU_CRITICAL_EXIT();
        *perr = LIB_MEM_ERR_POOL_EMPTY;
         return ((void *)0);
@@ -1362,6 +1802,10 @@ void  *Mem_PoolBlkGet (MEM_POOL    *pmem_pool,
     pmem_pool->BlkIx--;
     pmem_blk = pmem_pool->PoolPtrs[pmem_pool->BlkIx];
 
+    if ((pmem_pool->BlkNbr - pmem_pool->BlkIx) > pmem_pool->BlkNbrUsedMax) {
+        pmem_pool->BlkNbrUsedMax = pmem_pool->BlkNbr - pmem_pool->BlkIx;    /* Track the peak nbr of blks in use.       */
+    }
+
     CPU_CRITICAL_EXIT();
 
    *perr =  LIB_MEM_ERR_NONE;
@@ -1476,6 +1920,369 @@ void  Mem_PoolBlkFree (MEM_POOL  *pmem_pool,
 #endif
 
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          Mem_PoolCacheInit()
+*
+* Description : Initialize a memory pool cache 'magazine' over an existing memory pool.
+*
+* Argument(s) : pmem_cache  Pointer to memory pool cache to initialize.
+*
+*               pmem_pool   Pointer to the memory pool backing the cache (MUST already have been
+*                               created with Mem_PoolCreate()).
+*
+*               nbr_blks    Magazine size; number of blocks the cache may hold locally
+*                               (1 to LIB_MEM_POOL_CACHE_SIZE_MAX).
+*
+*               perr        Pointer to variable that will receive the return error code from this
+*                           function :
+*
+*                               LIB_MEM_ERR_NONE                Memory pool cache initialized.
+*                               LIB_MEM_ERR_NULL_PTR            Pointer argument(s) passed NULL pointer.
+*                               LIB_MEM_ERR_INVALID_POOL        Invalid memory pool type.
+*                               LIB_MEM_ERR_INVALID_BLK_NBR     Invalid magazine size.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The cache starts empty; the first Mem_PoolCacheBlkGet() refills it from the pool.
+*
+*               (2) Each cache MUST be used by a single task ONLY (see 'MEM_POOL_CACHE  Note #2').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
+void  Mem_PoolCacheInit (MEM_POOL_CACHE  *pmem_cache,
+                         MEM_POOL        *pmem_pool,
+                         MEM_POOL_IX      nbr_blks,
+                         LIB_ERR         *perr)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                     /* ------------- VALIDATE RTN ERR PTR ------------- */
+    if (perr == (LIB_ERR *)0) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (pmem_cache == (MEM_POOL_CACHE *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (pmem_pool == (MEM_POOL *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (pmem_pool->Type != LIB_MEM_TYPE_POOL) {                     /* Validate mem pool type.                          */
+       *perr = LIB_MEM_ERR_INVALID_POOL;
+        return;
+    }
+
+    if ((nbr_blks < 1) ||
+        (nbr_blks > (MEM_POOL_IX)LIB_MEM_POOL_CACHE_SIZE_MAX)) {    /* Validate magazine size.                          */
+       *perr = LIB_MEM_ERR_INVALID_BLK_NBR;
+        return;
+    }
+#endif
+
+    pmem_cache->PoolPtr   = pmem_pool;
+    pmem_cache->BlkNbr    = 0u;                                     /* Cache starts empty (see Note #1).                */
+    pmem_cache->BlkNbrMax = nbr_blks;
+
+   *perr = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        Mem_PoolCacheBlkGet()
+*
+* Description : Get a memory block from a memory pool cache, refilling the magazine from the shared
+*               pool in a single batch when the cache is empty.
+*
+* Argument(s) : pmem_cache  Pointer to memory pool cache.
+*
+*               size        Size of requested memory (in octets).
+*
+*               perr        Pointer to variable that will receive the return error code from this
+*                           function :
+*
+*                               LIB_MEM_ERR_NONE                Memory block successfully returned.
+*                               LIB_MEM_ERR_NULL_PTR            'pmem_cache' passed a NULL pointer.
+*                               LIB_MEM_ERR_INVALID_BLK_SIZE    Invalid memory block size.
+*                               LIB_MEM_ERR_POOL_EMPTY          Pool & cache empty; NO blocks available.
+*
+* Return(s)   : Pointer to memory block, if NO error(s).
+*
+*               Pointer to NULL,         otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Since the cache is owned by a single task (see 'MEM_POOL_CACHE  Note #2'), the
+*                   cache-local pop requires NO critical section.
+*
+*               (2) When the cache is empty, up to 'BlkNbrMax' blocks are taken from the shared pool
+*                   under ONE critical section, so the critical-section frequency on the allocation
+*                   hot path drops by the magazine size factor compared to Mem_PoolBlkGet().
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
+void  *Mem_PoolCacheBlkGet (MEM_POOL_CACHE  *pmem_cache,
+                            CPU_SIZE_T       size,
+                            LIB_ERR         *perr)
+{
+    MEM_POOL     *pmem_pool;
+    MEM_POOL_IX   nbr_refill;
+    MEM_POOL_IX   i;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                     /* ------------- VALIDATE RTN ERR PTR ------------- */
+    if (perr == (LIB_ERR *)0) {
+        CPU_SW_EXCEPTION((void *)0);
+    }
+
+    if (pmem_cache == (MEM_POOL_CACHE *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return ((void *)0);
+    }
+
+    if (size < 1) {                                                 /* Validate req'd size as non-NULL.                 */
+       *perr = LIB_MEM_ERR_INVALID_BLK_SIZE;
+        return ((void *)0);
+    }
+
+    if (size > pmem_cache->PoolPtr->BlkSize) {                      /* Validate req'd size <= mem pool blk size.        */
+       *perr = LIB_MEM_ERR_INVALID_BLK_SIZE;
+        return ((void *)0);
+    }
+#endif
+
+   (void)&size;                                                     /* Prevent possible 'variable unused' warning.      */
+
+    if (pmem_cache->BlkNbr < 1) {                                   /* Cache empty; batch-refill from the shared pool.  */
+        pmem_pool = pmem_cache->PoolPtr;
+
+        CPU_CRITICAL_ENTER();
+        nbr_refill = pmem_cache->BlkNbrMax;
+        if ((CPU_SIZE_T)nbr_refill > pmem_pool->BlkNbr) {
+            nbr_refill = (MEM_POOL_IX)pmem_pool->BlkNbr;
+        }
+        if (nbr_refill > pmem_pool->BlkIx) {                        /* Take NO more blks than the pool holds.           */
+            nbr_refill = pmem_pool->BlkIx;
+        }
+        if (nbr_refill < 1) {                                       /* Pool empty as well; NO blks available.           */
+            pmem_pool->AllocFailCtr++;
+            CPU_CRITICAL_EXIT();
+           *perr = LIB_MEM_ERR_POOL_EMPTY;
+            return ((void *)0);
+        }
+        for (i = 0u; i < nbr_refill; i++) {                         /* See Note #2.                                     */
+            pmem_pool->BlkIx--;
+            pmem_cache->BlkPtrs[i] = pmem_pool->PoolPtrs[pmem_pool->BlkIx];
+        }
+        if ((pmem_pool->BlkNbr - pmem_pool->BlkIx) > pmem_pool->BlkNbrUsedMax) {
+            pmem_pool->BlkNbrUsedMax = pmem_pool->BlkNbr - pmem_pool->BlkIx;    /* Track the peak nbr of blks in use.   */
+        }
+        CPU_CRITICAL_EXIT();
+
+        pmem_cache->BlkNbr = nbr_refill;
+    }
+
+    pmem_cache->BlkNbr--;                                           /* Cache-local pop (see Note #1).                   */
+
+   *perr = LIB_MEM_ERR_NONE;
+
+    return (pmem_cache->BlkPtrs[pmem_cache->BlkNbr]);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       Mem_PoolCacheBlkFree()
+*
+* Description : Free a memory block to a memory pool cache, flushing the magazine to the shared pool
+*               in a single batch when the cache is full.
+*
+* Argument(s) : pmem_cache  Pointer to memory pool cache.
+*
+*               pmem_blk    Pointer to memory block to free (MUST belong to the cache's backing pool).
+*
+*               perr        Pointer to variable that will receive the return error code from this
+*                           function :
+*
+*                               LIB_MEM_ERR_NONE                Memory block successfully freed.
+*                               LIB_MEM_ERR_NULL_PTR            Pointer argument(s) passed NULL pointer.
+*                               LIB_MEM_ERR_POOL_FULL           Pool full; block NOT freed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Since the cache is owned by a single task (see 'MEM_POOL_CACHE  Note #2'), the
+*                   cache-local push requires NO critical section; only a full magazine is flushed to
+*                   the shared pool, under ONE critical section.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
+void  Mem_PoolCacheBlkFree (MEM_POOL_CACHE  *pmem_cache,
+                            void            *pmem_blk,
+                            LIB_ERR         *perr)
+{
+    MEM_POOL     *pmem_pool;
+    MEM_POOL_IX   i;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                     /* ------------- VALIDATE RTN ERR PTR ------------- */
+    if (perr == (LIB_ERR *)0) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (pmem_cache == (MEM_POOL_CACHE *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (pmem_blk == (void *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (pmem_cache->BlkNbr >= pmem_cache->BlkNbrMax) {              /* Cache full; batch-flush to the shared pool.      */
+        pmem_pool = pmem_cache->PoolPtr;
+
+        CPU_CRITICAL_ENTER();
+        if (((CPU_SIZE_T)pmem_pool->BlkIx +
+             (CPU_SIZE_T)pmem_cache->BlkNbr) > pmem_pool->BlkNbr) { /* Validate mem pool ix NOT corrupt.                */
+            CPU_CRITICAL_EXIT();
+           *perr = LIB_MEM_ERR_POOL_FULL;
+            return;
+        }
+        for (i = 0u; i < pmem_cache->BlkNbr; i++) {                 /* See Note #1.                                     */
+            pmem_pool->PoolPtrs[pmem_pool->BlkIx] = pmem_cache->BlkPtrs[i];
+            pmem_pool->BlkIx++;
+        }
+        CPU_CRITICAL_EXIT();
+
+        pmem_cache->BlkNbr = 0u;
+    }
+
+    pmem_cache->BlkPtrs[pmem_cache->BlkNbr] = pmem_blk;             /* Cache-local push (see Note #1).                  */
+    pmem_cache->BlkNbr++;
+
+   *perr = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          Mem_PoolStatGet()
+*
+* Description : Snapshot a memory pool's (or the heap's) usage statistics.
+*
+* Argument(s) : pmem_pool           Pointer to memory pool (or '&Mem_PoolHeap'-backed heap pool; see
+*                                       Note #1).
+*
+*               pnbr_used           Optional pointer to a variable to receive the current usage.
+*
+*               pnbr_used_max       Optional pointer to a variable to receive the peak usage.
+*
+*               palloc_fail_ctr     Optional pointer to a variable to receive the number of failed
+*                                       allocation requests.
+*
+*               perr                Pointer to variable that will receive the return error code from
+*                                   this function :
+*
+*                                       LIB_MEM_ERR_NONE            Statistics successfully returned.
+*                                       LIB_MEM_ERR_NULL_PTR        'pmem_pool' passed a NULL pointer.
+*                                       LIB_MEM_ERR_INVALID_POOL    Invalid memory pool type.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) For a block pool, usage counts blocks in use; for the heap, usage counts octets
+*                   carved from the heap segment (which never shrinks; see Mem_HeapAlloc()) & the
+*                   fail counter covers both Mem_HeapAlloc() & Mem_HeapAllocEx().
+*
+*               (2) All three values are copied under ONE short critical section, so the snapshot is
+*                   consistent & cheap enough to poll from a statistics task; pools can then be sized
+*                   to measured peak-plus-margin instead of worst-case guesses.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)
+void  Mem_PoolStatGet (MEM_POOL    *pmem_pool,
+                       CPU_SIZE_T  *pnbr_used,
+                       CPU_SIZE_T  *pnbr_used_max,
+                       CPU_SIZE_T  *palloc_fail_ctr,
+                       LIB_ERR     *perr)
+{
+    CPU_SIZE_T  nbr_used;
+    CPU_SIZE_T  nbr_used_max;
+    CPU_SIZE_T  alloc_fail_ctr;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                     /* ------------- VALIDATE RTN ERR PTR ------------- */
+    if (perr == (LIB_ERR *)0) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (pmem_pool == (MEM_POOL *)0) {
+       *perr = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    switch (pmem_pool->Type) {
+        case LIB_MEM_TYPE_POOL:                                     /* See Note #1.                                     */
+             nbr_used     =  pmem_pool->BlkNbr     - pmem_pool->BlkIx;
+             nbr_used_max =  pmem_pool->BlkNbrUsedMax;
+             break;
+
+        case LIB_MEM_TYPE_HEAP:
+             nbr_used     =  pmem_pool->SegSizeTot - pmem_pool->SegSizeRem;
+             nbr_used_max =  nbr_used;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *perr = LIB_MEM_ERR_INVALID_POOL;
+             return;
+    }
+    alloc_fail_ctr = pmem_pool->AllocFailCtr;
+    CPU_CRITICAL_EXIT();
+
+    if (pnbr_used != (CPU_SIZE_T *)0) {
+       *pnbr_used  = nbr_used;
+    }
+    if (pnbr_used_max != (CPU_SIZE_T *)0) {
+       *pnbr_used_max  = nbr_used_max;
+    }
+    if (palloc_fail_ctr != (CPU_SIZE_T *)0) {
+       *palloc_fail_ctr  = alloc_fail_ctr;
+    }
+
+   *perr = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -220,6 +220,7 @@
 #define  LIB_MEM_ERR_HEAP_NOT_FOUND                    10210u   /* Heap seg NOT found.                                  */
 #define  LIB_MEM_ERR_HEAP_EMPTY                        10211u   /* Heap seg empty; i.e. NO avail mem in heap.           */
 #define  LIB_MEM_ERR_HEAP_OVF                          10212u   /* Heap seg ovf;   i.e. req'd mem ovfs rem mem in heap. */
+#define  LIB_MEM_ERR_HEAP_BLK_INVALID                  10213u   /* Heap blk NOT alloc'd by Mem_HeapAllocEx().           */
 
 
 /*
@@ -335,6 +336,8 @@ struct  mem_pool {
     CPU_SIZE_T      BlkNbr;                                     /* Nbr   of mem pool   blks.                            */
     CPU_SIZE_T      BlkSize;                                    /* Size  of mem pool   blks (in octets).                */
     CPU_SIZE_T      BlkAlign;                                   /* Align of mem pool   blks (in octets).                */
+    CPU_SIZE_T      BlkNbrUsedMax;                              /* Peak nbr of mem pool blks in use.                    */
+    CPU_SIZE_T      AllocFailCtr;                               /* Nbr of failed blk get / heap alloc requests.         */
 
                                                                 /* --------------------- MEM SEG ---------------------- */
     void           *SegAddr;                                    /* Ptr      to mem seg's base/start addr.               */
@@ -344,6 +347,34 @@ struct  mem_pool {
 };
 
 
+/*
+*********************************************************************************************************
+*                                  MEMORY POOL CACHE DATA TYPE
+*
+* Note(s) : (1) A memory pool cache 'magazine' holds a small, per-task stash of blocks from one memory
+*               pool so the task's block get/free operations run WITHOUT entering a critical section;
+*               the shared pool is only touched when the magazine empties or fills, one batch per
+*               critical section (see 'Mem_PoolCacheBlkGet()  Note #2').
+*
+*           (2) Each cache MUST be used by a single task ONLY; the cache itself is NOT protected.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_POOL_CACHE_SIZE_MAX
+#define  LIB_MEM_POOL_CACHE_SIZE_MAX                       8u   /* Max nbr of blks a cache magazine can hold.           */
+#endif
+
+typedef  struct  mem_pool_cache  MEM_POOL_CACHE;
+
+                                                                /* ------------------ MEM POOL CACHE ------------------ */
+struct  mem_pool_cache {
+    MEM_POOL       *PoolPtr;                                    /* Ptr to the shared mem pool backing this cache.       */
+    void           *BlkPtrs[LIB_MEM_POOL_CACHE_SIZE_MAX];       /* Locally-cached blk ptrs.                             */
+    MEM_POOL_IX     BlkNbr;                                     /* Nbr of blks currently cached.                        */
+    MEM_POOL_IX     BlkNbrMax;                                  /* Magazine size (<= LIB_MEM_POOL_CACHE_SIZE_MAX).      */
+};
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1070,14 +1101,29 @@ void          Mem_Copy       (       void        *pdest,
                               const  void        *psrc,
                                      CPU_SIZE_T   size);
 
+void          Mem_Move       (       void        *pdest,
+                              const  void        *psrc,
+                                     CPU_SIZE_T   size);
+
 CPU_BOOLEAN   Mem_Cmp        (const  void        *p1_mem,
                               const  void        *p2_mem,
                                      CPU_SIZE_T   size);
 
+CPU_SIZE_T    Mem_CmpDiff    (const  void        *p1_mem,
+                              const  void        *p2_mem,
+                                     CPU_SIZE_T   size);
+
 
 
 #if (LIB_MEM_CFG_ALLOC_EN == DEF_ENABLED)                           /* ---------------- MEM POOL FNCTS ---------------- */
 
+void         *Mem_HeapAllocEx(       CPU_SIZE_T   size,
+                                     CPU_SIZE_T  *poctets_reqd,
+                                     LIB_ERR     *perr);
+
+void          Mem_HeapFree   (       void        *pmem_blk,
+                                     LIB_ERR     *perr);
+
 void         *Mem_HeapAlloc  (       CPU_SIZE_T   size,
                                      CPU_SIZE_T   align,
                                      CPU_SIZE_T  *poctets_reqd,
@@ -1096,6 +1142,25 @@ void          Mem_PoolCreate (       MEM_POOL    *pmem_pool,
                                      CPU_SIZE_T  *poctets_reqd,
                                      LIB_ERR     *perr);
 
+void          Mem_PoolStatGet(       MEM_POOL    *pmem_pool,
+                                     CPU_SIZE_T  *pnbr_used,
+                                     CPU_SIZE_T  *pnbr_used_max,
+                                     CPU_SIZE_T  *palloc_fail_ctr,
+                                     LIB_ERR     *perr);
+
+void          Mem_PoolCacheInit(     MEM_POOL_CACHE  *pmem_cache,
+                                     MEM_POOL        *pmem_pool,
+                                     MEM_POOL_IX      nbr_blks,
+                                     LIB_ERR         *perr);
+
+void         *Mem_PoolCacheBlkGet(   MEM_POOL_CACHE  *pmem_cache,
+                                     CPU_SIZE_T       size,
+                                     LIB_ERR         *perr);
+
+void          Mem_PoolCacheBlkFree(  MEM_POOL_CACHE  *pmem_cache,
+                                     void            *pmem_blk,
+                                     LIB_ERR         *perr);
+
 void         *Mem_PoolBlkGet (       MEM_POOL    *pmem_pool,
                                      CPU_SIZE_T   size,
                                      LIB_ERR     *perr);
@@ -0,0 +1,173 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                          (c) Copyright 2004-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               uC/LIB is provided in source form to registered licensees ONLY.  It is 
+*               illegal to distribute this source code to any third party unless you receive 
+*               written permission by an authorized Micrium representative.  Knowledge of 
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest 
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     STACKLESS COROUTINES (PROTOTHREADS)
+*
+* Filename      : lib_pt.c
+* Version       : V1.35.00
+* Programmer(s) : SR
+*                 ITJ
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#define    LIB_PT_MODULE
+#include  <lib_pt.h>
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            PTSched_Init()
+*
+* Description : Initialize a protothread scheduler over a caller-supplied slot table.
+*
+* Argument(s) : p_sched     Pointer to the scheduler.
+*
+*               p_tbl       Pointer to the slot table; its storage belongs to the caller & sizes the
+*                               number of concurrent coroutines.
+*
+*               tbl_size    Number of slots in the table.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  PTSched_Init (PT_SCHED    *p_sched,
+                    PT_TASK     *p_tbl,
+                    CPU_INT16U   tbl_size)
+{
+    CPU_INT16U  ix;
+
+
+    p_sched->TblPtr  = p_tbl;
+    p_sched->TblSize = tbl_size;
+    for (ix = 0u; ix < tbl_size; ix++) {
+        p_tbl[ix].Active = DEF_FALSE;
+    }
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             PTSched_Add()
+*
+* Description : Start a coroutine in a free slot.
+*
+* Argument(s) : p_sched     Pointer to the scheduler.
+*
+*               fnct        Protothread function to run.
+*
+*               p_arg       Per-entity state passed to 'fnct' on every resume; this -- NOT locals inside
+*                               'fnct' -- is where state that must survive a blocking point lives (see
+*                               'lib_pt.h  Note #2a').
+*
+* Return(s)   : Pointer to the claimed slot, if a slot was free.
+*
+*               Pointer to NULL,             otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+PT_TASK  *PTSched_Add (PT_SCHED  *p_sched,
+                       PT_FNCT    fnct,
+                       void      *p_arg)
+{
+    PT_TASK     *p_task;
+    CPU_INT16U   ix;
+
+
+    for (ix = 0u; ix < p_sched->TblSize; ix++) {
+        p_task = &p_sched->TblPtr[ix];
+        if (p_task->Active == DEF_FALSE) {
+            PT_INIT(&p_task->PT);
+            p_task->Fnct   = fnct;
+            p_task->ArgPtr = p_arg;
+            p_task->Active = DEF_TRUE;
+            return (p_task);
+        }
+    }
+    return ((PT_TASK *)0);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             PTSched_Run()
+*
+* Description : Run one scheduler pass : resume every active coroutine whose delay (if any) has expired.
+*
+* Argument(s) : p_sched     Pointer to the scheduler.
+*
+*               tick_cur    Current tick; typically OSTimeGet().  PT_DELAY() durations are in units of
+*                               this tick, so a host task that calls PTSched_Run() once per OS tick gets
+*                               OSTimeDly() semantics (see 'lib_pt.h  Note #3').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application; ONE host task per scheduler.
+*
+* Note(s)     : (1) The signed tick difference handles tick counter wrap, exactly as the OS tick wheel
+*                   does.
+*
+*               (2) A coroutine that returns PT_STATE_ENDED frees its slot; PTSched_Add() may recycle it
+*                   on the very next pass.
+*********************************************************************************************************
+*/
+
+void  PTSched_Run (PT_SCHED    *p_sched,
+                   CPU_INT32U   tick_cur)
+{
+    PT_TASK     *p_task;
+    CPU_INT16U   ix;
+    CPU_INT08U   state;
+
+
+    for (ix = 0u; ix < p_sched->TblSize; ix++) {
+        p_task = &p_sched->TblPtr[ix];
+        if (p_task->Active == DEF_FALSE) {
+            continue;
+        }
+        p_task->PT.TickCur = tick_cur;
+        if (p_task->PT.DlyActive == DEF_TRUE) {
+            if ((CPU_INT32S)(tick_cur - p_task->PT.TickWake) < 0) {     /* See Note #1.                                 */
+                continue;
+            }
+            p_task->PT.DlyActive = DEF_FALSE;
+        }
+        state = (*p_task->Fnct)(&p_task->PT, p_task->ArgPtr);
+        if (state == PT_STATE_ENDED) {                                  /* See Note #2.                                 */
+            p_task->Active = DEF_FALSE;
+        }
+    }
+}
@@ -0,0 +1,218 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                          (c) Copyright 2004-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               uC/LIB is provided in source form to registered licensees ONLY.  It is 
+*               illegal to distribute this source code to any third party unless you receive 
+*               written permission by an authorized Micrium representative.  Knowledge of 
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest 
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     STACKLESS COROUTINES (PROTOTHREADS)
+*
+* Filename      : lib_pt.h
+* Version       : V1.35.00
+* Programmer(s) : SR
+*                 ITJ
+*********************************************************************************************************
+* Note(s)       : (1) A protothread is a stackless coroutine: a function that can block at marked points
+*                     (PT_WAIT_UNTIL(), PT_YIELD(), PT_DELAY()) & later resume after the blocking point,
+*                     WITHOUT a private stack.  The resume point (the "local continuation") is a line
+*                     number stored in the PT control structure & re-entered through a switch, so a
+*                     protothread costs a few bytes of RAM instead of a task stack.  Hundreds of
+*                     concurrent entities (game objects, lamp sequencers, protocol steps) therefore fit
+*                     inside ONE host task's stack.
+*
+*                 (2) The price of stacklessness :
+*
+*                     (a) Local variables DO NOT survive a blocking point; state that must survive
+*                         belongs in the structure passed through 'p_arg'.
+*
+*                     (b) A blocking macro may only appear in the protothread function itself, NOT in a
+*                         function it calls.
+*
+*                     (c) switch statements spanning a blocking macro are not allowed (the local
+*                         continuation is itself a switch).
+*
+*                 (3) The scheduler (see lib_pt.c) is tick-source agnostic : the host task passes the
+*                     current tick (typically OSTimeGet()) to PTSched_Run() & PT_DELAY() compares
+*                     against it, so delays have OSTimeDly() semantics without this module depending on
+*                     the OS.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_PT_MODULE_PRESENT
+#define  LIB_PT_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*
+* Note(s) : (1) See 'lib_math.h  INCLUDE FILES' for include file requirements & directory configuration.
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+#include  <lib_def.h>
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) Values returned by a protothread function to its scheduler.
+*********************************************************************************************************
+*/
+
+#define  PT_STATE_WAITING                                  0u   /* Blocked at a PT_WAIT_UNTIL()/PT_DELAY()  (Note #1).  */
+#define  PT_STATE_YIELDED                                  1u   /* Gave the CPU back; runnable again next pass.         */
+#define  PT_STATE_ENDED                                    2u   /* Ran off PT_END() or took PT_EXIT(); slot is free.    */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16U  PT_LC;                                     /* Local continuation : __LINE__ of the blocking point. */
+
+typedef  struct  pt {                                           /* ------------- PROTOTHREAD CONTROL BLOCK ------------ */
+    PT_LC        LC;                                            /* Resume point; 0 = start of the protothread.          */
+    CPU_INT32U   TickCur;                                       /* Current tick, written by the scheduler each pass.    */
+    CPU_INT32U   TickWake;                                      /* Tick at which a PT_DELAY() expires.                  */
+    CPU_BOOLEAN  DlyActive;                                     /* A PT_DELAY() is in progress.                         */
+} PT;
+
+                                                                /* Protothread function signature.                      */
+typedef  CPU_INT08U  (*PT_FNCT)(PT  *p_pt, void  *p_arg);
+
+typedef  struct  pt_task {                                      /* ---------------- SCHEDULER RUN SLOT ---------------- */
+    PT           PT;                                            /* The coroutine's control block.                       */
+    PT_FNCT      Fnct;                                          /* Protothread function to run.                         */
+    void        *ArgPtr;                                        /* Per-entity state; survives blocking points.          */
+    CPU_BOOLEAN  Active;                                        /* Slot holds a live coroutine.                         */
+} PT_TASK;
+
+typedef  struct  pt_sched {                                     /* -------------- PROTOTHREAD SCHEDULER --------------- */
+    PT_TASK     *TblPtr;                                        /* Caller-supplied slot table.                          */
+    CPU_INT16U   TblSize;                                       /* Number of slots in the table.                        */
+} PT_SCHED;
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                               MACRO'S
+*
+* Note(s) : (1) The local continuation is implemented with the switch/__LINE__ technique : PT_BEGIN()
+*               opens a switch on the stored line number, each blocking macro stores __LINE__ & drops a
+*               matching case label, & PT_END() closes the switch.  See 'lib_pt.h  Note #2' for the
+*               resulting restrictions.
+*********************************************************************************************************
+*/
+
+#define  PT_INIT(p_pt)                  do {                                                  \
+                                            (p_pt)->LC        = (PT_LC)0u;                    \
+                                            (p_pt)->DlyActive =  DEF_FALSE;                   \
+                                        } while (0)
+
+#define  PT_BEGIN(p_pt)                 switch ((p_pt)->LC) {                                 \
+                                            case 0u:
+
+#define  PT_END(p_pt)                       break;                                            \
+                                            default:                                          \
+                                                break;                                        \
+                                        }                                                     \
+                                        PT_INIT(p_pt);                                        \
+                                        return (PT_STATE_ENDED)
+
+                                                                /* Block until 'cond' is true  (see Note #1).           */
+#define  PT_WAIT_UNTIL(p_pt, cond)      do {                                                  \
+                                            (p_pt)->LC = (PT_LC)__LINE__;                     \
+                                            case __LINE__:                                    \
+                                            if (!(cond)) {                                    \
+                                                return (PT_STATE_WAITING);                    \
+                                            }                                                 \
+                                        } while (0)
+
+                                                                /* Give the CPU back for one scheduler pass.            */
+#define  PT_YIELD(p_pt)                 do {                                                  \
+                                            (p_pt)->LC = (PT_LC)__LINE__;                     \
+                                            return (PT_STATE_YIELDED);                        \
+                                            case __LINE__: ;                                  \
+                                        } while (0)
+
+                                                                /* OSTimeDly()-equivalent wait, in scheduler ticks.     */
+#define  PT_DELAY(p_pt, dly)            do {                                                  \
+                                            (p_pt)->TickWake  = (p_pt)->TickCur + (dly);      \
+                                            (p_pt)->DlyActive =  DEF_TRUE;                    \
+                                            (p_pt)->LC = (PT_LC)__LINE__;                     \
+                                            return (PT_STATE_WAITING);                        \
+                                            case __LINE__: ;                                  \
+                                        } while (0)
+
+                                                                /* Start over from the top on the next pass.            */
+#define  PT_RESTART(p_pt)               do {                                                  \
+                                            PT_INIT(p_pt);                                    \
+                                            return (PT_STATE_YIELDED);                        \
+                                        } while (0)
+
+                                                                /* Terminate; the scheduler frees the slot.             */
+#define  PT_EXIT(p_pt)                  do {                                                  \
+                                            PT_INIT(p_pt);                                    \
+                                            return (PT_STATE_ENDED);                          \
+                                        } while (0)
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void      PTSched_Init(PT_SCHED    *p_sched,
+                       PT_TASK     *p_tbl,
+                       CPU_INT16U   tbl_size);
+
+PT_TASK  *PTSched_Add (PT_SCHED    *p_sched,
+                       PT_FNCT      fnct,
+                       void        *p_arg);
+
+void      PTSched_Run (PT_SCHED    *p_sched,
+                       CPU_INT32U   tick_cur);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of lib pt module include.                        */
@@ -152,6 +152,11 @@ static  const  CPU_INT32U  Str_MultOvfThTbl_Int32U[] = {
 *********************************************************************************************************
 */
 
+static  CPU_INT32U   Str_FmtNbr_DigExtract(    CPU_INT32U     nbr,
+                                               CPU_INT08U     nbr_base,
+                                               CPU_INT08U     base_shift,
+                                               CPU_INT08U    *p_dig_val);
+
 static  CPU_CHAR    *Str_FmtNbr_Int32  (       CPU_INT32U     nbr,
                                                CPU_INT08U     nbr_dig,
                                                CPU_INT08U     nbr_base,
@@ -272,6 +277,16 @@ CPU_SIZE_T  Str_Len (const  CPU_CHAR  *pstr)
 *
 *                   (c) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include the terminating NULL character.
+*
+*               (4) For best CPU performance, optimized to scan one 'CPU_ALIGN'-sized word (4 octets) per 
+*                   iteration once the string pointer reaches a word-aligned address :
+*
+*                   (a) A word contains a zero octet if, & only if, 
+*                       ((word - 0x01010101) & ~word & 0x80808080) is non-zero.
+*
+*                   (b) The word scan reads whole aligned words & may therefore read up to 3 octets past 
+*                       the terminating NULL character; but it never crosses the aligned word containing 
+*                       that character, so the access stays within any legally-allocated buffer.
 *********************************************************************************************************
 */
 
@@ -280,10 +295,39 @@ CPU_SIZE_T  Str_Len_N (const  CPU_CHAR    *pstr,
 {
     const  CPU_CHAR    *pstr_len;
            CPU_SIZE_T   len;
+#if (CPU_CFG_DATA_SIZE == CPU_WORD_SIZE_32)
+    const  CPU_INT32U  *pstr_word;
+           CPU_INT32U   word;
+#endif
 
 
     pstr_len = pstr;
     len      = 0u;
+
+#if (CPU_CFG_DATA_SIZE == CPU_WORD_SIZE_32)                     /* See Note #4.                                         */
+    while (( pstr_len != (const CPU_CHAR *)  0 )                         &&
+           (((CPU_ADDR)pstr_len % sizeof(CPU_INT32U)) != (CPU_ADDR)0u)   &&  /* Scan octets to next word boundary ...   */
+           ( *pstr_len != (     CPU_CHAR  )'\0')                         &&
+           (  len      <  (     CPU_SIZE_T)len_max)) {
+        pstr_len++;
+        len++;
+    }
+
+    if (( pstr_len           != (const CPU_CHAR *)  0 )                 &&  /* Word scan only from an aligned ptr: ... */
+        (((CPU_ADDR)pstr_len  % sizeof(CPU_INT32U)) == (CPU_ADDR)0u)) {     /* ... prologue exits early on NULL char.  */
+        pstr_word = (const CPU_INT32U *)pstr_len;
+        while ((len + sizeof(CPU_INT32U)) <= (CPU_SIZE_T)len_max) { /* Scan one aligned word (4 octets) per iteration.  */
+            word = *pstr_word;
+            if (((word - 0x01010101u) & ~word & 0x80808080u) != 0u) {   /* Word holds a zero octet? (see Note #4a)      */
+                break;
+            }
+            pstr_word++;
+            len += sizeof(CPU_INT32U);
+        }
+        pstr_len = (const CPU_CHAR *)pstr_word;
+    }
+#endif
+
     while (( pstr_len != (const CPU_CHAR *)  0 ) &&             /* Calc str len until NULL ptr (see Note #3a) ...       */
            (*pstr_len != (      CPU_CHAR  )'\0') &&             /* ... or NULL char found      (see Note #3b) ...       */
            ( len      <  (      CPU_SIZE_T)len_max)) {          /* ... or max nbr chars srch'd (see Note #3c).          */
@@ -854,6 +898,14 @@ CPU_INT16S  Str_Cmp (const  CPU_CHAR  *p1_str,
 *
 *               (4) Since 16-bit signed arithmetic is performed to calculate a non-identical comparison
 *                   return value, 'CPU_CHAR' native data type size MUST be 8-bit.
+*
+*               (5) For best CPU performance, when both strings start on word-aligned addresses the 
+*                   identical leading characters are skipped one aligned word at a time.  A word may be 
+*                   skipped when both strings' words are bit-for-bit equal AND neither word contains a 
+*                   zero octet (see 'Str_Len_N()  Note #4'), so the octet-wise comparison below 
+*                   terminates on exactly the same character it would have without the fast path.  The 
+*                   fast path assumes the compared strings do NOT wrap around the top of the address 
+*                   space (see Note #3a2).
 *********************************************************************************************************
 */
 /*$PAGE*/
@@ -867,6 +919,9 @@ CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
     const  CPU_CHAR    *p2_str_cmp_next;
            CPU_INT16S   cmp_val;
            CPU_SIZE_T   cmp_len;
+#if (CPU_CFG_DATA_SIZE == CPU_WORD_SIZE_32)
+           CPU_INT32U   word;
+#endif
 
 
     if (len_max == 0) {                                         /* If cmp len = 0,        rtn 0       (see Note #3d1A). */
@@ -894,6 +949,26 @@ CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
     p2_str_cmp_next++;
     cmp_len         = 0u;
 
+#if (CPU_CFG_DATA_SIZE == CPU_WORD_SIZE_32)                     /* See Note #5.                                         */
+    if (((((CPU_ADDR)p1_str_cmp) % sizeof(CPU_INT32U)) == (CPU_ADDR)0u) &&
+        ((((CPU_ADDR)p2_str_cmp) % sizeof(CPU_INT32U)) == (CPU_ADDR)0u)) {
+        while ((cmp_len + sizeof(CPU_INT32U)) <= (CPU_SIZE_T)len_max) { /* Skip one aligned word (4 octets) per iter.   */
+            word = *(const CPU_INT32U *)p1_str_cmp;
+            if (word != *(const CPU_INT32U *)p2_str_cmp) {      /* Words differ;            finish octet-wise.          */
+                break;
+            }
+            if (((word - 0x01010101u) & ~word & 0x80808080u) != 0u) {   /* Word holds a zero octet; finish octet-wise.  */
+                break;
+            }
+            p1_str_cmp      += sizeof(CPU_INT32U);
+            p2_str_cmp      += sizeof(CPU_INT32U);
+            p1_str_cmp_next += sizeof(CPU_INT32U);
+            p2_str_cmp_next += sizeof(CPU_INT32U);
+            cmp_len         += sizeof(CPU_INT32U);
+        }
+    }
+#endif
+
     while ((*p1_str_cmp      == *p2_str_cmp)            &&      /* Cmp strs until non-matching chars (see Note #3c) ... */
            (*p1_str_cmp      != (      CPU_CHAR  )'\0') &&      /* ... or NULL chars                 (see Note #3b) ... */
            ( p1_str_cmp_next != (const CPU_CHAR *)  0 ) &&      /* ... or NULL ptr(s) found          (see Note #3a2);   */
@@ -1352,6 +1427,12 @@ CPU_CHAR  *Str_Char (const  CPU_CHAR  *pstr,
 *                           of characters; NULL pointer returned.
 *                       (2) 'len_max' number of characters MAY include terminating NULL character 
 *                           (see Note #2a2).
+*
+*               (4) For best CPU performance, optimized to scan one 'CPU_ALIGN'-sized word (4 octets) per 
+*                   iteration once the string pointer reaches a word-aligned address; the search character 
+*                   is broadcast into all four octets of a word & each scanned word is tested for a zero 
+*                   octet both as-is (terminating NULL character) & XOR'd with the broadcast word (search 
+*                   character), using the zero-octet test described in 'Str_Len_N()  Note #4'.
 *********************************************************************************************************
 */
 /*$PAGE*/
@@ -1361,6 +1442,12 @@ CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *pstr,
 {
     const  CPU_CHAR    *pstr_char;
            CPU_SIZE_T   len_srch;
+#if (CPU_CFG_DATA_SIZE == CPU_WORD_SIZE_32)
+    const  CPU_INT32U  *pstr_word;
+           CPU_INT32U   word;
+           CPU_INT32U   word_srch;
+           CPU_INT32U   char_word;
+#endif
 
 
     if (pstr == (const CPU_CHAR *)0) {                          /* Rtn NULL if srch str ptr NULL (see Note #3a1).       */
@@ -1375,6 +1462,37 @@ CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *pstr,
     pstr_char = pstr;
     len_srch  = 0u;
 
+#if (CPU_CFG_DATA_SIZE == CPU_WORD_SIZE_32)                     /* See Note #4.                                         */
+    while (( pstr_char != (const CPU_CHAR *)  0 )                        &&
+           (((CPU_ADDR)pstr_char % sizeof(CPU_INT32U)) != (CPU_ADDR)0u)  &&  /* Scan octets to next word boundary ...   */
+           ( *pstr_char != (     CPU_CHAR  )'\0')                        &&
+           ( *pstr_char != (     CPU_CHAR  )srch_char)                   &&
+           (  len_srch  <  (     CPU_SIZE_T)len_max)) {
+        pstr_char++;
+        len_srch++;
+    }
+
+    if (( pstr_char          != (const CPU_CHAR *)  0 )                 &&  /* Word scan only from an aligned ptr: ... */
+        (((CPU_ADDR)pstr_char % sizeof(CPU_INT32U)) == (CPU_ADDR)0u)) {     /* ... prologue exits early on NULL/srch.  */
+        char_word  = (CPU_INT32U)((CPU_INT08U)srch_char);       /* Broadcast srch char into all four octets.            */
+        char_word |= (char_word <<  8);
+        char_word |= (char_word << 16);
+
+        pstr_word = (const CPU_INT32U *)pstr_char;
+        while ((len_srch + sizeof(CPU_INT32U)) <= (CPU_SIZE_T)len_max) { /* Scan one aligned word (4 octets) per iter.  */
+            word      = *pstr_word;
+            word_srch =  word ^ char_word;
+            if ((((word      - 0x01010101u) & ~word      & 0x80808080u)  |   /* Word holds NULL char ...                */
+                 ((word_srch - 0x01010101u) & ~word_srch & 0x80808080u)) != 0u) {/* ... or srch char?                   */
+                break;
+            }
+            pstr_word++;
+            len_srch += sizeof(CPU_INT32U);
+        }
+        pstr_char = (const CPU_CHAR *)pstr_word;
+    }
+#endif
+
     while (( pstr_char != (const CPU_CHAR *)  0 )      &&       /* Srch str until NULL ptr     [see Note #3b]  ...      */
            (*pstr_char != (      CPU_CHAR  )'\0')      &&       /* ... or NULL char            (see Note #3c)  ...      */
            (*pstr_char != (      CPU_CHAR  )srch_char) &&       /* ... or srch char found      (see Note #3d); ...      */
@@ -3102,6 +3220,75 @@ CPU_INT32S  Str_ParseNbr_Int32S (const  CPU_CHAR     *pstr,
 }
 
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      Str_FmtNbr_DigExtract()
+*
+* Description : Extract the least-significant digit of a number, in a specific base, without a hardware 
+*                   divide for the common bases.
+*
+* Argument(s) : nbr             Number to extract least-significant digit from.
+*
+*               nbr_base        Base of number.
+*
+*               base_shift      log2('nbr_base') for power-of-2 bases (2, 4, 8, 16 & 32); ...
+*                               ... 0 otherwise.
+*
+*               p_dig_val       Pointer to variable to return the digit value.
+*
+* Return(s)   : Number shifted right by one base digit (i.e. 'nbr' / 'nbr_base').
+*
+* Caller(s)   : Str_FmtNbr_Int32().
+*
+* Note(s)     : (1) The hardware divider is many cycles & NOT pipelined on most MCUs, & one divide per 
+*                   digit dominates the cost of formatting a number.  The common bases avoid it :
+*
+*                   (a) Power-of-2 bases extract digits with a mask & a shift.
+*
+*                   (b) Base 10 estimates 'nbr' / 10 with the shift-&-add reciprocal sequence below 
+*                       (an approximation of 'nbr' * 0.100000001...); the estimate is at most one 
+*                       low & is corrected from the remainder, which is itself computed with shifts 
+*                       [ 'nbr_div' * 10  =  ('nbr_div' << 3) + ('nbr_div' << 1) ].
+*
+*                   (c) All other bases fall back on the hardware divide.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  Str_FmtNbr_DigExtract (CPU_INT32U   nbr,
+                                           CPU_INT08U   nbr_base,
+                                           CPU_INT08U   base_shift,
+                                           CPU_INT08U  *p_dig_val)
+{
+    CPU_INT32U  nbr_div;
+    CPU_INT08U  dig_val;
+
+
+    if (base_shift > 0u) {                                      /* Pwr-of-2 base: mask & shift (see Note #1a).          */
+       *p_dig_val = (CPU_INT08U)(nbr & ((CPU_INT32U)nbr_base - 1u));
+        return (nbr >> base_shift);
+    }
+
+    if (nbr_base == 10u) {                                      /* Base 10: reciprocal est (see Note #1b).              */
+        nbr_div   = (nbr     >>  1) + (nbr >> 2);
+        nbr_div  += (nbr_div >>  4);
+        nbr_div  += (nbr_div >>  8);
+        nbr_div  += (nbr_div >> 16);
+        nbr_div >>=  3;
+        dig_val   = (CPU_INT08U)(nbr - ((nbr_div << 3) + (nbr_div << 1)));
+        if (dig_val > 9u) {                                     /* Est low by at most 1; correct rem & quotient.        */
+            dig_val -= 10u;
+            nbr_div++;
+        }
+       *p_dig_val = dig_val;
+        return (nbr_div);
+    }
+
+   *p_dig_val = (CPU_INT08U)(nbr % nbr_base);                   /* Other bases: HW divide (see Note #1c).               */
+    return (nbr / nbr_base);
+}
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -3349,6 +3536,7 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     CPU_INT08U    nbr_neg_sign;
     CPU_INT08U    nbr_lead_char;
     CPU_INT08U    dig_val;
+    CPU_INT08U    base_shift;
     CPU_INT08U    i;
     CPU_INT08U    lead_char_delta_0;
     CPU_INT08U    lead_char_delta_a;
@@ -3403,13 +3591,25 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
                                                                 /* ----------------- PREPARE NBR FMT ------------------ */
     pstr_fmt = pstr;
 
+    base_shift = 0u;
+    if (((CPU_INT08U)(nbr_base & (nbr_base - 1u))) == 0u) {     /* Pwr-of-2 base: digs come from masks & shifts ...     */
+        nbr_log = (CPU_INT32U)nbr_base;                         /* ... (see 'Str_FmtNbr_DigExtract()  Note #1').        */
+        while (nbr_log > 1u) {
+            base_shift++;
+            nbr_log >>= 1;
+        }
+    }
+
     if (fmt_invalid == DEF_NO) {
         nbr_fmt     = nbr;
         nbr_log     = nbr;
         nbr_dig_max = 1u;
         while (nbr_log >= nbr_base) {                           /* While nbr base digs avail, ...                       */
             nbr_dig_max++;                                      /* ... calc max nbr digs.                               */
-            nbr_log /= nbr_base;
+            nbr_log = Str_FmtNbr_DigExtract(nbr_log,
+                                            nbr_base,
+                                            base_shift,
+                                           &dig_val);
         }
 
         nbr_neg_sign = (nbr_neg == DEF_YES) ? 1u : 0u;
@@ -3458,7 +3658,10 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
             if ((nbr_fmt > 0) ||                                /* If fmt nbr > 0                               ...     */
                 (i == 0)) {                                     /* ... OR on one's  dig to fmt (see Note #3c1), ...     */
                                                                 /* ... calc & fmt dig val;                      ...     */
-                dig_val = (CPU_INT08U)(nbr_fmt % nbr_base);
+                nbr_fmt = Str_FmtNbr_DigExtract(nbr_fmt,        /* Shift to next more-sig dig; NO divide for the ...    */
+                                                nbr_base,       /* ... common bases (see Str_FmtNbr_DigExtract()).      */
+                                                base_shift,
+                                               &dig_val);
                 if (dig_val <= 9) {
                    *pstr_fmt-- = (CPU_CHAR)(dig_val + '0');
                 } else {
@@ -3469,8 +3672,6 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
                     }
                 }
 
-                nbr_fmt /= nbr_base;                            /* Shift to next more-sig dig.                          */
-
             } else if ((nbr_neg      == DEF_YES)  &&            /* ... else if nbr neg             AND          ...     */
                      (((lead_char_0  == DEF_NO )  &&            /* ... lead char NOT a '0' dig                  ...     */
                        (nbr_neg_fmtd == DEF_NO )) ||            /* ... but neg sign NOT yet fmt'd  OR           ...     */
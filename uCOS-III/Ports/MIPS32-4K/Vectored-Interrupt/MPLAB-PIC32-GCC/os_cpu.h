@@ -27,7 +27,36 @@
 ************************************************************************************************************************
 */
 
-#define  OS_TASK_SW()     asm volatile("syscall");
+/*
+** OS_TASK_SW() declares every caller-saved register (and LO/HI) as clobbered, so the compiler
+** spills only the values that are actually live across the voluntary switch.  OSCtxSw() in
+** os_cpu_a.S relies on this to save a MINIMAL frame (callee-saved registers plus SR/EPC) on the
+** syscall path; preemptive switches still save and restore the full register set.
+*/
+#define  OS_TASK_SW()     asm volatile("syscall" : : : "$2", "$3", "$4", "$5", "$6", "$7",       \
+                                                       "$8", "$9", "$10", "$11", "$12", "$13",  \
+                                                       "$14", "$15", "$24", "$25", "$31",       \
+                                                       "lo", "hi", "memory");
+
+/*
+** OS_RAM_FN places a function in the '.ramfunc' section, which the default MPLAB C32 linker script
+** locates in KSEG0 RAM and copies out of flash during startup.  The kernel applies it to its hottest
+** paths (see 'os.h  RAM-RESIDENT FUNCTION PLACEMENT') so that scheduling events do not pay PIC32
+** flash wait states through the prefetch unit.  'longcall' is required because RAM (0x8xxxxxxx) and
+** flash (0x9Dxxxxxx) sit in different 'jal' regions.
+*/
+#define  OS_RAM_FN        __attribute__((section(".ramfunc"), longcall, nomips16))
+
+/*
+** Task stack placement.  OS_CPU_STK_ALIGN_BYTES is the alignment OSTaskCreate() enforces on the
+** base and top of every task stack: 8 bytes, the MIPS32 EABI frame alignment, so every exception
+** frame the port builds starts on an even-word boundary.  OS_CPU_STK_ALIGN_ATTR pins a stack
+** array's declaration to the same boundary so no entries are lost to the create-time fixup.
+** The PIC32MX's M4K core has no data cache and a single SRAM bank, so there is no faster section
+** or cache-line geometry to place hot stacks against on this part; alignment is the whole story.
+*/
+#define  OS_CPU_STK_ALIGN_BYTES   8u
+#define  OS_CPU_STK_ALIGN_ATTR    __attribute__((aligned(8)))
 
 /*
 ************************************************************************************************************************
@@ -40,17 +69,44 @@
 *               (i.e. cycle count registers):
 *
 *               (a) OS_TS_GET() may be defined as CPU_TS_TmrRd() to improve performance when retrieving the timestamp.
+*                   CPU_TS_TMR_RD() is used here so that, when the port's inline core-timer read is enabled (see
+*                   'cpu.h  TIMESTAMP TIMER INLINE READ'), each timestamp costs a single 'mfc0' instruction.
 *
 *               (b) CPU_TS_TmrRd() MUST be configured to be greater or equal to 32-bits to avoid truncation of TS.
 ************************************************************************************************************************
 */
 
 #if      OS_CFG_TS_EN == 1u
-#define  OS_TS_GET()               (CPU_TS)CPU_TS_TmrRd()   /* See Note #2a.                                          */
+#define  OS_TS_GET()               (CPU_TS)CPU_TS_TMR_RD()  /* See Note #2a.                                          */
 #else
 #define  OS_TS_GET()               (CPU_TS)0u
 #endif
 
+/*
+************************************************************************************************************************
+*                                                  GLOBAL VARIABLES
+*
+* Note(s) : (1) OSTickReload holds the number of core timer counts per tick and MUST be set by the BSP when it
+*               initializes the tick source (see Tmr_Init()).  OSTickStretch is the number of ticks covered by the
+*               current Compare interval; the BSP's tick ISR handler issues that many calls to OSTimeTick() so that
+*               tick processing catches up after a stretched idle period.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICKLESS_IDLE_EN > 0u) || (OS_CFG_DLY_HIGH_RES_EN > 0u)
+OS_CPU_EXT  CPU_INT32U           OSTickReload;              /* Core timer counts per tick (see Note #1)               */
+#endif
+
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+OS_CPU_EXT  CPU_INT32U volatile  OSTickStretch;             /* Ticks covered by the current Compare interval          */
+#endif
+
+#if OS_CFG_IDLE_WAIT_EN > 0u
+OS_CPU_EXT  CPU_INT32U volatile  OSIdleWaitTimeAcc;         /* TS units spent halted in 'wait' (see OS_CPU_IdleWait())*/
+OS_CPU_EXT  CPU_BOOLEAN volatile OSIdleWaitActive;          /* A 'wait' halt is in progress                           */
+OS_CPU_EXT  CPU_INT32U           OSIdleWaitTSStart;         /* Timestamp taken just before the halt                   */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      PROTOTYPES
@@ -67,3 +123,16 @@ void  OS_CPU_PendSVHandler (void);
 void  OS_CPU_SysTickHandler(void);
 void  OS_CPU_SysTickInit   (CPU_INT32U  cnts);
 
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+void  OS_CPU_TicklessIdle  (void);
+#endif
+
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+CPU_BOOLEAN  OS_CPU_HighResWake    (void);   /* Called by the BSP tick handler; OSTimeDlyHighRes() is in os.h        */
+void         OS_CPU_HighResTickArm (void);
+#endif
+
+#if OS_CFG_IDLE_WAIT_EN > 0u
+void  OS_CPU_IdleWait      (void);
+#endif
+
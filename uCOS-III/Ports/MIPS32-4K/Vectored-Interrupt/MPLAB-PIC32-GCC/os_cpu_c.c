@@ -18,6 +18,38 @@
 #define   OS_CPU_GLOBALS
 #include <os.h>
 
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+static  void  OS_CPU_TickResync (void);
+#endif
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL VARIABLES
+*
+* Note(s)    : 1) A single sub-tick wake can be armed at a time (see OSTimeDlyHighRes()).  OS_CPU_HighResTCBPtr is the
+*                 task sleeping on the wake; while OS_CPU_HighResArmed is set the Compare register has been pulled in
+*                 front of the tick boundary and OS_CPU_HighResCmpSaved holds the boundary to restore when the early
+*                 interrupt fires.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+#define  OS_CPU_HIGH_RES_MIN    (CPU_INT32U)128u           /* Wake resolution, in core timer counts: intervals only  */
+                                                            /* ... arm when the match cannot slip past while the arm  */
+                                                            /* ... (or restore) sequence itself is still executing    */
+
+static  OS_TCB      *volatile  OS_CPU_HighResTCBPtr;        /* Task sleeping on the armed sub-tick wake (see Note #1) */
+static  CPU_INT32U   volatile  OS_CPU_HighResTarget;        /* Core timer count at which the task must wake           */
+static  CPU_INT32U             OS_CPU_HighResCmpSaved;      /* Tick boundary Compare value to restore after the wake  */
+static  CPU_BOOLEAN  volatile  OS_CPU_HighResArmed;         /* Compare is currently pulled in front of the boundary   */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                OS INITIALIZATION HOOK
@@ -32,6 +64,16 @@
 
 void  OSInitHook (void)
 {
+#if (OS_CFG_TICKLESS_IDLE_EN > 0u) || (OS_CFG_DLY_HIGH_RES_EN > 0u)
+    OSTickReload  = (CPU_INT32U)0u;                         /* BSP sets the real value in Tmr_Init()                  */
+#endif
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+    OSTickStretch = (CPU_INT32U)1u;
+#endif
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+    OS_CPU_HighResTCBPtr = (OS_TCB *)0;
+    OS_CPU_HighResArmed  =  DEF_FALSE;
+#endif
 }
 
 /*
@@ -100,6 +142,16 @@ void  OSIdleTaskHook (void)
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
+#if OS_CFG_IDLE_WORK_EN > 0u
+    if (OS_IdleWorkRun() == DEF_TRUE) {                     /* Ran a background work slice: more may be pending, so   */
+        return;                                             /* ... come back around before sleeping the CPU           */
+    }
+#endif
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+    OS_CPU_TicklessIdle();                                  /* Stretch the tick interrupt and sleep the CPU           */
+#elif OS_CFG_IDLE_WAIT_EN > 0u
+    OS_CPU_IdleWait();                                      /* Halt the pipeline until the next interrupt             */
+#endif
 }
 
 /*
@@ -149,7 +201,7 @@ void  OSStatTaskHook (void)
 * 
 *              2) An initialized stack has the structure shown below.
 *
-*              OSTCBHighRdy->OSTCBStkPtr + 0x00    Free Entry                    (LOW Memory)
+*              OSTCBHighRdy->OSTCBStkPtr + 0x00    Frame Type (0 full/1 minimal)  (LOW Memory)
 *                                        + 0x04    Status Register
 *                                        + 0x08    EPC
 *                                        + 0x0C    Special Purpose LO Register
@@ -244,6 +296,7 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     *pstk--  = (CPU_INT32U)0x00000000;         /* Special Purpose LO Register                          */
     *pstk--  = (CPU_INT32U)p_task;             /* EPC                                                  */
     *pstk--  = sr_val;                         /* SR                                                   */
+    *pstk    = (CPU_INT32U)0x00000000;         /* Frame type: full (see 'os_cpu_a.S  OSCtxSw()')       */
 
     return ((CPU_STK *)pstk);                   /* Return new top of stack                              */
 }
@@ -261,6 +314,15 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 *              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task that will be
 *                 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points to the task being switched out
 *                 (i.e. the preempted task).
+*              3) When tickless idle is enabled, a switch away from the idle task while the tick interrupt is stretched
+*                 means the CPU was woken early by some other interrupt.  The tick list is caught up here, BEFORE the
+*                 new task runs, so that delays armed by that task are computed from an up-to-date OSTickCtr.
+*              4) When stack redzone checking is enabled, the redzone of the task being switched out is verified here,
+*                 i.e. immediately after the task last ran, so an overflow is caught on the very switch that follows it.
+*              5) When the stack limit check is enabled, the outgoing task's saved StkPtr is compared against its
+*                 StkLimitPtr.  The port's switch paths (os_cpu_a.S) store SP into the TCB before calling this hook,
+*                 so the compare sees the stack depth the task was just running at -- detection at switch granularity
+*                 for two compares per switch, with no redzone pattern to fill or scan.
 ************************************************************************************************************************
 */
 
@@ -269,12 +331,43 @@ void  OSTaskSwHook (void)
 #if OS_CFG_TASK_PROFILE_EN > 0u
     CPU_TS  ts;
 #endif
+#if OS_CFG_TASK_JITTER_EN > 0u
+    CPU_TS      jitter;
+    CPU_INT08U  bucket;
+#endif
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     CPU_TS  int_dis_time;
 #endif
 
 
 
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+    if (OSTickStretch > (CPU_INT32U)1u) {                   /* Leaving a stretched idle period early? (see Note #3)   */
+        OS_CPU_TickResync();
+    }
+#endif
+
+#if OS_CFG_IDLE_WAIT_EN > 0u
+    if (OSIdleWaitActive == DEF_TRUE) {                     /* An interrupt ended the idle halt and woke a task:      */
+        OSIdleWaitTimeAcc += (CPU_INT32U)OS_TS_GET()        /* ... close the halted interval here so the woken        */
+                           -  OSIdleWaitTSStart;            /* ... task's run time is not credited as idle            */
+        OSIdleWaitActive   =  DEF_FALSE;
+    }
+#endif
+
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+    if (OSTaskStkRedzoneChk(OSTCBCurPtr) == DEF_FAIL) {     /* Task being switched out overflowed? (see Note #4)      */
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+
+#if OS_CFG_TASK_STK_LIMIT_CHK_EN > 0u
+    if ((OSTCBCurPtr->StkLimitPtr != (CPU_STK *)0) &&       /* Outgoing task ran past its stack limit? (see Note #5)  */
+        (OSTCBCurPtr->StkPtr      <  OSTCBCurPtr->StkLimitPtr)) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+
 #if OS_CFG_APP_HOOKS_EN > 0u
     if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
         (*OS_AppTaskSwHookPtr)();
@@ -291,6 +384,28 @@ void  OSTaskSwHook (void)
     OSTCBHighRdyPtr->CyclesStart = ts;
 #endif
 
+#if OS_CFG_TASK_JITTER_EN > 0u
+    if (OSTCBHighRdyPtr->WakeupPending == DEF_TRUE) {       /* First dispatch after a timed wake (see os_tick.c)?     */
+        OSTCBHighRdyPtr->WakeupPending = DEF_FALSE;
+        jitter = OS_TS_GET() - OSTCBHighRdyPtr->WakeupTs;   /* Lateness: tick made task ready -> task dispatched      */
+        if (jitter > OSTCBHighRdyPtr->JitterMax) {
+            OSTCBHighRdyPtr->JitterMax = jitter;
+        }
+        if ((OSAnomalyDlyLateTrig >  (CPU_TS)0u) &&         /* Lateness crossed the trigger? (see os.h)               */
+            (jitter               >= OSAnomalyDlyLateTrig) &&
+            (OSAnomalyHookPtr     != (OS_ANOMALY_HOOK)0)) {
+            (*OSAnomalyHookPtr)(OS_ANOMALY_DLY_LATE, jitter);
+        }
+        bucket = (CPU_INT08U)0u;                            /* Find the log2 bucket: [2^n, 2^(n+1)) TS units          */
+        while ((jitter  > (CPU_TS)1u) &&
+               (bucket  < (CPU_INT08U)(OS_CFG_TASK_JITTER_HIST_SIZE - 1u))) {
+            jitter >>= 1u;
+            bucket++;
+        }
+        OSTCBHighRdyPtr->JitterHistTbl[bucket]++;
+    }
+#endif
+
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     int_dis_time = CPU_IntDisMeasMaxCurReset();             /* Keep track of per-task interrupt disable time          */
     if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
@@ -326,6 +441,10 @@ void  OSTimeTickHook (void)
         (*OS_AppTimeTickHookPtr)();
     }
 #endif
+
+#if (CPU_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS_Update();                                        /* Track the ts tmr wrap so 64-bit timestamps stay monotonic */
+#endif
 }
 
 /*$PAGE*/
@@ -353,3 +472,426 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 #endif
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                  REDZONE HIT HOOK
+*
+* Description: This function is called when the redzone of a task's stack is found to be corrupted or its StkPtr is
+*              found below its StkLimitPtr at a task switch, i.e. the task overflowed (or nearly overflowed) its stack.
+*
+* Arguments  : p_tcb   is a pointer to the task control block of the offending task.
+*
+* Note(s)    : 1) If the application does not install its own handler, the kernel cannot safely continue running with a
+*                 corrupted stack and a software exception is raised.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u) || (OS_CFG_TASK_STK_LIMIT_CHK_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        CPU_SW_EXCEPTION(;);
+    }
+#else
+    (void)p_tcb;
+    CPU_SW_EXCEPTION(;);
+#endif
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                                    TICKLESS IDLE
+*
+* Description: This function is called by OSIdleTaskHook().  If every delayed task and armed soft timer is more than
+*              one tick away from expiring, the core timer Compare register is pushed out to the tick on which the
+*              next one actually expires and the CPU is put to sleep with the 'wait' instruction.  The BSP's tick ISR handler then calls
+*              OSTimeTick() once per tick covered by the stretched interval (see OSTickStretch) so tick processing is
+*              batched on wakeup instead of running at full rate while nothing is scheduled.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) OSTickReload MUST have been set by the BSP (see Tmr_Init()) before this function stretches the tick;
+*                 until then it simply returns and the tick runs at full rate.
+*
+*              2) The stretch is bounded so that the Compare arithmetic stays well below the 32-bit core timer range.
+*
+*              3) While the CPU sleeps through stretched ticks the idle task's counter is not incremented, so the
+*                 statistic task over-reports CPU usage during long idle periods.
+*
+*              4) With OS_CFG_TMR_EN set, armed soft timers bound the stretch as well: Compare is never deferred past
+*                 the base tick on which the timer task must next be signaled for the soonest timer.  Without this
+*                 clamp a timer callback could fire up to 'ticks_max' ticks late while only delayed tasks were
+*                 consulted.  The first timer period in the sum is the partial one OSTmrUpdateCtr is counting down.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+void  OS_CPU_TicklessIdle (void)
+{
+    OS_TICK     ticks;
+    OS_TICK     ticks_max;
+#if OS_CFG_TMR_EN > 0u
+    OS_TICK     tmr_remain;
+    OS_TICK     tmr_ticks;
+#endif
+    CPU_INT32U  cmp;
+    CPU_SR_ALLOC();
+
+
+    if (OSTickReload == (CPU_INT32U)0u) {                   /* Tick source not initialized yet (see Note #1)          */
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+    if (OS_CPU_HighResTCBPtr != (OS_TCB *)0) {              /* Never stretch Compare past an armed sub-tick wake      */
+        CPU_CRITICAL_EXIT();
+        asm volatile("wait");
+        return;
+    }
+#endif
+    if (OSTickStretch == (CPU_INT32U)1u) {                  /* Don't re-stretch an interval that is already stretched */
+        ticks     =  OS_TickNextExpiry();
+        ticks_max = (OS_TICK)((CPU_INT32U)0x40000000u / OSTickReload);
+        if (ticks > ticks_max) {                            /* Bound the stretch (see Note #2)                        */
+            ticks = ticks_max;
+        }
+#if OS_CFG_TMR_EN > 0u
+        tmr_remain = OS_TmrNextExpiry();                    /* An armed soft timer bounds the stretch too (Note #4)   */
+        if (tmr_remain != (OS_TICK)-1) {
+            tmr_ticks = (OS_TICK)OSTmrUpdateCtr;            /* Base ticks to the next timer task signal ...           */
+            if (tmr_remain > (OS_TICK)1u) {                 /* ... plus the whole timer periods after it              */
+                tmr_ticks += (tmr_remain - (OS_TICK)1u) * (OS_TICK)OSTmrUpdateCnt;
+            }
+            if (ticks > tmr_ticks) {
+                ticks = tmr_ticks;
+            }
+        }
+#endif
+        if (ticks > (OS_TICK)1u) {
+            OSTickStretch = (CPU_INT32U)ticks;
+            asm volatile("mfc0   %0,$11" : "=r"(cmp));      /* Defer Compare to the tick of the next expiry           */
+            cmp += ((CPU_INT32U)ticks - 1u) * OSTickReload;
+            asm volatile("mtc0   %0,$11" : : "r"(cmp));
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    asm volatile("wait");                                   /* Sleep until the next enabled interrupt                 */
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                                     IDLE WAIT
+*
+* Description: This function is called by OSIdleTaskHook() when OS_CFG_IDLE_WAIT_EN is set (and tickless idle is not):
+*              it issues the MIPS32 'wait' instruction, halting the pipeline until the next enabled interrupt.  The
+*              tick keeps running at full rate -- this is the lightweight alternative to OS_CPU_TicklessIdle() -- but
+*              between interrupts the core draws no instruction fetches, cutting power and memory-bus contention with
+*              the DMA engines.
+*
+*              While halted the idle task cannot increment OSStatTaskCtr, so a counter-based CPU usage figure would
+*              read the halt as busy time.  The halted time is therefore accumulated in OSIdleWaitTimeAcc and credited
+*              back by OS_StatTask().  An interval normally closes right here when execution falls out of 'wait'; if
+*              the waking interrupt readies a task, the switch away from the idle task closes it in OSTaskSwHook()
+*              instead, so the woken task's run time is never mistaken for idle time.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Statistics calibration (OSStatTaskCPUUsageInit()) measures OSStatTaskCtrMax with the idle loop
+*                 spinning at full speed, so the halt is suppressed until the statistic task is ready.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_IDLE_WAIT_EN > 0u
+void  OS_CPU_IdleWait (void)
+{
+    CPU_SR_ALLOC();
+
+
+#if OS_CFG_STAT_TASK_EN > 0u
+    if (OSStatTaskRdy != DEF_TRUE) {                        /* Spin while OSStatTaskCtrMax is calibrated (Note #1)    */
+        return;
+    }
+#endif
+    CPU_CRITICAL_ENTER();
+    OSIdleWaitTSStart = (CPU_INT32U)OS_TS_GET();
+    OSIdleWaitActive  =  DEF_TRUE;
+    CPU_CRITICAL_EXIT();
+
+    asm volatile("wait");                                   /* Halt until the next enabled interrupt                  */
+
+    CPU_CRITICAL_ENTER();
+    if (OSIdleWaitActive == DEF_TRUE) {                     /* No task ran: the whole interval was idle               */
+        OSIdleWaitTimeAcc += (CPU_INT32U)OS_TS_GET() - OSIdleWaitTSStart;
+        OSIdleWaitActive   =  DEF_FALSE;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                              RESYNCHRONIZE THE TICK
+*
+* Description: This function is called by OSTaskSwHook() when a task switch occurs while the tick interrupt is
+*              stretched across an idle period, meaning some interrupt other than the tick woke the CPU early.  The
+*              tick list is caught up for every tick period that elapsed during the sleep and the Compare register is
+*              pulled back to the next tick boundary.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) This function is assumed to be called with interrupts disabled.
+*
+*              2) OS_TickListUpdate() is called directly instead of signalling the tick task so that OSTickCtr is
+*                 up-to-date BEFORE the task being switched in runs; tasks made ready here run at the next scheduling
+*                 point since the current switch has already selected its target.
+*
+*              3) If the stretched deadline has already been reached, the pending tick interrupt delivers the whole
+*                 batch itself and there is nothing to do here.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+static  void  OS_CPU_TickResync (void)
+{
+    CPU_INT32U  cmp;
+    CPU_INT32U  cnt;
+    CPU_INT32U  remain;
+    CPU_INT32U  period_cnt;
+    CPU_INT32U  owed;
+#if OS_CFG_TMR_EN > 0u
+    OS_ERR      err;
+#endif
+
+
+    asm volatile("mfc0   %0,$11" : "=r"(cmp));              /* End of the stretched Compare interval                  */
+    asm volatile("mfc0   %0,$9"  : "=r"(cnt));
+    remain = cmp - cnt;                                     /* Counts until the stretched deadline                    */
+    if (remain > (OSTickStretch * OSTickReload)) {          /* Deadline already reached? (see Note #3)                */
+        return;
+    }
+    period_cnt = remain / OSTickReload;                     /* Whole tick periods still ahead of us                   */
+    owed       = OSTickStretch - 1u - period_cnt;           /* Whole tick periods slept through so far                */
+    while (owed > (CPU_INT32U)0u) {
+        owed--;
+        OS_TickListUpdate();                                /* Catch up the tick list (see Note #2)                   */
+#if OS_CFG_TMR_EN > 0u
+        OSTmrUpdateCtr--;
+        if (OSTmrUpdateCtr == (OS_CTR)0u) {
+            OSTmrUpdateCtr = OSTmrUpdateCnt;
+            OSTaskSemPost((OS_TCB *)&OSTmrTaskTCB,          /* Signal timer task                                      */
+                          (OS_OPT  ) OS_OPT_POST_NO_SCHED,
+                          (OS_ERR *)&err);
+        }
+#endif
+    }
+    cmp -= period_cnt * OSTickReload;                       /* Pull Compare back to the next tick boundary            */
+    asm volatile("mtc0   %0,$11" : : "r"(cmp));
+    OSTickStretch = (CPU_INT32U)1u;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              HIGH RESOLUTION TIME DELAY
+*
+* Description: Delay the calling task with microsecond granularity.  Whole ticks are slept through the ordinary tick
+*              list (OSTimeDly()); the sub-tick remainder is implemented by pulling the core timer Compare register in
+*              front of the next tick boundary, so the task sleeps instead of spinning and the global tick rate never
+*              has to be raised.  The BSP's tick ISR handler calls OS_CPU_HighResWake() to tell an early wake apart
+*              from a real tick, and OS_CPU_HighResTickArm() after each real tick to arm a wake that falls inside the
+*              new Compare interval.
+*
+* Arguments  : dly_us   the desired delay, in microseconds
+*
+*              p_err    pointer to a variable that will contain an error code from this call:
+*
+*                           OS_ERR_NONE              The delay elapsed
+*                           OS_ERR_TIME_DLY_ISR      If called from an ISR
+*                           OS_ERR_OS_NOT_RUNNING    If the tick source has not been initialized yet
+*
+*                       other codes pass through from OSTimeDly() / OSTaskSemPend().
+*
+* Note(s)    : 1) The wake resolution is OS_CPU_HIGH_RES_MIN core timer counts (3.2 uS at 40 MHz): a remainder below
+*                 it is not armed, and a wake that lands within it of a tick boundary is delivered by the tick.  The
+*                 delay can therefore complete up to OS_CPU_HIGH_RES_MIN counts early but it never busy-waits.
+*
+*              2) A single sub-tick wake can be armed at a time.  A second caller degrades gracefully to a whole-tick
+*                 OSTimeDly(), i.e. the delay gets longer, never shorter.
+*
+*              3) OS_CPU_TicklessIdle() refuses to stretch the Compare interval while a wake is pending (the waiter's
+*                 target would be stretched past), so sub-tick delays and tickless idle coexist.
+*
+*              4) dly_us values up to one core timer wrap minus a tick (~107 seconds at 40 MHz) are supported; the
+*                 count arithmetic is modulo 2^32 throughout.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+void  OSTimeDlyHighRes (CPU_INT32U  dly_us,
+                        OS_ERR     *p_err)
+{
+    CPU_INT32U  cnts;
+    CPU_INT32U  remain;
+    CPU_INT32U  cnt;
+    CPU_INT32U  cmp;
+    OS_TICK     ticks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed from an ISR                                */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+    if (OSTickReload == (CPU_INT32U)0u) {                   /* Tick source not initialized yet (see Tmr_Init())       */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+                                                            /* Core timer counts per microsecond, from the tick rate  */
+    cnts   = dly_us * (OSTickReload / ((CPU_INT32U)1000000u / (CPU_INT32U)OSCfg_TickRate_Hz));
+    ticks  = (OS_TICK)(cnts / OSTickReload);                /* Whole ticks sleep through the ordinary tick list       */
+    remain =  cnts - ((CPU_INT32U)ticks * OSTickReload);
+    if (ticks > (OS_TICK)0u) {
+        OSTimeDly(ticks, OS_OPT_TIME_DLY, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+    if (remain < OS_CPU_HIGH_RES_MIN) {                     /* Remainder below the wake resolution (see Note #1)      */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+    if (OS_CPU_HighResTCBPtr != (OS_TCB *)0) {              /* Wake slot taken (see Note #2): a whole tick instead    */
+        CPU_CRITICAL_EXIT();
+        OSTimeDly((OS_TICK)1u, OS_OPT_TIME_DLY, p_err);
+        return;
+    }
+    OS_CPU_HighResTCBPtr = OSTCBCurPtr;
+    asm volatile("mfc0   %0,$9"  : "=r"(cnt));
+    OS_CPU_HighResTarget = cnt + remain;
+    asm volatile("mfc0   %0,$11" : "=r"(cmp));              /* Compare holds the next tick boundary: a running task   */
+                                                            /* ... means the interval is not stretched (see Note #3)  */
+    if ((CPU_INT32S)(cmp - OS_CPU_HighResTarget) > (CPU_INT32S)OS_CPU_HIGH_RES_MIN) {
+        OS_CPU_HighResCmpSaved = cmp;                       /* Wake lands before the boundary: pull Compare in        */
+        OS_CPU_HighResArmed    = DEF_TRUE;
+        asm volatile("mtc0   %0,$11" : : "r"(OS_CPU_HighResTarget));
+    }                                                       /* ... else the tick fires first and arms it (TickArm)    */
+    CPU_CRITICAL_EXIT();
+    OSTaskSemPend((OS_TICK)0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, p_err);
+    if (*p_err != OS_ERR_NONE) {                            /* Pend aborted: tear the pending wake down ourselves     */
+        CPU_CRITICAL_ENTER();
+        if (OS_CPU_HighResTCBPtr == OSTCBCurPtr) {
+            if (OS_CPU_HighResArmed == DEF_TRUE) {
+                asm volatile("mtc0   %0,$11" : : "r"(OS_CPU_HighResCmpSaved));
+                OS_CPU_HighResArmed = DEF_FALSE;
+            }
+            OS_CPU_HighResTCBPtr = (OS_TCB *)0;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                            HIGH RESOLUTION WAKE DELIVERY
+*
+* Description: Called by the BSP's tick ISR handler FIRST, before any tick processing, to tell an early sub-tick wake
+*              apart from a real tick interrupt.  On an early wake the saved tick boundary is restored into Compare,
+*              the sleeping task is posted and DEF_TRUE is returned -- the handler then skips tick processing, since
+*              the boundary has not been reached.  DEF_FALSE means the interrupt is an ordinary tick.
+*
+* Arguments  : none
+*
+* Returns    : DEF_TRUE     the interrupt was an armed early wake and has been fully handled
+*              DEF_FALSE    the interrupt is a real tick; proceed with tick processing
+*
+* Note(s)    : 1) If the restored boundary slipped past while the wake was being delivered, this interrupt doubles as
+*                 the tick itself: the waiter is already posted and DEF_FALSE directs the handler to run the tick
+*                 (at most OS_CPU_HIGH_RES_MIN counts late), so a Compare match is never lost to the 2^32 wrap.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+CPU_BOOLEAN  OS_CPU_HighResWake (void)
+{
+    OS_TCB     *p_tcb;
+    OS_ERR      err;
+    CPU_INT32U  cnt;
+
+
+    if (OS_CPU_HighResArmed != DEF_TRUE) {                  /* Compare sat at the tick boundary: a real tick          */
+        return (DEF_FALSE);
+    }
+    asm volatile("mtc0   %0,$11" : : "r"(OS_CPU_HighResCmpSaved));
+    OS_CPU_HighResArmed  =  DEF_FALSE;                      /* Boundary restored; deliver the wake                    */
+    p_tcb                =  OS_CPU_HighResTCBPtr;
+    OS_CPU_HighResTCBPtr = (OS_TCB *)0;
+    if (p_tcb != (OS_TCB *)0) {
+        OSTaskSemPostFromISR(p_tcb, &err);
+    }
+    asm volatile("mfc0   %0,$9" : "=r"(cnt));
+    if ((CPU_INT32S)(cnt - OS_CPU_HighResCmpSaved) >= (CPU_INT32S)0) {
+        return (DEF_FALSE);                                 /* Boundary already slipped past (see Note #1)            */
+    }
+    return (DEF_TRUE);
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                             HIGH RESOLUTION TICK RE-ARM
+*
+* Description: Called by the BSP's tick ISR handler after each REAL tick, once Compare has been advanced to the next
+*              boundary.  If a sub-tick wake is pending and its target now falls inside the new Compare interval the
+*              Compare register is pulled in to the target; a target that has already been reached (the wake landed
+*              within the wake resolution of the boundary, so it was never armed) is posted right here.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Runs inside the tick ISR, so the high resolution state cannot change underneath it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+void  OS_CPU_HighResTickArm (void)
+{
+    OS_TCB     *p_tcb;
+    OS_ERR      err;
+    CPU_INT32U  cnt;
+    CPU_INT32U  cmp;
+
+
+    if ((OS_CPU_HighResTCBPtr == (OS_TCB *)0) ||
+        (OS_CPU_HighResArmed  ==  DEF_TRUE)) {
+        return;
+    }
+    asm volatile("mfc0   %0,$9" : "=r"(cnt));
+    if ((CPU_INT32S)(OS_CPU_HighResTarget - cnt) < (CPU_INT32S)OS_CPU_HIGH_RES_MIN) {
+        p_tcb                =  OS_CPU_HighResTCBPtr;       /* Target reached, or too close to arm: post it now       */
+        OS_CPU_HighResTCBPtr = (OS_TCB *)0;
+        OSTaskSemPostFromISR(p_tcb, &err);
+        return;
+    }
+    asm volatile("mfc0   %0,$11" : "=r"(cmp));
+    if ((CPU_INT32S)(cmp - OS_CPU_HighResTarget) > (CPU_INT32S)OS_CPU_HIGH_RES_MIN) {
+        OS_CPU_HighResCmpSaved = cmp;                       /* Target inside the new interval: pull Compare in        */
+        OS_CPU_HighResArmed    =  DEF_TRUE;
+        asm volatile("mtc0   %0,$11" : : "r"(OS_CPU_HighResTarget));
+    }
+}
+#endif
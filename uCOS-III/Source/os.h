@@ -61,6 +61,62 @@ extern "C" {
 #include <os_cpu.h>
 
 
+/*
+************************************************************************************************************************
+*                                         RAM-RESIDENT FUNCTION PLACEMENT
+*
+* Note(s) : (1) A port may define OS_RAM_FN in os_cpu.h as a function attribute that places the kernel's hottest
+*               functions (OSSched(), OS_PrioGetHighest()) in RAM, avoiding flash wait states on every scheduling
+*               event.  Ports that do not define it get the default (flash) placement.
+************************************************************************************************************************
+*/
+
+#ifndef  OS_RAM_FN
+#define  OS_RAM_FN
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        TIMED-WAKEUP JITTER MEASUREMENT
+*
+* Note(s) : (1) When OS_CFG_TASK_JITTER_EN is defined as 1 in os_cfg.h, each OS_TCB records the delta between the
+*               tick that made the task ready (a timed delay or pend timeout expiring) and the timestamp at which
+*               the task was actually dispatched.  The per-task maximum and a log2 histogram are read back with
+*               OSTaskJitterGet().  The feature is opt-in; projects that do not define the switch get no extra
+*               TCB fields and no extra code in the tick or context switch paths.
+************************************************************************************************************************
+*/
+
+#ifndef  OS_CFG_TASK_JITTER_EN
+#define  OS_CFG_TASK_JITTER_EN          0u
+#endif
+
+#ifndef  OS_CFG_TASK_JITTER_HIST_SIZE
+#define  OS_CFG_TASK_JITTER_HIST_SIZE  16u                  /* Bucket n counts deltas in [2^n, 2^(n+1)) TS units      */
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             ANOMALY TRIGGER HOOK
+*
+* Note(s) : (1) The jitter and scheduler-lock measurements record anomalies for later inspection; by the time their
+*               peaks are read back, the events surrounding them are long overwritten.  When OSAnomalyHookPtr is set,
+*               the kernel also calls it AT the moment a measurement crosses its trigger threshold (a threshold of 0
+*               disables that predicate), so the application can freeze a trace buffer around the event.
+*
+*           (2) The hook runs in the detection's own context: the context switch path for OS_ANOMALY_DLY_LATE
+*               (interrupts disabled, see OSTaskSwHook() in the port) and the scheduler unlock path for
+*               OS_ANOMALY_SCHED_LOCK (see OS_SchedLockTimeMeasStop()).  It must only set flags or write memory;
+*               it must not call kernel services or busy-wait.
+************************************************************************************************************************
+*/
+
+#define  OS_ANOMALY_DLY_LATE            1u                  /* Timed wakeup dispatched late                           */
+#define  OS_ANOMALY_SCHED_LOCK          2u                  /* Scheduler lock held too long                           */
+
+
 /*
 ************************************************************************************************************************
 *                                               CRITICAL SECTION HANDLING
@@ -110,7 +166,7 @@ extern "C" {
              OSSchedLockNestingCtr--;                              \
              if (OSSchedLockNestingCtr == (OS_NESTING_CTR)0) {     \
                  OS_SCHED_LOCK_TIME_MEAS_STOP();                   \
-                 if (OSIntQNbrEntries > (OS_OBJ_QTY)0) {           \
+                 if (OSIntQInIx != OSIntQOutIx) {                  \
                      CPU_CRITICAL_EXIT();                          \
                      OS_Sched0();                                  \
                  } else {                                          \
@@ -160,7 +216,16 @@ extern "C" {
 
 #define  OS_PRIO_TBL_SIZE           ((OS_CFG_PRIO_MAX - 1u) / (sizeof(CPU_DATA) * 8u) + 1u)
 
-#define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
+#define  OS_OBJ_ID_NONE             ((OS_OBJ_ID)0u)
+
+                                                            /* Milliseconds to ticks, rounded up so a delay is  */
+                                                            /* ... never shortened.  Folds to a constant when   */
+                                                            /* ... 'ms' is one: periodic loops should pass the  */
+                                                            /* ... result to OSTimeDly() instead of converting  */
+                                                            /* ... through OSTimeDlyHMSM() on every iteration.  */
+#define  OS_MS_TO_TICKS(ms)        ((OS_TICK)((((OS_TICK)(ms) * (OS_TICK)OS_CFG_TICK_RATE_HZ) + 999u) / 1000u))
+
+#define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u) || (OS_CFG_SQ_EN > 0u)) ? 1u : 0u)
 
 /*$PAGE*/
 /*
@@ -205,6 +270,8 @@ extern "C" {
 #define  OS_ERR_H                             (OS_ERR)(17000u)
 
 #define  OS_ERR_I                             (OS_ERR)(18000u)
+#define  OS_ERR_IDLE_WORK_FNCT_NULL           (OS_ERR)(18005u)
+#define  OS_ERR_IDLE_WORK_NOT_FOUND           (OS_ERR)(18006u)
 #define  OS_ERR_ILLEGAL_CREATE_RUN_TIME       (OS_ERR)(18001u)
 #define  OS_ERR_INT_Q                         (OS_ERR)(18002u)
 #define  OS_ERR_INT_Q_FULL                    (OS_ERR)(18003u)
@@ -245,6 +312,7 @@ extern "C" {
 #define  OS_ERR_OBJ_DEL                       (OS_ERR)(24002u)
 #define  OS_ERR_OBJ_PTR_NULL                  (OS_ERR)(24003u)
 #define  OS_ERR_OBJ_TYPE                      (OS_ERR)(24004u)
+#define  OS_ERR_OBJ_ID_INVALID                (OS_ERR)(24005u)
 
 #define  OS_ERR_OPT_INVALID                   (OS_ERR)(24101u)
 
@@ -319,6 +387,8 @@ extern "C" {
 #define  OS_ERR_TASK_SUSPEND_ISR              (OS_ERR)(29020u)
 #define  OS_ERR_TASK_SUSPEND_PRIO             (OS_ERR)(29021u)
 #define  OS_ERR_TASK_WAITING                  (OS_ERR)(29022u)
+#define  OS_ERR_TASK_SLAB_NONE_FREE           (OS_ERR)(29023u)
+#define  OS_ERR_TASK_SLAB_NOT_OWNED           (OS_ERR)(29024u)
 
 #define  OS_ERR_TCB_INVALID                   (OS_ERR)(29101u)
 
@@ -334,6 +404,7 @@ extern "C" {
 #define  OS_ERR_TIME_NOT_DLY                  (OS_ERR)(29308u)
 #define  OS_ERR_TIME_SET_ISR                  (OS_ERR)(29309u)
 #define  OS_ERR_TIME_ZERO_DLY                 (OS_ERR)(29310u)
+#define  OS_ERR_TIME_DEADLINE_MISSED          (OS_ERR)(29311u)
 
 #define  OS_ERR_TIMEOUT                       (OS_ERR)(29401u)
 
@@ -403,6 +474,8 @@ extern "C" {
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_SQ                   (OS_STATE)(  8u)  /* Pending on slot queue                              */
+#define  OS_TASK_PEND_ON_PIPE                 (OS_STATE)(  9u)  /* Pending on byte-stream pipe                        */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -424,11 +497,15 @@ extern "C" {
 
 #if     (CPU_CFG_ENDIAN_TYPE == CPU_ENDIAN_TYPE_BIG)
 #define  OS_OBJ_TYPE_NONE           (OS_OBJ_TYPE)(0x4E4F4E45u)  /* "NONE" in ASCII.                                   */
+#define  OS_OBJ_TYPE_EDF            (OS_OBJ_TYPE)(0x45444620u)  /* "EDF " in ASCII.                                   */
 #define  OS_OBJ_TYPE_FLAG           (OS_OBJ_TYPE)(0x464C4147u)  /* "FLAG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MEM            (OS_OBJ_TYPE)(0x4D454D20u)  /* "MEM " in ASCII.                                   */
+#define  OS_OBJ_TYPE_MTASK          (OS_OBJ_TYPE)(0x4D54534Bu)  /* "MTSK" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MUTEX          (OS_OBJ_TYPE)(0x4D555458u)  /* "MUTX" in ASCII.                                   */
+#define  OS_OBJ_TYPE_PIPE           (OS_OBJ_TYPE)(0x50495045u)  /* "PIPE" in ASCII.                                   */
 #define  OS_OBJ_TYPE_Q              (OS_OBJ_TYPE)(0x51554555u)  /* "QUEU" in ASCII.                                   */
 #define  OS_OBJ_TYPE_SEM            (OS_OBJ_TYPE)(0x53454D41u)  /* "SEMA" in ASCII.                                   */
+#define  OS_OBJ_TYPE_SQ             (OS_OBJ_TYPE)(0x534C5451u)  /* "SLTQ" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_MSG       (OS_OBJ_TYPE)(0x544D5347u)  /* "TMSG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_SIGNAL    (OS_OBJ_TYPE)(0x54534947u)  /* "TSIG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TICK           (OS_OBJ_TYPE)(0x5449434Bu)  /* "TICK" in ASCII.                                   */
@@ -437,11 +514,15 @@ extern "C" {
 
 #if     (CPU_CFG_DATA_SIZE   == CPU_WORD_SIZE_32)
 #define  OS_OBJ_TYPE_NONE           (OS_OBJ_TYPE)(0x454E4F4Eu)  /* "NONE" in ASCII.                                   */
+#define  OS_OBJ_TYPE_EDF            (OS_OBJ_TYPE)(0x20464445u)  /* "EDF " in ASCII.                                   */
 #define  OS_OBJ_TYPE_FLAG           (OS_OBJ_TYPE)(0x47414C46u)  /* "FLAG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MEM            (OS_OBJ_TYPE)(0x204D454Du)  /* "MEM " in ASCII.                                   */
+#define  OS_OBJ_TYPE_MTASK          (OS_OBJ_TYPE)(0x4B53544Du)  /* "MTSK" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MUTEX          (OS_OBJ_TYPE)(0x5854554Du)  /* "MUTX" in ASCII.                                   */
+#define  OS_OBJ_TYPE_PIPE           (OS_OBJ_TYPE)(0x45504950u)  /* "PIPE" in ASCII.                                   */
 #define  OS_OBJ_TYPE_Q              (OS_OBJ_TYPE)(0x55455551u)  /* "QUEU" in ASCII.                                   */
 #define  OS_OBJ_TYPE_SEM            (OS_OBJ_TYPE)(0x414D4553u)  /* "SEMA" in ASCII.                                   */
+#define  OS_OBJ_TYPE_SQ             (OS_OBJ_TYPE)(0x51544C53u)  /* "SLTQ" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_MSG       (OS_OBJ_TYPE)(0x47534D54u)  /* "TMSG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_SIGNAL    (OS_OBJ_TYPE)(0x47495354u)  /* "TSIG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TICK           (OS_OBJ_TYPE)(0x4B434954u)  /* "TICK" in ASCII.                                   */
@@ -449,11 +530,15 @@ extern "C" {
 
 #elif   (CPU_CFG_DATA_SIZE   == CPU_WORD_SIZE_16)
 #define  OS_OBJ_TYPE_NONE           (OS_OBJ_TYPE)(0x4F4E454Eu)  /* "NONE" in ASCII.                                   */
+#define  OS_OBJ_TYPE_EDF            (OS_OBJ_TYPE)(0x44452046u)  /* "EDF " in ASCII.                                   */
 #define  OS_OBJ_TYPE_FLAG           (OS_OBJ_TYPE)(0x4C464741u)  /* "FLAG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MEM            (OS_OBJ_TYPE)(0x454D204Du)  /* "MEM " in ASCII.                                   */
+#define  OS_OBJ_TYPE_MTASK          (OS_OBJ_TYPE)(0x544D4B53u)  /* "MTSK" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MUTEX          (OS_OBJ_TYPE)(0x554D5854u)  /* "MUTX" in ASCII.                                   */
+#define  OS_OBJ_TYPE_PIPE           (OS_OBJ_TYPE)(0x49504550u)  /* "PIPE" in ASCII.                                   */
 #define  OS_OBJ_TYPE_Q              (OS_OBJ_TYPE)(0x55515545u)  /* "QUEU" in ASCII.                                   */
 #define  OS_OBJ_TYPE_SEM            (OS_OBJ_TYPE)(0x4553414Du)  /* "SEMA" in ASCII.                                   */
+#define  OS_OBJ_TYPE_SQ             (OS_OBJ_TYPE)(0x4C535154u)  /* "SLTQ" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_MSG       (OS_OBJ_TYPE)(0x4D544753u)  /* "TMSG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_SIGNAL    (OS_OBJ_TYPE)(0x53544749u)  /* "TSIG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TICK           (OS_OBJ_TYPE)(0x49544B43u)  /* "TICK" in ASCII.                                   */
@@ -461,11 +546,15 @@ extern "C" {
 
 #else                                                           /* Dflt CPU_WORD_SIZE_08.                             */
 #define  OS_OBJ_TYPE_NONE           (OS_OBJ_TYPE)(0x4E4F4E45u)  /* "NONE" in ASCII.                                   */
+#define  OS_OBJ_TYPE_EDF            (OS_OBJ_TYPE)(0x45444620u)  /* "EDF " in ASCII.                                   */
 #define  OS_OBJ_TYPE_FLAG           (OS_OBJ_TYPE)(0x464C4147u)  /* "FLAG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MEM            (OS_OBJ_TYPE)(0x4D454D20u)  /* "MEM " in ASCII.                                   */
+#define  OS_OBJ_TYPE_MTASK          (OS_OBJ_TYPE)(0x4D54534Bu)  /* "MTSK" in ASCII.                                   */
 #define  OS_OBJ_TYPE_MUTEX          (OS_OBJ_TYPE)(0x4D555458u)  /* "MUTX" in ASCII.                                   */
+#define  OS_OBJ_TYPE_PIPE           (OS_OBJ_TYPE)(0x50495045u)  /* "PIPE" in ASCII.                                   */
 #define  OS_OBJ_TYPE_Q              (OS_OBJ_TYPE)(0x51554555u)  /* "QUEU" in ASCII.                                   */
 #define  OS_OBJ_TYPE_SEM            (OS_OBJ_TYPE)(0x53454D41u)  /* "SEMA" in ASCII.                                   */
+#define  OS_OBJ_TYPE_SQ             (OS_OBJ_TYPE)(0x534C5451u)  /* "SLTQ" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_MSG       (OS_OBJ_TYPE)(0x544D5347u)  /* "TMSG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TASK_SIGNAL    (OS_OBJ_TYPE)(0x54534947u)  /* "TSIG" in ASCII.                                   */
 #define  OS_OBJ_TYPE_TICK           (OS_OBJ_TYPE)(0x5449434Bu)  /* "TICK" in ASCII.                                   */
@@ -555,6 +644,10 @@ extern "C" {
 #define  OS_OPT_TASK_STK_CLR                 (OS_OPT)(0x0002u)  /* Clear the stack when the task is create            */
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+#define  OS_TASK_STK_REDZONE_MARK          (CPU_STK)(0xABCD2345u) /* Pattern filled in the stack redzone               */
+#endif
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -634,20 +727,38 @@ extern "C" {
 ************************************************************************************************************************
 */
 
+typedef  struct  os_cfg_data_ram_entry  OS_CFG_DATA_RAM_ENTRY;
+
+typedef  struct  os_edf              OS_EDF;
+
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
 
 typedef  struct  os_mem              OS_MEM;
 
+typedef  struct  os_mtask            OS_MTASK;
+typedef  void                      (*OS_MTASK_FNCT)(void *p_arg);
+
 typedef  struct  os_msg              OS_MSG;
 typedef  struct  os_msg_pool         OS_MSG_POOL;
 typedef  struct  os_msg_q            OS_MSG_Q;
 
 typedef  struct  os_mutex            OS_MUTEX;
 
+#if OS_CFG_IDLE_WORK_EN > 0u
+typedef  CPU_BOOLEAN               (*OS_IDLE_WORK_FNCT)(void *p_arg);
+typedef  struct  os_idle_work        OS_IDLE_WORK;
+#endif
+
 typedef  struct  os_int_q            OS_INT_Q;
 
+typedef  struct  os_pipe             OS_PIPE;
+
 typedef  struct  os_q                OS_Q;
 
+typedef  struct  os_sq               OS_SQ;
+
+typedef  struct  os_sq_slot          OS_SQ_SLOT;
+
 typedef  struct  os_sem              OS_SEM;
 
 
@@ -655,6 +766,10 @@ typedef  void                      (*OS_TASK_PTR)(void *p_arg);
 
 typedef  struct  os_tcb              OS_TCB;
 
+typedef  struct  os_task_slab_pool   OS_TASK_SLAB_POOL;
+
+typedef  struct  os_task_desc        OS_TASK_DESC;
+
 typedef  struct  os_rdy_list         OS_RDY_LIST;
 
 typedef  struct  os_tick_spoke       OS_TICK_SPOKE;
@@ -673,6 +788,10 @@ typedef  void                      (*OS_APP_HOOK_VOID)(void);
 typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
 #endif
 
+#if (OS_CFG_TASK_JITTER_EN > 0u) || (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+typedef  void                      (*OS_ANOMALY_HOOK)(CPU_INT08U anomaly_id, CPU_TS measured);
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -682,6 +801,34 @@ typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
 ************************************************************************************************************************
 */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                            KERNEL RAM FOOTPRINT TABLE ENTRY
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_cfg_data_ram_entry {
+    CPU_CHAR     const  *NamePtr;                           /* Name of the statically allocated kernel object         */
+    CPU_INT32U           SizeRAM;                           /* RAM consumed by the object, in octets                  */
+};
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                IDLE-TIME WORK ITEM
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if OS_CFG_IDLE_WORK_EN > 0u
+struct  os_idle_work {
+    OS_IDLE_WORK_FNCT    FnctPtr;                           /* Runs one bounded slice; DEF_TRUE when work is finished */
+    void                *ArgPtr;                            /* Checkpoint state, owned by the work item               */
+    CPU_CHAR            *NamePtr;
+    OS_IDLE_WORK        *NextPtr;                           /* Singly linked list of registered items                 */
+    CPU_INT32U           SliceCtr;                          /* Slices executed so far                                 */
+    CPU_BOOLEAN          Done;                              /* Finished items stay listed but are no longer run       */
+};
+#endif
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                    ISR POST DATA
@@ -691,7 +838,6 @@ typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
 struct  os_int_q {
     OS_OBJ_TYPE          Type;                              /* Type of object placed in the circular list             */
-    OS_INT_Q            *NextPtr;                           /* Pointer to next OS_INT_Q in  circular list             */
     void                *ObjPtr;                            /* Pointer to object placed in the queue                  */
     void                *MsgPtr;                            /* Pointer to message if posting to a message queue       */
     OS_MSG_SIZE          MsgSize;                           /* Message Size       if posting to a message queue       */
@@ -707,10 +853,17 @@ struct  os_int_q {
 ------------------------------------------------------------------------------------------------------------------------
 */
 
+/*
+* Note(s)    : 1) The ready list is kept to exactly two pointers per priority so that OSRdyList[] packs into adjacent
+*                 8-byte entries (a power-of-two stride the compiler can index with a shift).  Emptiness is tested
+*                 with .HeadPtr == 0 and a single entry with .HeadPtr == .TailPtr; no counter is stored.  OSRdyList[]
+*                 is sized by OS_CFG_PRIO_MAX, so trimming that to the number of priorities actually used shrinks the
+*                 table directly.
+*/
+
 struct  os_rdy_list {
     OS_TCB              *HeadPtr;                           /* Pointer to task that will run at selected priority     */
     OS_TCB              *TailPtr;                           /* Pointer to last task          at selected priority     */
-    OS_OBJ_QTY           NbrEntries;                        /* Number of entries             at selected priority     */
 };
 
 
@@ -729,6 +882,9 @@ struct  os_pend_data {
     void                *RdyMsgPtr;
     OS_MSG_SIZE          RdyMsgSize;
     CPU_TS               RdyTS;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    OS_PRIO              Prio;                              /* Priority the entry was inserted at (see os_core.c)     */
+#endif
 };
 
 
@@ -737,6 +893,10 @@ struct  os_pend_list {
     OS_PEND_DATA        *HeadPtr;
     OS_PEND_DATA        *TailPtr;
     OS_OBJ_QTY           NbrEntries;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Bitmap of priorities present in the list               */
+    OS_PEND_DATA        *PrioTailPtrTbl[OS_CFG_PRIO_MAX];   /* Last waiter at each priority                           */
+#endif
 };
 
 
@@ -769,7 +929,15 @@ struct  os_flag_grp {                                       /* Event Flag Group
     CPU_CHAR            *DbgNamePtr;
 #endif
     OS_FLAGS             Flags;                             /* 8, 16 or 32 bit flags                                  */
+    OS_FLAGS             PendFlagsMask;                     /* OR of the .FlagsPend masks of all waiting tasks; may   */
+                                                            /* ... contain stale bits (see OS_FlagPost() Note #1)     */
     CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    CPU_BOOLEAN          TSEn;                              /* Posts time stamp only when DEF_TRUE (OSFlagTSCfg())    */
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+    OS_OBJ_ID            RegId;                             /* Compact ID assigned by the object registry             */
+#endif
 };
 
 /*$PAGE*/
@@ -788,6 +956,8 @@ struct os_mem {                                             /* MEMORY CONTROL BL
     OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
     OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
     OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of blocks in use (see OSMemGet() Note #2)  */
+    OS_CTR               GetFailCtr;                        /* Number of failed OSMemGet() calls                      */
 #if OS_CFG_DBG_EN > 0u
     OS_MEM              *DbgPrevPtr;
     OS_MEM              *DbgNextPtr;
@@ -815,6 +985,7 @@ struct  os_msg_pool {                                       /* OS_MSG POOL
     OS_MSG              *NextPtr;                           /* Pointer to next message                                */
     OS_MSG_QTY           NbrFree;                           /* Number of messages available from this pool            */
     OS_MSG_QTY           NbrUsed;                           /* Number of messages used                                */
+    OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used (sizes the pool)          */
 };
 
 
@@ -825,6 +996,8 @@ struct  os_msg_q {                                          /* OS_MSG_Q
     OS_MSG_QTY           NbrEntriesSize;                    /* Maximum allowable number of entries in the queue       */
     OS_MSG_QTY           NbrEntries;                        /* Current number of entries in the queue                 */
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
+    OS_MSG_POOL         *PoolPtr;                           /* Pool OS_MSGs are allocated from; &OSMsgPool unless ... */
+                                                            /* ... a private pool was given (see OSQCreate())         */
 };
 
 /*$PAGE*/
@@ -847,6 +1020,9 @@ struct  os_mutex {
     OS_PRIO              OwnerOriginalPrio;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
     CPU_TS               TS;
+#if OS_CFG_OBJ_REG_EN > 0u
+    OS_OBJ_ID            RegId;                             /* Compact ID assigned by the object registry             */
+#endif
 };
 
 /*$PAGE*/
@@ -866,8 +1042,132 @@ struct  os_q {
     CPU_CHAR            *DbgNamePtr;
 #endif
     OS_MSG_Q             MsgQ;                              /* List of tasks waiting on event flag group              */
+    OS_MSG_POOL          MsgPool;                           /* Private OS_MSG pool (only used if one was supplied ... */
+                                                            /* ... to OSQCreate(); see os_q.c Note #2)                */
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    CPU_BOOLEAN          TSEn;                              /* Posts time stamp only when DEF_TRUE (OSQTSCfg())       */
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+    OS_OBJ_ID            RegId;                             /* Compact ID assigned by the object registry             */
+#endif
+};
+
+/*$PAGE*/
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                        EARLIEST-DEADLINE-FIRST (EDF) CLASS
+*
+* Note(s) : (1) An OS_EDF registers a periodic task with the EDF class (see os_edf.c).  Registered tasks live in a
+*               reserved band of TWO priorities: the task whose current job has the EARLIEST absolute deadline runs at
+*               OSCfg_EdfPrioHi and every other registered task parks at OSCfg_EdfPrioLo.  'Release' and 'Deadline'
+*               are absolute tick values maintained at job boundaries by OSEdfJobWait(); deadline overruns are counted
+*               by the tick task (see OS_EdfUpdate() in os_edf.c).
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_edf {
+    OS_OBJ_TYPE          Type;                              /* EDF registration; should be set to OS_OBJ_TYPE_EDF     */
+    CPU_CHAR            *NamePtr;                           /* Pointer to EDF registration name (NUL terminated)      */
+    OS_TCB              *TCBPtr;                            /* TCB of the registered task                             */
+    OS_EDF              *NextPtr;                           /* Next registration in the EDF class list                */
+    OS_TICK              Period;                            /* Job release period, in ticks                           */
+    OS_TICK              DeadlineRel;                       /* Deadline, in ticks after each release                  */
+    OS_TICK              Release;                           /* Absolute tick of the current job's release             */
+    OS_TICK              Deadline;                          /* Absolute tick by which the current job must finish     */
+    CPU_BOOLEAN          JobActive;                         /* A job is released and not yet completed                */
+    CPU_BOOLEAN          OverrunFlagged;                    /* Current job's missed deadline already counted          */
+    CPU_INT32U           OverrunCtr;                        /* Number of jobs that missed their deadline              */
+};
+
+/*$PAGE*/
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                           RUN-TO-COMPLETION MINITASKS
+*
+* Note(s) : (1) A minitask is an event handler that runs to completion on the SHARED stack of the minitask dispatcher
+*               task, at the dispatcher's priority.  It costs this structure instead of an OS_TCB plus a private
+*               stack, which is what makes it attractive for simple event-reactive logic on RAM-limited parts.  The
+*               handler MUST NOT pend, delay or otherwise block.
+*
+*           (2) 'Rdy' and 'NextPtr' implement the dispatcher's ready FIFO: a minitask appears in the FIFO at most
+*               once, and posts arriving while it is queued (or running) coalesce through 'PostCtr'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_mtask {
+    OS_OBJ_TYPE          Type;                              /* Minitask; should be set to OS_OBJ_TYPE_MTASK           */
+    CPU_CHAR            *NamePtr;                           /* Pointer to Minitask Name (NUL terminated ASCII)        */
+    OS_MTASK_FNCT        Fnct;                              /* Handler; runs to completion, must never block          */
+    void                *ArgPtr;                            /* Argument passed to the handler on every dispatch       */
+    OS_MTASK            *NextPtr;                           /* Next minitask in the dispatcher's ready FIFO           */
+    CPU_BOOLEAN          Rdy;                               /* Minitask is already in the ready FIFO                  */
+    OS_SEM_CTR           PostCtr;                           /* Posts not yet serviced by a dispatch                   */
+    CPU_INT32U           DispCtr;                           /* Total number of dispatches (statistics)                */
+};
+
+/*$PAGE*/
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  BYTE-STREAM PIPES
+*
+* Note(s) : (1) A pipe moves a byte stream through a per-pipe ring buffer with bulk read/write semantics: a producer
+*               (typically a communication ISR) deposits a burst of N bytes in ONE call and a single waiting consumer
+*               is woken once per burst instead of once per byte.  No OS_MSG is allocated from the global message
+*               pool.
+*
+*           (2) 'In' and 'Out' are free-running byte counters; the number of bytes in the pipe is 'In - Out' and the
+*               counters are reduced modulo 'BufSize' when addressing the ring.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_pipe {
+    OS_OBJ_TYPE          Type;                              /* Pipe; should be set to OS_OBJ_TYPE_PIPE                */
+    CPU_CHAR            *NamePtr;                           /* Pointer to Pipe Name (NUL terminated ASCII)            */
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on the pipe                      */
+    CPU_INT08U          *BufPtr;                            /* Ring buffer storage                                    */
+    CPU_INT32U           BufSize;                           /* Size of the ring buffer (in bytes)                     */
+    CPU_INT32U  volatile In;                                /* Nbr of bytes ever written  to  the pipe (free-running) */
+    CPU_INT32U  volatile Out;                               /* Nbr of bytes ever consumed from the pipe (free-running)*/
+};
+
+/*$PAGE*/
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 ZERO-COPY SLOT QUEUES
+*
+* Note(s) : (1) A slot queue passes fixed-size messages through a per-queue preallocated slot ring.  Producers borrow
+*               a free slot with OSSQPostAlloc(), write the payload IN PLACE and publish it with OSSQPost(); consumers
+*               borrow the oldest published slot with OSSQPend() and hand it back with OSSQRelease().  No OS_MSG is
+*               allocated from the global message pool and no payload is ever copied.
+*
+*           (2) Each slot is an OS_SQ_SLOT header immediately followed by its payload.  The 'Full' marker is written
+*               LAST by the producer and thus publishes the slot; the indices are free-running and are reduced modulo
+*               'SlotQty' when addressing the ring.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_sq_slot {
+    OS_MSG_SIZE          MsgSize;                           /* Size of the posted payload (in bytes)                  */
+    CPU_INT08U  volatile Full;                              /* Publish marker; written LAST by the producer           */
+};
+
+struct  os_sq {
+    OS_OBJ_TYPE          Type;                              /* Slot queue; should be set to OS_OBJ_TYPE_SQ            */
+    CPU_CHAR            *NamePtr;                           /* Pointer to Slot Queue Name (NUL terminated ASCII)      */
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on the slot queue                */
+    CPU_INT08U          *StoragePtr;                        /* Ring storage; 'SlotQty' slots of 'SlotStride' bytes    */
+    OS_MSG_QTY           SlotQty;                           /* Number of slots in the ring                            */
+    OS_MSG_SIZE          SlotSize;                          /* Payload capacity of one slot (in bytes)                */
+    CPU_INT32U           SlotStride;                        /* Bytes from one slot header to the next                 */
+    CPU_INT32U  volatile AllocIx;                           /* Index of next slot handed to a producer (free-running) */
+    CPU_INT32U  volatile OutIx;                             /* Index of next slot handed to a consumer (free-running) */
+    CPU_INT32U  volatile FreeIx;                            /* Index of next slot to be released       (free-running) */
 };
 
+                                                            /* Bytes of storage needed for a 'qty'-slot ring          */
+#define  OS_SQ_STORAGE_SIZE(qty, size)     ((qty) * (sizeof(OS_SQ_SLOT) + \
+                                           (((size) + sizeof(CPU_ALIGN) - 1u) & ~(sizeof(CPU_ALIGN) - 1u))))
+
 /*$PAGE*/
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -886,6 +1186,12 @@ struct  os_sem {
 #endif
     OS_SEM_CTR           Ctr;                               /* List of tasks waiting on event flag group              */
     CPU_TS               TS;
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    CPU_BOOLEAN          TSEn;                              /* Posts time stamp only when DEF_TRUE (OSSemTSCfg())     */
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+    OS_OBJ_ID            RegId;                             /* Compact ID assigned by the object registry             */
+#endif
 };
 
 /*$PAGE*/
@@ -895,12 +1201,22 @@ struct  os_sem {
 ------------------------------------------------------------------------------------------------------------------------
 */
 
-struct os_tcb {
-    CPU_STK             *StkPtr;                            /* Pointer to current top of stack                        */
-
-    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
+/*
+* Note(s)    : 1) The TCB is laid out hot-to-cold.  The fields up to and including .SemCtr are the ONLY ones touched by
+*                 the context switch, the scheduler, the tick handler and the pend/post paths, so the per-switch
+*                 working set stays within the first few words of the TCB (short load/store offsets, one cache line
+*                 on cores that cache KSEG0 data).  Everything below .SemCtr is creation-time, statistics, profiling
+*                 or debug data and is deliberately kept out of the hot header.
+*
+*              2) .StkPtr MUST remain the first field: the context switch code in os_cpu_a.S accesses it at offset 0.
+*
+*              3) The byte-sized state fields (.Prio, .TaskState, .PendOn, .PendStatus) are grouped so they pack into
+*                 a single word instead of padding out four.
+*/
 
-    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
+struct os_tcb {
+                                                            /* --------------- HOT HEADER (see Note #1) ------------- */
+    CPU_STK             *StkPtr;                            /* Pointer to current top of stack (MUST be first)        */
 
     OS_TCB              *NextPtr;                           /* Pointer to next     TCB in the TCB list                */
     OS_TCB              *PrevPtr;                           /* Pointer to previous TCB in the TCB list                */
@@ -910,12 +1226,18 @@ struct os_tcb {
 
     OS_TICK_SPOKE       *TickSpokePtr;                      /* Pointer to tick spoke if task is in the tick list      */
 
-    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
-
-    CPU_STK             *StkBasePtr;                        /* Pointer to base address of stack                       */
+                                                            /* DELAY / TIMEOUT                                        */
+    OS_TICK              TickCtrPrev;                       /* Previous time when task was            ready           */
+    OS_TICK              TickCtrMatch;                      /* Absolute time when task is going to be ready           */
+    OS_TICK              TickRemain;                        /* Number of ticks remaining for a match (set when ...    */
+                                                            /* ... the task is inserted in the tick list)             */
+    OS_TICK              TimeQuanta;
+    OS_TICK              TimeQuantaCtr;
 
-    OS_TASK_PTR          TaskEntryAddr;                     /* Pointer to task entry point address                    */
-    void                *TaskEntryArg;                      /* Argument passed to task when it was created            */
+    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
+    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
+    OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
+    OS_STATUS            PendStatus;                        /* Pend status                                            */
 
     OS_PEND_DATA        *PendDataTblPtr;                    /* Pointer to list containing objects pended on           */
     OS_OBJ_QTY           PendDataTblEntries;                /* Size of array of objects to pend on                    */
@@ -927,6 +1249,26 @@ struct os_tcb {
     OS_MSG_SIZE          MsgSize;
 #endif
 
+#if OS_CFG_FLAG_EN > 0u
+    OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
+    OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
+    OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
+#endif
+
+    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
+
+                                                            /* ----------------- COLD DATA (see Note #1) ------------ */
+    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
+
+    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
+
+    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
+
+    CPU_STK             *StkBasePtr;                        /* Pointer to base address of stack                       */
+
+    OS_TASK_PTR          TaskEntryAddr;                     /* Pointer to task entry point address                    */
+    void                *TaskEntryArg;                      /* Argument passed to task when it was created            */
+
 #if OS_CFG_TASK_Q_EN > 0u
     OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
 #if OS_CFG_TASK_PROFILE_EN > 0u
@@ -935,17 +1277,10 @@ struct os_tcb {
 #endif
 #endif
 
-#if OS_CFG_FLAG_EN > 0u
-    OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
-    OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
-    OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
-#endif
-
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
     OS_REG               RegTbl[OS_CFG_TASK_REG_TBL_SIZE];  /* Task specific registers                                */
 #endif
 
-    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
 #if OS_CFG_TASK_PROFILE_EN > 0u
     CPU_TS               SemPendTime;                       /* Time it took for signal to be received                 */
     CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
@@ -959,17 +1294,10 @@ struct os_tcb {
 #if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
     CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
     CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
+    CPU_STK_SIZE         StkFreeWatermark;                  /* Free count found by last scan (see OSTaskStkChk())     */
 #endif
     OS_OPT               Opt;                               /* Task options as passed by OSTaskCreate()               */
 
-                                                            /* DELAY / TIMEOUT                                        */
-    OS_TICK              TickCtrPrev;                       /* Previous time when task was            ready           */
-    OS_TICK              TickCtrMatch;                      /* Absolute time when task is going to be ready           */
-    OS_TICK              TickRemain;                        /* Number of ticks remaining for a match (updated at ...  */
-                                                            /* ... run-time by OS_StatTask()                          */
-    OS_TICK              TimeQuanta;
-    OS_TICK              TimeQuantaCtr;
-
 #if OS_CFG_TASK_PROFILE_EN > 0u
     OS_CPU_USAGE         CPUUsage;                          /* CPU Usage of task (0-100%)                             */
     OS_CTX_SW_CTR        CtxSwCtr;                          /* Number of time the task was switched in                */
@@ -979,6 +1307,13 @@ struct os_tcb {
     OS_CYCLES            CyclesTotalPrev;                   /* Snapshot of previous # of cycles                       */
 #endif
 
+#if OS_CFG_TASK_JITTER_EN > 0u
+    CPU_TS               WakeupTs;                          /* Timestamp of the tick that made the task ready         */
+    CPU_BOOLEAN          WakeupPending;                     /* DEF_TRUE between timed wake and first dispatch         */
+    CPU_TS               JitterMax;                         /* Largest wake-to-dispatch delta seen (TS units)         */
+    OS_CTR               JitterHistTbl[OS_CFG_TASK_JITTER_HIST_SIZE];
+#endif
+
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
     CPU_TS               IntDisTimeMax;                     /* Maximum interrupt disable time                         */
 #endif
@@ -986,12 +1321,6 @@ struct os_tcb {
     CPU_TS               SchedLockTimeMax;                  /* Maximum scheduler lock time                            */
 #endif
 
-    OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
-    OS_STATUS            PendStatus;                        /* Pend status                                            */
-    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
-
-    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
-
 #if OS_CFG_DBG_EN > 0u
     OS_TCB              *DbgPrevPtr;
     OS_TCB              *DbgNextPtr;
@@ -999,6 +1328,56 @@ struct os_tcb {
 #endif
 };
 
+/*$PAGE*/
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  TASK DESCRIPTOR
+*
+* Note(s)    : 1) One entry of the table handed to OSTaskCreateBatch(): the arguments of one OSTaskCreate() call,
+*                 field for field, so a multi-task application can list its tasks as const data and create them in
+*                 one batch with a single scheduler entry at the end.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_task_desc {
+    OS_TCB              *TCBPtr;                            /* Task control block, name and entry point               */
+    CPU_CHAR            *NamePtr;
+    OS_TASK_PTR          TaskPtr;
+    void                *ArgPtr;                            /* Argument passed to the task                            */
+    OS_PRIO              Prio;
+    CPU_STK             *StkBasePtr;                        /* Stack: base, limit and size in CPU_STK elements        */
+    CPU_STK_SIZE         StkLimit;
+    CPU_STK_SIZE         StkSize;
+    OS_MSG_QTY           QSize;                             /* Size of the task's built-in message queue              */
+    OS_TICK              TimeQuanta;
+    void                *ExtPtr;
+    OS_OPT               Opt;
+};
+
+/*$PAGE*/
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   TASK SLAB POOL
+*
+* Note(s)    : 1) A task slab pool recycles pairs of one OS_TCB and one fixed-size stack so transient tasks can be
+*                 created and deleted without static worst-case allocation or heap growth.  Free TCBs are chained
+*                 through their .NextPtr field (unused while a task does not exist), so acquire and release are O(1).
+*                 The stack belonging to a TCB is found by index: TCB i owns .StkBasePtr + i * .StkSizeEach.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if OS_CFG_TASK_SLAB_EN > 0u
+struct  os_task_slab_pool {
+    CPU_CHAR            *NamePtr;                           /* Pointer to task slab pool name (NUL terminated ASCII)  */
+    OS_TCB              *TcbTblPtr;                         /* Table of all TCBs managed by the pool                  */
+    CPU_STK             *StkBasePtr;                        /* Base of the contiguous stack storage                   */
+    CPU_STK_SIZE         StkSizeEach;                       /* Stack size of each slab (in CPU_STK elements)          */
+    OS_TCB              *FreeListPtr;                       /* TCBs available for OSTaskSlabAcquire()                 */
+    OS_OBJ_QTY           SlabQty;                           /* Total number of slabs in the pool                      */
+    OS_OBJ_QTY           NbrFree;                           /* Number of slabs currently available                    */
+};
+#endif
+
 /*$PAGE*/
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -1026,6 +1405,7 @@ struct  os_tmr {
     void                *CallbackPtrArg;                    /* Argument to pass to function when timer expires        */
     OS_TMR              *NextPtr;                           /* Double link list pointers                              */
     OS_TMR              *PrevPtr;
+    OS_TMR              *ExpNextPtr;                        /* Link in the list of timers that expired this period    */
     OS_TICK              Match;                             /* Timer expires when OSTmrTickCtr matches this value     */
     OS_TICK              Remain;                            /* Amount of time remaining before timer expires          */
     OS_TICK              Dly;                               /* Delay before start of repeat                           */
@@ -1059,6 +1439,9 @@ struct  os_tmr_spoke {
 OS_EXT           OS_APP_HOOK_TCB         OS_AppTaskCreateHookPtr;     /* Application hooks                            */
 OS_EXT           OS_APP_HOOK_TCB         OS_AppTaskDelHookPtr;
 OS_EXT           OS_APP_HOOK_TCB         OS_AppTaskReturnHookPtr;
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u) || (OS_CFG_TASK_STK_LIMIT_CHK_EN > 0u)
+OS_EXT           OS_APP_HOOK_TCB         OS_AppRedzoneHitHookPtr;
+#endif
 
 OS_EXT           OS_APP_HOOK_VOID        OS_AppIdleTaskHookPtr;
 OS_EXT           OS_APP_HOOK_VOID        OS_AppStatTaskHookPtr;
@@ -1068,7 +1451,17 @@ OS_EXT           OS_APP_HOOK_VOID        OS_AppTimeTickHookPtr;
 
                                                                       /* IDLE TASK ---------------------------------- */
 OS_EXT            OS_IDLE_CTR            OSIdleTaskCtr;
+
+#if OS_CFG_DBG_EN > 0u
+OS_EXT            CPU_TS                 OSInitTime;                  /* Measured duration of OSInit() (boot report)  */
+#endif
 OS_EXT            OS_TCB                 OSIdleTaskTCB;
+#if OS_CFG_IDLE_WORK_EN > 0u
+OS_EXT            OS_IDLE_WORK          *OSIdleWorkListPtr;           /* Registered background work items             */
+OS_EXT            OS_IDLE_WORK          *OSIdleWorkRunPtr;            /* Round-robin rotor into the work list         */
+OS_EXT            OS_OBJ_QTY             OSIdleWorkQty;
+OS_EXT            CPU_INT32U             OSIdleWorkSliceCtr;          /* Work slices executed from the idle hook      */
+#endif
 
                                                                       /* MISCELLANEOUS ------------------------------ */
 OS_EXT            OS_NESTING_CTR         OSIntNestingCtr;             /* Interrupt nesting level                      */
@@ -1081,11 +1474,11 @@ OS_EXT            OS_STATE               OSRunning;                   /* Flag in
 
                                                                       /* ISR HANDLER TASK --------------------------- */
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
-OS_EXT            OS_INT_Q              *OSIntQInPtr;
-OS_EXT            OS_INT_Q              *OSIntQOutPtr;
-OS_EXT            OS_OBJ_QTY             OSIntQNbrEntries;
+OS_EXT            CPU_INT32U  volatile   OSIntQInIx;                  /* Free running index of next entry to fill     */
+OS_EXT            CPU_INT32U  volatile   OSIntQOutIx;                 /* Free running index of next entry to drain    */
 OS_EXT            OS_OBJ_QTY             OSIntQMaxNbrEntries;
 OS_EXT            OS_OBJ_QTY             OSIntQOvfCtr;
+OS_EXT            OS_OBJ_QTY             OSIntQNearFullCtr;           /* Posts that found the queue 3/4 full or more  */
 OS_EXT            OS_TCB                 OSIntQTaskTCB;
 OS_EXT            CPU_TS                 OSIntQTaskTimeMax;
 #endif
@@ -1115,6 +1508,32 @@ OS_EXT            OS_MSG_POOL            OSMsgPool;                   /* Pool of
 OS_EXT            OS_MUTEX              *OSMutexDbgListPtr;
 #endif
 OS_EXT            OS_OBJ_QTY             OSMutexQty;                  /* Number of mutexes created                    */
+#if OS_CFG_DBG_EN > 0u
+OS_EXT            CPU_INT32U             OSMutexBoostCtr;             /* Nbr of priority inheritance boosts applied   */
+OS_EXT            OS_OBJ_QTY             OSMutexBoostNbr;             /* Nbr of owners currently running boosted      */
+OS_EXT            OS_OBJ_QTY             OSMutexBoostNbrMax;          /* Peak simultaneous boosts; with single-level  */
+#endif                                                                /* ... inheritance this bounds the chain depth  */
+#endif
+
+                                                                      /* EDF CLASS ---------------------------------- */
+#if OS_CFG_EDF_EN > 0u
+OS_EXT            OS_EDF                *OSEdfListPtr;                /* Registered EDF tasks, unordered              */
+OS_EXT            OS_EDF                *OSEdfCurPtr;                 /* Registration holding OSCfg_EdfPrioHi         */
+OS_EXT            OS_OBJ_QTY             OSEdfQty;                    /* Number of registered EDF tasks               */
+#endif
+
+                                                                      /* MINITASKS ---------------------------------- */
+#if OS_CFG_MTASK_EN > 0u
+OS_EXT            OS_TCB                 OSMTaskDispTaskTCB;          /* TCB of the minitask dispatcher task          */
+OS_EXT            OS_OBJ_QTY             OSMTaskQty;                  /* Number of minitasks created                  */
+OS_EXT            OS_MTASK              *OSMTaskRdyHeadPtr;           /* Dispatcher's ready FIFO, oldest first        */
+OS_EXT            OS_MTASK              *OSMTaskRdyTailPtr;
+#endif
+
+                                                                      /* OBJECT REGISTRY ---------------------------- */
+#if OS_CFG_OBJ_REG_EN > 0u
+OS_EXT            OS_OBJ_QTY             OSObjRegQty;                 /* Number of objects currently registered       */
+extern            void                  *OSObjRegTbl[OS_CFG_OBJ_REG_MAX];
 #endif
 
                                                                       /* PRIORITIES --------------------------------- */
@@ -1131,6 +1550,16 @@ OS_EXT            OS_Q                  *OSQDbgListPtr;
 OS_EXT            OS_OBJ_QTY             OSQQty;                      /* Number of message queues created             */
 #endif
 
+                                                                      /* PIPES -------------------------------------- */
+#if OS_CFG_PIPE_EN > 0u
+OS_EXT            OS_OBJ_QTY             OSPipeQty;                   /* Number of pipes created                      */
+#endif
+
+                                                                      /* SLOT QUEUES -------------------------------- */
+#if OS_CFG_SQ_EN  > 0u
+OS_EXT            OS_OBJ_QTY             OSSQQty;                     /* Number of slot queues created                */
+#endif
+
 
 
                                                                       /* READY LIST --------------------------------- */
@@ -1140,15 +1569,28 @@ OS_EXT            OS_RDY_LIST            OSRdyList[OS_CFG_PRIO_MAX];  /* Table o
 #ifdef OS_SAFETY_CRITICAL_IEC61508
 OS_EXT            CPU_BOOLEAN            OSSafetyCriticalStartFlag;   /* Flag indicating that all init. done          */
 #endif
+                                                                      /* ANOMALY TRIGGER ---------------------------- */
+#if (OS_CFG_TASK_JITTER_EN > 0u) || (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+OS_EXT            OS_ANOMALY_HOOK        OSAnomalyHookPtr;            /* Called when a measurement crosses a trigger  */
+#endif
+#if OS_CFG_TASK_JITTER_EN > 0u
+OS_EXT            CPU_TS                 OSAnomalyDlyLateTrig;        /* Wakeup-lateness trigger (TS units, 0 = off)  */
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+OS_EXT            CPU_TS_TMR             OSAnomalySchedLockTrig;      /* Lock hold-time trigger (TS units, 0 = off)   */
+#endif
+
                                                                       /* SCHEDULER ---------------------------------- */
 #if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
 OS_EXT            CPU_TS_TMR             OSSchedLockTimeBegin;        /* Scheduler lock time measurement              */
 OS_EXT            CPU_TS_TMR             OSSchedLockTimeMax;
 OS_EXT            CPU_TS_TMR             OSSchedLockTimeMaxCur;
+OS_EXT            OS_TCB                *OSSchedLockHolderPtr;        /* Task that produced OSSchedLockTimeMax        */
 #endif
 
 OS_EXT            OS_NESTING_CTR         OSSchedLockNestingCtr;       /* Lock nesting level                           */
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
+OS_EXT            CPU_BOOLEAN            OSSchedRoundRobinAdaptEn;    /* Enable/Disable adaptive time quanta          */
 OS_EXT            OS_TICK                OSSchedRoundRobinDfltTimeQuanta;
 OS_EXT            CPU_BOOLEAN            OSSchedRoundRobinEn;         /* Enable/Disable round-robin scheduling        */
 #endif
@@ -1166,6 +1608,7 @@ OS_EXT            OS_CPU_USAGE           OSStatTaskCPUUsage;          /* CPU Usa
 OS_EXT            OS_TICK                OSStatTaskCtr;
 OS_EXT            OS_TICK                OSStatTaskCtrMax;
 OS_EXT            OS_TICK                OSStatTaskCtrRun;
+OS_EXT            CPU_BOOLEAN            OSStatTaskEn;                /* Run-time Enable/Disable of the measurements  */
 OS_EXT            CPU_BOOLEAN            OSStatTaskRdy;
 OS_EXT            OS_TCB                 OSStatTaskTCB;
 OS_EXT            CPU_TS                 OSStatTaskTimeMax;
@@ -1178,6 +1621,9 @@ OS_EXT            OS_CTX_SW_CTR          OSTaskCtxSwCtr;              /* Number
 OS_EXT            OS_TCB                *OSTaskDbgListPtr;
 #endif
 OS_EXT            OS_OBJ_QTY             OSTaskQty;                   /* Number of tasks created                      */
+#if OS_CFG_TASK_SLAB_EN > 0u
+OS_EXT            OS_OBJ_QTY             OSTaskSlabPoolQty;           /* Number of task slab pools created            */
+#endif
 
 
                                                                       /* TICK TASK ---------------------------------- */
@@ -1211,6 +1657,10 @@ OS_EXT            OS_TCB                *OSTCBHighRdyPtr;             /* Pointer
 ************************************************************************************************************************
 */
 
+extern  CPU_INT32U    const OSCfg_DataSizeRAM;
+extern  OS_CFG_DATA_RAM_ENTRY  const OSCfg_DataSizeRAMTbl[];
+extern  OS_OBJ_QTY    const OSCfg_DataSizeRAMTblEntries;
+
 extern  CPU_STK     * const OSCfg_IdleTaskStkBasePtr;
 extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkLimit;
 extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkSize;
@@ -1232,6 +1682,15 @@ extern  OS_MSG_SIZE   const OSCfg_MsgPoolSize;
 extern  CPU_INT32U    const OSCfg_MsgPoolSizeRAM;
 extern  OS_MSG      * const OSCfg_MsgPoolBasePtr;
 
+extern  OS_PRIO       const OSCfg_EdfPrioHi;
+extern  OS_PRIO       const OSCfg_EdfPrioLo;
+
+extern  OS_PRIO       const OSCfg_MTaskDispTaskPrio;
+extern  CPU_STK     * const OSCfg_MTaskDispTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_MTaskDispTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_MTaskDispTaskStkSize;
+extern  CPU_INT32U    const OSCfg_MTaskDispTaskStkSizeRAM;
+
 extern  OS_PRIO       const OSCfg_StatTaskPrio;
 extern  OS_RATE_HZ    const OSCfg_StatTaskRate_Hz;
 extern  CPU_STK     * const OSCfg_StatTaskStkBasePtr;
@@ -1267,6 +1726,10 @@ extern  CPU_STK        OSCfg_IntQTaskStk[];
 extern  OS_INT_Q       OSCfg_IntQ[];
 #endif
 
+#if (OS_CFG_MTASK_EN > 0u)
+extern  CPU_STK        OSCfg_MTaskDispTaskStk[];
+#endif
+
 extern  CPU_STK        OSCfg_ISRStk[];
 
 #if (OS_MSG_EN > 0u)
@@ -1330,6 +1793,12 @@ OS_FLAGS      OSFlagPost                (OS_FLAG_GRP           *p_grp,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+void          OSFlagTSCfg               (OS_FLAG_GRP           *p_grp,
+                                         CPU_BOOLEAN            en,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_FlagClr                (OS_FLAG_GRP           *p_grp);
@@ -1472,6 +1941,8 @@ void          OS_PendMultiWait          (OS_PEND_DATA          *p_pend_data_tbl,
 void          OSQCreate                 (OS_Q                  *p_q,
                                          CPU_CHAR              *p_name,
                                          OS_MSG_QTY             max_qty,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             msg_qty,
                                          OS_ERR                *p_err);
 
 #if OS_CFG_Q_DEL_EN > 0u
@@ -1504,6 +1975,20 @@ void          OSQPost                   (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+void          OSQTSCfg                  (OS_Q                  *p_q,
+                                         CPU_BOOLEAN            en,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_DBG_EN > 0u
+OS_Q         *OSQDbgStatNext            (OS_Q                  *p_q,
+                                         CPU_CHAR             **p_name,
+                                         OS_MSG_QTY            *p_entries,
+                                         OS_MSG_QTY            *p_entries_max,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
@@ -1524,6 +2009,138 @@ void          OS_QPost                  (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+/* ================================================================================================================== */
+/*                                       EARLIEST-DEADLINE-FIRST SCHEDULING CLASS                                     */
+/* ================================================================================================================== */
+
+#if OS_CFG_EDF_EN > 0u
+
+void          OSEdfTaskReg              (OS_EDF                *p_edf,
+                                         CPU_CHAR              *p_name,
+                                         OS_TCB                *p_tcb,
+                                         OS_TICK                period,
+                                         OS_TICK                deadline_rel,
+                                         OS_ERR                *p_err);
+
+void          OSEdfJobWait              (OS_EDF                *p_edf,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_EdfInit                (OS_ERR                *p_err);
+
+void          OS_EdfSched               (void);
+
+void          OS_EdfUpdate              (void);
+#endif
+
+/* ================================================================================================================== */
+/*                                           RUN-TO-COMPLETION MINITASKS                                              */
+/* ================================================================================================================== */
+
+#if OS_CFG_MTASK_EN > 0u
+
+void          OSMTaskCreate             (OS_MTASK              *p_mt,
+                                         CPU_CHAR              *p_name,
+                                         OS_MTASK_FNCT          fnct,
+                                         void                  *p_arg,
+                                         OS_ERR                *p_err);
+
+void          OSMTaskPost               (OS_MTASK              *p_mt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_MTaskDispTask          (void                  *p_arg);
+
+void          OS_MTaskInit              (OS_ERR                *p_err);
+#endif
+
+/* ================================================================================================================== */
+/*                                                  BYTE-STREAM PIPES                                                 */
+/* ================================================================================================================== */
+
+#if OS_CFG_PIPE_EN > 0u
+
+void          OSPipeCreate              (OS_PIPE               *p_pipe,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_buf,
+                                         CPU_INT32U             buf_size,
+                                         OS_ERR                *p_err);
+
+OS_MSG_SIZE   OSPipeRead                (OS_PIPE               *p_pipe,
+                                         void                  *p_dest,
+                                         OS_MSG_SIZE            max_bytes,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+OS_MSG_SIZE   OSPipeWrite               (OS_PIPE               *p_pipe,
+                                         const  void           *p_src,
+                                         OS_MSG_SIZE            nbytes,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_PipeClr                (OS_PIPE               *p_pipe);
+
+void          OS_PipeInit               (OS_ERR                *p_err);
+
+void          OS_PipePost               (OS_PIPE               *p_pipe,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
+/* ================================================================================================================== */
+/*                                                    SLOT QUEUES                                                     */
+/* ================================================================================================================== */
+
+#if OS_CFG_SQ_EN > 0u
+
+void          OSSQCreate                (OS_SQ                 *p_sq,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_QTY             slot_qty,
+                                         OS_MSG_SIZE            slot_size,
+                                         OS_ERR                *p_err);
+
+void         *OSSQPend                  (OS_SQ                 *p_sq,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void         *OSSQPostAlloc             (OS_SQ                 *p_sq,
+                                         OS_ERR                *p_err);
+
+void          OSSQPost                  (OS_SQ                 *p_sq,
+                                         void                  *p_slot,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSSQRelease               (OS_SQ                 *p_sq,
+                                         void                  *p_slot,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_SQClr                  (OS_SQ                 *p_sq);
+
+void          OS_SQInit                 (OS_ERR                *p_err);
+
+void          OS_SQPost                 (OS_SQ                 *p_sq,
+                                         void                  *p_slot,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
 /*$PAGE*/
 /* ================================================================================================================== */
 /*                                                     SEMAPHORES                                                     */
@@ -1562,6 +2179,12 @@ void          OSSemSet                  (OS_SEM                *p_sem,
                                          OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+void          OSSemTSCfg                (OS_SEM                *p_sem,
+                                         CPU_BOOLEAN            en,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_SemClr                 (OS_SEM                *p_sem);
@@ -1605,6 +2228,10 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+OS_OBJ_QTY    OSTaskCreateBatch         (OS_TASK_DESC          *p_desc_tbl,
+                                         OS_OBJ_QTY             qty,
+                                         OS_ERR                *p_err);
+
 #if OS_CFG_TASK_DEL_EN > 0u
 void          OSTaskDel                 (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
@@ -1662,6 +2289,9 @@ CPU_BOOLEAN   OSTaskSemPendAbort        (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+void          OSTaskSemPostFromISR      (OS_TCB                *p_tcb,
+                                         OS_ERR                *p_err);
+
 OS_SEM_CTR    OSTaskSemPost             (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
@@ -1677,6 +2307,28 @@ void          OSTaskStkChk              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+CPU_BOOLEAN   OSTaskStkRedzoneChk       (OS_TCB                *p_tcb);
+#endif
+
+#if OS_CFG_TASK_SLAB_EN > 0u
+void          OSTaskSlabPoolCreate      (OS_TASK_SLAB_POOL     *p_pool,
+                                         CPU_CHAR              *p_name,
+                                         OS_TCB                *p_tcb_tbl,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_size_each,
+                                         OS_OBJ_QTY             slab_qty,
+                                         OS_ERR                *p_err);
+
+OS_TCB       *OSTaskSlabAcquire         (OS_TASK_SLAB_POOL     *p_pool,
+                                         CPU_STK              **p_stk_base,
+                                         OS_ERR                *p_err);
+
+void          OSTaskSlabRelease         (OS_TASK_SLAB_POOL     *p_pool,
+                                         OS_TCB                *p_tcb,
+                                         OS_ERR                *p_err);
+#endif
+
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
 void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
                                          OS_TICK                time_quanta,
@@ -1709,6 +2361,11 @@ void          OS_TaskRdy                (OS_TCB                *p_tcb);
 
 void          OS_TaskReturn             (void);
 
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+void          OS_TaskStkRedzoneInit     (CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_size);
+#endif
+
 OS_SEM_CTR    OS_TaskSemPost            (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          CPU_TS                 ts,
@@ -1737,6 +2394,15 @@ void          OSTimeDlyResume           (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_DLY_HIGH_RES_EN > 0u
+void          OSTimeDlyHighRes          (CPU_INT32U             dly_us,
+                                         OS_ERR                *p_err);   /* Implemented by the port (os_cpu_c.c)             */
+#endif
+
+void          OSTimeDlyUntil            (OS_TICK               *p_prev,
+                                         OS_TICK                period,
+                                         OS_ERR                *p_err);
+
 OS_TICK       OSTimeGet                 (OS_ERR                *p_err);
 
 void          OSTimeSet                 (OS_TICK                ticks,
@@ -1744,6 +2410,13 @@ void          OSTimeSet                 (OS_TICK                ticks,
 
 void          OSTimeTick                (void);
 
+#if OS_CFG_TASK_JITTER_EN > 0u
+void          OSTaskJitterGet           (OS_TCB                *p_tcb,
+                                         CPU_TS                *p_max,
+                                         OS_CTR                *p_hist_tbl,
+                                         OS_ERR                *p_err);
+#endif
+
 /*$PAGE*/
 /* ================================================================================================================== */
 /*                                                 TIMER MANAGEMENT                                                   */
@@ -1788,9 +2461,15 @@ void          OS_TmrDbgListRemove       (OS_TMR                *p_tmr);
 
 void          OS_TmrInit                (OS_ERR                *p_err);
 
+void          OS_TmrTaskInit            (OS_ERR                *p_err);
+
 void          OS_TmrLink                (OS_TMR                *p_tmr,
                                          OS_OPT                 opt);
 
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+OS_TICK       OS_TmrNextExpiry          (void);
+#endif
+
 void          OS_TmrResetPeak           (void);
 
 void          OS_TmrUnlink              (OS_TMR                *p_tmr);
@@ -1804,11 +2483,27 @@ void          OS_TmrTask                (void                  *p_arg);
 /*                                                    MISCELLANEOUS                                                   */
 /* ================================================================================================================== */
 
+#if OS_CFG_IDLE_WORK_EN > 0u
+void          OSIdleWorkAdd             (OS_IDLE_WORK          *p_work,
+                                         CPU_CHAR              *p_name,
+                                         OS_IDLE_WORK_FNCT      fnct,
+                                         void                  *p_arg,
+                                         OS_ERR                *p_err);
+
+void          OSIdleWorkRemove          (OS_IDLE_WORK          *p_work,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSInit                    (OS_ERR                *p_err);
 
 void          OSIntEnter                (void);
 void          OSIntExit                 (void);
 
+void          OSMsgPoolStatGet          (OS_MSG_QTY            *p_free,
+                                         OS_MSG_QTY            *p_used,
+                                         OS_MSG_QTY            *p_used_max,
+                                         OS_ERR                *p_err);
+
 void          OSMsgPoolExtend           (OS_MSG                *p_msg,
                                          OS_MSG_QTY             size,
                                          OS_ERR                *p_err);
@@ -1822,6 +2517,9 @@ void          OSSchedRoundRobinCfg      (CPU_BOOLEAN            en,
                                          OS_TICK                dflt_time_quanta,
                                          OS_ERR                *p_err);
 
+void          OSSchedRoundRobinAdaptCfg (CPU_BOOLEAN            en,
+                                         OS_ERR                *p_err);
+
 void          OSSchedRoundRobinYield    (OS_ERR                *p_err);
 
 #endif
@@ -1837,6 +2535,16 @@ void          OSStart                   (OS_ERR                *p_err);
 void          OSStatReset               (OS_ERR                *p_err);
 
 void          OSStatTaskCPUUsageInit    (OS_ERR                *p_err);
+
+void          OSStatTaskEnSet           (CPU_BOOLEAN            en,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_DBG_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+OS_TCB       *OSStatTaskUsageNext       (OS_TCB                *p_tcb,
+                                         CPU_CHAR             **p_name,
+                                         OS_CPU_USAGE          *p_usage,
+                                         OS_ERR                *p_err);
+#endif
 #endif
 
 CPU_INT16U    OSVersion                 (OS_ERR                *p_err);
@@ -1847,6 +2555,10 @@ void          OS_IdleTask               (void                  *p_arg);
 
 void          OS_IdleTaskInit           (OS_ERR                *p_err);
 
+#if OS_CFG_IDLE_WORK_EN > 0u
+CPU_BOOLEAN   OS_IdleWorkRun            (void);
+#endif
+
 #if OS_CFG_STAT_TASK_EN > 0u
 void          OS_StatTask               (void                  *p_arg);
 #endif
@@ -1887,6 +2599,10 @@ void          OSTaskSwHook              (void);
 
 void          OSTimeTickHook            (void);
 
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u) || (OS_CFG_TASK_STK_LIMIT_CHK_EN > 0u)
+void          OSRedzoneHitHook          (OS_TCB                *p_tcb);
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -1981,6 +2697,24 @@ void          OS_Post1                  (OS_PEND_OBJ           *p_obj,
                                          OS_MSG_SIZE            msg_size,
                                          CPU_TS                 ts);
 
+void          OS_PostAll                (OS_PEND_OBJ           *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts);
+
+/* ------------------------------------------------ OBJECT REGISTRY ------------------------------------------------- */
+
+#if OS_CFG_OBJ_REG_EN > 0u
+void         *OSObjRegGet               (OS_OBJ_ID              id,
+                                         OS_ERR                *p_err);
+
+OS_OBJ_ID     OS_ObjRegAdd              (void                  *p_obj);
+
+void          OS_ObjRegInit             (void);
+
+void          OS_ObjRegRemove           (OS_OBJ_ID              id);
+#endif
+
 /* ----------------------------------------------- PRIORITY MANAGEMENT ---------------------------------------------- */
 
 void          OS_PrioInit               (void);
@@ -1997,6 +2731,8 @@ OS_PRIO       OS_PrioGetHighest         (void);
 void          OS_Sched0                 (void);
 #endif
 
+void          OS_SchedPost              (OS_PRIO                prio_new);
+
 #if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
 void          OS_SchedLockTimeMeasStart (void);
 void          OS_SchedLockTimeMeasStop  (void);
@@ -2067,6 +2803,10 @@ void          OS_TickListResetPeak      (void);
 
 void          OS_TickListUpdate         (void);
 
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+OS_TICK       OS_TickNextExpiry         (void);
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -2115,6 +2855,24 @@ void          OS_TickListUpdate         (void);
 #error  "OS_CFG.H, Missing OS_CFG_PEND_MULTI_EN: Enable (1) or Disable (0) multi-pend feature"
 #endif
 
+#ifndef OS_CFG_PEND_PRIO_TBL_EN
+#error  "OS_CFG.H, Missing OS_CFG_PEND_PRIO_TBL_EN: Enable (1) or Disable (0) constant-time pend-list insertion"
+#endif
+
+#ifndef OS_CFG_OBJ_REG_EN
+#error  "OS_CFG.H, Missing OS_CFG_OBJ_REG_EN: Enable (1) or Disable (0) the kernel object registry"
+
+#else
+    #if OS_CFG_OBJ_REG_EN > 0u
+    #ifndef OS_CFG_OBJ_REG_MAX
+    #error  "OS_CFG.H, Missing OS_CFG_OBJ_REG_MAX: Maximum number of registered objects"
+
+    #elif   OS_CFG_OBJ_REG_MAX > 255u
+    #error  "OS_CFG.H,          OS_CFG_OBJ_REG_MAX must fit the 8-bit OS_OBJ_ID type (1 .. 255)"
+    #endif
+    #endif
+#endif
+
 
 #if     OS_CFG_PRIO_MAX < 8u
 #error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be >= 8"
@@ -2149,6 +2907,15 @@ void          OS_TickListUpdate         (void);
     #endif
 #endif
 
+#ifndef OS_CFG_TS_OBJ_SEL_EN
+#error  "OS_CFG.H, Missing OS_CFG_TS_OBJ_SEL_EN: Determines whether objects can opt out of time stamping"
+#else
+    #if    (OS_CFG_TS_OBJ_SEL_EN >  0u) && \
+           (OS_CFG_TS_EN         == 0u)
+    #error  "OS_CFG.H,        OS_CFG_TS_EN must be Enabled (1) to use per-object time-stamp selection"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                     EVENT FLAGS
@@ -2221,6 +2988,22 @@ void          OS_TickListUpdate         (void);
     #endif
 #endif
 
+#ifndef OS_CFG_PIPE_EN
+#error  "OS_CFG.H, Missing OS_CFG_PIPE_EN: Enable (1) or Disable (0) code generation for BYTE-STREAM PIPES"
+#endif
+
+#ifndef OS_CFG_SQ_EN
+#error  "OS_CFG.H, Missing OS_CFG_SQ_EN: Enable (1) or Disable (0) code generation for ZERO-COPY SLOT QUEUES"
+#endif
+
+#ifndef OS_CFG_EDF_EN
+#error  "OS_CFG.H, Missing OS_CFG_EDF_EN: Enable (1) or Disable (0) code generation for the EDF SCHEDULING CLASS"
+#endif
+
+#ifndef OS_CFG_MTASK_EN
+#error  "OS_CFG.H, Missing OS_CFG_MTASK_EN: Enable (1) or Disable (0) code generation for RUN-TO-COMPLETION MINITASKS"
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      SEMAPHORES
@@ -2285,6 +3068,24 @@ void          OS_TickListUpdate         (void);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_SEM_PEND_ABORT_EN: Include code for OSTaskSemPendAbort()"
 #endif
 
+#ifndef OS_CFG_TASK_SLAB_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_SLAB_EN: Include code for OSTaskSlabXxxx(), recyclable TCB+stack pools"
+#endif
+
+#ifndef OS_CFG_TASK_STK_LIMIT_CHK_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_STK_LIMIT_CHK_EN: Include code for the stack limit check at task switch"
+#endif
+
+#ifndef OS_CFG_TASK_STK_REDZONE_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_STK_REDZONE_EN: Include code for stack redzone checking"
+#else
+    #if OS_CFG_TASK_STK_REDZONE_EN > 0u
+    #ifndef OS_CFG_TASK_STK_REDZONE_DEPTH
+    #error  "OS_CFG.H, Missing OS_CFG_TASK_STK_REDZONE_DEPTH: Determines the size (in CPU_STK elements) of the redzone"
+    #endif
+    #endif
+#endif
+
 #ifndef OS_CFG_TASK_SUSPEND_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_SUSPEND_EN: Include code for OSTaskSuspend() and OSTaskResume()"
 #endif
@@ -40,6 +40,7 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 
 #define  OS_CFG_IDLE_TASK_STK_LIMIT      ((OS_CFG_IDLE_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #define  OS_CFG_INT_Q_TASK_STK_LIMIT     ((OS_CFG_INT_Q_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
+#define  OS_CFG_MTASK_DISP_TASK_STK_LIMIT ((OS_CFG_MTASK_DISP_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #define  OS_CFG_STAT_TASK_STK_LIMIT      ((OS_CFG_STAT_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #define  OS_CFG_TICK_TASK_STK_LIMIT      ((OS_CFG_TICK_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #define  OS_CFG_TMR_TASK_STK_LIMIT       ((OS_CFG_TMR_TASK_STK_SIZE   * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
@@ -65,6 +66,10 @@ CPU_STK        OSCfg_ISRStk        [OS_CFG_ISR_STK_SIZE];
 OS_MSG         OSCfg_MsgPool       [OS_CFG_MSG_POOL_SIZE];
 #endif
 
+#if (OS_CFG_MTASK_EN > 0u)
+CPU_STK        OSCfg_MTaskDispTaskStk [OS_CFG_MTASK_DISP_TASK_STK_SIZE];
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 CPU_STK        OSCfg_StatTaskStk   [OS_CFG_STAT_TASK_STK_SIZE];
 #endif
@@ -131,6 +136,30 @@ OS_MSG       * const  OSCfg_MsgPoolBasePtr       = (OS_MSG    *)0;
 #endif
 
 
+#if (OS_CFG_EDF_EN > 0u)
+OS_PRIO        const  OSCfg_EdfPrioHi             = (OS_PRIO     )OS_CFG_EDF_PRIO_HI;
+OS_PRIO        const  OSCfg_EdfPrioLo             = (OS_PRIO     )OS_CFG_EDF_PRIO_LO;
+#else
+OS_PRIO        const  OSCfg_EdfPrioHi             = (OS_PRIO     )0;
+OS_PRIO        const  OSCfg_EdfPrioLo             = (OS_PRIO     )0;
+#endif
+
+
+#if (OS_CFG_MTASK_EN > 0u)
+OS_PRIO        const  OSCfg_MTaskDispTaskPrio      = (OS_PRIO     )OS_CFG_MTASK_DISP_TASK_PRIO;
+CPU_STK      * const  OSCfg_MTaskDispTaskStkBasePtr= (CPU_STK    *)&OSCfg_MTaskDispTaskStk[0];
+CPU_STK_SIZE   const  OSCfg_MTaskDispTaskStkLimit  = (CPU_STK_SIZE)OS_CFG_MTASK_DISP_TASK_STK_LIMIT;
+CPU_STK_SIZE   const  OSCfg_MTaskDispTaskStkSize   = (CPU_STK_SIZE)OS_CFG_MTASK_DISP_TASK_STK_SIZE;
+CPU_INT32U     const  OSCfg_MTaskDispTaskStkSizeRAM= (CPU_INT32U  )sizeof(OSCfg_MTaskDispTaskStk);
+#else
+OS_PRIO        const  OSCfg_MTaskDispTaskPrio      = (OS_PRIO     )0;
+CPU_STK      * const  OSCfg_MTaskDispTaskStkBasePtr= (CPU_STK    *)0;
+CPU_STK_SIZE   const  OSCfg_MTaskDispTaskStkLimit  = (CPU_STK_SIZE)0;
+CPU_STK_SIZE   const  OSCfg_MTaskDispTaskStkSize   = (CPU_STK_SIZE)0;
+CPU_INT32U     const  OSCfg_MTaskDispTaskStkSizeRAM= (CPU_INT32U  )0;
+#endif
+
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 OS_PRIO        const  OSCfg_StatTaskPrio         = (OS_PRIO     )OS_CFG_STAT_TASK_PRIO;
 OS_RATE_HZ     const  OSCfg_StatTaskRate_Hz      = (OS_RATE_HZ  )OS_CFG_STAT_TASK_RATE_HZ;
@@ -200,6 +229,10 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = sizeof(OSCfg_IdleTaskStk)
                                                  + sizeof(OSCfg_MsgPool)
 #endif
 
+#if (OS_CFG_MTASK_EN > 0u)
+                                                 + sizeof(OSCfg_MTaskDispTaskStk)
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
                                                  + sizeof(OSCfg_StatTaskStk)
 #endif
@@ -215,6 +248,53 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = sizeof(OSCfg_IdleTaskStk)
                                                  + sizeof(OSCfg_TickTaskStk)
                                                  + sizeof(OSCfg_TickWheel);
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                           KERNEL RAM FOOTPRINT REPORT TABLE
+*
+* Note(s): (1) This table itemizes, per statically allocated kernel object, the RAM cost summed in OSCfg_DataSizeRAM
+*              above.  It lives in code space (const) and costs no RAM; the application can walk it at boot to print
+*              a footprint report (see App note) instead of digging the figures out of the linker map file.
+************************************************************************************************************************
+*/
+
+OS_CFG_DATA_RAM_ENTRY  const  OSCfg_DataSizeRAMTbl[] = {
+    { "IdleTaskStk", sizeof(OSCfg_IdleTaskStk) },
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    { "IntQ",        sizeof(OSCfg_IntQ)        },
+    { "IntQTaskStk", sizeof(OSCfg_IntQTaskStk) },
+#endif
+
+#if (OS_CFG_ISR_STK_SIZE > 0u)
+    { "ISRStk",      sizeof(OSCfg_ISRStk)      },
+#endif
+
+#if (OS_MSG_EN > 0u)
+    { "MsgPool",     sizeof(OSCfg_MsgPool)     },
+#endif
+
+#if (OS_CFG_MTASK_EN > 0u)
+    { "MTaskDispStk", sizeof(OSCfg_MTaskDispTaskStk) },
+#endif
+
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    { "StatTaskStk", sizeof(OSCfg_StatTaskStk) },
+#endif
+
+#if (OS_CFG_TMR_EN > 0u)
+    { "TmrTaskStk",  sizeof(OSCfg_TmrTaskStk)  },
+    { "TmrWheel",    sizeof(OSCfg_TmrWheel)    },
+#endif
+
+    { "TickTaskStk", sizeof(OSCfg_TickTaskStk) },
+    { "TickWheel",   sizeof(OSCfg_TickWheel)   }
+};
+
+OS_OBJ_QTY  const  OSCfg_DataSizeRAMTblEntries = (OS_OBJ_QTY)(sizeof(OSCfg_DataSizeRAMTbl)
+                                                            / sizeof(OSCfg_DataSizeRAMTbl[0]));
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
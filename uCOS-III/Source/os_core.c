@@ -51,6 +51,9 @@ void  OSInit (OS_ERR  *p_err)
 {
     CPU_STK      *p_stk;
     CPU_STK_SIZE  size;
+#if OS_CFG_DBG_EN > 0u
+    CPU_TS        ts_start;
+#endif
 
 
 
@@ -61,8 +64,22 @@ void  OSInit (OS_ERR  *p_err)
     }
 #endif
 
+#if OS_CFG_DBG_EN > 0u
+    ts_start = OS_TS_GET();                                 /* Measure how long initialization takes (see OSInitTime) */
+#endif
+
     OSInitHook();                                           /* Call port specific initialization code                 */
 
+#if (OS_CFG_TASK_JITTER_EN > 0u) || (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+    OSAnomalyHookPtr                = (OS_ANOMALY_HOOK)0;  /* No anomaly trigger hook (see os.h)                     */
+#endif
+#if OS_CFG_TASK_JITTER_EN > 0u
+    OSAnomalyDlyLateTrig            = (CPU_TS)0;
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    OSAnomalySchedLockTrig          = (CPU_TS_TMR)0;
+#endif
+
     OSIntNestingCtr                 = (OS_NESTING_CTR)0;    /* Clear the interrupt nesting counter                    */
 
     OSRunning                       =  OS_STATE_OS_STOPPED; /* Indicate that multitasking not started                 */
@@ -73,6 +90,7 @@ void  OSInit (OS_ERR  *p_err)
     OSSchedLockTimeBegin            = (CPU_TS)0;
     OSSchedLockTimeMax              = (CPU_TS)0;
     OSSchedLockTimeMaxCur           = (CPU_TS)0;
+    OSSchedLockHolderPtr            = (OS_TCB *)0;
 #endif
 
 #ifdef OS_SAFETY_CRITICAL_IEC61508
@@ -81,6 +99,7 @@ void  OSInit (OS_ERR  *p_err)
 
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
     OSSchedRoundRobinEn             = DEF_FALSE;
+    OSSchedRoundRobinAdaptEn        = DEF_FALSE;
     OSSchedRoundRobinDfltTimeQuanta = OSCfg_TickRate_Hz / 10u;
 #endif
 
@@ -100,6 +119,9 @@ void  OSInit (OS_ERR  *p_err)
     OS_AppTaskCreateHookPtr = (OS_APP_HOOK_TCB )0;          /* Clear application hook pointers                        */
     OS_AppTaskDelHookPtr    = (OS_APP_HOOK_TCB )0;
     OS_AppTaskReturnHookPtr = (OS_APP_HOOK_TCB )0;
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u) || (OS_CFG_TASK_STK_LIMIT_CHK_EN > 0u)
+    OS_AppRedzoneHitHookPtr = (OS_APP_HOOK_TCB )0;
+#endif
 
     OS_AppIdleTaskHookPtr   = (OS_APP_HOOK_VOID)0;
     OS_AppStatTaskHookPtr   = (OS_APP_HOOK_VOID)0;
@@ -109,6 +131,10 @@ void  OSInit (OS_ERR  *p_err)
 
     OS_PrioInit();                                          /* Initialize the priority bitmap table                   */
 
+#if OS_CFG_OBJ_REG_EN > 0u
+    OS_ObjRegInit();                                        /* Initialize the object registry                         */
+#endif
+
     OS_RdyListInit();                                       /* Initialize the Ready List                              */
 
     OS_TaskInit(p_err);                                     /* Initialize the task manager                            */
@@ -134,11 +160,14 @@ void  OSInit (OS_ERR  *p_err)
     }
 
 
-#if OS_CFG_STAT_TASK_EN > 0u                                /* Initialize the Statistic Task                          */
-    OS_StatTaskInit(p_err);
-    if (*p_err != OS_ERR_NONE) {
-        return;
-    }
+#if OS_CFG_STAT_TASK_EN > 0u                                /* Statistic task is created on first use by ...          */
+    OSStatTaskCtr        = (OS_TICK)0;                      /* ... OSStatTaskCPUUsageInit(), NOT here; only its ...    */
+    OSStatTaskCtrRun     = (OS_TICK)0;                      /* ... variables are initialized so a minimal boot ...     */
+    OSStatTaskCtrMax     = (OS_TICK)0;                      /* ... does not pay for the task creation or its stack    */
+    OSStatTaskRdy        =  OS_STATE_NOT_RDY;
+    OSStatResetFlag      =  DEF_FALSE;
+    OSStatTaskEn         =  DEF_TRUE;                       /* Measurements run by default; see OSStatTaskEnSet()     */
+    OSStatTaskTCB.StkPtr = (CPU_STK *)0;                    /* Marks the statistic task as not yet created            */
 #endif
 
 
@@ -166,6 +195,22 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if OS_CFG_EDF_EN > 0u                                      /* Initialize the EDF scheduling class                    */
+    OS_EdfInit(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
+#if OS_CFG_MTASK_EN > 0u                                    /* Initialize the Minitask Manager module                 */
+    OS_MTaskInit(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if OS_CFG_MUTEX_EN > 0u                                    /* Initialize the Mutex Manager module                    */
     OS_MutexInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -174,6 +219,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if OS_CFG_PIPE_EN > 0u
+    OS_PipeInit(p_err);                                     /* Initialize the Pipe Manager module                     */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if OS_CFG_Q_EN > 0u
     OS_QInit(p_err);                                        /* Initialize the Message Queue Manager module            */
     if (*p_err != OS_ERR_NONE) {
@@ -182,6 +235,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if OS_CFG_SQ_EN > 0u
+    OS_SQInit(p_err);                                       /* Initialize the Slot Queue Manager module               */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if OS_CFG_SEM_EN > 0u                                      /* Initialize the Semaphore Manager module                */
     OS_SemInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -203,7 +264,175 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
     OSCfg_Init();
+
+#if OS_CFG_DBG_EN > 0u
+    OSInitTime = OS_TS_GET() - ts_start;                    /* Boot-time report: time spent initializing the kernel   */
+#endif
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              REGISTER IDLE-TIME WORK
+*
+* Description: This function registers a background work item to be executed from the idle task hook, strictly when no
+*              other task is ready to run.
+*
+* Arguments  : p_work   is a pointer to the work item storage, typically a static, which must remain valid while the
+*              ------   item is registered.
+*
+*              p_name   is a pointer to an ASCII string naming the work item, for debugger inspection.
+*
+*              fnct     is the slice function.  Each invocation must perform one BOUNDED slice of the work, save its
+*                       progress in the checkpoint state and return: DEF_FALSE while work remains, DEF_TRUE once the
+*                       item has finished.  Finished items stay registered but are no longer run; re-arm by calling
+*                       OSIdleWorkAdd() again, or unlink with OSIdleWorkRemove().
+*
+*              p_arg    is the checkpoint state passed to every slice.
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE                 the work item was registered (or re-armed)
+*                           OS_ERR_OBJ_PTR_NULL         if 'p_work' is a NULL pointer
+*                           OS_ERR_IDLE_WORK_FNCT_NULL  if 'fnct' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) Slices run in the context of the idle task, which must never block: a slice may post but MUST NOT
+*                 call any blocking kernel service.  It runs with interrupts enabled, so a task readied mid-slice
+*                 preempts it like any other idle-task code -- that is what keeps background work from ever delaying a
+*                 real task.  Size slices accordingly (tens of microseconds, not milliseconds).
+*
+*              2) Calling OSIdleWorkAdd() on an item that is already registered does not create a duplicate: it resets
+*                 the item's checkpoint fields and clears its done flag, re-arming it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_IDLE_WORK_EN > 0u
+void  OSIdleWorkAdd (OS_IDLE_WORK       *p_work,
+                     CPU_CHAR           *p_name,
+                     OS_IDLE_WORK_FNCT   fnct,
+                     void               *p_arg,
+                     OS_ERR             *p_err)
+{
+    OS_IDLE_WORK  *p_item;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_work == (OS_IDLE_WORK *)0) {                      /* Validate 'p_work'                                      */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (fnct == (OS_IDLE_WORK_FNCT)0) {                     /* Validate 'fnct'                                        */
+        *p_err = OS_ERR_IDLE_WORK_FNCT_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_work->FnctPtr  = fnct;
+    p_work->ArgPtr   = p_arg;
+    p_work->NamePtr  = p_name;
+    p_work->SliceCtr = (CPU_INT32U)0;
+    p_work->Done     = DEF_FALSE;
+    p_item = OSIdleWorkListPtr;                             /* Re-arm in place if already registered (see Note #2)    */
+    while ((p_item != (OS_IDLE_WORK *)0) &&
+           (p_item != p_work)) {
+        p_item = p_item->NextPtr;
+    }
+    if (p_item == (OS_IDLE_WORK *)0) {
+        p_work->NextPtr   = OSIdleWorkListPtr;
+        OSIdleWorkListPtr = p_work;
+        OSIdleWorkQty++;
+    }
+    CPU_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
+}
+#endif
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                             UNREGISTER IDLE-TIME WORK
+*
+* Description: This function unlinks a background work item from the idle work list.
+*
+* Arguments  : p_work   is a pointer to the work item to unlink.
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE                 the work item was unlinked
+*                           OS_ERR_OBJ_PTR_NULL         if 'p_work' is a NULL pointer
+*                           OS_ERR_IDLE_WORK_NOT_FOUND  if 'p_work' is not in the idle work list
+*
+* Returns    : none
+*
+* Note(s)    : 1) The idle task may be preempted in the middle of a slice of this very item; removal only guarantees no
+*                 NEW slice starts.  The item's storage must therefore outlive the slice in flight -- with statically
+*                 allocated items (the normal case) this needs no further thought.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_IDLE_WORK_EN > 0u
+void  OSIdleWorkRemove (OS_IDLE_WORK  *p_work,
+                        OS_ERR        *p_err)
+{
+    OS_IDLE_WORK  *p_item;
+    OS_IDLE_WORK  *p_prev;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_work == (OS_IDLE_WORK *)0) {                      /* Validate 'p_work'                                      */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_prev = (OS_IDLE_WORK *)0;
+    p_item = OSIdleWorkListPtr;
+    while ((p_item != (OS_IDLE_WORK *)0) &&
+           (p_item != p_work)) {
+        p_prev = p_item;
+        p_item = p_item->NextPtr;
+    }
+    if (p_item == (OS_IDLE_WORK *)0) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_IDLE_WORK_NOT_FOUND;
+        return;
+    }
+    if (p_prev == (OS_IDLE_WORK *)0) {
+        OSIdleWorkListPtr = p_work->NextPtr;
+    } else {
+        p_prev->NextPtr   = p_work->NextPtr;
+    }
+    if (OSIdleWorkRunPtr == p_work) {                       /* Keep the rotor off the unlinked item                   */
+        OSIdleWorkRunPtr  = p_work->NextPtr;
+    }
+    p_work->NextPtr = (OS_IDLE_WORK *)0;
+    OSIdleWorkQty--;
+    CPU_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
 }
+#endif
 
 /*$PAGE*/
 /*
@@ -351,7 +580,7 @@ void  OSSafetyCriticalStart (void)
 ************************************************************************************************************************
 */
 
-void  OSSched (void)
+OS_RAM_FN  void  OSSched (void)
 {
     CPU_SR_ALLOC();
 
@@ -366,6 +595,7 @@ void  OSSched (void)
     }
 
     CPU_INT_DIS();
+    CPU_INT_DIS_MEAS_SITE_SET(CPU_INT_DIS_MEAS_SITE_OS_CORE);
     OSPrioHighRdy   = OS_PrioGetHighest();                  /* Find the highest priority ready                        */
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                   /* Current task is still highest priority task?           */
@@ -382,6 +612,76 @@ void  OSSched (void)
     CPU_INT_EN();
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            SCHEDULER, POST FAST PATH
+*
+* Description: This function is called by the single-task post paths instead of OSSched() when the priority of the task
+*              that was just made ready is known.  If that priority cannot preempt the caller, the highest-priority
+*              recomputation and the dispatch decision are skipped entirely.  If it CAN preempt, the woken task is
+*              known to be the new highest-priority task (see Note #2) and is dispatched directly, skipping the
+*              OS_PrioGetHighest() scan as well -- the most common wake pattern costs one compare either way.
+*
+* Arguments  : prio_new   is the priority of the task that the post just made ready to run
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) A post only ADDS a task to the ready list, so if 'prio_new' is not more urgent than the caller's
+*                 priority the caller is still the highest-priority ready task and no context switch can result
+*                 (a task readied AT the caller's priority is inserted at the tail and does not preempt).  This hint
+*                 therefore MUST NOT be used on paths that can remove tasks from the ready list (pend aborts, task
+*                 deletes) or that ready several tasks of different priorities (broadcast posts); those still call
+*                 OSSched().
+*
+*              3) An ISR sneaking in between the post and this test can ready a higher-priority task, but that ISR's
+*                 OSIntExit() performs its own dispatch, so skipping here never misses a required context switch.
+*
+*              4) The direct dispatch re-checks the ready list head with interrupts disabled: an ISR between the
+*                 post and this call can have dispatched the woken task already (it may even have run and blocked
+*                 again), in which case the decision recorded in 'prio_new' is stale and the generic OSSched()
+*                 path is taken instead.
+************************************************************************************************************************
+*/
+
+void  OS_SchedPost (OS_PRIO  prio_new)
+{
+    CPU_SR_ALLOC();
+
+
+
+    if (prio_new >= OSPrioCur) {                            /* Woken task cannot preempt the caller? (see Note #2)    */
+        return;                                             /* Yes, highest-priority ready task is unchanged          */
+    }
+
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Same dispatch guards as OSSched(): ...                 */
+        return;                                             /* ... OSIntExit()     performs the dispatch              */
+    }
+    if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {
+        return;                                             /* ... OSSchedUnlock() performs the dispatch              */
+    }
+
+    CPU_INT_DIS();
+    CPU_INT_DIS_MEAS_SITE_SET(CPU_INT_DIS_MEAS_SITE_OS_CORE);
+    OSTCBHighRdyPtr = OSRdyList[prio_new].HeadPtr;
+    if (OSTCBHighRdyPtr == (OS_TCB *)0) {                   /* An ISR already dispatched the woken task? (see Note #4)*/
+        CPU_INT_EN();                                       /* ... 'prio_new' is stale; take the generic path         */
+        OSSched();
+        return;
+    }
+    OSPrioHighRdy = prio_new;                               /* The single wake IS the new highest priority (Note #2): */
+                                                            /* ... no OS_PrioGetHighest() scan is needed              */
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    OSTCBHighRdyPtr->CtxSwCtr++;                            /* Inc. # of context switches to this task                */
+#endif
+    OSTaskCtxSwCtr++;                                       /* Increment context switch counter                       */
+
+    OS_TASK_SW();                                           /* Perform a task level context switch                    */
+    CPU_INT_EN();
+}
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -548,6 +848,58 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN  en,
 }
 #endif
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                      CONFIGURE ADAPTIVE ROUND-ROBIN TIME QUANTA
+*
+* Description: This function enables or disables adaptive time quanta for round-robin scheduling.  When enabled, the
+*              kernel tunes each task's time quanta from its observed behavior: a task that EXHAUSTS its quanta while
+*              same-priority peers are waiting has its quanta grown by a quarter (it is compute-bound, so fewer, longer
+*              slices cut context switch overhead), and a task that BLOCKS with more than half of its quanta unused has
+*              its quanta shrunk by a quarter (it is I/O-bound, so long slices only add latency for its peers).  Growth
+*              is capped at four times the default quanta and shrinkage stops at one tick, so each task converges to a
+*              slice length matched to its burst length without per-task manual tuning.
+*
+*              Adaptation rewrites the per-task '.TimeQuanta' (see OSTaskTimeQuantaSet()); a task created with time
+*              quanta of 0 starts adapting from the default quanta.
+*
+* Arguments  : en     determines whether adaptation will be enabled (when DEF_ENABLED) or not (when DEF_DISABLED)
+*
+*              p_err  is a pointer to a variable that will contain an error code returned by this function.
+*
+*                         OS_ERR_NONE    The call was successful
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
+void  OSSchedRoundRobinAdaptCfg (CPU_BOOLEAN   en,
+                                 OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (en != DEF_ENABLED) {
+        OSSchedRoundRobinAdaptEn = DEF_DISABLED;
+    } else {
+        OSSchedRoundRobinAdaptEn = DEF_ENABLED;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -604,7 +956,7 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
 
     CPU_CRITICAL_ENTER();
     p_rdy_list = &OSRdyList[OSPrioCur];                     /* Can't yield if it's the only task at that priority     */
-    if (p_rdy_list->NbrEntries < (OS_OBJ_QTY)2) {
+    if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {
         CPU_CRITICAL_EXIT();
        *p_err = OS_ERR_ROUND_ROBIN_1;
         return;
@@ -770,6 +1122,12 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 #endif
 
     OSIdleTaskCtr = (OS_IDLE_CTR)0;
+#if OS_CFG_IDLE_WORK_EN > 0u
+    OSIdleWorkListPtr  = (OS_IDLE_WORK *)0;                 /* No background work registered yet                      */
+    OSIdleWorkRunPtr   = (OS_IDLE_WORK *)0;
+    OSIdleWorkQty      = (OS_OBJ_QTY   )0;
+    OSIdleWorkSliceCtr = (CPU_INT32U   )0;
+#endif
                                                             /* ---------------- CREATE THE IDLE TASK ---------------- */
     OSTaskCreate((OS_TCB     *)&OSIdleTaskTCB,
                  (CPU_CHAR   *)((void *)"uC/OS-III Idle Task"),
@@ -786,6 +1144,71 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
                  (OS_ERR     *)p_err);
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                           RUN ONE SLICE OF IDLE-TIME WORK
+*
+* Description: This function is called by OSIdleTaskHook() to pick the next unfinished work item round robin and run
+*              one slice of it.
+*
+* Arguments  : none
+*
+* Returns    : DEF_TRUE   if a slice was executed (more work may be pending, come back around before sleeping)
+*              DEF_FALSE  if no runnable work is registered (the hook may sleep the CPU)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The slice itself runs OUTSIDE the critical section, with interrupts enabled: a task readied mid-slice
+*                 preempts the idle task as usual, so registered work never delays a ready task.  Only the list walk
+*                 and the rotor update are protected.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_IDLE_WORK_EN > 0u
+CPU_BOOLEAN  OS_IdleWorkRun (void)
+{
+    OS_IDLE_WORK  *p_work;
+    OS_OBJ_QTY     qty;
+    CPU_BOOLEAN    done;
+    CPU_SR_ALLOC();
+
+
+
+    CPU_CRITICAL_ENTER();
+    p_work = OSIdleWorkRunPtr;
+    if (p_work == (OS_IDLE_WORK *)0) {
+        p_work = OSIdleWorkListPtr;
+    }
+    qty = OSIdleWorkQty;                                    /* Next unfinished item, at most one lap over the list    */
+    while ((qty    >  (OS_OBJ_QTY)0) &&
+           (p_work != (OS_IDLE_WORK *)0) &&
+           (p_work->Done == DEF_TRUE)) {
+        p_work = p_work->NextPtr;
+        if (p_work == (OS_IDLE_WORK *)0) {
+            p_work = OSIdleWorkListPtr;
+        }
+        qty--;
+    }
+    if ((p_work == (OS_IDLE_WORK *)0) ||
+        (p_work->Done == DEF_TRUE)) {
+        CPU_CRITICAL_EXIT();                                /* Nothing runnable: everything finished or list empty    */
+        return (DEF_FALSE);
+    }
+    OSIdleWorkRunPtr = p_work->NextPtr;                     /* Advance the rotor before running the slice             */
+    CPU_CRITICAL_EXIT();
+
+    done = (*p_work->FnctPtr)(p_work->ArgPtr);              /* One bounded slice, interrupts enabled (see Note #2)    */
+
+    p_work->SliceCtr++;
+    OSIdleWorkSliceCtr++;
+    if (done == DEF_TRUE) {
+        p_work->Done = DEF_TRUE;
+    }
+    return (DEF_TRUE);
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -974,6 +1397,9 @@ void   OS_PendAbort (OS_PEND_OBJ *p_obj,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task's OS_PEND_DATA entry for the aborted object is found through the object's OWN wait list
+*                 instead of scanning the whole OS_PEND_DATA table of the task (see OS_Post1() Note #2).
 ************************************************************************************************************************
 */
 
@@ -981,22 +1407,18 @@ void  OS_PendAbort1 (OS_PEND_OBJ  *p_obj,
                      OS_TCB       *p_tcb,
                      CPU_TS        ts)
 {
-    OS_OBJ_QTY      n_pend_list;                                    /* Number of pend lists                           */
     OS_PEND_DATA   *p_pend_data;
 
 
 
-    p_pend_data = p_tcb->PendDataTblPtr;                            /* Point to the first OS_PEND_DATA to remove      */
-    n_pend_list = p_tcb->PendDataTblEntries;                        /* Get number of entries in the table             */
-
-    while (n_pend_list > (OS_OBJ_QTY)0) {                           /* Mark posted object in OS_PEND_DATA table       */
-        if (p_obj == p_pend_data->PendObjPtr) {                     /* Did we find the object pend aborted?           */
+    p_pend_data = p_obj->PendList.HeadPtr;                          /* Resolve the entry through the object's own ... */
+    while (p_pend_data != (OS_PEND_DATA *)0) {                      /* ... wait list (see Note #2)                    */
+        if (p_pend_data->TCBPtr == p_tcb) {                         /* Did we find the entry of the task to abort?    */
             p_pend_data->RdyObjPtr = p_obj;                         /* Yes, indicate the object in the .RdyObjPtr     */
             p_pend_data->RdyTS     = ts;                            /*      save the timestamp of the pend abort      */
             break;
         }
-        p_pend_data++;
-        n_pend_list--;
+        p_pend_data = p_pend_data->NextPtr;
     }
 }
 
@@ -1265,9 +1687,23 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb,
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    OS_PRIO  i;
+#endif
+
+
+
     p_pend_list->HeadPtr    = (OS_PEND_DATA *)0;
     p_pend_list->TailPtr    = (OS_PEND_DATA *)0;
     p_pend_list->NbrEntries = (OS_OBJ_QTY    )0;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {               /* No priority has a waiter yet                           */
+        p_pend_list->PrioTbl[i] = (CPU_DATA)0;
+    }
+    for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {
+        p_pend_list->PrioTailPtrTbl[i] = (OS_PEND_DATA *)0;
+    }
+#endif
 }
 
 /*$PAGE*/
@@ -1321,9 +1757,22 @@ void  OS_PendListInsertHead (OS_PEND_LIST  *p_pend_list,
                              OS_PEND_DATA  *p_pend_data)
 {
     OS_PEND_DATA  *p_pend_data_next;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    OS_PRIO        prio;
+#endif
 
 
 
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    prio              = p_pend_data->TCBPtr->Prio;
+    p_pend_data->Prio = prio;
+    if (p_pend_list->PrioTailPtrTbl[prio] == (OS_PEND_DATA *)0) {  /* Only waiter at this priority: it is the tail    */
+        p_pend_list->PrioTbl[prio / (sizeof(CPU_DATA) * 8u)] |= (CPU_DATA)1u
+                                                             << ((sizeof(CPU_DATA) * 8u - 1u)
+                                                             -   ((CPU_DATA)prio & (sizeof(CPU_DATA) * 8u - 1u)));
+        p_pend_list->PrioTailPtrTbl[prio] = p_pend_data;
+    }
+#endif
     p_pend_list->NbrEntries++;                              /* One more entry in the list                             */
     p_pend_data->NextPtr  = p_pend_list->HeadPtr;           /* Adjust new entry's links                               */
     p_pend_data->PrevPtr  = (OS_PEND_DATA  *)0;
@@ -1402,6 +1851,10 @@ void  OS_PendListInsertHead (OS_PEND_LIST  *p_pend_list,
 *
 *              2) 'p_pend_data->TCBPtr->Prio' contains the priority of the TCB associated with the entry to insert.
 *                 We can compare this priority with the priority of other entries in the list.
+*
+*              3) With OS_CFG_PEND_PRIO_TBL_EN, the insertion point is found from a per-list priority bitmap and
+*                 per-priority tail pointers (same layout as OSPrioTbl) instead of walking the list, so the time spent
+*                 with interrupts disabled does NOT depend on the number of tasks already waiting.
 ************************************************************************************************************************
 */
 
@@ -1410,14 +1863,68 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 {
     OS_PRIO        prio;
     OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
     OS_PEND_DATA  *p_pend_data_prev;
     OS_PEND_DATA  *p_pend_data_next;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    OS_PRIO        ix;
+    CPU_DATA       bit;
+    CPU_DATA       bits;
+#else
+    OS_TCB        *p_tcb_next;
+#endif
 
 
 
     p_tcb = p_pend_data->TCBPtr;                                      /* Obtain the priority of the task to insert    */
     prio  = p_tcb->Prio;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    p_pend_data->Prio = prio;                                         /* Remember where we insert, for removal        */
+    p_pend_data_prev  = p_pend_list->PrioTailPtrTbl[prio];            /* Last waiter at the SAME priority, if any     */
+    if (p_pend_data_prev == (OS_PEND_DATA *)0) {                      /* None: locate the nearest HIGHER prio tail    */
+        ix    = (OS_PRIO  )(prio / (sizeof(CPU_DATA) * 8u));
+        bit   = (CPU_DATA )1u
+             << ((sizeof(CPU_DATA) * 8u - 1u) - ((CPU_DATA)prio & (sizeof(CPU_DATA) * 8u - 1u)));
+        bits  = p_pend_list->PrioTbl[ix]
+              & (CPU_DATA)~(bit | (bit - 1u));                        /* Higher prios map to more significant bits    */
+        for (;;) {
+            if (bits != (CPU_DATA)0) {
+                bits &= (CPU_DATA)0 - bits;                           /* Keep the LSB: closest priority above ours    */
+                p_pend_data_prev = p_pend_list->PrioTailPtrTbl[(ix * (sizeof(CPU_DATA) * 8u))
+                                                             + (OS_PRIO)CPU_CntLeadZeros(bits)];
+                break;
+            }
+            if (ix == (OS_PRIO)0) {                                   /* No higher priority waiting: we are the head  */
+                break;
+            }
+            ix--;
+            bits = p_pend_list->PrioTbl[ix];
+        }
+        p_pend_list->PrioTbl[prio / (sizeof(CPU_DATA) * 8u)] |= bit;  /* This priority now has a waiter               */
+    }
+    p_pend_list->PrioTailPtrTbl[prio] = p_pend_data;                  /* New entry is the tail of its priority group  */
+    p_pend_list->NbrEntries++;
+    if (p_pend_data_prev == (OS_PEND_DATA *)0) {                      /* Insert as the new head of the list           */
+        p_pend_data_next     = p_pend_list->HeadPtr;
+        p_pend_data->PrevPtr = (OS_PEND_DATA *)0;
+        p_pend_data->NextPtr = p_pend_data_next;
+        if (p_pend_data_next != (OS_PEND_DATA *)0) {
+            p_pend_data_next->PrevPtr = p_pend_data;
+        } else {
+            p_pend_list->TailPtr      = p_pend_data;
+        }
+        p_pend_list->HeadPtr = p_pend_data;
+    } else {                                                          /* Insert AFTER the tail found above            */
+        p_pend_data_next          = p_pend_data_prev->NextPtr;
+        p_pend_data->PrevPtr      = p_pend_data_prev;
+        p_pend_data->NextPtr      = p_pend_data_next;
+        p_pend_data_prev->NextPtr = p_pend_data;
+        if (p_pend_data_next != (OS_PEND_DATA *)0) {
+            p_pend_data_next->PrevPtr = p_pend_data;
+        } else {
+            p_pend_list->TailPtr      = p_pend_data;
+        }
+    }
+#else
     if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {                   /* CASE 0: Insert when there are no entries     */
         p_pend_list->NbrEntries = (OS_OBJ_QTY)1;                      /*         This is the first entry              */
         p_pend_data->NextPtr    = (OS_PEND_DATA *)0;                  /*         No other OS_PEND_DATAs in the list   */
@@ -1456,6 +1963,7 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
             }
         }
     }
+#endif
 }
 
 /*$PAGE*/
@@ -1588,9 +2096,27 @@ void  OS_PendListRemove1 (OS_PEND_LIST  *p_pend_list,
 {
     OS_PEND_DATA  *p_prev;
     OS_PEND_DATA  *p_next;
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    OS_PRIO        prio;
+#endif
 
 
 
+#if OS_CFG_PEND_PRIO_TBL_EN > 0u
+    prio = p_pend_data->Prio;                               /* Use the priority recorded at insertion: the TCB may    */
+    if (p_pend_list->PrioTailPtrTbl[prio] == p_pend_data) { /* ... have changed since.  Tail of its priority group?   */
+        p_prev = p_pend_data->PrevPtr;
+        if ((p_prev       != (OS_PEND_DATA *)0) &&
+            (p_prev->Prio ==  prio)) {
+            p_pend_list->PrioTailPtrTbl[prio] = p_prev;     /* Previous entry keeps the group alive                   */
+        } else {
+            p_pend_list->PrioTailPtrTbl[prio] = (OS_PEND_DATA *)0;
+            p_pend_list->PrioTbl[prio / (sizeof(CPU_DATA) * 8u)] &= (CPU_DATA)~((CPU_DATA)1u
+                                                                 << ((sizeof(CPU_DATA) * 8u - 1u)
+                                                                 -   ((CPU_DATA)prio & (sizeof(CPU_DATA) * 8u - 1u))));
+        }
+    }
+#endif
     if (p_pend_list->NbrEntries == 1u) {
         p_pend_list->HeadPtr = (OS_PEND_DATA *)0;           /* Only one entry in the pend list                        */
         p_pend_list->TailPtr = (OS_PEND_DATA *)0;
@@ -1736,6 +2262,12 @@ void   OS_PendObjDel (OS_PEND_OBJ *p_obj,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task's OS_PEND_DATA entry for the deleted object is found through the object's OWN wait list
+*                 (every entry in the table was inserted in the wait list of the object it refers to by
+*                 OS_PendMultiWait()) instead of scanning the whole OS_PEND_DATA table of the task.  Since the caller
+*                 selects the task to wake from the head of that same wait list, the entry is found on the first
+*                 probe in all kernel call paths.
 ************************************************************************************************************************
 */
 
@@ -1743,22 +2275,18 @@ void  OS_PendObjDel1 (OS_PEND_OBJ  *p_obj,
                       OS_TCB       *p_tcb,
                       CPU_TS        ts)
 {
-    OS_OBJ_QTY      n_pend_list;                                    /* Number of pend lists                           */
     OS_PEND_DATA   *p_pend_data;
 
 
 
-    p_pend_data = p_tcb->PendDataTblPtr;                            /* Point to the first OS_PEND_DATA to remove      */
-    n_pend_list = p_tcb->PendDataTblEntries;                        /* Get number of entries in the table             */
-
-    while (n_pend_list > (OS_OBJ_QTY)0) {                           /* Mark posted object in OS_PEND_DATA table       */
-        if (p_obj == p_pend_data->PendObjPtr) {                     /* Did we find the object deleted?                */
+    p_pend_data = p_obj->PendList.HeadPtr;                          /* Resolve the entry through the object's own ... */
+    while (p_pend_data != (OS_PEND_DATA *)0) {                      /* ... wait list (see Note #2)                    */
+        if (p_pend_data->TCBPtr == p_tcb) {                         /* Did we find the entry of the task to wake?     */
             p_pend_data->RdyObjPtr = p_obj;                         /* Yes, indicate the object in the .RdyObjPtr     */
             p_pend_data->RdyTS     = ts;                            /*      save the timestamp                        */
             break;
         }
-        p_pend_data++;
-        n_pend_list--;
+        p_pend_data = p_pend_data->NextPtr;
     }
 }
 
@@ -1911,6 +2439,13 @@ void   OS_Post (OS_PEND_OBJ  *p_obj,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task's OS_PEND_DATA entry for the posted object is found through the object's OWN wait list:
+*                 every entry of the OS_PEND_DATA table was inserted (by priority) in the wait list of the object it
+*                 refers to by OS_PendMultiWait(), so that wait list doubles as a back-reference from the object to
+*                 the entry to mark.  All posting code selects the task to wake from the head of that same wait list,
+*                 so the entry is found on the FIRST probe and a post resolves the multi-pend in O(1), instead of
+*                 scanning the task's whole OS_PEND_DATA table as was done before.
 ************************************************************************************************************************
 */
 
@@ -1920,24 +2455,121 @@ void  OS_Post1 (OS_PEND_OBJ  *p_obj,
                 OS_MSG_SIZE   msg_size,
                 CPU_TS        ts)
 {
-    OS_OBJ_QTY      n_pend_list;                                    /* Number of pend lists                           */
     OS_PEND_DATA   *p_pend_data;
 
 
 
-    p_pend_data = p_tcb->PendDataTblPtr;                            /* Point to the first OS_PEND_DATA to remove      */
-    n_pend_list = p_tcb->PendDataTblEntries;                        /* Get number of entries in the table             */
-
-    while (n_pend_list > (OS_OBJ_QTY)0) {                           /* Mark posted object in OS_PEND_DATA table       */
-        if (p_obj == p_pend_data->PendObjPtr) {                     /* Did we find the object posted to?              */
+    p_pend_data = p_obj->PendList.HeadPtr;                          /* Resolve the entry through the object's own ... */
+    while (p_pend_data != (OS_PEND_DATA *)0) {                      /* ... wait list (see Note #2)                    */
+        if (p_pend_data->TCBPtr == p_tcb) {                         /* Did we find the entry of the task to wake?     */
             p_pend_data->RdyObjPtr  = p_obj;                        /* Yes, indicate the object in the .RdyObjPtr     */
             p_pend_data->RdyMsgPtr  = p_void;                       /*      store the message posted                  */
             p_pend_data->RdyMsgSize = msg_size;                     /*      store the size of the message posted      */
             p_pend_data->RdyTS      = ts;                           /*      save the timestamp of the post            */
             break;
         }
-        p_pend_data++;
-        n_pend_list--;
+        p_pend_data = p_pend_data->NextPtr;
+    }
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                         POST TO ALL TASKS WAITING ON AN OBJECT
+*
+* Description: This function is called to broadcast a post (OS_OPT_POST_ALL) to every task waiting on an object.  It
+*              performs the work of one OS_Post() call per waiter in a SINGLE pass over the object's wait list, so a
+*              fan-out wakeup costs close to a single post (see Note #2).
+*
+* Arguments  : p_obj          Is a pointer to the object being posted to
+*              -----
+*
+*              p_void         If we are posting a message, this is the message that the tasks will receive
+*
+*              msg_size       If we are posting a message, this is the size of the message
+*
+*              ts             The timestamp as to when the post occurred
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The wait list is priority ordered, so tasks of equal priority are adjacent and the ready list
+*                 bitmap only needs to be touched once per DISTINCT priority released instead of once per task.
+*                 Multi-pend entries are marked in place (the wait list node IS the OS_PEND_DATA entry to fill),
+*                 and the caller makes the single scheduling decision once the whole batch has been readied.
+************************************************************************************************************************
+*/
+
+void  OS_PostAll (OS_PEND_OBJ  *p_obj,
+                  void         *p_void,
+                  OS_MSG_SIZE   msg_size,
+                  CPU_TS        ts)
+{
+    OS_PEND_DATA   *p_pend_data;
+    OS_PEND_DATA   *p_pend_data_next;
+    OS_TCB         *p_tcb;
+    OS_PRIO         prio_prev;
+
+
+
+    prio_prev   = (OS_PRIO)OS_CFG_PRIO_MAX;                         /* Invalid priority forces the first bitmap set   */
+    p_pend_data = p_obj->PendList.HeadPtr;
+    while (p_pend_data != (OS_PEND_DATA *)0) {
+        p_pend_data_next = p_pend_data->NextPtr;
+        p_tcb            = p_pend_data->TCBPtr;
+        if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {               /* Mark the wait list entry at hand (see Note #2) */
+            p_pend_data->RdyObjPtr  = p_obj;
+            p_pend_data->RdyMsgPtr  = p_void;
+            p_pend_data->RdyMsgSize = msg_size;
+            p_pend_data->RdyTS      = ts;
+        } else {
+#if (OS_MSG_EN > 0u)
+            p_tcb->MsgPtr  = p_void;                                /* Deposit message in OS_TCB of task waiting      */
+            p_tcb->MsgSize = msg_size;                              /* ... assuming posting a message                 */
+#endif
+            p_tcb->TS      = ts;
+        }
+        switch (p_tcb->TaskState) {
+            case OS_TASK_STATE_PEND:
+            case OS_TASK_STATE_PEND_TIMEOUT:
+                 OS_TickListRemove(p_tcb);                          /* Cancel any timeout                             */
+                 OS_PendListRemove(p_tcb);                          /* Remove task from wait list(s)                  */
+#if OS_CFG_DBG_EN > 0u
+                 OS_PendDbgNameRemove(p_obj,
+                                      p_tcb);
+#endif
+                 if (p_tcb->Prio != prio_prev) {                    /* Only touch the bitmap once per distinct prio   */
+                     OS_PrioInsert(p_tcb->Prio);
+                     prio_prev = p_tcb->Prio;
+                 }
+                 if (p_tcb->Prio == OSPrioCur) {                    /* Are we readying a task at the same prio?       */
+                     OS_RdyListInsertTail(p_tcb);                   /* Yes, insert readied task at the end of list    */
+                 } else {
+                     OS_RdyListInsertHead(p_tcb);                   /* No,  insert readied task at beginning of list  */
+                 }
+                 p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                 p_tcb->PendStatus = OS_STATUS_PEND_OK;             /* Clear pend status                              */
+                 p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;       /* Indicate no longer pending                     */
+                 break;
+
+            case OS_TASK_STATE_PEND_SUSPENDED:
+            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                 OS_TickListRemove(p_tcb);                          /* Cancel any timeout                             */
+                 OS_PendListRemove(p_tcb);                          /* Remove task from wait list(s)                  */
+#if OS_CFG_DBG_EN > 0u
+                 OS_PendDbgNameRemove(p_obj,
+                                      p_tcb);
+#endif
+                 p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;       /* Task remains suspended                         */
+                 p_tcb->PendStatus = OS_STATUS_PEND_OK;             /* Clear pend status                              */
+                 p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;       /* Indicate no longer pending                     */
+                 break;
+
+            default:                                                /* Wait list entries are always pending tasks     */
+                 break;
+        }
+        p_pend_data = p_pend_data_next;
     }
 }
 
@@ -1949,31 +2581,30 @@ void  OS_Post1 (OS_PEND_OBJ  *p_obj,
 *
 * Description: This function is called by OSInit() to initialize the ready list.  The ready list contains a list of all
 *              the tasks that are ready to run.  The list is actually an array of OS_RDY_LIST.  An OS_RDY_LIST contains
-*              three fields.  The number of OS_TCBs in the list (i.e. .NbrEntries), a pointer to the first OS_TCB in the
-*              OS_RDY_LIST (i.e. .HeadPtr) and a pointer to the last OS_TCB in the OS_RDY_LIST (i.e. .TailPtr).
+*              two fields: a pointer to the first OS_TCB in the OS_RDY_LIST (i.e. .HeadPtr) and a pointer to the last
+*              OS_TCB in the OS_RDY_LIST (i.e. .TailPtr), so each entry packs into two adjacent words.
 *
 *              OS_TCBs are doubly linked in the OS_RDY_LIST and each OS_TCB points pack to the OS_RDY_LIST it belongs
 *              to.
 *
 *              'OS_RDY_LIST  OSRdyTbl[OS_CFG_PRIO_MAX]'  looks like this once initialized:
 *
-*                               +---------------+--------------+
-*                               |               | TailPtr      |-----> 0
-*                          [0]  | NbrEntries=0  +--------------+
-*                               |               | HeadPtr      |-----> 0
-*                               +---------------+--------------+
-*                               |               | TailPtr      |-----> 0
-*                          [1]  | NbrEntries=0  +--------------+
-*                               |               | HeadPtr      |-----> 0
-*                               +---------------+--------------+
-*                                       :              :
-*                                       :              :
-*                                       :              :
-*                               +---------------+--------------+
-*                               |               | TailPtr      |-----> 0
-*          [OS_CFG_PRIO_MAX-1]  | NbrEntries=0  +--------------+
-*                               |               | HeadPtr      |-----> 0
-*                               +---------------+--------------+
+*                               +--------------+
+*                          [0]  | TailPtr      |-----> 0
+*                               +--------------+
+*                               | HeadPtr      |-----> 0
+*                               +--------------+
+*                          [1]  | TailPtr      |-----> 0
+*                               +--------------+
+*                               | HeadPtr      |-----> 0
+*                               +--------------+
+*                                       :
+*                                       :
+*                               +--------------+
+*          [OS_CFG_PRIO_MAX-1]  | TailPtr      |-----> 0
+*                               +--------------+
+*                               | HeadPtr      |-----> 0
+*                               +--------------+
 *
 *
 * Arguments  : none
@@ -1993,9 +2624,8 @@ void  OS_RdyListInit (void)
 
     for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {                /* Initialize the array of OS_RDY_LIST at each priority   */
         p_rdy_list = &OSRdyList[i];
-        p_rdy_list->NbrEntries = (OS_OBJ_QTY)0;
-        p_rdy_list->HeadPtr    = (OS_TCB   *)0;
-        p_rdy_list->TailPtr    = (OS_TCB   *)0;
+        p_rdy_list->HeadPtr = (OS_TCB *)0;
+        p_rdy_list->TailPtr = (OS_TCB *)0;
     }
 }
 
@@ -2043,8 +2673,6 @@ void  OS_RdyListInsert (OS_TCB *p_tcb)
 *                     +--------------+
 *                     | HeadPtr      |-> 0
 *                     +--------------+
-*                     | NbrEntries=0 |
-*                     +--------------+
 *
 *
 *
@@ -2056,8 +2684,8 @@ void  OS_RdyListInsert (OS_TCB *p_tcb)
 *                     +--------------+  |     | NextPtr    |->0
 *                     | HeadPtr      |--/     +------------+
 *                     +--------------+     0<-| PrevPtr    |
-*                     | NbrEntries=1 |        +------------+
-*                     +--------------+        :            :
+*                                             +------------+
+*                                             :            :
 *                                             :            :
 *                                             +------------+
 *
@@ -2068,8 +2696,8 @@ void  OS_RdyListInsert (OS_TCB *p_tcb)
 *                     +--------------+          OS_TCB               OS_TCB          |     OS_TCB
 *                     | HeadPtr      |------> +------------+       +------------+    +-> +------------+
 *                     +--------------+        | NextPtr    |------>| NextPtr    | ...... | NextPtr    |->0
-*                     | NbrEntries=N |        +------------+       +------------+        +------------+
-*                     +--------------+     0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
+*                     +--------------+        +------------+       +------------+        +------------+
+*                                          0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
 *                                             +------------+       +------------+        +------------+
 *                                             :            :       :            :        :            :
 *                                             :            :       :            :        :            :
@@ -2093,14 +2721,12 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
     p_rdy_list = &OSRdyList[p_tcb->Prio];
-    if (p_rdy_list->NbrEntries == (OS_OBJ_QTY)0) {          /* CASE 0: Insert when there are no entries               */
-        p_rdy_list->NbrEntries =  (OS_OBJ_QTY)1;            /*         This is the first entry                        */
+    if (p_rdy_list->HeadPtr == (OS_TCB *)0) {               /* CASE 0: Insert when there are no entries               */
         p_tcb->NextPtr         =  (OS_TCB   *)0;            /*         No other OS_TCBs in the list                   */
         p_tcb->PrevPtr         =  (OS_TCB   *)0;
         p_rdy_list->HeadPtr    =  p_tcb;                    /*         Both list pointers point to this OS_TCB        */
         p_rdy_list->TailPtr    =  p_tcb;
     } else {                                                /* CASE 1: Insert BEFORE the current head of list         */
-        p_rdy_list->NbrEntries++;                           /*         One more OS_TCB in the list                    */
         p_tcb->NextPtr         = p_rdy_list->HeadPtr;       /*         Adjust new OS_TCBs links                       */
         p_tcb->PrevPtr         = (OS_TCB    *)0;
         p_tcb2                 = p_rdy_list->HeadPtr;       /*         Adjust old head of list's links                */
@@ -2124,8 +2750,6 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 *                     +--------------+
 *                     | HeadPtr      |-> 0
 *                     +--------------+
-*                     | NbrEntries=0 |
-*                     +--------------+
 *
 *
 *
@@ -2137,8 +2761,8 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 *                     +--------------+  |     | NextPtr    |->0
 *                     | HeadPtr      |--/     +------------+
 *                     +--------------+     0<-| PrevPtr    |
-*                     | NbrEntries=1 |        +------------+
-*                     +--------------+        :            :
+*                                             +------------+
+*                                             :            :
 *                                             :            :
 *                                             +------------+
 *
@@ -2149,8 +2773,8 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 *                     +--------------+          OS_TCB               OS_TCB          |     OS_TCB
 *                     | HeadPtr      |------> +------------+       +------------+    +-> +------------+
 *                     +--------------+        | NextPtr    |------>| NextPtr    | ...... | NextPtr    |->0
-*                     | NbrEntries=N |        +------------+       +------------+        +------------+
-*                     +--------------+     0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
+*                     +--------------+        +------------+       +------------+        +------------+
+*                                          0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
 *                                             +------------+       +------------+        +------------+
 *                                             :            :       :            :        :            :
 *                                             :            :       :            :        :            :
@@ -2174,14 +2798,12 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
     p_rdy_list = &OSRdyList[p_tcb->Prio];
-    if (p_rdy_list->NbrEntries == (OS_OBJ_QTY)0) {          /* CASE 0: Insert when there are no entries               */
-        p_rdy_list->NbrEntries  = (OS_OBJ_QTY)1;            /*         This is the first entry                        */
+    if (p_rdy_list->HeadPtr == (OS_TCB *)0) {               /* CASE 0: Insert when there are no entries               */
         p_tcb->NextPtr          = (OS_TCB   *)0;            /*         No other OS_TCBs in the list                   */
         p_tcb->PrevPtr          = (OS_TCB   *)0;
         p_rdy_list->HeadPtr     = p_tcb;                    /*         Both list pointers point to this OS_TCB        */
         p_rdy_list->TailPtr     = p_tcb;
     } else {                                                /* CASE 1: Insert AFTER the current tail of list          */
-        p_rdy_list->NbrEntries++;                           /*         One more OS_TCB in the list                    */
         p_tcb->NextPtr          = (OS_TCB   *)0;            /*         Adjust new OS_TCBs links                       */
         p_tcb2                  = p_rdy_list->TailPtr;
         p_tcb->PrevPtr          = p_tcb2;
@@ -2210,8 +2832,8 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 *                     +--------------+          OS_TCB          |     OS_TCB
 *                     | HeadPtr      |------> +------------+    +-> +------------+
 *                     +--------------+        | NextPtr    |------> | NextPtr    |->0
-*                     | NbrEntries=2 |        +------------+        +------------+
-*                     +--------------+     0<-| PrevPtr    | <------| PrevPtr    |
+*                     +--------------+        +------------+        +------------+
+*                                          0<-| PrevPtr    | <------| PrevPtr    |
 *                                             +------------+        +------------+
 *                                             :            :        :            :
 *                                             :            :        :            :
@@ -2226,8 +2848,8 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 *                     +--------------+          OS_TCB               OS_TCB          |     OS_TCB
 *                     | HeadPtr      |------> +------------+       +------------+    +-> +------------+
 *                     +--------------+        | NextPtr    |------>| NextPtr    | ...... | NextPtr    |->0
-*                     | NbrEntries=N |        +------------+       +------------+        +------------+
-*                     +--------------+     0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
+*                     +--------------+        +------------+       +------------+        +------------+
+*                                          0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
 *                                             +------------+       +------------+        +------------+
 *                                             :            :       :            :        :            :
 *                                             :            :       :            :        :            :
@@ -2251,33 +2873,26 @@ void  OS_RdyListMoveHeadToTail (OS_RDY_LIST  *p_rdy_list)
 
 
 
-    switch (p_rdy_list->NbrEntries) {
-        case 0:
-        case 1:
-             break;
-
-        case 2:                                             /* SWAP the TCBs                                          */
-             p_tcb1              = p_rdy_list->HeadPtr;     /* Point to current head                                  */
-             p_tcb2              = p_rdy_list->TailPtr;     /* Point to current tail                                  */
-             p_tcb1->PrevPtr     = p_tcb2;
-             p_tcb1->NextPtr     = (OS_TCB *)0;
-             p_tcb2->PrevPtr     = (OS_TCB *)0;
-             p_tcb2->NextPtr     = p_tcb1;
-             p_rdy_list->HeadPtr = p_tcb2;
-             p_rdy_list->TailPtr = p_tcb1;
-             break;
-
-        default:                                            /* Move only if there are more than 2 OS_TCBs in the list */
-             p_tcb1              = p_rdy_list->HeadPtr;     /* Point to current head                                  */
-             p_tcb2              = p_rdy_list->TailPtr;     /* Point to current tail                                  */
-             p_tcb3              = p_tcb1->NextPtr;         /* Point to new list head                                 */
-             p_tcb3->PrevPtr     = (OS_TCB *)0;             /* Adjust back    link of new list head                   */
-             p_tcb1->NextPtr     = (OS_TCB *)0;             /* Adjust forward link of new list tail                   */
-             p_tcb1->PrevPtr     = p_tcb2;                  /* Adjust back    link of new list tail                   */
-             p_tcb2->NextPtr     = p_tcb1;                  /* Adjust forward link of old list tail                   */
-             p_rdy_list->HeadPtr = p_tcb3;                  /* Adjust new list head and tail pointers                 */
-             p_rdy_list->TailPtr = p_tcb1;
-             break;
+    p_tcb1 = p_rdy_list->HeadPtr;                           /* Point to current head                                  */
+    p_tcb2 = p_rdy_list->TailPtr;                           /* Point to current tail                                  */
+    if (p_tcb1 == p_tcb2) {                                 /* 0 or 1 entry in the list, nothing to move              */
+        return;
+    }
+    if (p_tcb1->NextPtr == p_tcb2) {                        /* 2 entries, SWAP the TCBs                               */
+        p_tcb1->PrevPtr     = p_tcb2;
+        p_tcb1->NextPtr     = (OS_TCB *)0;
+        p_tcb2->PrevPtr     = (OS_TCB *)0;
+        p_tcb2->NextPtr     = p_tcb1;
+        p_rdy_list->HeadPtr = p_tcb2;
+        p_rdy_list->TailPtr = p_tcb1;
+    } else {                                                /* More than 2 OS_TCBs in the list                        */
+        p_tcb3              = p_tcb1->NextPtr;              /* Point to new list head                                 */
+        p_tcb3->PrevPtr     = (OS_TCB *)0;                  /* Adjust back    link of new list head                   */
+        p_tcb1->NextPtr     = (OS_TCB *)0;                  /* Adjust forward link of new list tail                   */
+        p_tcb1->PrevPtr     = p_tcb2;                       /* Adjust back    link of new list tail                   */
+        p_tcb2->NextPtr     = p_tcb1;                       /* Adjust forward link of old list tail                   */
+        p_rdy_list->HeadPtr = p_tcb3;                       /* Adjust new list head and tail pointers                 */
+        p_rdy_list->TailPtr = p_tcb1;
     }
 }
 
@@ -2300,8 +2915,8 @@ void  OS_RdyListMoveHeadToTail (OS_RDY_LIST  *p_rdy_list)
 *                     +--------------+  |     | NextPtr    |->0
 *                     | HeadPtr      |--/     +------------+
 *                     +--------------+     0<-| PrevPtr    |
-*                     | NbrEntries=1 |        +------------+
-*                     +--------------+        :            :
+*                                             +------------+
+*                                             :            :
 *                                             :            :
 *                                             +------------+
 *
@@ -2313,8 +2928,8 @@ void  OS_RdyListMoveHeadToTail (OS_RDY_LIST  *p_rdy_list)
 *                     +--------------+          OS_TCB               OS_TCB          |     OS_TCB
 *                     | HeadPtr      |------> +------------+       +------------+    +-> +------------+
 *                     +--------------+        | NextPtr    |------>| NextPtr    | ...... | NextPtr    |->0
-*                     | NbrEntries=N |        +------------+       +------------+        +------------+
-*                     +--------------+     0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
+*                     +--------------+        +------------+       +------------+        +------------+
+*                                          0<-| PrevPtr    |<------| PrevPtr    | ...... | PrevPtr    |
 *                                             +------------+       +------------+        +------------+
 *                                             :            :       :            :        :            :
 *                                             :            :       :            :        :            :
@@ -2343,18 +2958,15 @@ void  OS_RdyListRemove (OS_TCB *p_tcb)
     p_tcb2     = p_tcb->NextPtr;
     if (p_tcb1 == (OS_TCB *)0) {                            /* Was the OS_TCB to remove was at the head?              */
         if (p_tcb2 == (OS_TCB *)0) {                        /* Yes, was it the only OS_TCB?                           */
-            p_rdy_list->NbrEntries = (OS_OBJ_QTY)0;         /*      Yes, no more entries                              */
-            p_rdy_list->HeadPtr    = (OS_TCB   *)0;
+            p_rdy_list->HeadPtr    = (OS_TCB   *)0;         /*      Yes, no more entries                              */
             p_rdy_list->TailPtr    = (OS_TCB   *)0;
             OS_PrioRemove(p_tcb->Prio);
         } else {
-            p_rdy_list->NbrEntries--;                       /*      No,  one less entry                               */
-            p_tcb2->PrevPtr        = (OS_TCB   *)0;         /*           adjust back link of new list head            */
+            p_tcb2->PrevPtr        = (OS_TCB   *)0;         /*      No,  adjust back link of new list head            */
             p_rdy_list->HeadPtr    = p_tcb2;                /*           adjust OS_RDY_LIST's new head                */
         }
     } else {
-        p_rdy_list->NbrEntries--;                           /* No,  one less entry                                    */
-        p_tcb1->NextPtr = p_tcb2;
+        p_tcb1->NextPtr = p_tcb2;                           /* No,  unlink from the middle or the tail                */
         if (p_tcb2 == (OS_TCB *)0) {
             p_rdy_list->TailPtr = p_tcb1;                   /*      Removing the TCB at the tail, adj the tail ptr    */
         } else {
@@ -2443,10 +3055,16 @@ void  OS_SchedLockTimeMeasStop (void)
               - OSSchedLockTimeBegin;
         if (delta > OSSchedLockTimeMax) {                   /* Detect peak value                                      */
             OSSchedLockTimeMax    = delta;
+            OSSchedLockHolderPtr  = OSTCBCurPtr;            /* Remember which task held the longest blackout          */
         }
         if (delta > OSSchedLockTimeMaxCur) {                /* Detect peak value (for resetable value)                */
             OSSchedLockTimeMaxCur = delta;
         }
+        if ((OSAnomalySchedLockTrig >  (CPU_TS_TMR)0) &&    /* Hold time crossed the trigger? (see os.h)              */
+            (delta                  >= OSAnomalySchedLockTrig) &&
+            (OSAnomalyHookPtr       != (OS_ANOMALY_HOOK)0)) {
+            (*OSAnomalyHookPtr)(OS_ANOMALY_SCHED_LOCK, (CPU_TS)delta);
+        }
     }
 }
 #endif
@@ -2472,6 +3090,8 @@ void  OS_SchedLockTimeMeasStop (void)
 void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 {
     OS_TCB   *p_tcb;
+    OS_TICK   quanta;
+    OS_TICK   quanta_max;
     CPU_SR_ALLOC();
 
 
@@ -2502,7 +3122,7 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         return;
     }
 
-    if (p_rdy_list->NbrEntries < (OS_OBJ_QTY)2) {           /* See if it's time to time slice current task            */
+    if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {       /* See if it's time to time slice current task            */
         CPU_CRITICAL_EXIT();                                /* ... only if multiple tasks at same priority            */
         return;
     }
@@ -2512,6 +3132,21 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         return;
     }
 
+    if (OSSchedRoundRobinAdaptEn == DEF_TRUE) {             /* Exhausted with peers waiting: compute-bound, so ...    */
+        quanta = p_tcb->TimeQuanta;                         /* ... grow its quanta to cut switch overhead             */
+        if (quanta == (OS_TICK)0) {
+            quanta = OSSchedRoundRobinDfltTimeQuanta;       /* Adapt from the default quanta (see OSTaskCreate())     */
+        }
+        quanta_max = OSSchedRoundRobinDfltTimeQuanta << 2;  /* Growth is capped at 4x the default quanta              */
+        if (quanta < quanta_max) {
+            quanta += (quanta >> 2) + (OS_TICK)1;
+            if (quanta > quanta_max) {
+                quanta = quanta_max;
+            }
+            p_tcb->TimeQuanta = quanta;
+        }
+    }
+
     OS_RdyListMoveHeadToTail(p_rdy_list);                   /* Move current OS_TCB to the end of the list             */
     p_tcb = p_rdy_list->HeadPtr;                            /* Point to new OS_TCB at head of the list                */
     if (p_tcb->TimeQuanta == (OS_TICK)0) {                  /* See if we need to use the default time slice           */
@@ -2545,8 +3180,27 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 void  OS_TaskBlock (OS_TCB   *p_tcb,
                     OS_TICK   timeout)
 {
-    OS_ERR  err;
+    OS_ERR   err;
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
+    OS_TICK  quanta;
+#endif
+
 
+#if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
+    if (OSSchedRoundRobinAdaptEn == DEF_TRUE) {             /* See OSSchedRoundRobinAdaptCfg()                        */
+        quanta = p_tcb->TimeQuanta;
+        if (quanta == (OS_TICK)0) {
+            quanta = OSSchedRoundRobinDfltTimeQuanta;
+        }
+        if ((p_tcb->TimeQuantaCtr << 1) > quanta) {         /* Blocked with over half the slice unused: I/O-bound, ...*/
+            quanta -= quanta >> 2;                          /* ... so shrink its quanta to cut peer latency           */
+            if (quanta == (OS_TICK)0) {
+                quanta = (OS_TICK)1;
+            }
+            p_tcb->TimeQuanta = quanta;
+        }
+    }
+#endif
 
     if (timeout > (OS_TICK)0) {                             /* Add task to tick list if timeout non zero               */
         OS_TickListInsert(p_tcb,
@@ -82,6 +82,30 @@ CPU_INT16U  const  OSDbg_MemSize               = 0u;
 #endif
 
 
+CPU_INT08U  const  OSDbg_EdfEn                 = OS_CFG_EDF_EN;
+#if OS_CFG_EDF_EN > 0u
+CPU_INT16U  const  OSDbg_EdfSize               = sizeof(OS_EDF);               /* Size in bytes of OS_EDF             */
+#else
+CPU_INT16U  const  OSDbg_EdfSize               = 0u;
+#endif
+
+
+CPU_INT08U  const  OSDbg_ObjRegEn              = OS_CFG_OBJ_REG_EN;
+#if OS_CFG_OBJ_REG_EN > 0u
+OS_OBJ_QTY  const  OSDbg_ObjRegMax             = OS_CFG_OBJ_REG_MAX;
+#else
+OS_OBJ_QTY  const  OSDbg_ObjRegMax             = (OS_OBJ_QTY)0;
+#endif
+
+
+CPU_INT08U  const  OSDbg_MTaskEn               = OS_CFG_MTASK_EN;
+#if OS_CFG_MTASK_EN > 0u
+CPU_INT16U  const  OSDbg_MTaskSize             = sizeof(OS_MTASK);             /* Size in bytes of OS_MTASK           */
+#else
+CPU_INT16U  const  OSDbg_MTaskSize             = 0u;
+#endif
+
+
 CPU_INT08U  const  OSDbg_MsgEn                 = OS_MSG_EN;
 #if (OS_MSG_EN) > 0u
 CPU_INT16U  const  OSDbg_MsgSize               = sizeof(OS_MSG);               /* OS_MSG size                         */
@@ -121,6 +145,13 @@ CPU_INT16U  const  OSDbg_PrioTblSize           = sizeof(OSPrioTbl);
 CPU_INT16U  const  OSDbg_PtrSize               = sizeof(void *);               /* Size in Bytes of a pointer          */
 
 
+CPU_INT08U  const  OSDbg_PipeEn                = OS_CFG_PIPE_EN;
+#if OS_CFG_PIPE_EN > 0u
+CPU_INT16U  const  OSDbg_PipeSize              = sizeof(OS_PIPE);              /* Size in bytes of OS_PIPE structure  */
+#else
+CPU_INT16U  const  OSDbg_PipeSize              = 0u;
+#endif
+
 OS_Q        const  OSDbg_Q                     = { 0u };
 CPU_INT08U  const  OSDbg_QEn                   = OS_CFG_Q_EN;
 #if OS_CFG_Q_EN > 0u
@@ -135,6 +166,13 @@ CPU_INT08U  const  OSDbg_QPendAbortEn          = 0u;
 CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
+CPU_INT08U  const  OSDbg_SQEn                  = OS_CFG_SQ_EN;
+#if OS_CFG_SQ_EN > 0u
+CPU_INT16U  const  OSDbg_SQSize                = sizeof(OS_SQ);                /* Size in bytes of OS_SQ structure    */
+#else
+CPU_INT16U  const  OSDbg_SQSize                = 0u;
+#endif
+
 
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
 
@@ -219,9 +257,8 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSIdleTaskTCB)
 
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
-                                  + sizeof(OSIntQInPtr)
-                                  + sizeof(OSIntQOutPtr)
-                                  + sizeof(OSIntQNbrEntries)
+                                  + sizeof(OSIntQInIx)
+                                  + sizeof(OSIntQOutIx)
                                   + sizeof(OSIntQMaxNbrEntries)
                                   + sizeof(OSIntQOvfCtr)
                                   + sizeof(OSIntQTaskTCB)
@@ -384,6 +421,11 @@ void  OS_Dbg_Init (void)
 
     p_temp = (void const *)&OSDbg_PtrSize;
 
+    p_temp = (void const *)&OSDbg_PipeEn;
+#if (OS_CFG_PIPE_EN) > 0u
+    p_temp = (void const *)&OSDbg_PipeSize;
+#endif
+
     p_temp = (void const *)&OSDbg_Q;
     p_temp = (void const *)&OSDbg_QEn;
 #if (OS_CFG_Q_EN) > 0u
@@ -393,6 +435,11 @@ void  OS_Dbg_Init (void)
     p_temp = (void const *)&OSDbg_QSize;
 #endif
 
+    p_temp = (void const *)&OSDbg_SQEn;
+#if (OS_CFG_SQ_EN) > 0u
+    p_temp = (void const *)&OSDbg_SQSize;
+#endif
+
     p_temp = (void const *)&OSDbg_SchedRoundRobinEn;
 
     p_temp = (void const *)&OSDbg_Sem;
@@ -0,0 +1,381 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*                          All rights reserved.  Protected by international copyright laws.
+*
+*                                     EARLIEST-DEADLINE-FIRST SCHEDULING CLASS
+*
+* File    : OS_EDF.C
+* By      : JJL
+* Version : V3.02.0
+*
+* LICENSING TERMS:
+* ---------------
+*               uC/OS-III is provided in source form to registered licensees ONLY.  It is
+*               illegal to distribute this source code to any third party unless you receive
+*               written permission by an authorized Micrium representative.  Knowledge of
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#include <os.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_edf__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_EDF_EN > 0u
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            REGISTER A TASK WITH THE EDF CLASS
+*
+* Description: This function registers an existing task with the earliest-deadline-first class.  Registered tasks live
+*              in a reserved band of TWO priorities: at any instant the task whose current job has the earliest
+*              absolute deadline runs at OSCfg_EdfPrioHi and every other registered task parks at OSCfg_EdfPrioLo.
+*              Since uC/OS-III always runs the highest priority ready task, re-pointing those two priorities at job
+*              boundaries yields EDF order among the registered tasks without touching the scheduler proper.
+*
+*              The task must already have been created, at OSCfg_EdfPrioLo.  Its body is expected to be:
+*
+*                  while (DEF_ON) {
+*                      do one job;                   (must not block indefinitely)
+*                      OSEdfJobWait(&edf, &err);     (completes the job, waits for the next release)
+*                  }
+*
+*              The first job is considered released at the time of this call.
+*
+* Arguments  : p_edf         is a pointer to the EDF registration to initialize
+*
+*              p_name        is a pointer to an ASCII string that will be used to name the registration
+*
+*              p_tcb         is a pointer to the TCB of the task being registered
+*
+*              period        is the job release period, in ticks
+*
+*              deadline_rel  is the deadline, in ticks after each release.  Passing 0 selects an implicit
+*                            deadline equal to the period.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    the call was successful
+*                                OS_ERR_CREATE_ISR              can't register from an ISR
+*                                OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_edf'
+*                                OS_ERR_TASK_INVALID            if you passed a NULL pointer for 'p_tcb'
+*                                OS_ERR_TIME_ZERO_DLY           if you passed 0 for 'period'
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSEdfTaskReg (OS_EDF    *p_edf,
+                    CPU_CHAR  *p_name,
+                    OS_TCB    *p_tcb,
+                    OS_TICK    period,
+                    OS_TICK    deadline_rel,
+                    OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_edf == (OS_EDF *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_tcb == (OS_TCB *)0) {
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+    if (period == (OS_TICK)0) {
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+#endif
+
+    if (deadline_rel == (OS_TICK)0) {                       /* Implicit deadline: due at the next release             */
+        deadline_rel = period;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_edf->Type           = OS_OBJ_TYPE_EDF;
+    p_edf->NamePtr        = p_name;
+    p_edf->TCBPtr         = p_tcb;
+    p_edf->Period         = period;
+    p_edf->DeadlineRel    = deadline_rel;
+    p_edf->Release        = OSTickCtr;                      /* First job is released now                              */
+    p_edf->Deadline       = OSTickCtr + deadline_rel;
+    p_edf->JobActive      = DEF_TRUE;
+    p_edf->OverrunFlagged = DEF_FALSE;
+    p_edf->OverrunCtr     = (CPU_INT32U)0;
+    p_edf->NextPtr        = OSEdfListPtr;
+    OSEdfListPtr          = p_edf;
+    OSEdfQty++;
+    CPU_CRITICAL_EXIT();
+
+    OS_EdfSched();                                          /* The new job may be the earliest deadline               */
+   *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                       COMPLETE THE CURRENT JOB, WAIT FOR THE NEXT
+*
+* Description: This function is called by a registered task at the end of each job.  It marks the job complete, hands
+*              the high priority slot to the task with the next earliest deadline, waits (drift-free) until the next
+*              periodic release, then re-enters the EDF competition with a fresh absolute deadline.
+*
+*              If the job overran into its next period the next job is released immediately, back-to-back; the missed
+*              deadline has already been counted by the tick task (see OS_EdfUpdate()).
+*
+* Arguments  : p_edf       is a pointer to the EDF registration
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_PEND_ISR                can't wait from an ISR
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_edf'
+*                              OS_ERR_OBJ_TYPE                if 'p_edf' was not registered by OSEdfTaskReg()
+*                              OS_ERR_TASK_INVALID            if the caller is not the registered task
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSEdfJobWait (OS_EDF  *p_edf,
+                    OS_ERR  *p_err)
+{
+    OS_TICK  release;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_edf == (OS_EDF *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_edf->Type != OS_OBJ_TYPE_EDF) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_edf->TCBPtr != OSTCBCurPtr) {                     /* Only the registered task completes its own jobs        */
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_edf->JobActive      = DEF_FALSE;
+    p_edf->OverrunFlagged = DEF_FALSE;
+    p_edf->Release       += p_edf->Period;                  /* Next release is one period after the previous one      */
+    release               = p_edf->Release;
+    CPU_CRITICAL_EXIT();
+
+    OS_EdfSched();                                          /* Pass the high slot to the next earliest deadline       */
+
+    if ((CPU_INT32S)(release - OSTickCtr) > 0) {            /* Overrun past the release: start the next job now       */
+        OSTimeDly((OS_TICK )release,                        /* Absolute match: periods do not accumulate drift        */
+                  (OS_OPT  )OS_OPT_TIME_MATCH,
+                  (OS_ERR *)&err);
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_edf->JobActive = DEF_TRUE;
+    p_edf->Deadline  = p_edf->Release + p_edf->DeadlineRel;
+    CPU_CRITICAL_EXIT();
+
+    OS_EdfSched();                                          /* The fresh job may now be the earliest deadline         */
+   *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              EDF PRIORITY-BAND UPDATE
+*
+* Description: This function re-points the reserved priority band: the registration with the earliest absolute deadline
+*              among the active jobs is promoted to OSCfg_EdfPrioHi and the previous holder is parked back at
+*              OSCfg_EdfPrioLo.  Deadlines are fixed for the life of a job, so EDF order can only change at job
+*              boundaries; this is therefore called from OSEdfTaskReg() and OSEdfJobWait(), NOT on every tick.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Deadline comparisons are done on signed tick differences so that tick counter wrap is handled.
+************************************************************************************************************************
+*/
+
+void  OS_EdfSched (void)
+{
+    OS_EDF  *p_edf;
+    OS_EDF  *p_win;
+    OS_EDF  *p_old;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+
+    CPU_CRITICAL_ENTER();
+    p_win = (OS_EDF *)0;
+    p_edf =  OSEdfListPtr;
+    while (p_edf != (OS_EDF *)0) {
+        if (p_edf->JobActive == DEF_TRUE) {
+            if (p_win == (OS_EDF *)0) {
+                p_win = p_edf;
+            } else if ((CPU_INT32S)(p_edf->Deadline - p_win->Deadline) < 0) {
+                p_win = p_edf;                              /* Earlier deadline (see Note #2)                         */
+            }
+        }
+        p_edf = p_edf->NextPtr;
+    }
+    if (p_win == OSEdfCurPtr) {                             /* Band already points at the right task                  */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    p_old       = OSEdfCurPtr;
+    OSEdfCurPtr = p_win;
+    CPU_CRITICAL_EXIT();
+
+    if (p_old != (OS_EDF *)0) {                             /* Park the previous holder ...                           */
+        OSTaskChangePrio(p_old->TCBPtr, OSCfg_EdfPrioLo, &err);
+    }
+    if (p_win != (OS_EDF *)0) {                             /* ... then promote the earliest deadline                 */
+        OSTaskChangePrio(p_win->TCBPtr, OSCfg_EdfPrioHi, &err);
+    }
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              EDF DEADLINE BOOKKEEPING
+*
+* Description: This function is called by OS_TickTask() on every tick to detect deadline overruns: an active job whose
+*              absolute deadline has passed has its registration's overrun counter bumped, once per job.  Detection is
+*              deliberately decoupled from correction -- the job keeps running at OSCfg_EdfPrioHi and the application
+*              inspects 'OverrunCtr' (or watches it from the statistics display) to decide whether the task set is
+*              feasible.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_EdfUpdate (void)
+{
+    OS_EDF  *p_edf;
+    CPU_SR_ALLOC();
+
+
+
+    if (OSEdfQty == (OS_OBJ_QTY)0) {                        /* Nothing registered: the tick pays one compare          */
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+    p_edf = OSEdfListPtr;
+    while (p_edf != (OS_EDF *)0) {
+        if ((p_edf->JobActive      == DEF_TRUE ) &&
+            (p_edf->OverrunFlagged == DEF_FALSE)) {
+            if ((CPU_INT32S)(OSTickCtr - p_edf->Deadline) > 0) {
+                p_edf->OverrunCtr++;
+                p_edf->OverrunFlagged = DEF_TRUE;           /* Count each missed deadline once                        */
+            }
+        }
+        p_edf = p_edf->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                               INITIALIZE THE EDF CLASS
+*
+* Description: This function is called by OSInit() to initialize the earliest-deadline-first class.
+*
+* Arguments  : p_err   is a pointer to a variable that will contain an error code returned by this function.
+*
+*                          OS_ERR_NONE          the call was successful
+*                          OS_ERR_PRIO_INVALID  the reserved band is not two distinct priorities below the idle task
+*                                               with OSCfg_EdfPrioHi the more urgent of the two
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_EdfInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSEdfListPtr = (OS_EDF    *)0;
+    OSEdfCurPtr  = (OS_EDF    *)0;
+    OSEdfQty     = (OS_OBJ_QTY )0;
+
+    if (OSCfg_EdfPrioHi >= OSCfg_EdfPrioLo) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+    if (OSCfg_EdfPrioLo >= (OS_PRIO)(OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
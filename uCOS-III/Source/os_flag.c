@@ -100,16 +100,23 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
 #endif
 
     OS_CRITICAL_ENTER();
-    p_grp->Type    = OS_OBJ_TYPE_FLAG;                      /* Set to event flag group type                           */
-    p_grp->NamePtr = p_name;
-    p_grp->Flags   = flags;                                 /* Set to desired initial value                           */
-    p_grp->TS      = (CPU_TS)0;
+    p_grp->Type          = OS_OBJ_TYPE_FLAG;                /* Set to event flag group type                           */
+    p_grp->NamePtr       = p_name;
+    p_grp->Flags         = flags;                           /* Set to desired initial value                           */
+    p_grp->PendFlagsMask = (OS_FLAGS)0;                     /* Nobody is waiting on any bit yet                       */
+    p_grp->TS            = (CPU_TS)0;
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    p_grp->TSEn          = DEF_TRUE;                        /* Time stamping on by default (see OSFlagTSCfg())        */
+#endif
     OS_PendListInit(&p_grp->PendList);
 
 #if OS_CFG_DBG_EN > 0u
     OS_FlagDbgListAdd(p_grp);
 #endif
     OSFlagQty++;
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_grp->RegId = OS_ObjRegAdd((void *)p_grp);             /* Assign a compact ID for trace/telemetry references     */
+#endif
 
     OS_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
@@ -207,6 +214,9 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
              if (nbr_tasks == (OS_OBJ_QTY)0) {
 #if OS_CFG_DBG_EN > 0u
                  OS_FlagDbgListRemove(p_grp);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+                 OS_ObjRegRemove(p_grp->RegId);
 #endif
                  OSFlagQty--;
                  OS_FlagClr(p_grp);
@@ -231,6 +241,9 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
              }
 #if OS_CFG_DBG_EN > 0u
              OS_FlagDbgListRemove(p_grp);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+             OS_ObjRegRemove(p_grp->RegId);
 #endif
              OSFlagQty--;
              OS_FlagClr(p_grp);
@@ -594,7 +607,11 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP *p_grp,
 *
 *                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the event flag
 *                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the event flag
-*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler.  OR this in when aborting
+*                                                         waits on several objects in a row (shutdown or mode
+*                                                         change); all the readied tasks then compete in ONE
+*                                                         scheduler pass, issued by the caller, instead of one
+*                                                         per object.
 *
 *              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -682,7 +699,7 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {                 /* Pend abort all tasks waiting?                          */
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == (OS_OPT)0u) {  /* Pend abort all tasks waiting?                          */
             break;                                          /* No                                                     */
         }
     }
@@ -780,7 +797,8 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 *
 * Returns    : the new value of the event flags bits that are still set.
 *
-* Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+* Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group
+*                 whose pend mask intersects the posted bits (see OS_FlagPost() Note #1).
 ************************************************************************************************************************
 */
 OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
@@ -827,7 +845,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #endif
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    if (p_grp->TSEn != DEF_FALSE) {
+        ts = OS_TS_GET();                                   /* Get timestamp                                          */
+    } else {
+        ts = (CPU_TS)0;                                     /* This event flag group opted out of time stamping       */
+    }
+#else
     ts = OS_TS_GET();                                       /* Get timestamp                                          */
+#endif
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
     if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR                              */
         OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_FLAG,          /* Post to ISR queue                                      */
@@ -851,6 +877,67 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     return (flags_cur);
 }
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                   ENABLE OR DISABLE TIME STAMPING FOR A FLAG GROUP
+*
+* Description: This function lets an application decide, per object, whether posts record a time stamp.  Reading the
+*              time stamp costs a timer access on every post, which hot objects may not want to pay; diagnostic
+*              objects keep it.  Objects start with time stamping ENABLED so default behavior is unchanged.
+*
+* Arguments  : p_grp         is a pointer to the object
+*
+*              en            is DEF_TRUE to record a time stamp on each post, DEF_FALSE to skip it (posts then carry
+*                            a time stamp of 0)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                the call was successful
+*                                OS_ERR_OBJ_PTR_NULL        if 'p_grp' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE            if 'p_grp' is not pointing at the proper object type
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSFlagTSCfg (OS_FLAG_GRP  *p_grp,
+                   CPU_BOOLEAN   en,
+                   OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_grp == (OS_FLAG_GRP *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_grp->TSEn = en;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -898,6 +985,9 @@ void  OS_FlagBlock (OS_PEND_DATA  *p_pend_data,
     OSTCBCurPtr->FlagsOpt  = opt;                           /* Save the type of wait we are doing                     */
     OSTCBCurPtr->FlagsRdy  = (OS_FLAGS)0;
 
+    p_grp->PendFlagsMask  |= flags;                         /* Index the bits being waited on at the group level ...  */
+                                                            /* ... so posts can skip the wait list (see OS_FlagPost())*/
+
     OS_Pend(p_pend_data,
             (OS_PEND_OBJ *)((void *)p_grp),
              OS_TASK_PEND_ON_FLAG,
@@ -930,6 +1020,13 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->Type             = OS_OBJ_TYPE_NONE;
     p_grp->NamePtr          = (CPU_CHAR *)((void *)"?FLAG");    /* Unknown name                                       */
     p_grp->Flags            = (OS_FLAGS )0;
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_grp->RegId            = OS_OBJ_ID_NONE;
+#endif
+    p_grp->PendFlagsMask    = (OS_FLAGS )0;
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    p_grp->TSEn             = DEF_TRUE;
+#endif
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
 }
@@ -1070,7 +1167,14 @@ void  OS_FlagDbgListRemove (OS_FLAG_GRP  *p_grp)
 *
 * Returns    : the new value of the event flags bits that are still set.
 *
-* Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+* Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group
+*                 whose pend mask intersects the posted bits.  The group keeps the OR of the pend masks of all its
+*                 waiters (.PendFlagsMask): a post whose bits miss that mask returns without touching the wait list
+*                 at all, and waiters whose own mask does not intersect the posted bits are skipped with a single
+*                 AND.  Skipping is exact, not heuristic: a post can only (newly) satisfy a waiter by changing group
+*                 flag bits that appear in that waiter's mask, whether the waiter uses a SET or a CLR mode.  The
+*                 summary mask may accumulate stale bits when waits time out or abort; stale bits merely cost a walk
+*                 and the mask is rebuilt from the surviving waiters each time the wait list is traversed.
 ************************************************************************************************************************
 */
 OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
@@ -1081,6 +1185,7 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
 {
     OS_FLAGS        flags_cur;
     OS_FLAGS        flags_rdy;
+    OS_FLAGS        flags_wait;
     OS_OPT          mode;
     OS_PEND_DATA   *p_pend_data;
     OS_PEND_DATA   *p_pend_data_next;
@@ -1114,12 +1219,29 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
         *p_err = OS_ERR_NONE;
         return (p_grp->Flags);
     }
+    if ((p_grp->PendFlagsMask & flags) == (OS_FLAGS)0) {        /* Nobody waits on any of the posted bits?            */
+        flags_cur = p_grp->Flags;                               /* No waiter can become ready; don't walk the wait    */
+        CPU_CRITICAL_EXIT();                                    /* ... list at all (see Note #1)                      */
+        *p_err = OS_ERR_NONE;
+        return (flags_cur);
+    }
 
     OS_CRITICAL_ENTER_CPU_CRITICAL_EXIT();
+    flags_wait  = (OS_FLAGS)0;                                  /* Rebuild the summary mask as the list is walked     */
     p_pend_data = p_pend_list->HeadPtr;
     p_tcb       = p_pend_data->TCBPtr;
     while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)      */
         p_pend_data_next = p_pend_data->NextPtr;
+        if ((p_tcb->FlagsPend & flags) == (OS_FLAGS)0) {        /* Posted bits can't affect this waiter's condition?  */
+            flags_wait |= p_tcb->FlagsPend;                     /* Correct, skip it (see Note #1)                     */
+            p_pend_data = p_pend_data_next;
+            if (p_pend_data != (OS_PEND_DATA *)0) {
+                p_tcb = p_pend_data->TCBPtr;
+            } else {
+                p_tcb = (OS_TCB *)0;
+            }
+            continue;
+        }
         mode             = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
         switch (mode) {
             case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node     */
@@ -1128,6 +1250,8 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
                      OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                       */
                                     flags_rdy,
                                     ts);
+                 } else {
+                     flags_wait |= p_tcb->FlagsPend;            /* Task keeps waiting; keep its bits in the summary   */
                  }
                  break;
 
@@ -1137,6 +1261,8 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
                      OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                       */
                                     flags_rdy,
                                     ts);
+                 } else {
+                     flags_wait |= p_tcb->FlagsPend;            /* Task keeps waiting; keep its bits in the summary   */
                  }
                  break;
 
@@ -1147,6 +1273,8 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
                      OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                       */
                                     flags_rdy,
                                     ts);
+                 } else {
+                     flags_wait |= p_tcb->FlagsPend;            /* Task keeps waiting; keep its bits in the summary   */
                  }
                  break;
 
@@ -1156,6 +1284,8 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
                      OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                       */
                                     flags_rdy,
                                     ts);
+                 } else {
+                     flags_wait |= p_tcb->FlagsPend;            /* Task keeps waiting; keep its bits in the summary   */
                  }
                  break;
 #endif
@@ -1171,6 +1301,7 @@ OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
             p_tcb = (OS_TCB *)0;
         }
     }
+    p_grp->PendFlagsMask = flags_wait;                          /* Summary now reflects only the surviving waiters    */
     OS_CRITICAL_EXIT_NO_SCHED();
 
     if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
@@ -79,7 +79,14 @@ const  CPU_CHAR  *os_int__c = "$Id: $";
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When the CPU port provides an atomic compare-and-swap (CPU_CFG_ATOMIC_ASM_PRESENT), a queue slot is
+*                 claimed by atomically advancing the free running 'in' index so that posting NEVER disables
+*                 interrupts for queue maintenance; nested ISRs each claim their own slot.  Without atomic support a
+*                 short critical section protects the index claim only.
+*
+*              2) Making the interrupt handler task ready does not require a critical section here: task level code
+*                 only manipulates the ready list and priority table with interrupts disabled (so it can never be
+*                 interleaved by this code), and a nested ISR performs exactly the same stores.
 ************************************************************************************************************************
 */
 
@@ -92,7 +99,12 @@ void  OS_IntQPost (OS_OBJ_TYPE    type,
                    CPU_TS         ts,
                    OS_ERR        *p_err)
 {
+    OS_INT_Q    *p_int_q;
+    CPU_INT32U   in;
+    CPU_INT32U   nbr;
+#ifndef CPU_CFG_ATOMIC_ASM_PRESENT
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -103,36 +115,53 @@ void  OS_IntQPost (OS_OBJ_TYPE    type,
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-    if (OSIntQNbrEntries < OSCfg_IntQSize) {                /* Make sure we haven't already filled the ISR queue      */
-        OSIntQNbrEntries++;
-
-        if (OSIntQMaxNbrEntries < OSIntQNbrEntries) {
-            OSIntQMaxNbrEntries = OSIntQNbrEntries;
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    do {
+        in = OSIntQInIx;
+        if ((in - OSIntQOutIx) >= (CPU_INT32U)OSCfg_IntQSize) {
+            OSIntQOvfCtr++;                                 /* Count the number of ISR queue overflows                */
+           *p_err = OS_ERR_INT_Q_FULL;
+            return;
         }
-
-        OSIntQInPtr->Type       = type;                     /* Save object type being posted                          */
-        OSIntQInPtr->ObjPtr     = p_obj;                    /* Save pointer to object being posted                    */
-        OSIntQInPtr->MsgPtr     = p_void;                   /* Save pointer to message if posting to a message queue  */
-        OSIntQInPtr->MsgSize    = msg_size;                 /* Save the message size   if posting to a message queue  */
-        OSIntQInPtr->Flags      = flags;                    /* Save the flags if posting to an event flag group       */
-        OSIntQInPtr->Opt        = opt;                      /* Save post options                                      */
-        OSIntQInPtr->TS         = ts;                       /* Save time stamp                                        */
-
-        OSIntQInPtr             =  OSIntQInPtr->NextPtr;    /* Point to the next interrupt handler queue entry        */
-
-        OSRdyList[0].NbrEntries = (OS_OBJ_QTY)1;            /* Make the interrupt handler task ready to run           */
-        OSRdyList[0].HeadPtr    = &OSIntQTaskTCB;
-        OSRdyList[0].TailPtr    = &OSIntQTaskTCB;
-        OS_PrioInsert(0u);                                  /* Add task priority 0 in the priority table              */
-        OSPrioSaved             = OSPrioCur;                /* Save current priority                                  */
-
-       *p_err                   = OS_ERR_NONE;
-    } else {
+    } while (CPU_AtomicCmpSwap32(&OSIntQInIx,               /* Claim the slot lock-free (see Note #1)                 */
+                                  in,
+                                  in + 1u) != in);
+#else
+    CPU_CRITICAL_ENTER();
+    in = OSIntQInIx;
+    if ((in - OSIntQOutIx) >= (CPU_INT32U)OSCfg_IntQSize) { /* Make sure we haven't already filled the ISR queue      */
         OSIntQOvfCtr++;                                     /* Count the number of ISR queue overflows                */
-       *p_err                   = OS_ERR_INT_Q_FULL;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
     }
+    OSIntQInIx = in + 1u;
     CPU_CRITICAL_EXIT();
+#endif
+
+    p_int_q          = &OSCfg_IntQBasePtr[in % (CPU_INT32U)OSCfg_IntQSize];
+    p_int_q->ObjPtr  = p_obj;                               /* Save pointer to object being posted                    */
+    p_int_q->MsgPtr  = p_void;                              /* Save pointer to message if posting to a message queue  */
+    p_int_q->MsgSize = msg_size;                            /* Save the message size   if posting to a message queue  */
+    p_int_q->Flags   = flags;                               /* Save the flags if posting to an event flag group       */
+    p_int_q->Opt     = opt;                                 /* Save post options                                      */
+    p_int_q->TS      = ts;                                  /* Save time stamp                                        */
+    p_int_q->Type    = type;                                /* Save object type being posted                          */
+
+    nbr = (in + 1u) - OSIntQOutIx;
+    if (OSIntQMaxNbrEntries < (OS_OBJ_QTY)nbr) {
+        OSIntQMaxNbrEntries = (OS_OBJ_QTY)nbr;
+    }
+    if (nbr >= ((CPU_INT32U)OSCfg_IntQSize * 3u) / 4u) {    /* Queue 3/4 full: sizing headroom is nearly gone         */
+        OSIntQNearFullCtr++;
+    }
+
+    OSRdyList[0].HeadPtr    = &OSIntQTaskTCB;               /* Make the interrupt handler task ready (see Note #2)    */
+    OSRdyList[0].TailPtr    = &OSIntQTaskTCB;
+    OS_PrioInsert(0u);                                      /* Add task priority 0 in the priority table              */
+    OSPrioSaved             = OSPrioCur;                    /* Save current priority                                  */
+
+   *p_err                   = OS_ERR_NONE;
 }
 
 /*$PAGE*/
@@ -151,6 +180,7 @@ void  OS_IntQPost (OS_OBJ_TYPE    type,
 
 void  OS_IntQRePost (void)
 {
+    OS_INT_Q     *p_int_q;
     void         *p_obj;
     void         *p_void;
     OS_ERR        err;
@@ -159,20 +189,19 @@ void  OS_IntQRePost (void)
     OS_OBJ_TYPE   type;
     OS_OPT        opt;
     OS_MSG_SIZE   msg_size;
-    CPU_SR_ALLOC();
 
 
 
-    CPU_CRITICAL_ENTER();
-    type         = OSIntQOutPtr->Type;                      /* Get local copy of queue item contents                  */
-    p_obj        = OSIntQOutPtr->ObjPtr;
-    p_void       = OSIntQOutPtr->MsgPtr;
-    msg_size     = OSIntQOutPtr->MsgSize;
-    flags        = OSIntQOutPtr->Flags;
-    opt          = OSIntQOutPtr->Opt;
-    ts           = OSIntQOutPtr->TS;
-    OSIntQOutPtr = OSIntQOutPtr->NextPtr;                   /* Point to next item in the ISR queue                    */
-    CPU_CRITICAL_EXIT();
+    p_int_q      = &OSCfg_IntQBasePtr[OSIntQOutIx % (CPU_INT32U)OSCfg_IntQSize];
+    type         = p_int_q->Type;                           /* Get local copy of queue item contents.  This task is   */
+    p_obj        = p_int_q->ObjPtr;                         /* ... the only consumer and ISR producers always run to  */
+    p_void       = p_int_q->MsgPtr;                         /* ... completion before it, so no critical section is    */
+    msg_size     = p_int_q->MsgSize;                        /* ... needed around the copy                             */
+    flags        = p_int_q->Flags;
+    opt          = p_int_q->Opt;
+    ts           = p_int_q->TS;
+    p_int_q->Type = OS_OBJ_TYPE_NONE;                       /* Mark the slot as drained                               */
+    OSIntQOutIx++;                                          /* Release the slot; point to next item in the ISR queue  */
     switch (type) {                                         /* Re-post to task                                        */
         case OS_OBJ_TYPE_FLAG:
 #if OS_CFG_FLAG_EN > 0u
@@ -184,6 +213,15 @@ void  OS_IntQRePost (void)
 #endif
              break;
 
+        case OS_OBJ_TYPE_PIPE:
+#if OS_CFG_PIPE_EN > 0u
+             OS_PipePost((OS_PIPE *)p_obj,
+                         (OS_OPT   )opt,
+                         (CPU_TS   )ts,
+                         (OS_ERR  *)&err);
+#endif
+             break;
+
         case OS_OBJ_TYPE_Q:
 #if OS_CFG_Q_EN > 0u
              OS_QPost((OS_Q      *)p_obj,
@@ -204,6 +242,17 @@ void  OS_IntQRePost (void)
 #endif
              break;
 
+        case OS_OBJ_TYPE_SQ:
+#if OS_CFG_SQ_EN > 0u
+             OS_SQPost((OS_SQ     *)p_obj,
+                       (void      *)p_void,
+                       (OS_MSG_SIZE)msg_size,
+                       (OS_OPT     )opt,
+                       (CPU_TS     )ts,
+                       (OS_ERR    *)&err);
+#endif
+             break;
+
         case OS_OBJ_TYPE_TASK_MSG:
 #if OS_CFG_TASK_Q_EN > 0u
              OS_TaskQPost((OS_TCB    *)p_obj,
@@ -276,10 +325,9 @@ void  OS_IntQTask (void *p_arg)
     while (DEF_ON) {
         done = DEF_FALSE;
         while (done == DEF_FALSE) {
-            if (OSIntQNbrEntries == (OS_OBJ_QTY)0u) {
+            if (OSIntQInIx == OSIntQOutIx) {                /* See if the ISR queue is empty                          */
                 CPU_CRITICAL_ENTER();
-                OSRdyList[0].NbrEntries = (OS_OBJ_QTY)0u;   /* Remove from ready list                                 */
-                OSRdyList[0].HeadPtr    = (OS_TCB   *)0;
+                OSRdyList[0].HeadPtr    = (OS_TCB   *)0;    /* Remove from ready list                                 */
                 OSRdyList[0].TailPtr    = (OS_TCB   *)0;
                 OS_PrioRemove(0u);                          /* Remove from the priority table                         */
                 CPU_CRITICAL_EXIT();
@@ -292,9 +340,6 @@ void  OS_IntQTask (void *p_arg)
                 if (ts_end > OSIntQTaskTimeMax) {
                     OSIntQTaskTimeMax = ts_end;
                 }
-                CPU_CRITICAL_ENTER();
-                OSIntQNbrEntries--;
-                CPU_CRITICAL_EXIT();
             }
         }
     }
@@ -326,7 +371,6 @@ void  OS_IntQTask (void *p_arg)
 void  OS_IntQTaskInit (OS_ERR  *p_err)
 {
     OS_INT_Q      *p_int_q;
-    OS_INT_Q      *p_int_q_next;
     OS_OBJ_QTY     i;
 
 
@@ -339,6 +383,7 @@ void  OS_IntQTaskInit (OS_ERR  *p_err)
 #endif
 
     OSIntQOvfCtr = (OS_QTY)0u;                              /* Clear the ISR queue overflow counter                   */
+    OSIntQNearFullCtr = (OS_QTY)0u;                         /* Clear the ISR queue near-full counter                  */
 
     if (OSCfg_IntQBasePtr == (OS_INT_Q *)0) {
        *p_err = OS_ERR_INT_Q;
@@ -353,8 +398,6 @@ void  OS_IntQTaskInit (OS_ERR  *p_err)
     OSIntQTaskTimeMax = (CPU_TS)0;
 
     p_int_q           = OSCfg_IntQBasePtr;                  /* Initialize the circular ISR queue                      */
-    p_int_q_next      = p_int_q;
-    p_int_q_next++;
     for (i = 0u; i < OSCfg_IntQSize; i++) {
         p_int_q->Type    =  OS_OBJ_TYPE_NONE;
         p_int_q->ObjPtr  = (void      *)0;
@@ -362,16 +405,10 @@ void  OS_IntQTaskInit (OS_ERR  *p_err)
         p_int_q->MsgSize = (OS_MSG_SIZE)0u;
         p_int_q->Flags   = (OS_FLAGS   )0u;
         p_int_q->Opt     = (OS_OPT     )0u;
-        p_int_q->NextPtr = p_int_q_next;
         p_int_q++;
-        p_int_q_next++;
     }
-    p_int_q--;
-    p_int_q_next        = OSCfg_IntQBasePtr;
-    p_int_q->NextPtr    = p_int_q_next;
-    OSIntQInPtr         = p_int_q_next;
-    OSIntQOutPtr        = p_int_q_next;
-    OSIntQNbrEntries    = (OS_OBJ_QTY)0u;
+    OSIntQInIx          = (CPU_INT32U)0u;
+    OSIntQOutIx         = (CPU_INT32U)0u;
     OSIntQMaxNbrEntries = (OS_OBJ_QTY)0u;
 
                                                             /* -------------- CREATE THE ISR QUEUE TASK ------------- */
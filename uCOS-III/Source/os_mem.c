@@ -146,6 +146,8 @@ void  OSMemCreate (OS_MEM      *p_mem,
     p_mem->FreeListPtr = p_addr;                            /* Initialize pointer to pool of free blocks              */
     p_mem->NbrFree     = n_blks;                            /* Store number of free blocks in MCB                     */
     p_mem->NbrMax      = n_blks;
+    p_mem->NbrUsedMax  = (OS_MEM_QTY)0;                     /* Clear the usage watermarks (see OSMemGet() Note #2)    */
+    p_mem->GetFailCtr  = (OS_CTR)0;
     p_mem->BlkSize     = blk_size;                          /* Store block size of each memory blocks                 */
 
 #if OS_CFG_DBG_EN > 0u
@@ -176,14 +178,30 @@ void  OSMemCreate (OS_MEM      *p_mem,
 *
 * Returns     : A pointer to a memory block if no error is detected
 *               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) When the port provides the atomic helpers (CPU_CFG_ATOMIC_ASM_PRESENT), the free list is popped
+*                  with CPU_AtomicListPop() instead of a critical section, so tasks AND ISRs can allocate blocks
+*                  without ever disabling interrupts.  The pop dereferences the head INSIDE the ll/sc window and any
+*                  intervening interrupt or context switch clears the LL bit on its exception return, so a stale
+*                  'next' pointer (the classic compare-and-swap ABA hazard) can never be stored.
+*
+*               2) Each partition tracks its peak usage in .NbrUsedMax and its failed allocations in .GetFailCtr, so
+*                  partitions can be sized to measured peak-plus-margin instead of guesses; reading the two fields IS
+*                  the snapshot.  On the lock-free path the watermark update is advisory (it may lag by a block under
+*                  contention) but never costs a critical section.
 ************************************************************************************************************************
 */
 
 void  *OSMemGet (OS_MEM  *p_mem,
                  OS_ERR  *p_err)
 {
-    void    *p_blk;
+    void        *p_blk;
+    OS_MEM_QTY   nbr_used;
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    CPU_INT32U   nbr_free;
+#else
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -201,8 +219,24 @@ void  *OSMemGet (OS_MEM  *p_mem,
     }
 #endif
 
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    p_blk = CPU_AtomicListPop((void * volatile *)&p_mem->FreeListPtr);  /* Pop the free list head lock-free, Note #1  */
+    if (p_blk == (void *)0) {                               /* See if there are any free memory blocks                */
+       (void)CPU_AtomicAdd32((CPU_INT32U volatile *)&p_mem->GetFailCtr,
+                             (CPU_INT32U)1);
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;                    /* No,  Notify caller of empty memory partition           */
+        return ((void *)0);                                 /*      Return NULL pointer to caller                     */
+    }
+    nbr_free = CPU_AtomicAdd32((CPU_INT32U volatile *)&p_mem->NbrFree,  /* One less memory block in this partition    */
+                               (CPU_INT32U)-1) - 1u;
+    nbr_used = (OS_MEM_QTY)(p_mem->NbrMax - (OS_MEM_QTY)nbr_free);
+    if (nbr_used > p_mem->NbrUsedMax) {                     /* Track the peak usage (advisory; see Note #2)           */
+        p_mem->NbrUsedMax = nbr_used;
+    }
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree == (OS_MEM_QTY)0) {                  /* See if there are any free memory blocks                */
+        p_mem->GetFailCtr++;
         CPU_CRITICAL_EXIT();
        *p_err = OS_ERR_MEM_NO_FREE_BLKS;                    /* No,  Notify caller of empty memory partition           */
         return ((void *)0);                                 /*      Return NULL pointer to caller                     */
@@ -210,7 +244,12 @@ void  *OSMemGet (OS_MEM  *p_mem,
     p_blk              = p_mem->FreeListPtr;                /* Yes, point to next free memory block                   */
     p_mem->FreeListPtr = *(void **)p_blk;                   /*      Adjust pointer to new free list                   */
     p_mem->NbrFree--;                                       /*      One less memory block in this partition           */
+    nbr_used           = p_mem->NbrMax - p_mem->NbrFree;
+    if (nbr_used > p_mem->NbrUsedMax) {                     /* Track the peak usage (see Note #2)                     */
+        p_mem->NbrUsedMax = nbr_used;
+    }
     CPU_CRITICAL_EXIT();
+#endif
    *p_err = OS_ERR_NONE;                                    /*      No error                                          */
     return (p_blk);                                         /*      Return memory block to caller                     */
 }
@@ -233,6 +272,10 @@ void  *OSMemGet (OS_MEM  *p_mem,
 *                                                      partition (You freed more blocks than you allocated!)
 *                            OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for the block to release.
 *                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*
+* Note(s)     : 1) When the port provides the atomic helpers (CPU_CFG_ATOMIC_ASM_PRESENT), the block is pushed with
+*                  CPU_AtomicListPush() instead of a critical section (see OSMemGet() Note #1); the full-partition
+*                  check is then advisory only, since NbrFree may change between the check and the push.
 ************************************************************************************************************************
 */
 
@@ -240,7 +283,9 @@ void  OSMemPut (OS_MEM  *p_mem,
                 void    *p_blk,
                 OS_ERR  *p_err)
 {
+#ifndef CPU_CFG_ATOMIC_ASM_PRESENT
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -262,6 +307,15 @@ void  OSMemPut (OS_MEM  *p_mem,
     }
 #endif
 
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    if (p_mem->NbrFree >= p_mem->NbrMax) {                  /* Make sure all blocks not already returned              */
+       *p_err = OS_ERR_MEM_FULL;
+        return;
+    }
+    CPU_AtomicListPush((void * volatile *)&p_mem->FreeListPtr, p_blk);         /* Push the block lock-free (see Note #1)                 */
+   (void)CPU_AtomicAdd32((CPU_INT32U volatile *)&p_mem->NbrFree,   /* One more memory block in this partition         */
+                         (CPU_INT32U)1);
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree >= p_mem->NbrMax) {                  /* Make sure all blocks not already returned              */
         CPU_CRITICAL_EXIT();
@@ -272,6 +326,7 @@ void  OSMemPut (OS_MEM  *p_mem,
     p_mem->FreeListPtr = p_blk;
     p_mem->NbrFree++;                                       /* One more memory block in this partition                */
     CPU_CRITICAL_EXIT();
+#endif
    *p_err              = OS_ERR_NONE;                       /* Notify caller that memory block was released           */
 }
 
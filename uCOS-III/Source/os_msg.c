@@ -86,6 +86,60 @@ void  OSMsgPoolExtend (OS_MSG      *p_msg,
    *p_err                   = OS_ERR_NONE;
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                        GET 'OS_MSG' POOL USAGE STATISTICS
+*
+* Description: This function is called by your application to read how heavily the OS_MSG pool is loaded.  The peak
+*              (p_used_max) is the number to size OS_CFG_MSG_POOL_SIZE (os_cfg_app.h) from: a peak well below the
+*              pool size means RAM can be reclaimed, a peak at the pool size means posts have been failing with
+*              OS_ERR_MSG_POOL_EMPTY.
+*
+* Arguments  : p_free       is a pointer to where the current number of free OS_MSGs will be stored (NULL allowed).
+*
+*              p_used       is a pointer to where the current number of OS_MSGs in use will be stored (NULL allowed).
+*
+*              p_used_max   is a pointer to where the peak number of OS_MSGs in use will be stored (NULL allowed).
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSMsgPoolStatGet (OS_MSG_QTY  *p_free,
+                        OS_MSG_QTY  *p_used,
+                        OS_MSG_QTY  *p_used_max,
+                        OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                   /* All three counters read as one consistent snapshot     */
+    if (p_free != (OS_MSG_QTY *)0) {
+       *p_free = OSMsgPool.NbrFree;
+    }
+    if (p_used != (OS_MSG_QTY *)0) {
+       *p_used = OSMsgPool.NbrUsed;
+    }
+    if (p_used_max != (OS_MSG_QTY *)0) {
+       *p_used_max = OSMsgPool.NbrUsedMax;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -176,8 +230,9 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     OS_MsgPoolCreate(OSCfg_MsgPoolBasePtr,
                     OSCfg_MsgPoolSize);
     OSMsgPool.NextPtr =  OSCfg_MsgPoolBasePtr;
-    OSMsgPool.NbrFree =  OSCfg_MsgPoolSize;
-    OSMsgPool.NbrUsed = (OS_MSG_QTY)0;
+    OSMsgPool.NbrFree    =  OSCfg_MsgPoolSize;
+    OSMsgPool.NbrUsed    = (OS_MSG_QTY)0;
+    OSMsgPool.NbrUsedMax = (OS_MSG_QTY)0;
    *p_err             =  OS_ERR_NONE;
 }
 
@@ -226,17 +281,19 @@ void  OS_MsgQEntriesPeakReset (OS_MSG_Q  *p_msg_q)
 OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 {
     OS_MSG      *p_msg;
+    OS_MSG_POOL *p_pool;
     OS_MSG_QTY   qty;
 
 
 
     qty = p_msg_q->NbrEntries;                              /* Get the number of OS_MSGs being freed                  */
     if (p_msg_q->NbrEntries > (OS_MSG_QTY)0) {
+        p_pool                  = p_msg_q->PoolPtr;         /* Return OS_MSGs to the pool they were allocated from    */
         p_msg                   = p_msg_q->InPtr;           /* Point to end of message chain                          */
-        p_msg->NextPtr          = OSMsgPool.NextPtr;
-        OSMsgPool.NextPtr       = p_msg_q->OutPtr;          /* Point to beginning of message chain                    */
-        OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;      /* Update statistics for free list of messages            */
-        OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+        p_msg->NextPtr          = p_pool->NextPtr;
+        p_pool->NextPtr         = p_msg_q->OutPtr;          /* Point to beginning of message chain                    */
+        p_pool->NbrUsed        -= p_msg_q->NbrEntries;      /* Update statistics for free list of messages            */
+        p_pool->NbrFree        += p_msg_q->NbrEntries;
         p_msg_q->NbrEntries     = (OS_MSG_QTY)0;            /* Flush the message queue                                */
         p_msg_q->NbrEntriesMax  = (OS_MSG_QTY)0;
         p_msg_q->InPtr          = (OS_MSG   *)0;
@@ -271,6 +328,7 @@ void  OS_MsgQInit (OS_MSG_Q     *p_msg_q,
     p_msg_q->NbrEntriesMax  = (OS_MSG_QTY)0;
     p_msg_q->InPtr          = (OS_MSG   *)0;
     p_msg_q->OutPtr         = (OS_MSG   *)0;
+    p_msg_q->PoolPtr        = &OSMsgPool;                   /* Allocate from the global pool unless told otherwise    */
 }
 
 /*$PAGE*/
@@ -303,8 +361,9 @@ void  *OS_MsgQGet (OS_MSG_Q    *p_msg_q,
                    CPU_TS      *p_ts,
                    OS_ERR      *p_err)
 {
-    OS_MSG  *p_msg;
-    void    *p_void;
+    OS_MSG      *p_msg;
+    OS_MSG_POOL *p_pool;
+    void        *p_void;
 
 
 
@@ -337,10 +396,11 @@ void  *OS_MsgQGet (OS_MSG_Q    *p_msg_q,
     } else {
         p_msg_q->NbrEntries--;
     }
-    p_msg->NextPtr    = OSMsgPool.NextPtr;                  /* Return message control block to free list              */
-    OSMsgPool.NextPtr = p_msg;
-    OSMsgPool.NbrFree++;
-    OSMsgPool.NbrUsed--;
+    p_pool            = p_msg_q->PoolPtr;
+    p_msg->NextPtr    = p_pool->NextPtr;                    /* Return message control block to its pool's free list   */
+    p_pool->NextPtr   = p_msg;
+    p_pool->NbrFree++;
+    p_pool->NbrUsed--;
     *p_err            = OS_ERR_NONE;
     return (p_void);
 }
@@ -384,8 +444,9 @@ void  OS_MsgQPut (OS_MSG_Q    *p_msg_q,
                   CPU_TS       ts,
                   OS_ERR      *p_err)
 {
-    OS_MSG  *p_msg;
-    OS_MSG  *p_msg_in;
+    OS_MSG      *p_msg;
+    OS_MSG      *p_msg_in;
+    OS_MSG_POOL *p_pool;
 
 
 
@@ -401,15 +462,19 @@ void  OS_MsgQPut (OS_MSG_Q    *p_msg_q,
         return;
     }
 
-    if (OSMsgPool.NbrFree == (OS_MSG_QTY)0) {
+    p_pool = p_msg_q->PoolPtr;                              /* Allocate from this queue's pool (see OSQCreate())      */
+    if (p_pool->NbrFree == (OS_MSG_QTY)0) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                      /* No more OS_MSG to use                                  */
         return;
     }
 
-    p_msg             = OSMsgPool.NextPtr;                  /* Remove message control block from free list            */
-    OSMsgPool.NextPtr = p_msg->NextPtr;
-    OSMsgPool.NbrFree--;
-    OSMsgPool.NbrUsed++;
+    p_msg             = p_pool->NextPtr;                    /* Remove message control block from free list            */
+    p_pool->NextPtr   = p_msg->NextPtr;
+    p_pool->NbrFree--;
+    p_pool->NbrUsed++;
+    if (p_pool->NbrUsed > p_pool->NbrUsedMax) {             /* Track the peak so the pool can be sized from data      */
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
+    }
     if (p_msg_q->NbrEntries == (OS_MSG_QTY)0) {             /* Is this first message placed in the queue?             */
         p_msg_q->InPtr         = p_msg;                     /* Yes                                                    */
         p_msg_q->OutPtr        = p_msg;
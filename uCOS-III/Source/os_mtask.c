@@ -0,0 +1,315 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*                          All rights reserved.  Protected by international copyright laws.
+*
+*                                      RUN-TO-COMPLETION MINITASK MANAGEMENT
+*
+* File    : OS_MTASK.C
+* By      : JJL
+* Version : V3.02.0
+*
+* LICENSING TERMS:
+* ---------------
+*               uC/OS-III is provided in source form to registered licensees ONLY.  It is
+*               illegal to distribute this source code to any third party unless you receive
+*               written permission by an authorized Micrium representative.  Knowledge of
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#include <os.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_mtask__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_MTASK_EN > 0u
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                  CREATE A MINITASK
+*
+* Description: This function registers a run-to-completion minitask.  A minitask is a handler function executed on the
+*              shared stack of the minitask dispatcher task, at the dispatcher's priority; it therefore costs the RAM
+*              of an OS_MTASK (a few pointers) instead of a full OS_TCB and stack.  The handler MUST run to completion:
+*              it cannot pend, delay or otherwise block, since doing so would block every other minitask.
+*
+* Arguments  : p_mt        is a pointer to the minitask
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the minitask
+*
+*              fnct        is the handler to execute each time the minitask is posted
+*
+*              p_arg       is the argument passed to the handler on every dispatch
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_CREATE_ISR              can't create from an ISR
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_mt'
+*                              OS_ERR_PTR_INVALID             if you passed a NULL pointer for 'fnct'
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSMTaskCreate (OS_MTASK       *p_mt,
+                     CPU_CHAR       *p_name,
+                     OS_MTASK_FNCT   fnct,
+                     void           *p_arg,
+                     OS_ERR         *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mt == (OS_MTASK *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (fnct == (OS_MTASK_FNCT)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_mt->Type    = OS_OBJ_TYPE_MTASK;
+    p_mt->NamePtr = p_name;
+    p_mt->Fnct    = fnct;
+    p_mt->ArgPtr  = p_arg;
+    p_mt->NextPtr = (OS_MTASK *)0;
+    p_mt->Rdy     = DEF_FALSE;
+    p_mt->PostCtr = (OS_SEM_CTR)0;
+    p_mt->DispCtr = (CPU_INT32U)0;
+    OSMTaskQty++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                   POST A MINITASK
+*
+* Description: This function makes a minitask ready to run.  The minitask is appended (once) to the dispatcher's ready
+*              FIFO and the dispatcher task is signalled through its built-in task semaphore; the handler will run on
+*              the dispatcher's stack, at the dispatcher's priority, as soon as the dispatcher is the highest priority
+*              ready task.  Posts while the minitask is already queued are accumulated in the minitask's post counter
+*              and produce ONE dispatch; the handler reads how many posts it is servicing from that counter if it
+*              cares.  This function may be called from an ISR.
+*
+* Arguments  : p_mt        is a pointer to the minitask
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_mt'
+*                              OS_ERR_OBJ_TYPE                if 'p_mt' was not created by OSMTaskCreate()
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSMTaskPost (OS_MTASK  *p_mt,
+                   OS_ERR    *p_err)
+{
+    CPU_BOOLEAN  signal;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mt == (OS_MTASK *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_mt->Type != OS_OBJ_TYPE_MTASK) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_mt->PostCtr++;
+    if (p_mt->Rdy == DEF_FALSE) {                           /* Append once; repeat posts coalesce into one dispatch   */
+        p_mt->Rdy     = DEF_TRUE;
+        p_mt->NextPtr = (OS_MTASK *)0;
+        if (OSMTaskRdyTailPtr == (OS_MTASK *)0) {
+            OSMTaskRdyHeadPtr = p_mt;
+        } else {
+            OSMTaskRdyTailPtr->NextPtr = p_mt;
+        }
+        OSMTaskRdyTailPtr = p_mt;
+        signal = DEF_TRUE;
+    } else {
+        signal = DEF_FALSE;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (signal == DEF_TRUE) {
+        (void)OSTaskSemPost(&OSMTaskDispTaskTCB,            /* Wake the dispatcher; it drains the whole FIFO          */
+                            OS_OPT_POST_NONE,
+                            p_err);
+    } else {
+       *p_err = OS_ERR_NONE;
+    }
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              MINITASK DISPATCHER TASK
+*
+* Description: This task provides the shared stack and the priority that every minitask runs at.  It pends on its task
+*              semaphore until at least one minitask has been posted, then pops and runs ready minitasks until the FIFO
+*              is empty.  A minitask's ready flag is cleared BEFORE its handler runs, so a post arriving during the
+*              handler re-queues it for another dispatch rather than being lost.
+*
+* Arguments  : p_arg       is the argument passed to the task (unused)
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_MTaskDispTask (void  *p_arg)
+{
+    OS_MTASK    *p_mt;
+    OS_SEM_CTR   ctr;
+    OS_ERR       err;
+    CPU_SR_ALLOC();
+
+
+
+    (void)&p_arg;
+
+    while (DEF_ON) {
+        (void)OSTaskSemPend((OS_TICK )0,
+                            (OS_OPT  )OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                            (OS_ERR *)&err);
+
+        for (;;) {
+            CPU_CRITICAL_ENTER();
+            p_mt = OSMTaskRdyHeadPtr;                       /* Pop the oldest ready minitask                          */
+            if (p_mt == (OS_MTASK *)0) {
+                CPU_CRITICAL_EXIT();
+                break;
+            }
+            OSMTaskRdyHeadPtr = p_mt->NextPtr;
+            if (OSMTaskRdyHeadPtr == (OS_MTASK *)0) {
+                OSMTaskRdyTailPtr = (OS_MTASK *)0;
+            }
+            p_mt->NextPtr = (OS_MTASK *)0;
+            p_mt->Rdy     = DEF_FALSE;                      /* Posts from here on schedule another dispatch           */
+            ctr           = p_mt->PostCtr;                  /* Posts being serviced by THIS dispatch                  */
+            CPU_CRITICAL_EXIT();
+
+          (*p_mt->Fnct)(p_mt->ArgPtr);                      /* Run to completion on this task's stack                 */
+
+            CPU_CRITICAL_ENTER();
+            p_mt->PostCtr -= ctr;                           /* Posts that arrived DURING the handler are kept         */
+            p_mt->DispCtr++;
+            CPU_CRITICAL_EXIT();
+        }
+    }
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            INITIALIZE MINITASK MANAGEMENT
+*
+* Description: This function is called by OSInit() to initialize the minitask management module and create the shared
+*              dispatcher task.  Application code MUST NOT call this function.
+*
+* Arguments  : p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_MTaskInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSMTaskQty        = (OS_OBJ_QTY)0;
+    OSMTaskRdyHeadPtr = (OS_MTASK *)0;
+    OSMTaskRdyTailPtr = (OS_MTASK *)0;
+
+                                                            /* ------------- CREATE THE DISPATCHER TASK ------------- */
+    if (OSCfg_MTaskDispTaskStkBasePtr == (CPU_STK *)0) {
+        *p_err = OS_ERR_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_MTaskDispTaskStkSize < OSCfg_StkSizeMin) {
+        *p_err = OS_ERR_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (OSCfg_MTaskDispTaskPrio >= (OS_CFG_PRIO_MAX - 1u)) {
+        *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+
+    OSTaskCreate((OS_TCB     *)&OSMTaskDispTaskTCB,
+                 (CPU_CHAR   *)((void *)"uC/OS-III MTask Disp Task"),
+                 (OS_TASK_PTR )OS_MTaskDispTask,
+                 (void       *)0,
+                 (OS_PRIO     )OSCfg_MTaskDispTaskPrio,
+                 (CPU_STK    *)OSCfg_MTaskDispTaskStkBasePtr,
+                 (CPU_STK_SIZE)OSCfg_MTaskDispTaskStkLimit,
+                 (CPU_STK_SIZE)OSCfg_MTaskDispTaskStkSize,
+                 (OS_MSG_QTY  )0,
+                 (OS_TICK     )0,
+                 (void       *)0,
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR     *)p_err);
+}
+
+#endif
@@ -108,6 +108,9 @@ void  OSMutexCreate (OS_MUTEX    *p_mutex,
     OS_MutexDbgListAdd(p_mutex);
 #endif
     OSMutexQty++;
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_mutex->RegId = OS_ObjRegAdd((void *)p_mutex);         /* Assign a compact ID for trace/telemetry references     */
+#endif
 
     CPU_CRITICAL_EXIT();
     *p_err = OS_ERR_NONE;
@@ -204,6 +207,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
              if (nbr_tasks == (OS_OBJ_QTY)0) {
 #if OS_CFG_DBG_EN > 0u
                  OS_MutexDbgListRemove(p_mutex);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+                 OS_ObjRegRemove(p_mutex->RegId);
 #endif
                  OSMutexQty--;
                  OS_MutexClr(p_mutex);
@@ -219,6 +225,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
              p_tcb_owner = p_mutex->OwnerTCBPtr;                           /* Did we had to change the prio of owner? */
              if ((p_tcb_owner       != (OS_TCB *)0) &&
                  (p_tcb_owner->Prio !=  p_mutex->OwnerOriginalPrio)) {
+#if OS_CFG_DBG_EN > 0u
+                 OSMutexBoostNbr--;                                        /* Owner is no longer running boosted      */
+#endif
                  switch (p_tcb_owner->TaskState) {                         /* yes                                     */
                      case OS_TASK_STATE_RDY:
                           OS_RdyListRemove(p_tcb_owner);
@@ -259,6 +268,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
              }
 #if OS_CFG_DBG_EN > 0u
              OS_MutexDbgListRemove(p_mutex);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+             OS_ObjRegRemove(p_mutex->RegId);
 #endif
              OSMutexQty--;
              OS_MutexClr(p_mutex);
@@ -316,6 +328,23 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *                                OS_ERR_TIMEOUT            The mutex was not received within the specified timeout.
 *
 * Returns    : none
+*
+* Note(s)    : 1) When the port provides atomic primitives (CPU_CFG_ATOMIC_ASM_PRESENT), an uncontended mutex is
+*                 claimed with a single compare-and-swap on the owner pointer, WITHOUT disabling interrupts or
+*                 engaging the priority inheritance machinery.  The critical section below is only entered when the
+*                 mutex is actually owned by another task.
+*
+*              2) The caller's priority is snapshot BEFORE the compare-and-swap.  If a higher priority task preempts
+*                 between the swap and the stores that finalize ownership, and boosts us through the inheritance code
+*                 below, the snapshot still holds our true original priority and is the correct value to record in
+*                 .OwnerOriginalPrio.  Availability is keyed on .OwnerTCBPtr alone; contenders that observe the
+*                 transient state (.OwnerTCBPtr != 0 with .OwnerNestingCtr == 0) simply treat the mutex as owned.
+*
+*              3) Priority inheritance in uC/OS-III is single-level: the owner is raised to the priority of the
+*                 highest waiter but a task BLOCKED on a mutex is never itself boosted, so inheritance cannot
+*                 propagate along a chain of nested mutexes.  Worst-case blocking is thus bounded by ONE critical
+*                 section per mutex level.  OSMutexBoostCtr, OSMutexBoostNbr and OSMutexBoostNbrMax (OS_CFG_DBG_EN)
+*                 make the boost rate and the peak number of simultaneously boosted owners measurable.
 ************************************************************************************************************************
 */
 
@@ -327,6 +356,9 @@ void  OSMutexPend (OS_MUTEX   *p_mutex,
 {
     OS_PEND_DATA  pend_data;
     OS_TCB       *p_tcb;
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    OS_PRIO       prio_cur;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -372,8 +404,23 @@ void  OSMutexPend (OS_MUTEX   *p_mutex,
        *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
     }
 
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    prio_cur = OSTCBCurPtr->Prio;                           /* Snapshot BEFORE claiming ownership (see Note #2)       */
+    if (CPU_AtomicCmpSwap32((CPU_INT32U volatile *)&p_mutex->OwnerTCBPtr,
+                            (CPU_INT32U           )0,
+                            (CPU_INT32U           )OSTCBCurPtr) == (CPU_INT32U)0) {
+        p_mutex->OwnerOriginalPrio =  prio_cur;             /* Uncontended: mutex claimed without disabling ints      */
+        p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)1;
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts                   =  p_mutex->TS;
+        }
+        *p_err                     =  OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
-    if (p_mutex->OwnerNestingCtr == (OS_NESTING_CTR)0) {    /* Resource available?                                    */
+    if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {              /* Resource available? (see Note #2)                      */
         p_mutex->OwnerTCBPtr       =  OSTCBCurPtr;          /* Yes, caller may proceed                                */
         p_mutex->OwnerOriginalPrio =  OSTCBCurPtr->Prio;
         p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)1;
@@ -410,6 +457,15 @@ void  OSMutexPend (OS_MUTEX   *p_mutex,
     OS_CRITICAL_ENTER_CPU_CRITICAL_EXIT();                  /* Lock the scheduler/re-enable interrupts                */
     p_tcb = p_mutex->OwnerTCBPtr;                           /* Point to the TCB of the Mutex owner                    */
     if (p_tcb->Prio > OSTCBCurPtr->Prio) {                  /* See if mutex owner has a lower priority than current   */
+#if OS_CFG_DBG_EN > 0u
+        OSMutexBoostCtr++;                                  /* Keep inheritance measurable (see Note #3)              */
+        if (p_tcb->Prio == p_mutex->OwnerOriginalPrio) {    /* First boost for this ownership?                        */
+            OSMutexBoostNbr++;
+            if (OSMutexBoostNbr > OSMutexBoostNbrMax) {
+                OSMutexBoostNbrMax = OSMutexBoostNbr;
+            }
+        }
+#endif
         switch (p_tcb->TaskState) {
             case OS_TASK_STATE_RDY:
                  OS_RdyListRemove(p_tcb);                   /* Remove from ready list at current priority             */
@@ -499,7 +555,11 @@ void  OSMutexPend (OS_MUTEX   *p_mutex,
 *
 *                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the mutex
 *                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the mutex
-*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler.  OR this in when aborting
+*                                                         waits on several objects in a row (shutdown or mode
+*                                                         change); all the readied tasks then compete in ONE
+*                                                         scheduler pass, issued by the caller, instead of one
+*                                                         per object.
 *
 *              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -552,6 +612,8 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
     switch (opt) {                                          /* Validate 'opt'                                         */
         case OS_OPT_PEND_ABORT_1:
         case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
              break;
 
         default:
@@ -584,7 +646,7 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {                 /* Pend abort all tasks waiting?                          */
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == (OS_OPT)0u) {  /* Pend abort all tasks waiting?                          */
             break;                                          /* No                                                     */
         }
     }
@@ -623,6 +685,16 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *                           OS_ERR_POST_ISR         If you attempted to post from an ISR
 *
 * Returns    : none
+*
+* Note(s)    : 1) When the port provides atomic primitives (CPU_CFG_ATOMIC_ASM_PRESENT), an uncontended release
+*                 (owner, no nesting, no waiters, priority never boosted) completes with plain stores and one atomic
+*                 exchange, WITHOUT disabling interrupts.  The owner pointer is published LAST so that a contender
+*                 never sees a half-released mutex.
+*
+*              2) A task of higher priority can preempt between the pre-checks and the owner pointer publish, pend on
+*                 the mutex and boost this task.  The release therefore re-checks the pend list and its own priority
+*                 AFTER the publish; if either changed, it falls into a recovery section that undoes the boost and,
+*                 if the mutex is still free, hands it to the new head waiter exactly as the contended path would.
 ************************************************************************************************************************
 */
 
@@ -633,6 +705,9 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    OS_PRIO        prio_cur;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -665,6 +740,54 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    if ((OSTCBCurPtr                  == p_mutex->OwnerTCBPtr      ) &&  /* Uncontended release? Owner, no nesting,   */
+        (p_mutex->OwnerNestingCtr     == (OS_NESTING_CTR)1         ) &&  /* ... nobody waiting and never boosted      */
+        (p_mutex->PendList.NbrEntries == (OS_OBJ_QTY)0             ) &&
+        (OSTCBCurPtr->Prio            == p_mutex->OwnerOriginalPrio)) {
+        prio_cur                 =  p_mutex->OwnerOriginalPrio;
+        p_mutex->TS              =  OS_TS_GET();            /* Get timestamp                                          */
+        p_mutex->OwnerNestingCtr = (OS_NESTING_CTR)0;
+        (void)CPU_AtomicXchg32((CPU_INT32U volatile *)&p_mutex->OwnerTCBPtr,  /* Publish the release LAST             */
+                               (CPU_INT32U           )0);
+        if ((p_mutex->PendList.NbrEntries == (OS_OBJ_QTY)0) &&  /* Did a task block (and possibly boost us) while ... */
+            (OSTCBCurPtr->Prio            ==  prio_cur    )) {  /* ... the release was in flight? (see Note #2)       */
+            *p_err = OS_ERR_NONE;                               /*  No, clean release; nothing else to do             */
+            return;
+        }
+        OS_CRITICAL_ENTER();                                    /*  Yes, recover: undo the boost and/or hand over     */
+        if (OSTCBCurPtr->Prio != prio_cur) {
+#if OS_CFG_DBG_EN > 0u
+            OSMutexBoostNbr--;
+#endif
+            OS_RdyListRemove(OSTCBCurPtr);
+            OSTCBCurPtr->Prio = prio_cur;                   /* Lower our priority back to its original one            */
+            OS_PrioInsert(OSTCBCurPtr->Prio);
+            OS_RdyListInsertTail(OSTCBCurPtr);
+            OSPrioCur         = OSTCBCurPtr->Prio;
+        }
+        p_pend_list = &p_mutex->PendList;
+        if ((p_mutex->OwnerTCBPtr  == (OS_TCB    *)0) &&    /* Mutex still free and a task got caught waiting?        */
+            (p_pend_list->NbrEntries > (OS_OBJ_QTY)0)) {
+            p_tcb                      = p_pend_list->HeadPtr->TCBPtr;
+            p_mutex->OwnerTCBPtr       = p_tcb;             /* Yes, give the mutex to the new owner                   */
+            p_mutex->OwnerOriginalPrio = p_tcb->Prio;
+            p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)1;
+            OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
+                    (OS_TCB      *)p_tcb,
+                    (void        *)0,
+                    (OS_MSG_SIZE  )0,
+                    (CPU_TS       )p_mutex->TS);
+        }
+        OS_CRITICAL_EXIT_NO_SCHED();
+        if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+            OSSched();                                      /* Run the scheduler                                      */
+        }
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {              /* Make sure the mutex owner is releasing the mutex       */
         CPU_CRITICAL_EXIT();
@@ -692,6 +815,9 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
                                                             /* Yes                                                    */
     if (OSTCBCurPtr->Prio != p_mutex->OwnerOriginalPrio) {
+#if OS_CFG_DBG_EN > 0u
+        OSMutexBoostNbr--;                                  /* Owner is no longer running boosted                     */
+#endif
         OS_RdyListRemove(OSTCBCurPtr);
         OSTCBCurPtr->Prio = p_mutex->OwnerOriginalPrio;     /* Lower owner's priority back to its original one        */
         OS_PrioInsert(OSTCBCurPtr->Prio);
@@ -741,6 +867,9 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->Type              =  OS_OBJ_TYPE_NONE;         /* Mark the data structure as a NONE                      */
     p_mutex->NamePtr           = (CPU_CHAR     *)((void *)"?MUTEX");
     p_mutex->OwnerTCBPtr       = (OS_TCB       *)0;
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_mutex->RegId             =  OS_OBJ_ID_NONE;
+#endif
     p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)0;
     p_mutex->TS                = (CPU_TS        )0;
     p_mutex->OwnerOriginalPrio =  OS_CFG_PRIO_MAX;
@@ -836,7 +965,10 @@ void  OS_MutexInit (OS_ERR  *p_err)
 #endif
 
 #if OS_CFG_DBG_EN > 0u
-    OSMutexDbgListPtr = (OS_MUTEX *)0;
+    OSMutexDbgListPtr   = (OS_MUTEX  *)0;
+    OSMutexBoostCtr     = (CPU_INT32U )0;
+    OSMutexBoostNbr     = (OS_OBJ_QTY)0;
+    OSMutexBoostNbrMax  = (OS_OBJ_QTY)0;
 #endif
 
     OSMutexQty        = (OS_OBJ_QTY)0;
@@ -0,0 +1,185 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*                          All rights reserved.  Protected by international copyright laws.
+*
+*                                                KERNEL OBJECT REGISTRY
+*
+* File    : OS_OBJREG.C
+* By      : JJL
+* Version : V3.02.0
+*
+* LICENSING TERMS:
+* ---------------
+*               uC/OS-III is provided in source form to registered licensees ONLY.  It is
+*               illegal to distribute this source code to any third party unless you receive
+*               written permission by an authorized Micrium representative.  Knowledge of
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#include <os.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_objreg__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_OBJ_REG_EN > 0u
+void  *OSObjRegTbl[OS_CFG_OBJ_REG_MAX];                     /* Declare the array local to this file to allow for  ... */
+                                                            /* ... optimization.  Entry 'n' holds the object with ... */
+                                                            /* ... ID 'n + 1'; ID 0 (OS_OBJ_ID_NONE) is reserved      */
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                           GET A REGISTERED OBJECT FROM ITS ID
+*
+* Description: This function converts a compact object ID (as assigned at create time and stored in the object's
+*              .RegId field) back into the object pointer, in constant time.  IDs fit in a byte, so trace records and
+*              telemetry packets can carry them instead of full pointers.  Tooling that wants to enumerate all
+*              registered objects can simply look up every ID from 1 to OS_CFG_OBJ_REG_MAX; unused IDs return a NULL
+*              pointer with OS_ERR_NONE.  The first field of every registered object is its OS_OBJ_TYPE, which tells
+*              the caller what kind of object the ID resolved to.
+*
+* Arguments  : id        is the object ID to look up (1 .. OS_CFG_OBJ_REG_MAX)
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    the lookup was performed
+*                            OS_ERR_OBJ_ID_INVALID          'id' is OS_OBJ_ID_NONE or above OS_CFG_OBJ_REG_MAX
+*
+* Returns    : The object registered under 'id', or a NULL pointer if the ID is unused or invalid.
+************************************************************************************************************************
+*/
+
+void  *OSObjRegGet (OS_OBJ_ID   id,
+                    OS_ERR     *p_err)
+{
+    void  *p_obj;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+    if ((id == OS_OBJ_ID_NONE) ||
+        (id >  (OS_OBJ_ID)OS_CFG_OBJ_REG_MAX)) {
+       *p_err = OS_ERR_OBJ_ID_INVALID;
+        return ((void *)0);
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_obj = OSObjRegTbl[id - 1u];
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (p_obj);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                 REGISTER AN OBJECT
+*
+* Description: This function is called by the object create services (OSSemCreate(), OSQCreate(), OSMutexCreate(),
+*              OSFlagCreate()) to assign the object the lowest free ID.  Creation is a cold path so the free-slot scan
+*              is a plain linear walk; lookups, which are the hot direction, stay O(1).
+*
+* Arguments  : p_obj     is a pointer to the object to register
+*
+* Returns    : The ID assigned to the object, or OS_OBJ_ID_NONE if the registry is full.  A full registry is not an
+*              error: the object works normally, it simply cannot be referenced by ID.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The caller MUST have interrupts disabled; create services call this from inside their critical
+*                 section.
+************************************************************************************************************************
+*/
+
+OS_OBJ_ID  OS_ObjRegAdd (void  *p_obj)
+{
+    OS_OBJ_ID  id;
+
+
+    for (id = (OS_OBJ_ID)0; id < (OS_OBJ_ID)OS_CFG_OBJ_REG_MAX; id++) {
+        if (OSObjRegTbl[id] == (void *)0) {                 /* Lowest free slot keeps the ID space dense              */
+            OSObjRegTbl[id] = p_obj;
+            OSObjRegQty++;
+            return (id + 1u);
+        }
+    }
+    return (OS_OBJ_ID_NONE);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                UNREGISTER AN OBJECT
+*
+* Description: This function is called by the object delete services to release an object's ID so it can be reused.
+*
+* Arguments  : id        is the ID to release; OS_OBJ_ID_NONE is accepted and ignored so delete paths do not need to
+*                        care whether registration succeeded at create time.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The caller MUST have interrupts disabled; delete services call this from inside their critical
+*                 section.
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegRemove (OS_OBJ_ID  id)
+{
+    if ((id == OS_OBJ_ID_NONE) ||
+        (id >  (OS_OBJ_ID)OS_CFG_OBJ_REG_MAX)) {
+        return;
+    }
+    if (OSObjRegTbl[id - 1u] != (void *)0) {
+        OSObjRegTbl[id - 1u]  = (void *)0;
+        OSObjRegQty--;
+    }
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            INITIALIZE THE OBJECT REGISTRY
+*
+* Description: This function is called by OSInit() to initialize the object registry.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegInit (void)
+{
+    OS_OBJ_ID  id;
+
+
+    for (id = (OS_OBJ_ID)0; id < (OS_OBJ_ID)OS_CFG_OBJ_REG_MAX; id++) {
+        OSObjRegTbl[id] = (void *)0;
+    }
+    OSObjRegQty = (OS_OBJ_QTY)0;
+}
+
+#endif
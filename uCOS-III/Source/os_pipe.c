@@ -0,0 +1,637 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                  BYTE-STREAM PIPES
+*
+* File    : OS_PIPE.C
+* By      : JJL
+* Version : V3.02.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or 
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your 
+*           application/product.   We provide ALL the source code for your convenience and to help you 
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use 
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+************************************************************************************************************************
+* Note(s) : (1) A pipe carries a BYTE STREAM through a per-pipe ring buffer.  Unlike a message queue, posting to a
+*               pipe does NOT allocate an OS_MSG from the global message pool and does NOT wake the consumer once
+*               per byte: a producer (typically a communication ISR) deposits a burst of N bytes in a single call
+*               and a waiting consumer is made ready at most once per burst, then drains every byte available when
+*               it runs.  This is the intended transport for sustained serial input, where per-byte message posts
+*               would exhaust the message pool and thrash the scheduler.
+*
+*           (2) Writes never block.  A write copies as many bytes as currently fit in the ring and returns the
+*               number of bytes actually deposited; the caller decides whether to retry, drop or count overruns.
+*               Reads return at least one byte, or block (optionally with a timeout) while the pipe is empty.
+************************************************************************************************************************
+*/
+
+#include <os.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pipe__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_PIPE_EN > 0u
+
+/*
+************************************************************************************************************************
+*                                                 LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_PipeCopy (CPU_INT08U        *p_dest,
+                           const  CPU_INT08U *p_src,
+                           CPU_INT32U         nbytes);
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                    CREATE A PIPE
+*
+* Description: This function is called by your application to create a pipe.  A pipe streams bytes from one or more
+*              producers to a consumer task through a caller-supplied ring buffer (see Note #1 at the top of this
+*              file).
+*
+* Arguments  : p_pipe        is a pointer to the pipe control block to use.  Your application is responsible for
+*                            allocating storage for the pipe.
+*
+*              p_name        is a pointer to an ASCII string that will be used to name the pipe
+*
+*              p_buf         is a pointer to the storage used as the pipe's ring buffer.  Your application is
+*                            responsible for allocating this storage.
+*
+*              buf_size      is the size (in bytes) of the ring buffer
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    the call was successful
+*                                OS_ERR_CREATE_ISR              can't create from an ISR
+*                                OS_ERR_OBJ_CREATED             if the pipe has already been created
+*                                OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_pipe'
+*                                OS_ERR_PTR_INVALID             if you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_Q_SIZE                  if you passed a zero 'buf_size'
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSPipeCreate (OS_PIPE     *p_pipe,
+                    CPU_CHAR    *p_name,
+                    void        *p_buf,
+                    CPU_INT32U   buf_size,
+                    OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_pipe == (OS_PIPE *)0) {                           /* Validate 'p_pipe'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_buf == (void *)0) {                               /* Validate 'p_buf'                                       */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (buf_size == (CPU_INT32U)0) {                        /* Cannot specify a zero size ring buffer                 */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    OS_CRITICAL_ENTER();
+    p_pipe->Type    =  OS_OBJ_TYPE_PIPE;                    /* Mark the data structure as a pipe                      */
+    p_pipe->NamePtr =  p_name;
+    p_pipe->BufPtr  = (CPU_INT08U *)p_buf;
+    p_pipe->BufSize =  buf_size;
+    p_pipe->In      = (CPU_INT32U)0;
+    p_pipe->Out     = (CPU_INT32U)0;
+    OS_PendListInit(&p_pipe->PendList);                     /* Initialize the waiting list                            */
+
+    OSPipeQty++;                                            /* One more pipe created                                  */
+    OS_CRITICAL_EXIT_NO_SCHED();
+   *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                 READ FROM A PIPE
+*
+* Description: This function reads up to 'max_bytes' bytes from a pipe.  If the pipe contains data, the call copies
+*              whatever is available (limited to 'max_bytes') and returns immediately; a read therefore returns at
+*              least one byte unless it times out, is aborted, or is a non-blocking read of an empty pipe.  If the
+*              pipe is empty, the caller is blocked until a producer deposits data, the timeout expires, or the pend
+*              is aborted.
+*
+* Arguments  : p_pipe        is a pointer to the pipe
+*
+*              p_dest        is a pointer to the destination buffer that will receive the bytes read
+*
+*              max_bytes     is the size (in bytes) of the destination buffer
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                            data up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever for data.
+*
+*              opt           determines whether the user wants to block if the pipe is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the data was
+*                            deposited in the pipe.  Passing a NULL pointer (i.e. (CPU_TS *)0) indicates that you
+*                            don't need the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    bytes were copied to 'p_dest'
+*                                OS_ERR_OBJ_PTR_NULL            if you pass a NULL pointer for 'p_pipe'
+*                                OS_ERR_OBJ_TYPE                if 'p_pipe' is not pointing to a pipe
+*                                OS_ERR_OPT_INVALID             if you specified an invalid option
+*                                OS_ERR_PEND_ABORT              the pend was aborted by another task
+*                                OS_ERR_PEND_ISR                if you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK        non-blocking read of an empty pipe
+*                                OS_ERR_PTR_INVALID             if you pass a NULL pointer for 'p_dest'
+*                                OS_ERR_Q_SIZE                  if you pass a zero 'max_bytes'
+*                                OS_ERR_SCHED_LOCKED            the scheduler is locked and the pipe is empty
+*                                OS_ERR_TIMEOUT                 no data was received within the specified timeout
+*
+* Returns    : The number of bytes copied to 'p_dest' (0 upon error or timeout)
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSPipeRead (OS_PIPE      *p_pipe,
+                         void         *p_dest,
+                         OS_MSG_SIZE   max_bytes,
+                         OS_TICK       timeout,
+                         OS_OPT        opt,
+                         CPU_TS       *p_ts,
+                         OS_ERR       *p_err)
+{
+    OS_PEND_DATA  pend_data;
+    CPU_INT32U    used;
+    CPU_INT32U    nbr;
+    CPU_INT32U    ix;
+    CPU_INT32U    chunk;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_PEND_ISR;
+        return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_pipe == (OS_PIPE *)0) {                           /* Validate 'p_pipe'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_MSG_SIZE)0);
+    }
+    if (p_dest == (void *)0) {                              /* Validate 'p_dest'                                      */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((OS_MSG_SIZE)0);
+    }
+    if (max_bytes == (OS_MSG_SIZE)0) {                      /* Cannot read into a zero size buffer                    */
+       *p_err = OS_ERR_Q_SIZE;
+        return ((OS_MSG_SIZE)0);
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_pipe->Type != OS_OBJ_TYPE_PIPE) {                 /* Make sure pipe was created                             */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
+
+    for (;;) {
+        CPU_CRITICAL_ENTER();
+        used = p_pipe->In - p_pipe->Out;                    /* Nbr of bytes currently in the pipe                     */
+        if (used > (CPU_INT32U)0) {                         /* Data available?  Drain up to 'max_bytes' of it         */
+            nbr = used;
+            if (nbr > (CPU_INT32U)max_bytes) {
+                nbr = (CPU_INT32U)max_bytes;
+            }
+            ix    = p_pipe->Out % p_pipe->BufSize;
+            chunk = p_pipe->BufSize - ix;                   /* Bytes available before the ring wraps                  */
+            if (chunk > nbr) {
+                chunk = nbr;
+            }
+            OS_PipeCopy((CPU_INT08U *)p_dest,
+                        &p_pipe->BufPtr[ix],
+                        chunk);
+            if (nbr > chunk) {                              /* Copy the remainder from the start of the ring          */
+                OS_PipeCopy((CPU_INT08U *)p_dest + chunk,
+                            &p_pipe->BufPtr[0],
+                            nbr - chunk);
+            }
+            p_pipe->Out += nbr;
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_NONE;
+            return ((OS_MSG_SIZE)nbr);
+        }
+
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {    /* Caller wants to block if pipe is empty?            */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;                /* No                                                     */
+            return ((OS_MSG_SIZE)0);
+        } else {                                            /* Yes                                                    */
+            if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    /* Can't pend when the scheduler is locked            */
+                CPU_CRITICAL_EXIT();
+               *p_err = OS_ERR_SCHED_LOCKED;
+                return ((OS_MSG_SIZE)0);
+            }
+        }
+                                                            /* Lock the scheduler/re-enable interrupts                */
+        OS_CRITICAL_ENTER_CPU_CRITICAL_EXIT();
+        OS_Pend(&pend_data,                                 /* Block task pending on the pipe                         */
+                (OS_PEND_OBJ *)((void *)p_pipe),
+                 OS_TASK_PEND_ON_PIPE,
+                 timeout);
+        OS_CRITICAL_EXIT_NO_SCHED();
+
+        OSSched();                                          /* Find the next highest priority task ready to run       */
+
+        CPU_CRITICAL_ENTER();
+        switch (OSTCBCurPtr->PendStatus) {
+            case OS_STATUS_PEND_OK:                         /* A producer deposited data; go drain the ring           */
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts  =  OSTCBCurPtr->TS;
+                 }
+                 CPU_CRITICAL_EXIT();
+                 break;
+
+            case OS_STATUS_PEND_ABORT:                      /* Indicate that we aborted                               */
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts  =  OSTCBCurPtr->TS;
+                 }
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_PEND_ABORT;
+                 return ((OS_MSG_SIZE)0);
+
+            case OS_STATUS_PEND_TIMEOUT:                    /* Indicate that we didn't get data within timeout        */
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts  = (CPU_TS  )0;
+                 }
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TIMEOUT;
+                 return ((OS_MSG_SIZE)0);
+
+            case OS_STATUS_PEND_DEL:                        /* Indicate that object pended on has been deleted        */
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts  =  OSTCBCurPtr->TS;
+                 }
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_OBJ_DEL;
+                 return ((OS_MSG_SIZE)0);
+
+            default:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_STATUS_INVALID;
+                 return ((OS_MSG_SIZE)0);
+        }
+    }
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                  WRITE TO A PIPE
+*
+* Description: This function deposits up to 'nbytes' bytes into a pipe and, if a consumer is waiting, makes the
+*              highest priority waiting task ready to run.  The whole burst costs a SINGLE ring-buffer copy and at
+*              most ONE wakeup, regardless of how many bytes it carries (see Note #1 at the top of this file).
+*              Writes never block: if the ring cannot hold the whole burst, only the bytes that fit are deposited
+*              and the count returned tells the caller how many were taken.
+*
+* Arguments  : p_pipe        is a pointer to the pipe
+*
+*              p_src         is a pointer to the bytes to deposit into the pipe
+*
+*              nbytes        is the number of bytes to deposit
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE
+*                                OS_OPT_POST_NO_SCHED           Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    all 'nbytes' bytes were deposited
+*                                OS_ERR_OBJ_PTR_NULL            if you pass a NULL pointer for 'p_pipe'
+*                                OS_ERR_OBJ_TYPE                if 'p_pipe' is not pointing to a pipe
+*                                OS_ERR_PTR_INVALID             if you pass a NULL pointer for 'p_src'
+*                                OS_ERR_Q_MAX                   only SOME of the bytes fit (see returned count)
+*                                OS_ERR_Q_FULL                  the pipe was full; NO bytes were deposited
+*
+* Returns    : The number of bytes actually deposited into the pipe
+*
+* Note(s)    : 1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSPipeWrite (OS_PIPE      *p_pipe,
+                          const  void  *p_src,
+                          OS_MSG_SIZE   nbytes,
+                          OS_OPT        opt,
+                          OS_ERR       *p_err)
+{
+    CPU_INT32U  free;
+    CPU_INT32U  nbr;
+    CPU_INT32U  ix;
+    CPU_INT32U  chunk;
+    OS_OBJ_QTY  nbr_waiting;
+    CPU_TS      ts;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_pipe == (OS_PIPE *)0) {                           /* Validate 'p_pipe'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_MSG_SIZE)0);
+    }
+    if (p_src == (const void *)0) {                         /* Validate 'p_src'                                       */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_pipe->Type != OS_OBJ_TYPE_PIPE) {                 /* Make sure pipe was created                             */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_MSG_SIZE)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    free = p_pipe->BufSize - (p_pipe->In - p_pipe->Out);    /* Nbr of bytes of space left in the ring                 */
+    nbr  = (CPU_INT32U)nbytes;
+    if (nbr > free) {
+        nbr = free;                                         /* Deposit only the bytes that fit                        */
+    }
+    if (nbr == (CPU_INT32U)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_FULL;                              /* Pipe is full; the burst is lost to the caller          */
+        return ((OS_MSG_SIZE)0);
+    }
+    ix    = p_pipe->In % p_pipe->BufSize;
+    chunk = p_pipe->BufSize - ix;                           /* Bytes of space before the ring wraps                   */
+    if (chunk > nbr) {
+        chunk = nbr;
+    }
+    OS_PipeCopy(&p_pipe->BufPtr[ix],
+                (const CPU_INT08U *)p_src,
+                chunk);
+    if (nbr > chunk) {                                      /* Copy the remainder to the start of the ring            */
+        OS_PipeCopy(&p_pipe->BufPtr[0],
+                    (const CPU_INT08U *)p_src + chunk,
+                    nbr - chunk);
+    }
+    p_pipe->In += nbr;                                      /* Publish the burst                                      */
+    nbr_waiting = p_pipe->PendList.NbrEntries;
+    CPU_CRITICAL_EXIT();
+
+    if (nbr == (CPU_INT32U)nbytes) {
+       *p_err = OS_ERR_NONE;
+    } else {
+       *p_err = OS_ERR_Q_MAX;                               /* Partial deposit; see the returned count                */
+    }
+
+    if (nbr_waiting > (OS_OBJ_QTY)0) {                      /* Any task waiting on the pipe?                          */
+        ts = OS_TS_GET();                                   /* Get timestamp                                          */
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+        if (OSIntNestingCtr > (OS_NESTING_CTR)0) {          /* See if called from an ISR                              */
+            OS_IntQPost((OS_OBJ_TYPE) OS_OBJ_TYPE_PIPE,     /* Yes, defer the consumer wakeup until ISR exits         */
+                        (void      *) p_pipe,
+                        (void      *) 0,
+                        (OS_MSG_SIZE) 0,
+                        (OS_FLAGS   ) 0,
+                        (OS_OPT     ) opt,
+                        (CPU_TS     ) ts,
+                        (OS_ERR    *)&err);
+            return ((OS_MSG_SIZE)nbr);
+        }
+#endif
+        OS_PipePost(p_pipe,                                 /* Wake the highest priority waiting consumer             */
+                    opt,
+                    ts,
+                   &err);
+    }
+    return ((OS_MSG_SIZE)nbr);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            CLEAR THE CONTENTS OF A PIPE
+*
+* Description: This function is called by OSPipeDel() to clear the contents of a pipe
+*
+* Argument(s): p_pipe        is a pointer to the pipe to clear
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_PipeClr (OS_PIPE  *p_pipe)
+{
+    p_pipe->Type    =  OS_OBJ_TYPE_NONE;                    /* Mark the data structure as a NONE                      */
+    p_pipe->NamePtr = (CPU_CHAR   *)((void *)"?PIPE");
+    p_pipe->BufPtr  = (CPU_INT08U *)0;
+    p_pipe->BufSize = (CPU_INT32U  )0;
+    p_pipe->In      = (CPU_INT32U  )0;
+    p_pipe->Out     = (CPU_INT32U  )0;
+    OS_PendListInit(&p_pipe->PendList);                     /* Initialize the waiting list                            */
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                               PIPE MODULE INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the pipe management module.
+*
+* Argument(s): p_err         is a pointer to a variable that will receive an error code.
+*
+*                                OS_ERR_NONE                    the module was initialized
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_PipeInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSPipeQty = (OS_OBJ_QTY)0;
+   *p_err     =  OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              WAKE A PIPE'S CONSUMER
+*
+* Description: This function makes the highest priority task waiting on a pipe ready to run, once data is available.
+*              It is called by OSPipeWrite() at task level, and by OS_IntQRePost() when a deferred ISR write is
+*              replayed by the Interrupt Queue Handler Task.
+*
+* Argument(s): p_pipe        is a pointer to the pipe
+*
+*              opt           determines the type of POST performed (see OSPipeWrite())
+*
+*              ts            is the timestamp of the write
+*
+*              p_err         is a pointer to a variable that will receive an error code.
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              (2) No payload is carried through the pend: the woken task re-examines the ring itself and drains
+*                  whatever is available, which may include bytes from several bursts.
+************************************************************************************************************************
+*/
+
+void  OS_PipePost (OS_PIPE  *p_pipe,
+                   OS_OPT    opt,
+                   CPU_TS    ts,
+                   OS_ERR   *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_SR_ALLOC();
+
+
+
+    OS_CRITICAL_ENTER();
+    p_pend_list = &p_pipe->PendList;
+    if (p_pend_list->NbrEntries  > (OS_OBJ_QTY)0) {         /* Any task waiting on pipe?                              */
+        if ((p_pipe->In - p_pipe->Out) > (CPU_INT32U)0) {   /* Wake only if data is (still) available (see Note #2)   */
+            p_tcb = p_pend_list->HeadPtr->TCBPtr;           /* Yes, extract the highest priority waiting task         */
+            OS_Post((OS_PEND_OBJ *)((void *)p_pipe),
+                    (OS_TCB      *) p_tcb,
+                    (void        *) 0,
+                    (OS_MSG_SIZE  ) 0,
+                    (CPU_TS       ) ts);
+        }
+    }
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+        OSSched();                                          /* Run the scheduler                                      */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                 COPY A BYTE RANGE
+*
+* Description: This function copies a contiguous range of bytes.  The kernel does not depend on uC/LIB, so pipes
+*              carry their own copy loop; ranges never overlap because the source and destination are never both
+*              inside the same ring buffer.
+*
+* Argument(s): p_dest        is a pointer to the destination
+*
+*              p_src         is a pointer to the source
+*
+*              nbytes        is the number of bytes to copy
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_PipeCopy (CPU_INT08U         *p_dest,
+                           const  CPU_INT08U  *p_src,
+                           CPU_INT32U          nbytes)
+{
+    while (nbytes > (CPU_INT32U)0) {
+       *p_dest++ = *p_src++;
+        nbytes--;
+    }
+}
+
+#endif
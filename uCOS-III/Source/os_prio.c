@@ -82,7 +82,7 @@ void  OS_PrioInit (void)
 ************************************************************************************************************************
 */
 
-OS_PRIO  OS_PrioGetHighest (void)
+OS_RAM_FN  OS_PRIO  OS_PrioGetHighest (void)
 {
     CPU_DATA  *p_tbl;
     OS_PRIO    prio;
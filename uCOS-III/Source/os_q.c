@@ -48,24 +48,46 @@ const  CPU_CHAR  *os_q__c = "$Id: $";
 *              max_qty     indicates the maximum size of the message queue (must be non-zero).  Note that it's also not
 *                          possible to have a size higher than the maximum number of OS_MSGs available.
 *
+*              p_msg_tbl   is a pointer to an array of OS_MSGs used as a PRIVATE message pool for this queue (see
+*                          Note #2).  Pass a NULL pointer to allocate OS_MSGs from the global pool (OSMsgPool) as
+*                          usual.
+*
+*              msg_qty     is the number of entries in 'p_msg_tbl' (must be non-zero when 'p_msg_tbl' is non-NULL)
+*
 *              p_err       is a pointer to a variable that will contain an error code returned by this function.
 *
 *                              OS_ERR_NONE                    the call was successful
 *                              OS_ERR_CREATE_ISR              can't create from an ISR
 *                              OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the Queue after you called
 *                                                               OSSafetyCriticalStart().
+*                              OS_ERR_MSG_POOL_EMPTY          if you passed 'p_msg_tbl' with a zero 'msg_qty'
 *                              OS_ERR_NAME                    if 'p_name' is a NULL pointer
 *                              OS_ERR_OBJ_CREATED             if the message queue has already been created
 *                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_q'
 *                              OS_ERR_Q_SIZE                  if the size you specified is 0
 *
 * Returns    : none
+*
+* Note(s)    : 1) Message queues normally share the single global pool of OS_MSGs carved by OS_MsgPoolInit().  That
+*                 makes every post on every queue contend for the same free list and allows a burst on one queue to
+*                 exhaust OS_MSGs for all the others.
+*
+*              2) Supplying 'p_msg_tbl'/'msg_qty' gives the queue its own private pool: its posts can never be starved
+*                 by traffic on other queues, and free list operations on queues with disjoint pools no longer touch
+*                 shared data.  The array should be declared as follows:
+*
+*                     OS_MSG  MyQMsgTbl[msg_qty];
+*
+*                 All OS_MSGs queued at the time the queue is deleted or flushed are returned to the pool they were
+*                 allocated from.
 ************************************************************************************************************************
 */
 
 void  OSQCreate (OS_Q        *p_q,
                  CPU_CHAR    *p_name,
                  OS_MSG_QTY   max_qty,
+                 OS_MSG      *p_msg_tbl,
+                 OS_MSG_QTY   msg_qty,
                  OS_ERR      *p_err)
 
 {
@@ -103,19 +125,41 @@ void  OSQCreate (OS_Q        *p_q,
         *p_err = OS_ERR_Q_SIZE;
         return;
     }
+    if (p_msg_tbl != (OS_MSG *)0) {
+        if (msg_qty == (OS_MSG_QTY)0) {                     /* Cannot specify an empty private message pool           */
+            *p_err = OS_ERR_MSG_POOL_EMPTY;
+            return;
+        }
+    }
 #endif
 
     OS_CRITICAL_ENTER();
     p_q->Type    = OS_OBJ_TYPE_Q;                           /* Mark the data structure as a message queue             */
     p_q->NamePtr = p_name;
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    p_q->TSEn    = DEF_TRUE;                                /* Time stamping on by default (see OSQTSCfg())           */
+#endif
     OS_MsgQInit(&p_q->MsgQ,                                 /* Initialize the queue                                   */
                 max_qty);
+    p_q->MsgPool.NextPtr = (OS_MSG   *)0;
+    p_q->MsgPool.NbrFree = (OS_MSG_QTY)0;
+    p_q->MsgPool.NbrUsed = (OS_MSG_QTY)0;
+    if (p_msg_tbl != (OS_MSG *)0) {                         /* Caller supplied a private message pool? (see Note #2)  */
+        OS_MsgPoolCreate(p_msg_tbl,                         /* Yes, link its OS_MSGs into a free list ...             */
+                         msg_qty);
+        p_q->MsgPool.NextPtr = p_msg_tbl;
+        p_q->MsgPool.NbrFree = msg_qty;
+        p_q->MsgQ.PoolPtr    = &p_q->MsgPool;               /* ... and allocate this queue's OS_MSGs from it          */
+    }
     OS_PendListInit(&p_q->PendList);                        /* Initialize the waiting list                            */
 
 #if OS_CFG_DBG_EN > 0u
     OS_QDbgListAdd(p_q);
 #endif
     OSQQty++;                                               /* One more queue created                                 */
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_q->RegId = OS_ObjRegAdd((void *)p_q);                 /* Assign a compact ID for trace/telemetry references     */
+#endif
 
     OS_CRITICAL_EXIT();
     *p_err = OS_ERR_NONE;
@@ -210,6 +254,9 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
              if (nbr_tasks == (OS_OBJ_QTY)0) {
 #if OS_CFG_DBG_EN > 0u
                  OS_QDbgListRemove(p_q);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+                 OS_ObjRegRemove(p_q->RegId);
 #endif
                  OSQQty--;
                  OS_QClr(p_q);
@@ -234,6 +281,9 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
              }
 #if OS_CFG_DBG_EN > 0u
              OS_QDbgListRemove(p_q);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+             OS_ObjRegRemove(p_q->RegId);
 #endif
              OSQQty--;
              OS_QClr(p_q);
@@ -426,6 +476,7 @@ void  *OSQPend (OS_Q         *p_q,
     }
 
     CPU_CRITICAL_ENTER();
+    CPU_INT_DIS_MEAS_SITE_SET(CPU_INT_DIS_MEAS_SITE_OS_Q);
     p_void = OS_MsgQGet(&p_q->MsgQ,                         /* Any message waiting in the message queue?              */
                         p_msg_size,
                         p_ts,
@@ -519,7 +570,11 @@ void  *OSQPend (OS_Q         *p_q,
 *
 *                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the queue
 *                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the queue
-*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler.  OR this in when aborting
+*                                                         waits on several objects in a row (shutdown or mode
+*                                                         change); all the readied tasks then compete in ONE
+*                                                         scheduler pass, issued by the caller, instead of one
+*                                                         per object.
 *
 *              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -572,6 +627,8 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
     switch (opt) {                                          /* Validate 'opt'                                         */
         case OS_OPT_PEND_ABORT_1:
         case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
              break;
 
         default:
@@ -604,7 +661,7 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {                 /* Pend abort all tasks waiting?                          */
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == (OS_OPT)0u) {  /* Pend abort all tasks waiting?                          */
             break;                                          /* No                                                     */
         }
     }
@@ -700,7 +757,15 @@ void  OSQPost (OS_Q        *p_q,
     }
 #endif
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    if (p_q->TSEn != DEF_FALSE) {
+        ts = OS_TS_GET();                                   /* Get timestamp                                          */
+    } else {
+        ts = (CPU_TS)0;                                     /* This queue opted out of time stamping                  */
+    }
+#else
     ts = OS_TS_GET();                                       /* Get timestamp                                          */
+#endif
 
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
     if (OSIntNestingCtr > (OS_NESTING_CTR)0) {
@@ -724,6 +789,139 @@ void  OSQPost (OS_Q        *p_q,
              p_err);
 }
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                   ENABLE OR DISABLE TIME STAMPING FOR A MESSAGE QUEUE
+*
+* Description: This function lets an application decide, per object, whether posts record a time stamp.  Reading the
+*              time stamp costs a timer access on every post, which hot objects may not want to pay; diagnostic
+*              objects keep it.  Objects start with time stamping ENABLED so default behavior is unchanged.
+*
+* Arguments  : p_q           is a pointer to the object
+*
+*              en            is DEF_TRUE to record a time stamp on each post, DEF_FALSE to skip it (posts then carry
+*                            a time stamp of 0)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                the call was successful
+*                                OS_ERR_OBJ_PTR_NULL        if 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE            if 'p_q' is not pointing at the proper object type
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSQTSCfg (OS_Q  *p_q,
+                CPU_BOOLEAN   en,
+                OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_q == (OS_Q *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_q->Type != OS_OBJ_TYPE_Q) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_q->TSEn = en;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                        ITERATE OVER MESSAGE QUEUE DEPTHS
+*
+* Description: This function is called by your application to walk the message queues known to the kernel (the debug
+*              list maintained by OSQCreate()/OSQDel()) and read each queue's current and peak depth.  The peak is
+*              the number to size each queue's max_qty from, the same way OSMsgPoolStatGet() sizes the shared OS_MSG
+*              pool.  Typical usage:
+*
+*                  p_q = OSQDbgStatNext((OS_Q *)0, &name, &entries, &entries_max, &err);    Start of the queue list
+*                  while (p_q != (OS_Q *)0) {
+*                      ... display 'name', 'entries' and 'entries_max' ...
+*                      p_q = OSQDbgStatNext(p_q, &name, &entries, &entries_max, &err);
+*                  }
+*
+* Argument(s): p_q              is a pointer to the previously returned queue, or a NULL pointer to start at the head
+*                               of the queue list.
+*
+*              p_name           is a pointer to where the queue's name pointer will be stored.
+*
+*              p_entries        is a pointer to where the queue's current depth will be stored.
+*
+*              p_entries_max    is a pointer to where the queue's peak depth will be stored.
+*
+*              p_err            is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                   OS_ERR_NONE
+*
+* Returns    : The queue whose statistics were stored, or a NULL pointer when the end of the queue list is reached.
+*
+* Note(s)    : 1) The queue list is only modified by OSQCreate() and OSQDel(); the next pointer and both depth fields
+*                 are read under the critical section, so the walk cannot follow a dangling pointer.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DBG_EN > 0u
+OS_Q  *OSQDbgStatNext (OS_Q        *p_q,
+                       CPU_CHAR   **p_name,
+                       OS_MSG_QTY  *p_entries,
+                       OS_MSG_QTY  *p_entries_max,
+                       OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_Q *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_q == (OS_Q *)0) {                                 /* Start at the head of the debug list ...                */
+        p_q = OSQDbgListPtr;
+    } else {                                                /* ... or advance from the caller's position              */
+        p_q = p_q->DbgNextPtr;
+    }
+    if (p_q != (OS_Q *)0) {
+       *p_name        = p_q->NamePtr;
+       *p_entries     = p_q->MsgQ.NbrEntries;
+       *p_entries_max = p_q->MsgQ.NbrEntriesMax;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (p_q);
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -746,6 +944,12 @@ void  OS_QClr (OS_Q *p_q)
     (void)OS_MsgQFreeAll(&p_q->MsgQ);                       /* Return all OS_MSGs to the free list                    */
     p_q->Type    =  OS_OBJ_TYPE_NONE;                       /* Mark the data structure as a NONE                      */
     p_q->NamePtr = (CPU_CHAR *)((void *)"?Q");
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    p_q->TSEn    =  DEF_TRUE;
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_q->RegId   =  OS_OBJ_ID_NONE;
+#endif
     OS_MsgQInit(&p_q->MsgQ,                                 /* Initialize the list of OS_MSGs                         */
                 0u);
     OS_PendListInit(&p_q->PendList);                        /* Initialize the waiting list                            */
@@ -895,17 +1099,16 @@ void  OS_QPost (OS_Q        *p_q,
                 CPU_TS       ts,
                 OS_ERR      *p_err)
 {
-    OS_OBJ_QTY     cnt;
     OS_OPT         post_type;
     OS_PEND_LIST  *p_pend_list;
-    OS_PEND_DATA  *p_pend_data;
-    OS_PEND_DATA  *p_pend_data_next;
+    OS_PRIO        prio_new;
     OS_TCB        *p_tcb;
     CPU_SR_ALLOC();
 
 
 
     OS_CRITICAL_ENTER();
+    CPU_INT_DIS_MEAS_SITE_SET(CPU_INT_DIS_MEAS_SITE_OS_Q);
     p_pend_list = &p_q->PendList;
     if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {         /* Any task waiting on message queue?                     */
         if ((opt & OS_OPT_POST_LIFO) == (OS_OPT)0) {        /* Determine whether we post FIFO or LIFO                 */
@@ -924,25 +1127,26 @@ void  OS_QPost (OS_Q        *p_q,
     }
 
     if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {             /* Post message to all tasks waiting?                     */
-        cnt = p_pend_list->NbrEntries;                      /* Yes                                                    */
+        OS_PostAll((OS_PEND_OBJ *)((void *)p_q),            /* Yes, release the whole wait list in a single pass      */
+                   p_void,
+                   msg_size,
+                   ts);
     } else {
-        cnt = (OS_OBJ_QTY)1;                                /* No                                                     */
-    }
-    p_pend_data = p_pend_list->HeadPtr;
-    while (cnt > 0u) {
-        p_tcb            = p_pend_data->TCBPtr;
-        p_pend_data_next = p_pend_data->NextPtr;
+        p_tcb = p_pend_list->HeadPtr->TCBPtr;               /* No,  release the highest priority waiting task only    */
         OS_Post((OS_PEND_OBJ *)((void *)p_q),
                 p_tcb,
                 p_void,
                 msg_size,
                 ts);
-        p_pend_data = p_pend_data_next;
-        cnt--;
+        prio_new = p_tcb->Prio;                             /* Known wake priority, the scheduler can use the hint    */
     }
     OS_CRITICAL_EXIT_NO_SCHED();
     if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
-        OSSched();                                          /* Run the scheduler                                      */
+        if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {
+            OSSched();                                      /* Broadcast released several priorities, full dispatch   */
+        } else {
+            OS_SchedPost(prio_new);                         /* Skip the dispatch if the woken task cannot preempt     */
+        }
     }
     *p_err = OS_ERR_NONE;
 }
@@ -106,6 +106,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
     p_sem->Type    = OS_OBJ_TYPE_SEM;                       /* Mark the data structure as a semaphore                 */
     p_sem->Ctr     = cnt;                                   /* Set semaphore value                                    */
     p_sem->TS      = (CPU_TS)0;
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    p_sem->TSEn    = DEF_TRUE;                              /* Time stamping on by default (see OSSemTSCfg())         */
+#endif
     p_sem->NamePtr = p_name;                                /* Save the name of the semaphore                         */
     OS_PendListInit(&p_sem->PendList);                      /* Initialize the waiting list                            */
 
@@ -113,6 +116,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
     OS_SemDbgListAdd(p_sem);
 #endif
     OSSemQty++;
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_sem->RegId = OS_ObjRegAdd((void *)p_sem);             /* Assign a compact ID for trace/telemetry references     */
+#endif
 
     CPU_CRITICAL_EXIT();
     *p_err = OS_ERR_NONE;
@@ -206,6 +212,9 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
              if (nbr_tasks == (OS_OBJ_QTY)0) {
 #if OS_CFG_DBG_EN > 0u
                  OS_SemDbgListRemove(p_sem);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+                 OS_ObjRegRemove(p_sem->RegId);
 #endif
                  OSSemQty--;
                  OS_SemClr(p_sem);
@@ -230,6 +239,9 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
              }
 #if OS_CFG_DBG_EN > 0u
              OS_SemDbgListRemove(p_sem);
+#endif
+#if OS_CFG_OBJ_REG_EN > 0u
+             OS_ObjRegRemove(p_sem->RegId);
 #endif
              OSSemQty--;
              OS_SemClr(p_sem);
@@ -291,6 +303,11 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 *
 *
 * Returns    : The current value of the semaphore counter or 0 if not available.
+*
+* Note(s)    : 1) When the port provides native atomic instructions (CPU_CFG_ATOMIC_ASM_PRESENT #define'd in cpu.h),
+*                 an available semaphore is claimed with a single compare-and-swap on the counter, WITHOUT entering
+*                 a critical section.  The counter can only be non-zero when no task is waiting, so the pend-list
+*                 path need only be taken when the counter is zero.
 ************************************************************************************************************************
 */
 
@@ -347,6 +364,25 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     if (p_ts != (CPU_TS *)0) {
        *p_ts  = (CPU_TS)0;                                  /* Initialize the returned timestamp                      */
     }
+
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    if (sizeof(OS_SEM_CTR) == 4u) {                         /* Uncontended fast path (see Note #1)                    */
+        ctr = p_sem->Ctr;
+        while (ctr > (OS_SEM_CTR)0) {                       /* Resource available?                                    */
+            if (CPU_AtomicCmpSwap32((CPU_INT32U volatile *)&p_sem->Ctr,
+                                    (CPU_INT32U           ) ctr,
+                                    (CPU_INT32U           )(ctr - 1u)) == ctr) {
+                if (p_ts != (CPU_TS *)0) {
+                   *p_ts  = p_sem->TS;                      /* Yes, get timestamp of last post                        */
+                }
+                *p_err = OS_ERR_NONE;
+                return (ctr - (OS_SEM_CTR)1);
+            }
+            ctr = p_sem->Ctr;                               /* Counter changed under us; re-examine it                */
+        }
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     if (p_sem->Ctr > (OS_SEM_CTR)0) {                       /* Resource available?                                    */
         p_sem->Ctr--;                                       /* Yes, caller may proceed                                */
@@ -436,7 +472,11 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
 *
 *                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the semaphore
 *                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the semaphore
-*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler.  OR this in when aborting
+*                                                         waits on several objects in a row (shutdown or mode
+*                                                         change); all the readied tasks then compete in ONE
+*                                                         scheduler pass, issued by the caller, instead of one
+*                                                         per object.
 *
 *              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -489,6 +529,8 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
     switch (opt) {                                          /* Validate 'opt'                                         */
         case OS_OPT_PEND_ABORT_1:
         case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
              break;
 
         default:
@@ -521,7 +563,7 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
                      p_tcb,
                      ts);
         nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {                 /* Pend abort all tasks waiting?                          */
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == (OS_OPT)0u) {  /* Pend abort all tasks waiting?                          */
             break;                                          /* No                                                     */
         }
     }
@@ -596,7 +638,15 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     }
 #endif
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    if (p_sem->TSEn != DEF_FALSE) {
+        ts = OS_TS_GET();                                   /* Get timestamp                                          */
+    } else {
+        ts = (CPU_TS)0;                                     /* This semaphore opted out of time stamping              */
+    }
+#else
     ts = OS_TS_GET();                                       /* Get timestamp                                          */
+#endif
 
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
     if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR                              */
@@ -700,6 +750,67 @@ void  OSSemSet (OS_SEM      *p_sem,
 }
 #endif
 
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                   ENABLE OR DISABLE TIME STAMPING FOR A SEMAPHORE
+*
+* Description: This function lets an application decide, per object, whether posts record a time stamp.  Reading the
+*              time stamp costs a timer access on every post, which hot objects may not want to pay; diagnostic
+*              objects keep it.  Objects start with time stamping ENABLED so default behavior is unchanged.
+*
+* Arguments  : p_sem         is a pointer to the object
+*
+*              en            is DEF_TRUE to record a time stamp on each post, DEF_FALSE to skip it (posts then carry
+*                            a time stamp of 0)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                the call was successful
+*                                OS_ERR_OBJ_PTR_NULL        if 'p_sem' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE            if 'p_sem' is not pointing at the proper object type
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSSemTSCfg (OS_SEM  *p_sem,
+                  CPU_BOOLEAN   en,
+                  OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sem == (OS_SEM *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_sem->TSEn = en;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -722,7 +833,13 @@ void  OS_SemClr (OS_SEM  *p_sem)
     p_sem->Type    = OS_OBJ_TYPE_NONE;                      /* Mark the data structure as a NONE                      */
     p_sem->Ctr     = (OS_SEM_CTR)0;                         /* Set semaphore value                                    */
     p_sem->TS      = (CPU_TS    )0;                         /* Clear the time stamp                                   */
+#if OS_CFG_TS_OBJ_SEL_EN > 0u
+    p_sem->TSEn    = DEF_TRUE;
+#endif
     p_sem->NamePtr = (CPU_CHAR *)((void *)"?SEM");
+#if OS_CFG_OBJ_REG_EN > 0u
+    p_sem->RegId   = OS_OBJ_ID_NONE;
+#endif
     OS_PendListInit(&p_sem->PendList);                      /* Initialize the waiting list                            */
 }
 
@@ -851,7 +968,13 @@ void  OS_SemInit (OS_ERR  *p_err)
 *
 * Returns    : The current value of the semaphore counter or 0 upon error.
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) When the port provides native atomic instructions (CPU_CFG_ATOMIC_ASM_PRESENT #define'd in cpu.h),
+*                 a post to a non-zero semaphore is performed with a single compare-and-swap on the counter, WITHOUT
+*                 entering a critical section.  The counter can only be non-zero when no task is waiting (a post that
+*                 finds waiters readies a task instead of incrementing), so the pend-list walk need only be taken
+*                 when the counter is zero.
 ************************************************************************************************************************
 */
 
@@ -860,16 +983,34 @@ OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
                         CPU_TS   ts,
                         OS_ERR  *p_err)
 {
-    OS_OBJ_QTY     cnt;
     OS_SEM_CTR     ctr;
     OS_PEND_LIST  *p_pend_list;
-    OS_PEND_DATA  *p_pend_data;
-    OS_PEND_DATA  *p_pend_data_next;
+    OS_PRIO        prio_new;
     OS_TCB        *p_tcb;
     CPU_SR_ALLOC();
 
 
 
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    if (sizeof(OS_SEM_CTR) == 4u) {                         /* Uncontended fast path (see Note #2)                    */
+        ctr = p_sem->Ctr;
+        while (ctr > (OS_SEM_CTR)0) {                       /* Non-zero counter, thus nobody waiting?                 */
+            if (ctr == DEF_INT_32U_MAX_VAL) {
+                *p_err = OS_ERR_SEM_OVF;
+                return ((OS_SEM_CTR)0);
+            }
+            if (CPU_AtomicCmpSwap32((CPU_INT32U volatile *)&p_sem->Ctr,
+                                    (CPU_INT32U           ) ctr,
+                                    (CPU_INT32U           )(ctr + 1u)) == ctr) {
+                p_sem->TS = ts;                             /* Save timestamp in semaphore control block              */
+                *p_err    = OS_ERR_NONE;
+                return (ctr + (OS_SEM_CTR)1);
+            }
+            ctr = p_sem->Ctr;                               /* Counter changed under us; re-examine it                */
+        }
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_sem->PendList;
     if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {         /* Any task waiting on semaphore?                         */
@@ -911,26 +1052,27 @@ OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
 
     OS_CRITICAL_ENTER_CPU_CRITICAL_EXIT();
     if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {             /* Post message to all tasks waiting?                     */
-        cnt = p_pend_list->NbrEntries;                      /* Yes                                                    */
+        OS_PostAll((OS_PEND_OBJ *)((void *)p_sem),          /* Yes, release the whole wait list in a single pass      */
+                   (void      *)0,
+                   (OS_MSG_SIZE)0,
+                   ts);
     } else {
-        cnt = (OS_OBJ_QTY)1;                                /* No                                                     */
-    }
-    p_pend_data = p_pend_list->HeadPtr;
-    while (cnt > 0u) {
-        p_tcb            = p_pend_data->TCBPtr;
-        p_pend_data_next = p_pend_data->NextPtr;
+        p_tcb = p_pend_list->HeadPtr->TCBPtr;               /* No,  release the highest priority waiting task only    */
         OS_Post((OS_PEND_OBJ *)((void *)p_sem),
                 p_tcb,
                 (void      *)0,
                 (OS_MSG_SIZE)0,
                 ts);
-        p_pend_data = p_pend_data_next;
-        cnt--;
+        prio_new = p_tcb->Prio;                             /* Known wake priority, the scheduler can use the hint    */
     }
     ctr = p_sem->Ctr;
     OS_CRITICAL_EXIT_NO_SCHED();
     if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
-        OSSched();                                          /* Run the scheduler                                      */
+        if ((opt & OS_OPT_POST_ALL) != (OS_OPT)0) {
+            OSSched();                                      /* Broadcast released several priorities, full dispatch   */
+        } else {
+            OS_SchedPost(prio_new);                         /* Skip the dispatch if the woken task cannot preempt     */
+        }
     }
     *p_err = OS_ERR_NONE;
     return (ctr);
@@ -0,0 +1,803 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*                          All rights reserved.  Protected by international copyright laws.
+*
+*                                        ZERO-COPY SLOT QUEUE MANAGEMENT
+*
+* File    : OS_SQ.C
+* By      : JJL
+* Version : V3.02.0
+*
+* LICENSING TERMS:
+* ---------------
+*               uC/OS-III is provided in source form to registered licensees ONLY.  It is
+*               illegal to distribute this source code to any third party unless you receive
+*               written permission by an authorized Micrium representative.  Knowledge of
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#include <os.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_sq__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_SQ_EN > 0u
+/*
+************************************************************************************************************************
+*                                                 LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_SQ_SLOT  *OS_SQ_SlotPtr(OS_SQ       *p_sq,
+                                   CPU_INT32U   ix);
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                 CREATE A SLOT QUEUE
+*
+* Description: This function is called by your application to create a slot queue.  Slot queues MUST be created before
+*              they can be used.
+*
+* Arguments  : p_sq        is a pointer to the slot queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the slot queue
+*
+*              p_storage   is a pointer to the storage for the slot ring.  The storage MUST be aligned on a CPU_ALIGN
+*                          boundary and MUST provide at least OS_SQ_STORAGE_SIZE(slot_qty, slot_size) bytes.
+*
+*              slot_qty    indicates the number of slots in the ring (must be non-zero)
+*
+*              slot_size   indicates the payload capacity of one slot, in bytes (must be non-zero)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_CREATE_ISR              can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the slot queue after you
+*                                                               called OSSafetyCriticalStart().
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_sq'
+*                              OS_ERR_PTR_INVALID             if 'p_storage' is a NULL pointer or is misaligned
+*                              OS_ERR_Q_SIZE                  if 'slot_qty' or 'slot_size' is 0
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSSQCreate (OS_SQ        *p_sq,
+                  CPU_CHAR     *p_name,
+                  void         *p_storage,
+                  OS_MSG_QTY    slot_qty,
+                  OS_MSG_SIZE   slot_size,
+                  OS_ERR       *p_err)
+{
+    OS_MSG_QTY   i;
+    OS_SQ_SLOT  *p_slot;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+        *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sq == (OS_SQ *)0) {                               /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_storage == (void *)0) {                           /* Must provide storage for the slot ring                 */
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (((CPU_ADDR)p_storage & ((CPU_ADDR)sizeof(CPU_ALIGN) - 1u)) != (CPU_ADDR)0) {
+        *p_err = OS_ERR_PTR_INVALID;                        /* Storage must be aligned on a CPU_ALIGN boundary        */
+        return;
+    }
+    if (slot_qty == (OS_MSG_QTY)0) {                        /* Cannot specify a zero size ring                        */
+        *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+    if (slot_size == (OS_MSG_SIZE)0) {                      /* Cannot specify zero size slots                         */
+        *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    OS_CRITICAL_ENTER();
+    p_sq->Type       = OS_OBJ_TYPE_SQ;                      /* Mark the data structure as a slot queue                */
+    p_sq->NamePtr    = p_name;
+    p_sq->StoragePtr = (CPU_INT08U *)p_storage;
+    p_sq->SlotQty    = slot_qty;
+    p_sq->SlotSize   = slot_size;
+                                                            /* Keep each payload aligned on a CPU_ALIGN boundary      */
+    p_sq->SlotStride = (CPU_INT32U)sizeof(OS_SQ_SLOT)
+                     + (((CPU_INT32U)slot_size + (CPU_INT32U)sizeof(CPU_ALIGN) - 1u)
+                     & ~((CPU_INT32U)sizeof(CPU_ALIGN) - 1u));
+    p_sq->AllocIx    = (CPU_INT32U)0;
+    p_sq->OutIx      = (CPU_INT32U)0;
+    p_sq->FreeIx     = (CPU_INT32U)0;
+    for (i = (OS_MSG_QTY)0; i < slot_qty; i++) {            /* All slots start out empty                              */
+        p_slot          = OS_SQ_SlotPtr(p_sq, (CPU_INT32U)i);
+        p_slot->MsgSize = (OS_MSG_SIZE)0;
+        p_slot->Full    = (CPU_INT08U)0;
+    }
+    OS_PendListInit(&p_sq->PendList);                       /* Initialize the waiting list                            */
+    OSSQQty++;                                              /* One more slot queue created                            */
+    OS_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            PEND ON A SLOT QUEUE FOR A SLOT
+*
+* Description: This function waits for a published slot to arrive at a slot queue.  The caller BORROWS the slot; once
+*              done with the payload it MUST hand the slot back with OSSQRelease() so producers can reuse it.
+*
+* Arguments  : p_sq          is a pointer to the slot queue
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            slot to arrive at the queue up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever at the specified queue or, until a slot
+*                            arrives.
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the payload
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the slot was posted.
+*                            If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a slot.
+*                                OS_ERR_OBJ_PTR_NULL       if you pass a NULL pointer for 'p_sq'
+*                                OS_ERR_OBJ_TYPE           if the slot queue was not created
+*                                OS_ERR_PEND_ABORT         the pend was aborted
+*                                OS_ERR_PEND_ISR           if you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        if you pass a NULL pointer for 'p_msg_size'
+*                                OS_ERR_SCHED_LOCKED       the scheduler is locked
+*                                OS_ERR_TIMEOUT            A slot was not received within the specified timeout
+*
+* Returns    : != (void *)0  is a pointer to the payload of the borrowed slot
+*              == (void *)0  if no slot was received or upon error
+*
+* Note(s)    : 1) When the port provides native atomic instructions (CPU_CFG_ATOMIC_ASM_PRESENT #define'd in cpu.h),
+*                 a published slot is claimed with a single compare-and-swap on the consumer index, WITHOUT entering
+*                 a critical section.  The critical section is only entered when the queue appears empty.
+*
+*              2) The oldest allocated slot may not be published yet (its producer is still filling it in).  The
+*                 queue then reports empty; the slot is delivered as soon as its producer posts it.
+************************************************************************************************************************
+*/
+
+void  *OSSQPend (OS_SQ        *p_sq,
+                 OS_TICK       timeout,
+                 OS_OPT        opt,
+                 OS_MSG_SIZE  *p_msg_size,
+                 CPU_TS       *p_ts,
+                 OS_ERR       *p_err)
+{
+    OS_PEND_DATA  pend_data;
+    OS_SQ_SLOT   *p_slot;
+    void         *p_void;
+    CPU_INT32U    out;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_PEND_ISR;
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sq == (OS_SQ *)0) {                               /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    if (p_msg_size == (OS_MSG_SIZE *)0) {
+        *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_sq->Type != OS_OBJ_TYPE_SQ) {                     /* Make sure slot queue was created                       */
+        *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
+
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    out = p_sq->OutIx;                                      /* Uncontended fast path (see Note #1)                    */
+    while (out != p_sq->AllocIx) {                          /* Any slot allocated ahead of us?                        */
+        p_slot = OS_SQ_SlotPtr(p_sq, out);
+        if (p_slot->Full == (CPU_INT08U)0) {                /* Oldest slot not yet published (see Note #2)            */
+            break;
+        }
+        if (CPU_AtomicCmpSwap32(&p_sq->OutIx, out, out + 1u) == out) {
+            *p_msg_size = p_slot->MsgSize;
+            *p_err      = OS_ERR_NONE;
+            return ((void *)((CPU_INT08U *)((void *)p_slot) + sizeof(OS_SQ_SLOT)));
+        }
+        out = p_sq->OutIx;                                  /* Lost the race to another consumer; re-examine          */
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    out = p_sq->OutIx;                                      /* Any published slot waiting in the ring?                */
+    if (out != p_sq->AllocIx) {
+        p_slot = OS_SQ_SlotPtr(p_sq, out);
+        if (p_slot->Full != (CPU_INT08U)0) {
+            p_sq->OutIx = out + 1u;                         /* Yes, borrow it                                         */
+            *p_msg_size = p_slot->MsgSize;
+            CPU_CRITICAL_EXIT();
+            *p_err      = OS_ERR_NONE;
+            return ((void *)((CPU_INT08U *)((void *)p_slot) + sizeof(OS_SQ_SLOT)));
+        }
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {    /* Caller wants to block if not available?                */
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_PEND_WOULD_BLOCK;                   /* No                                                     */
+        return ((void *)0);
+    } else {
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    /* Can't pend when the scheduler is locked                */
+            CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_CRITICAL_ENTER_CPU_CRITICAL_EXIT();                  /* Lock the scheduler/re-enable interrupts                */
+    OS_Pend(&pend_data,                                     /* Block task pending on Slot Queue                       */
+            (OS_PEND_OBJ *)((void *)p_sq),
+            OS_TASK_PEND_ON_SQ,
+            timeout);
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    OSSched();                                              /* Find the next highest priority task ready to run       */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                             /* Extract slot from TCB (Put there by Post)              */
+             p_void      = OSTCBCurPtr->MsgPtr;
+             *p_msg_size = OSTCBCurPtr->MsgSize;
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+             *p_err      = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                          /* Indicate that we aborted                               */
+             p_void      = (void      *)0;
+             *p_msg_size = (OS_MSG_SIZE)0;
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+             *p_err      = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                        /* Indicate that we didn't get event within TO            */
+             p_void      = (void      *)0;
+             *p_msg_size = (OS_MSG_SIZE)0;
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts  = (CPU_TS  )0;
+             }
+             *p_err      = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                            /* Indicate that object pended on has been deleted        */
+             p_void      = (void      *)0;
+             *p_msg_size = (OS_MSG_SIZE)0;
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+             *p_err      = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_void      = (void      *)0;
+             *p_msg_size = (OS_MSG_SIZE)0;
+             *p_err      = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_void);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                          ALLOCATE A SLOT FROM A SLOT QUEUE
+*
+* Description: This function borrows a free slot from the slot queue's ring so the producer can build the payload IN
+*              PLACE.  The slot is NOT visible to consumers until it is published with OSSQPost().
+*
+* Arguments  : p_sq        is a pointer to the slot queue
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE            a slot was allocated
+*                              OS_ERR_OBJ_PTR_NULL    if you pass a NULL pointer for 'p_sq'
+*                              OS_ERR_OBJ_TYPE        if the slot queue was not created
+*                              OS_ERR_Q_FULL          all slots are allocated and not yet released
+*
+* Returns    : != (void *)0  is a pointer to the payload area of the allocated slot
+*              == (void *)0  if no slot is available or upon error
+*
+* Note(s)    : 1) When the port provides native atomic instructions (CPU_CFG_ATOMIC_ASM_PRESENT #define'd in cpu.h),
+*                 the slot is claimed with a single compare-and-swap on the producer index, WITHOUT entering a
+*                 critical section.  This function is thus safe to call from tasks and (nested) ISRs alike.
+************************************************************************************************************************
+*/
+
+void  *OSSQPostAlloc (OS_SQ   *p_sq,
+                      OS_ERR  *p_err)
+{
+    OS_SQ_SLOT  *p_slot;
+    CPU_INT32U   in;
+#ifndef CPU_CFG_ATOMIC_ASM_PRESENT
+    CPU_SR_ALLOC();
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sq == (OS_SQ *)0) {                               /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_sq->Type != OS_OBJ_TYPE_SQ) {                     /* Make sure slot queue was created                       */
+        *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    do {
+        in = p_sq->AllocIx;                                 /* Claim a free slot with a single atomic op (Note #1)    */
+        if ((in - p_sq->FreeIx) >= (CPU_INT32U)p_sq->SlotQty) {
+            *p_err = OS_ERR_Q_FULL;                         /* All slots allocated and not yet released               */
+            return ((void *)0);
+        }
+    } while (CPU_AtomicCmpSwap32(&p_sq->AllocIx, in, in + 1u) != in);
+#else
+    CPU_CRITICAL_ENTER();
+    in = p_sq->AllocIx;
+    if ((in - p_sq->FreeIx) >= (CPU_INT32U)p_sq->SlotQty) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_Q_FULL;                             /* All slots allocated and not yet released               */
+        return ((void *)0);
+    }
+    p_sq->AllocIx = in + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    p_slot = OS_SQ_SlotPtr(p_sq, in);
+    *p_err = OS_ERR_NONE;
+    return ((void *)((CPU_INT08U *)((void *)p_slot) + sizeof(OS_SQ_SLOT)));
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              PUBLISH A SLOT TO A SLOT QUEUE
+*
+* Description: This function publishes a slot previously allocated with OSSQPostAlloc() and filled in by the producer.
+*              The payload is NOT copied; consumers receive a pointer to the very memory the producer wrote.
+*
+* Arguments  : p_sq        is a pointer to the slot queue
+*
+*              p_slot      is the payload pointer returned by OSSQPostAlloc()
+*
+*              msg_size    specifies the size of the payload (in bytes)
+*
+*              opt         determines the type of POST performed:
+*
+*                              OS_OPT_POST_FIFO         Slots are always delivered oldest first
+*                              OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE            the call was successful and the slot was published
+*                              OS_ERR_OBJ_PTR_NULL    if you pass a NULL pointer for 'p_sq'
+*                              OS_ERR_OBJ_TYPE        if the slot queue was not created
+*                              OS_ERR_PTR_INVALID     if 'p_slot' is a NULL pointer
+*                              OS_ERR_Q_SIZE          if 'msg_size' exceeds the payload capacity of a slot
+************************************************************************************************************************
+*/
+
+void  OSSQPost (OS_SQ        *p_sq,
+                void         *p_slot,
+                OS_MSG_SIZE   msg_size,
+                OS_OPT        opt,
+                OS_ERR       *p_err)
+{
+    CPU_TS  ts;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sq == (OS_SQ *)0) {                               /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_slot == (void *)0) {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (msg_size > p_sq->SlotSize) {                        /* Payload cannot exceed the slot capacity                */
+        *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_sq->Type != OS_OBJ_TYPE_SQ) {                     /* Make sure slot queue was created                       */
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    ts = OS_TS_GET();                                       /* Get timestamp                                          */
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR                              */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_SQ,            /* Post to ISR queue                                      */
+                    (void      *)p_sq,
+                    (void      *)p_slot,
+                    (OS_MSG_SIZE)msg_size,
+                    (OS_FLAGS   )0,
+                    (OS_OPT     )opt,
+                    (CPU_TS     )ts,
+                    (OS_ERR    *)p_err);
+        return;
+    }
+#endif
+
+    OS_SQPost(p_sq,                                         /* Publish the slot                                       */
+              p_slot,
+              msg_size,
+              opt,
+              ts,
+              p_err);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                          RELEASE A BORROWED SLOT
+*
+* Description: This function hands a slot borrowed with OSSQPend() back to the slot queue so producers can reuse it.
+*              Slots MUST be released in the order they were received.
+*
+* Arguments  : p_sq        is a pointer to the slot queue
+*
+*              p_slot      is the payload pointer received from OSSQPend()
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE            the slot was released
+*                              OS_ERR_OBJ_PTR_NULL    if you pass a NULL pointer for 'p_sq'
+*                              OS_ERR_OBJ_TYPE        if the slot queue was not created
+*                              OS_ERR_PTR_INVALID     if 'p_slot' is not the oldest borrowed slot
+*                              OS_ERR_Q_EMPTY         if no slot is currently borrowed
+*
+* Returns    : none
+*
+* Note(s)    : 1) The slot is emptied (its 'Full' marker cleared) BEFORE the release index is advanced; a producer
+*                 can only see the slot as reusable once it no longer looks published.
+************************************************************************************************************************
+*/
+
+void  OSSQRelease (OS_SQ   *p_sq,
+                   void    *p_slot,
+                   OS_ERR  *p_err)
+{
+    OS_SQ_SLOT  *p_slot_hdr;
+    CPU_INT32U   ix;
+#ifndef CPU_CFG_ATOMIC_ASM_PRESENT
+    CPU_SR_ALLOC();
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sq == (OS_SQ *)0) {                               /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_slot == (void *)0) {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_sq->Type != OS_OBJ_TYPE_SQ) {                     /* Make sure slot queue was created                       */
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#ifdef CPU_CFG_ATOMIC_ASM_PRESENT
+    do {
+        ix = p_sq->FreeIx;
+        if (ix == p_sq->OutIx) {                            /* Nothing borrowed?                                      */
+            *p_err = OS_ERR_Q_EMPTY;
+            return;
+        }
+        p_slot_hdr = OS_SQ_SlotPtr(p_sq, ix);               /* Released slot must be the oldest borrowed one          */
+        if (p_slot != (void *)((CPU_INT08U *)((void *)p_slot_hdr) + sizeof(OS_SQ_SLOT))) {
+            *p_err = OS_ERR_PTR_INVALID;
+            return;
+        }
+        p_slot_hdr->Full    = (CPU_INT08U)0;                /* Empty the slot BEFORE making it reusable (Note #1)     */
+        p_slot_hdr->MsgSize = (OS_MSG_SIZE)0;
+    } while (CPU_AtomicCmpSwap32(&p_sq->FreeIx, ix, ix + 1u) != ix);
+#else
+    CPU_CRITICAL_ENTER();
+    ix = p_sq->FreeIx;
+    if (ix == p_sq->OutIx) {                                /* Nothing borrowed?                                      */
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_Q_EMPTY;
+        return;
+    }
+    p_slot_hdr = OS_SQ_SlotPtr(p_sq, ix);                   /* Released slot must be the oldest borrowed one          */
+    if (p_slot != (void *)((CPU_INT08U *)((void *)p_slot_hdr) + sizeof(OS_SQ_SLOT))) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    p_slot_hdr->Full    = (CPU_INT08U)0;                    /* Empty the slot BEFORE making it reusable (Note #1)     */
+    p_slot_hdr->MsgSize = (OS_MSG_SIZE)0;
+    p_sq->FreeIx        = ix + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                             CLEAR THE CONTENTS OF A SLOT QUEUE
+*
+* Description: This function is called to clear the contents of a slot queue
+*
+* Arguments  : p_sq      is a pointer to the slot queue to clear
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_SQClr (OS_SQ  *p_sq)
+{
+    p_sq->Type       = OS_OBJ_TYPE_NONE;                    /* Mark the data structure as a NONE                      */
+    p_sq->NamePtr    = (CPU_CHAR   *)((void *)"?SQ");
+    p_sq->StoragePtr = (CPU_INT08U *)0;
+    p_sq->SlotQty    = (OS_MSG_QTY  )0;
+    p_sq->SlotSize   = (OS_MSG_SIZE )0;
+    p_sq->SlotStride = (CPU_INT32U  )0;
+    p_sq->AllocIx    = (CPU_INT32U  )0;
+    p_sq->OutIx      = (CPU_INT32U  )0;
+    p_sq->FreeIx     = (CPU_INT32U  )0;
+    OS_PendListInit(&p_sq->PendList);                       /* Initialize the waiting list                            */
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              SLOT QUEUE INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the slot queue management.
+*
+* Argument(s): p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE     the call was successful
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_SQInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSSQQty = (OS_OBJ_QTY)0;                                /* Clear the number of slot queues created                */
+    *p_err  = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              PUBLISH A SLOT TO A SLOT QUEUE
+*
+* Description: This function publishes a slot and, if consumers are waiting, hands published slots to them oldest
+*              first.
+*
+* Arguments  : p_sq        is a pointer to the slot queue
+*
+*              p_slot      is the payload pointer returned by OSSQPostAlloc()
+*
+*              msg_size    specifies the size of the payload (in bytes)
+*
+*              opt         determines the type of POST performed (see OSSQPost())
+*
+*              ts          is a timestamp indicating when the post occurred
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) Publishing is a plain store of the slot's 'Full' marker, which MUST be the producer's last store to
+*                 the slot.  No critical section is needed on the fast path; the pend list is only examined (under
+*                 the critical section) when consumers are actually waiting.
+************************************************************************************************************************
+*/
+
+void  OS_SQPost (OS_SQ        *p_sq,
+                 void         *p_slot,
+                 OS_MSG_SIZE   msg_size,
+                 OS_OPT        opt,
+                 CPU_TS        ts,
+                 OS_ERR       *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_SQ_SLOT    *p_slot_hdr;
+    OS_TCB        *p_tcb;
+    CPU_SR_ALLOC();
+
+
+
+    p_slot_hdr = (OS_SQ_SLOT *)((void *)((CPU_INT08U *)p_slot - sizeof(OS_SQ_SLOT)));
+    p_slot_hdr->MsgSize = msg_size;                         /* Payload was already written in place by the producer   */
+    p_slot_hdr->Full    = (CPU_INT08U)1;                    /* Publish the slot; MUST be the last store (see Note #2) */
+
+    if (p_sq->PendList.NbrEntries == (OS_OBJ_QTY)0) {       /* Nobody waiting: publication is all there is to do      */
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    OS_CRITICAL_ENTER();
+    p_pend_list = &p_sq->PendList;
+    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0) {       /* Hand published slots to waiting consumers              */
+        if (p_sq->OutIx == p_sq->AllocIx) {
+            break;
+        }
+        p_slot_hdr = OS_SQ_SlotPtr(p_sq, p_sq->OutIx);
+        if (p_slot_hdr->Full == (CPU_INT08U)0) {            /* Oldest slot not published yet; stop delivering         */
+            break;
+        }
+        p_tcb = p_pend_list->HeadPtr->TCBPtr;
+        OS_Post((OS_PEND_OBJ *)((void *)p_sq),
+                p_tcb,
+                (void *)((CPU_INT08U *)((void *)p_slot_hdr) + sizeof(OS_SQ_SLOT)),
+                p_slot_hdr->MsgSize,
+                ts);
+        p_sq->OutIx++;                                      /* The woken consumer has borrowed the slot               */
+    }
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+        OSSched();                                          /* Run the scheduler                                      */
+    }
+    *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                              ADDRESS A SLOT IN THE RING
+*
+* Description: This function converts a free-running slot index into a pointer to the slot's header.
+*
+* Arguments  : p_sq      is a pointer to the slot queue
+*
+*              ix        is the free-running slot index
+*
+* Returns    : Pointer to the OS_SQ_SLOT header of the addressed slot.
+************************************************************************************************************************
+*/
+
+static  OS_SQ_SLOT  *OS_SQ_SlotPtr (OS_SQ       *p_sq,
+                                    CPU_INT32U   ix)
+{
+    return ((OS_SQ_SLOT *)((void *)&p_sq->StoragePtr[(ix % (CPU_INT32U)p_sq->SlotQty) * p_sq->SlotStride]));
+}
+
+#endif
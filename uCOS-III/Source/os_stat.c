@@ -58,6 +58,9 @@ void  OSStatReset (OS_ERR  *p_err)
 #endif
 #if (OS_CFG_Q_EN > 0u)
     OS_Q        *p_q;
+#endif
+#if (OS_CFG_TASK_JITTER_EN > 0u)
+    CPU_INT08U   ix;
 #endif
     CPU_SR_ALLOC();
 #endif
@@ -91,7 +94,14 @@ void  OSStatReset (OS_ERR  *p_err)
 #endif
 
 #if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
-    OSSchedLockTimeMax = (CPU_TS)0;                         /* Reset the maximum scheduler lock time                  */
+    OSSchedLockTimeMax   = (CPU_TS)0;                       /* Reset the maximum scheduler lock time                  */
+    OSSchedLockHolderPtr = (OS_TCB *)0;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u) && (OS_MSG_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;               /* Restart the pool watermark from the current load       */
+    CPU_CRITICAL_EXIT();
 #endif
 
 #if OS_CFG_DBG_EN > 0u
@@ -119,6 +129,13 @@ void  OSStatReset (OS_ERR  *p_err)
         p_tcb->CyclesStart      =  OS_TS_GET();
 #endif
 
+#if OS_CFG_TASK_JITTER_EN > 0u
+        p_tcb->JitterMax        = (CPU_TS      )0;
+        for (ix = 0u; ix < OS_CFG_TASK_JITTER_HIST_SIZE; ix++) {
+            p_tcb->JitterHistTbl[ix] = (OS_CTR  )0;
+        }
+#endif
+
 #if OS_CFG_TASK_Q_EN > 0u
         p_msg_q                 = &p_tcb->MsgQ;
         p_msg_q->NbrEntriesMax  = (OS_MSG_QTY  )0;
@@ -185,6 +202,13 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     }
 #endif
 
+    if (OSStatTaskTCB.StkPtr == (CPU_STK *)0) {             /* First use?  Create the statistic task now; OSInit()    */
+        OS_StatTaskInit(p_err);                             /* ... no longer does, so a boot that never calls this    */
+        if (*p_err != OS_ERR_NONE) {                        /* ... function never pays for the task or its stack      */
+            return;
+        }
+    }
+
     OSTimeDly((OS_TICK )2,                                  /* Synchronize with clock tick                            */
               (OS_OPT  )OS_OPT_TIME_DLY,
               (OS_ERR *)&err);
@@ -216,6 +240,143 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     *p_err            = OS_ERR_NONE;
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                    ENABLE/DISABLE THE STATISTIC TASK MEASUREMENTS
+*
+* Description: This function is called by your application to enable or disable the statistic task's periodic
+*              measurements at run time.  While disabled, the statistic task parks on its built-in semaphore instead of
+*              sleeping between measurement periods, so the periodic cost of the statistics (CPU usage computation,
+*              per-task profiling and stack checking) drops to exactly zero without rebuilding with different os_cfg.h
+*              settings.  Re-enabling resets the computed statistics (see OSStatReset()) so the first sample after the
+*              gap covers one clean measurement period instead of everything accumulated while off.
+*
+* Argument(s): en         DEF_TRUE  to enable the measurements (the default after OSInit()),
+*                         DEF_FALSE to disable them.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE        The call was successful
+*                             OS_ERR_SET_ISR     If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) OSStatTaskCPUUsageInit() must still be called once to create the statistic task and calibrate the
+*                 idle counter; this function only pauses and resumes the task that already exists.  Calling it before
+*                 the task is created simply records the setting for when the task starts.
+************************************************************************************************************************
+*/
+
+void  OSStatTaskEnSet (CPU_BOOLEAN   en,
+                       OS_ERR       *p_err)
+{
+    CPU_BOOLEAN  en_prev;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    en_prev      = OSStatTaskEn;
+    OSStatTaskEn = en;
+    CPU_CRITICAL_EXIT();
+
+    if ((en      == DEF_TRUE ) &&
+        (en_prev == DEF_FALSE)) {
+        if (OSStatTaskTCB.StkPtr != (CPU_STK *)0) {         /* Wake the parked statistic task, if it has been created */
+            (void)OSTaskSemPost((OS_TCB *)&OSStatTaskTCB,
+                                (OS_OPT  )OS_OPT_POST_NONE,
+                                (OS_ERR *)p_err);
+            return;
+        }
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                           ITERATE OVER PER-TASK CPU USAGE
+*
+* Description: This function is called by your application to walk the tasks known to the kernel and read each task's
+*              CPU usage as computed by the statistic task.  Each task's runtime is accumulated in its TCB by
+*              OSTaskSwHook() (a CPU_TS delta captured at every context switch) and converted to a percentage of the
+*              measurement period by OS_StatTask(), so attributing a high OSStatTaskCPUUsage figure to a specific
+*              task does not require an external trace.  Typical usage:
+*
+*                  p_tcb = OSStatTaskUsageNext((OS_TCB *)0, &name, &usage, &err);    Start of the task list
+*                  while (p_tcb != (OS_TCB *)0) {
+*                      ... display 'name' and 'usage' ...
+*                      p_tcb = OSStatTaskUsageNext(p_tcb, &name, &usage, &err);
+*                  }
+*
+* Argument(s): p_tcb        is a pointer to the previously returned TCB, or a NULL pointer to start at the head of
+*                           the task list.
+*
+*              p_name       is a pointer to where the task's name pointer will be stored.
+*
+*              p_usage      is a pointer to where the task's CPU usage (0-100%) will be stored.  The value lags by
+*                           one statistic task period (see OS_CFG_STAT_TASK_RATE_HZ in os_cfg_app.h).
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE
+*
+* Returns    : The TCB whose name and usage were stored, or a NULL pointer when the end of the task list is reached.
+*
+* Note(s)    : 1) The task list is only modified by OSTaskCreate() and OSTaskDel(); iterating while tasks are being
+*                 created or deleted can skip entries but cannot follow a dangling pointer because the next pointer
+*                 is read under the critical section.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+OS_TCB  *OSStatTaskUsageNext (OS_TCB        *p_tcb,
+                              CPU_CHAR     **p_name,
+                              OS_CPU_USAGE  *p_usage,
+                              OS_ERR        *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TCB *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                             /* Start (or restart) at the head of the task list        */
+        p_tcb = OSTaskDbgListPtr;
+    } else {
+        p_tcb = p_tcb->DbgNextPtr;
+    }
+    if (p_tcb != (OS_TCB *)0) {
+        *p_name  =  p_tcb->NamePtr;
+        *p_usage =  p_tcb->CPUUsage;
+    }
+    CPU_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
+    return (p_tcb);
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -240,6 +401,8 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 *                 for the idle counter.
 *
 *              4) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              5) The periodic measurements can be paused and resumed at run time with OSStatTaskEnSet().
 ************************************************************************************************************************
 */
 
@@ -256,6 +419,13 @@ void  OS_StatTask (void *p_arg)
     OS_TICK      dly;
     CPU_TS       ts_start;
     CPU_TS       ts_end;
+#if OS_CFG_IDLE_WAIT_EN > 0u
+    CPU_TS       ts_prev;
+    CPU_TS       ts_now;
+    CPU_INT32U   halt_tm;
+    CPU_INT32U   period_tm;
+    CPU_INT32U   halt_pct;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -276,7 +446,29 @@ void  OS_StatTask (void *p_arg)
         dly =  (OS_TICK)(OSCfg_TickRate_Hz / (OS_RATE_HZ)10);
     }
 
+#if OS_CFG_IDLE_WAIT_EN > 0u
+    ts_prev = OS_TS_GET();
+#endif
+
     while (DEF_ON) {
+        if (OSStatTaskEn != DEF_TRUE) {                     /* Measurements disabled?  Park on the task semaphore ... */
+            do {                                            /* ... so the periodic cost is exactly zero while off     */
+                (void)OSTaskSemPend((OS_TICK )0,
+                                    (OS_OPT  )OS_OPT_PEND_BLOCKING,
+                                    (CPU_TS *)0,
+                                    (OS_ERR *)&err);
+            } while (OSStatTaskEn != DEF_TRUE);             /* A post left over from a prior toggle is absorbed here  */
+            OSStatReset(&err);                              /* Restart from clean statistics ...                      */
+            CPU_CRITICAL_ENTER();
+            OSStatTaskCtr = (OS_TICK)0;
+            CPU_CRITICAL_EXIT();
+#if OS_CFG_IDLE_WAIT_EN > 0u
+            ts_prev = OS_TS_GET();
+#endif
+            OSTimeDly(dly,                                  /* ... and let one full period elapse before sampling     */
+                      OS_OPT_TIME_DLY,
+                      &err);
+        }
         ts_start        = OS_TS_GET();
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
         OSIntDisTimeMax = CPU_IntDisMeasMaxGet();
@@ -297,6 +489,24 @@ void  OS_StatTask (void *p_arg)
             OSStatTaskCPUUsage = (OS_CPU_USAGE)100;
         }
 
+#if OS_CFG_IDLE_WAIT_EN > 0u
+        ts_now    = OS_TS_GET();                            /* Credit time the idle task spent halted in 'wait':      */
+        CPU_CRITICAL_ENTER();                               /* ... it could not increment OSStatTaskCtr while halted  */
+        halt_tm           = OSIdleWaitTimeAcc;              /* ... so the counter-based figure reads halts as busy    */
+        OSIdleWaitTimeAcc = (CPU_INT32U)0;
+        CPU_CRITICAL_EXIT();
+        period_tm = (CPU_INT32U)(ts_now - ts_prev);
+        ts_prev   =  ts_now;
+        if (period_tm > (CPU_INT32U)0) {
+            halt_pct = 100u * halt_tm / period_tm;          /* Halted share of the measurement period, in percent     */
+            if ((CPU_INT32U)OSStatTaskCPUUsage > halt_pct) {
+                OSStatTaskCPUUsage = (OS_CPU_USAGE)((CPU_INT32U)OSStatTaskCPUUsage - halt_pct);
+            } else {
+                OSStatTaskCPUUsage = (OS_CPU_USAGE)0;
+            }
+        }
+#endif
+
         OSStatTaskHook();                                   /* Invoke user definable hook                             */
 
 
@@ -343,6 +553,12 @@ void  OS_StatTask (void *p_arg)
                          &err);
 #endif
 
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+            if (OSTaskStkRedzoneChk(p_tcb) == DEF_FAIL) {   /* Make sure the task did not overflow its stack          */
+                OSRedzoneHitHook(p_tcb);
+            }
+#endif
+
             p_tcb = p_tcb->DbgNextPtr;
         }
 #endif
@@ -368,7 +584,9 @@ void  OS_StatTask (void *p_arg)
 ************************************************************************************************************************
 *                                              INITIALIZE THE STATISTICS
 *
-* Description: This function is called by OSInit() to initialize the statistic task.
+* Description: This function is called by OSStatTaskCPUUsageInit(), the first time it runs, to create the statistic
+*              task.  OSInit() only initializes the statistic variables, so configurations that never enable CPU usage
+*              measurement never spend boot time or RAM bandwidth creating this task.
 *
 * Argument(s): p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -393,12 +611,6 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
     }
 #endif
 
-    OSStatTaskCtr    = (OS_TICK)0;
-    OSStatTaskCtrRun = (OS_TICK)0;
-    OSStatTaskCtrMax = (OS_TICK)0;
-    OSStatTaskRdy    = OS_STATE_NOT_RDY;                    /* Statistic task is not ready                            */
-    OSStatResetFlag  = DEF_FALSE;
-
                                                             /* ---------------- CREATE THE STAT TASK ---------------- */
     if (OSCfg_StatTaskStkBasePtr == (CPU_STK*)0) {
         *p_err = OS_ERR_STK_INVALID;
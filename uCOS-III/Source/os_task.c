@@ -228,6 +228,11 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_ERR_TCB_INVALID             if you specified a NULL pointer for 'p_tcb'
 *
 * Returns    : A pointer to the TCB of the task created.  This pointer must be used as an ID (i.e handle) to the task.
+*
+* Note(s)    : 1) When the port defines OS_CPU_STK_ALIGN_BYTES, the stack is aligned at create time: the base is
+*                 rounded up and the size down to that boundary, so every frame the port builds is aligned no matter
+*                 how the caller declared the array.  At most a few entries are sacrificed; declare stacks with the
+*                 port's OS_CPU_STK_ALIGN_ATTR to lose none.
 ************************************************************************************************************************
 */
 /*$PAGE*/
@@ -303,6 +308,16 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     }
 #endif
 
+#ifdef OS_CPU_STK_ALIGN_BYTES
+                                                            /* --------------- ALIGN THE TASK'S STACK --------------- */
+    while ((((CPU_ADDR)p_stk_base) & (CPU_ADDR)(OS_CPU_STK_ALIGN_BYTES - 1u)) != 0u) {
+        p_stk_base++;                                       /* Round the base up to the port boundary (see Note #1)   */
+        stk_size--;
+    }
+    stk_size -= stk_size % (CPU_STK_SIZE)(OS_CPU_STK_ALIGN_BYTES / sizeof(CPU_STK));
+                                                            /* ... and the size down, so the stack TOP stays aligned  */
+#endif
+
     CPU_CRITICAL_ENTER();
 
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
@@ -315,7 +330,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     }
 #endif
 
-    if (OSRdyList[OS_CFG_PRIO_MAX - 1u].NbrEntries > 0u) {  /* -- ONLY ONE TASK ALLOWED AT THE IDLE TASK PRIORITY --- */
+    if (OSRdyList[OS_CFG_PRIO_MAX - 1u].HeadPtr != (OS_TCB *)0) {  /* ONLY ONE TASK ALLOWED AT THE IDLE TASK PRIORITY */
         if (prio == (OS_CFG_PRIO_MAX - 1u)) {
             CPU_CRITICAL_EXIT();
             *p_err = OS_ERR_PRIO_INVALID;
@@ -337,6 +352,11 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
             }
         }
     }
+
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+    OS_TaskStkRedzoneInit(p_stk_base,                       /* Pattern-fill the redzone at the stack-limit end        */
+                          stk_size);
+#endif
                                                             /* ------- INITIALIZE THE STACK FRAME OF THE TASK ------- */
 #if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
     p_stk_limit = p_stk_base + stk_limit;
@@ -373,6 +393,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     p_tcb->ExtPtr        = p_ext;                           /* Save pointer to TCB extension                          */
     p_tcb->StkBasePtr    = p_stk_base;                      /* Save pointer to the base address of the stack          */
     p_tcb->StkSize       = stk_size;                        /* Save the stack size (in number of CPU_STK elements)    */
+#if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
+    p_tcb->StkFreeWatermark = stk_size;                     /* No scan yet; first OSTaskStkChk() walks the free part  */
+#endif
     p_tcb->Opt           = opt;                             /* Save task options                                      */
 
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
@@ -409,6 +432,103 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     OSSched();
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                                 CREATE A BATCH OF TASKS
+*
+* Description: This function creates every task listed in a descriptor table under ONE scheduler lock, so the batch
+*              pays a single dispatch when the lock is released instead of one scheduler entry per create.  Each
+*              entry holds the arguments of one OSTaskCreate() call (see OS_TASK_DESC in os.h).
+*
+* Arguments  : p_desc_tbl     is a pointer to a table of 'qty' task descriptors
+*
+*              qty            is the number of descriptors in the table
+*
+*              p_err          is a pointer to an error code.  '*p_err' is OS_ERR_NONE when every task was created;
+*                             otherwise it holds the OSTaskCreate() error of the FIRST entry that failed and the
+*                             remaining entries are not attempted.  Additionally:
+*
+*                                 OS_ERR_PTR_INVALID         if 'p_desc_tbl' is a NULL pointer
+*                                 OS_ERR_TASK_INVALID        if 'qty' is 0
+*                                 OS_ERR_TASK_CREATE_ISR     if called from an ISR
+*
+* Returns    : The number of tasks created (the index of the failing entry when not equal to 'qty').
+*
+* Note(s)    : 1) The per-task argument validation is retained -- it is a handful of compares and catches the faults
+*                 a table makes easy (a copy-pasted priority, a swapped limit/size).  What the batch amortizes is the
+*                 scheduler: created tasks accumulate in the ready list and the highest-priority one is dispatched
+*                 once, by the OSSchedUnlock() at the end.
+*
+*              2) The dominant remaining cost is the stack clear of each task created with OS_OPT_TASK_STK_CLR.  For
+*                 boot-time creates of statically allocated stacks that cost can be skipped entirely: crt0 already
+*                 zeroed the arrays, so passing OS_OPT_TASK_STK_CHK without OS_OPT_TASK_STK_CLR is safe and cuts the
+*                 batch to near the cost of a single create.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSTaskCreateBatch (OS_TASK_DESC  *p_desc_tbl,
+                               OS_OBJ_QTY     qty,
+                               OS_ERR        *p_err)
+{
+    OS_TASK_DESC  *p_desc;
+    OS_OBJ_QTY     i;
+    OS_ERR         err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* ---------- CANNOT CREATE A TASK FROM AN ISR ---------- */
+        *p_err = OS_ERR_TASK_CREATE_ISR;
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_desc_tbl == (OS_TASK_DESC *)0) {                  /* User must supply a valid descriptor table              */
+        *p_err = OS_ERR_PTR_INVALID;
+        return ((OS_OBJ_QTY)0);
+    }
+    if (qty == (OS_OBJ_QTY)0) {                             /* ... with at least one entry                            */
+        *p_err = OS_ERR_TASK_INVALID;
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+    OSSchedLock(&err);                                      /* One dispatch for the whole batch (see Note #1); ...    */
+                                                            /* ... before OSStart() the lock call is a no-op and ...  */
+                                                            /* ... creates never schedule anyway                      */
+    *p_err = OS_ERR_NONE;
+    for (i = (OS_OBJ_QTY)0; i < qty; i++) {
+        p_desc = &p_desc_tbl[i];
+        OSTaskCreate((OS_TCB       *)p_desc->TCBPtr,
+                     (CPU_CHAR     *)p_desc->NamePtr,
+                     (OS_TASK_PTR   )p_desc->TaskPtr,
+                     (void         *)p_desc->ArgPtr,
+                     (OS_PRIO       )p_desc->Prio,
+                     (CPU_STK      *)p_desc->StkBasePtr,
+                     (CPU_STK_SIZE  )p_desc->StkLimit,
+                     (CPU_STK_SIZE  )p_desc->StkSize,
+                     (OS_MSG_QTY    )p_desc->QSize,
+                     (OS_TICK       )p_desc->TimeQuanta,
+                     (void         *)p_desc->ExtPtr,
+                     (OS_OPT        )p_desc->Opt,
+                     (OS_ERR       *)p_err);
+        if (*p_err != OS_ERR_NONE) {                        /* Stop at the first failing entry (see banner)           */
+            break;
+        }
+    }
+    OSSchedUnlock(&err);                                    /* Dispatch the highest-priority task created             */
+    return (i);
+}
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -1439,6 +1559,98 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
     return (ctr);
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                          SIGNAL A TASK FROM AN ISR (FAST PATH)
+*
+* Description: This function is the streamlined ISR-side version of OSTaskSemPost(): it wakes the task pending on its
+*              built-in task semaphore with a SINGLE pending check and no option processing.  The task semaphore is the
+*              cheapest wake primitive in the kernel (no separate object, no pend list) and this entry point makes its
+*              post side equally light, which is what interrupt-driven drivers (e.g. the UART1 RX path) want for their
+*              completion signals.
+*
+*              With OS_CFG_ISR_POST_DEFERRED_EN the signal is pushed into the interrupt queue exactly as the generic
+*              path would, so drivers do not need to care which post model the project uses.
+*
+* Arguments  : p_tcb     is the pointer to the TCB of the task to signal.  Unlike OSTaskSemPost() a NULL pointer is NOT
+*                        a self-post; an ISR has no 'self'.
+*
+*              p_err     is a pointer to an error code returned by this function:
+*
+*                            OS_ERR_NONE              If the task was signaled
+*                            OS_ERR_OBJ_PTR_NULL      If 'p_tcb' is a NULL pointer
+*                            OS_ERR_SEM_OVF           If the post would cause the signal counter to overflow
+*
+* Returns    : none
+*
+* Note(s)    : 1) No scheduler call is made here: when called from an ISR the scheduling decision belongs to
+*                 OSIntExit() (or the port's interrupt epilogue).  If called at task level the post behaves as if
+*                 OS_OPT_POST_NO_SCHED had been given.
+************************************************************************************************************************
+*/
+
+void  OSTaskSemPostFromISR (OS_TCB  *p_tcb,
+                            OS_ERR  *p_err)
+{
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_tcb == (OS_TCB *)0) {                             /* An ISR cannot post to 'self' (see Note above)          */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    ts = OS_TS_GET();                                       /* Get timestamp                                          */
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Deferred mode: same route as the generic post          */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_SIGNAL,
+                    (void      *)p_tcb,
+                    (void      *)0,
+                    (OS_MSG_SIZE)0,
+                    (OS_FLAGS   )0,
+                    (OS_OPT     )0,
+                    (CPU_TS     )ts,
+                    (OS_ERR    *)p_err);
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TS = ts;
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) {        /* The single check: waiting for a signal?                */
+        OS_Post((OS_PEND_OBJ *)0,                           /* Yes: ready the task; OSIntExit() runs the scheduler    */
+                (OS_TCB      *)p_tcb,
+                (void        *)0,
+                (OS_MSG_SIZE  )0u,
+                (CPU_TS       )ts);
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+    p_tcb->SemCtr++;                                        /* No: bank the signal for its next pend                  */
+    if (p_tcb->SemCtr == (OS_SEM_CTR)0) {                   /* Counter wrapped                                        */
+        p_tcb->SemCtr--;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SEM_OVF;
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -1516,6 +1728,18 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
 *                              OS_ERR_TASK_OPT           if you did NOT specified OS_OPT_TASK_STK_CHK when the task
 *                                                        was created
 *                              OS_ERR_TASK_STK_CHK_ISR   you called this function from an ISR
+*
+* Note(s)    : 1) The scan is bounded by the free count found by the previous call, kept in the TCB
+*                 (.StkFreeWatermark): entries that call already found dirtied are never re-read, so the per-call
+*                 cost is proportional to the FREE part of the stack instead of to its total size, and the watermark
+*                 only ever moves down.
+*
+*              2) The walk runs from the free end toward the used end and stops at the first NONZERO entry, exactly
+*                 as the full scan did.  Walking from the used end instead would stop at the first zero, and zero is
+*                 not a reliable "never used" marker there: the initial frame holds persistent zero words (HI, LO,
+*                 the frame-type tag, a NULL 'p_arg') and popped frames leave stale zeros, so such a walk would
+*                 stick at the shallowest of them and over-report free space without bound.  Scanning for the first
+*                 nonzero only assumes the deepest dirtied entry is nonzero.
 ************************************************************************************************************************
 */
 
@@ -1526,6 +1750,7 @@ void  OSTaskStkChk (OS_TCB       *p_tcb,
                     OS_ERR       *p_err)
 {
     CPU_STK_SIZE  free_stk;
+    CPU_STK_SIZE  free_lim;
     CPU_STK      *p_stk;
     CPU_SR_ALLOC();
 
@@ -1579,26 +1804,345 @@ void  OSTaskStkChk (OS_TCB       *p_tcb,
     }
     CPU_CRITICAL_EXIT();
 
-    free_stk  = 0u;
+    free_lim = p_tcb->StkFreeWatermark;                     /* Entries past the last scan's watermark are known ...   */
+    if (free_lim > p_tcb->StkSize) {                        /* ... used and are not re-read (see Note #1)             */
+        free_lim = p_tcb->StkSize;
+    }
+    free_stk = 0u;
 #if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
-    p_stk = p_tcb->StkBasePtr;                              /* Start at the lowest memory and go up                   */
-    while (*p_stk == (CPU_STK)0) {                          /* Compute the number of zero entries on the stk          */
+    p_stk = p_tcb->StkBasePtr;                              /* Count free entries up from the base, stopping at ...   */
+    while ((free_stk <  free_lim) &&                        /* ... the first NONZERO entry (see Note #2)              */
+           (*p_stk   == (CPU_STK)0)) {
         p_stk++;
         free_stk++;
     }
 #else
-    p_stk = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;        /* Start at the highest memory and go down                */
-    while (*p_stk == (CPU_STK)0) {
-        free_stk++;
+    p_stk = p_tcb->StkBasePtr + p_tcb->StkSize;             /* Count free entries down from the top, stopping at ...  */
+    while ((free_stk <  free_lim) &&                        /* ... the first NONZERO entry (see Note #2)              */
+           (*(p_stk - 1u) == (CPU_STK)0)) {
         p_stk--;
+        free_stk++;
     }
 #endif
+    p_tcb->StkFreeWatermark = free_stk;                     /* Remember the watermark for the next pass               */
     *p_free = free_stk;
     *p_used = (p_tcb->StkSize - free_stk);                  /* Compute number of entries used on the stack            */
     *p_err  = OS_ERR_NONE;
 }
 #endif
 
+/*$PAGE*/
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+/*
+************************************************************************************************************************
+*                                            CHECK A TASK'S STACK REDZONE
+*
+* Description: This function verifies that the redzone pattern written at the stack-limit end of a task's stack when
+*              the task was created (see OS_TaskStkRedzoneInit()) is still intact.  A corrupted redzone means the task
+*              overflowed (or came within OS_CFG_TASK_STK_REDZONE_DEPTH entries of overflowing) its stack.
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task to check.  A NULL pointer indicates that you wish to check
+*                        the redzone of the current task.
+*
+* Returns    : DEF_OK    if the redzone is intact
+*              DEF_FAIL  if the redzone has been overwritten
+*
+* Note(s)    : 1) Unlike OSTaskStkChk(), this check reads only OS_CFG_TASK_STK_REDZONE_DEPTH stack entries and thus is
+*                 cheap enough to run on every context switch (see OSTaskSwHook()) without requiring the stack to be
+*                 cleared at task creation.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSTaskStkRedzoneChk (OS_TCB  *p_tcb)
+{
+    CPU_STK       *p_stk;
+    CPU_STK_SIZE   i;
+
+
+
+    if (p_tcb == (OS_TCB *)0) {                             /* Check the redzone of the current task?                 */
+        p_tcb = OSTCBCurPtr;
+    }
+#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
+    p_stk = p_tcb->StkBasePtr;                              /* Redzone occupies the LOWEST stack entries              */
+#else
+    p_stk = p_tcb->StkBasePtr                               /* Redzone occupies the HIGHEST stack entries             */
+          + p_tcb->StkSize
+          - (CPU_STK_SIZE)OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+    for (i = 0u; i < (CPU_STK_SIZE)OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
+        if (*p_stk != OS_TASK_STK_REDZONE_MARK) {
+            return (DEF_FAIL);
+        }
+        p_stk++;
+    }
+    return (DEF_OK);
+}
+#endif
+
+/*$PAGE*/
+#if OS_CFG_TASK_SLAB_EN > 0u
+/*
+************************************************************************************************************************
+*                                             CREATE A TASK SLAB POOL
+*
+* Description: This function creates a pool of recyclable TCB+stack slabs.  Transient tasks can then be created from
+*              the pool with OSTaskSlabAcquire() and, once deleted, their TCB and stack recycled with
+*              OSTaskSlabRelease(), both in O(1), instead of dedicating a static TCB and stack to every task that may
+*              ever exist or growing the heap with Mem_HeapAlloc() which never frees.
+*
+* Arguments  : p_pool         is a pointer to the task slab pool to create
+*
+*              p_name         is a pointer to an ASCII string to give a name to the pool
+*
+*              p_tcb_tbl      is a pointer to an array of 'slab_qty' OS_TCBs
+*
+*              p_stk_base     is the base address of the stack storage, which MUST contain at least
+*                             'slab_qty' * 'stk_size_each' CPU_STK elements
+*
+*              stk_size_each  is the stack size given to each slab, in CPU_STK elements
+*
+*              slab_qty       is the number of slabs in the pool
+*
+*              p_err          is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                 OS_ERR_NONE                the pool was created
+*                                 OS_ERR_OBJ_PTR_NULL        if 'p_pool' is a NULL pointer
+*                                 OS_ERR_PTR_INVALID         if 'p_tcb_tbl' or 'p_stk_base' is a NULL pointer
+*                                 OS_ERR_TASK_INVALID        if 'slab_qty' is 0
+*                                 OS_ERR_STK_SIZE_INVALID    if 'stk_size_each' is below OSCfg_StkSizeMin
+*                                 OS_ERR_CREATE_ISR          if you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The typical life cycle of a pooled task is:
+*
+*                     p_tcb = OSTaskSlabAcquire(&pool, &p_stk, &err);
+*                     OSTaskCreate(p_tcb, ..., p_stk, ..., stk_size_each, ..., &err);
+*                        :
+*                     OSTaskDel(p_tcb, &err);
+*                     OSTaskSlabRelease(&pool, p_tcb, &err);
+************************************************************************************************************************
+*/
+
+void  OSTaskSlabPoolCreate (OS_TASK_SLAB_POOL  *p_pool,
+                            CPU_CHAR           *p_name,
+                            OS_TCB             *p_tcb_tbl,
+                            CPU_STK            *p_stk_base,
+                            CPU_STK_SIZE        stk_size_each,
+                            OS_OBJ_QTY          slab_qty,
+                            OS_ERR             *p_err)
+{
+    OS_OBJ_QTY  i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+        *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+        *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_pool == (OS_TASK_SLAB_POOL *)0) {                 /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_tcb_tbl == (OS_TCB *)0) {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (p_stk_base == (CPU_STK *)0) {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (slab_qty == (OS_OBJ_QTY)0) {
+        *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+    if (stk_size_each < OSCfg_StkSizeMin) {
+        *p_err = OS_ERR_STK_SIZE_INVALID;
+        return;
+    }
+#endif
+
+    for (i = 0u; i < slab_qty; i++) {                       /* Chain the free TCBs through their .NextPtr field       */
+        p_tcb_tbl[i].StkPtr  = (CPU_STK *)0;
+        if (i < (slab_qty - 1u)) {
+            p_tcb_tbl[i].NextPtr = &p_tcb_tbl[i + 1u];
+        } else {
+            p_tcb_tbl[i].NextPtr = (OS_TCB *)0;
+        }
+    }
+
+    OS_CRITICAL_ENTER();
+    p_pool->NamePtr     = p_name;
+    p_pool->TcbTblPtr   = p_tcb_tbl;
+    p_pool->StkBasePtr  = p_stk_base;
+    p_pool->StkSizeEach = stk_size_each;
+    p_pool->FreeListPtr = &p_tcb_tbl[0];
+    p_pool->SlabQty     = slab_qty;
+    p_pool->NbrFree     = slab_qty;
+    OSTaskSlabPoolQty++;                                    /* One more task slab pool created                        */
+    OS_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                         ACQUIRE A TCB+STACK SLAB FROM A POOL
+*
+* Description: This function takes one TCB and its stack out of a task slab pool in O(1).  The returned TCB and stack
+*              are then passed to OSTaskCreate() by the caller.
+*
+* Arguments  : p_pool      is a pointer to the task slab pool
+*
+*              p_stk_base  is a pointer to a variable that will receive the base address of the stack that belongs to
+*                          the returned TCB; pass that address (and the pool's stack size) to OSTaskCreate()
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                 a slab was acquired
+*                              OS_ERR_OBJ_PTR_NULL         if 'p_pool' is a NULL pointer
+*                              OS_ERR_PTR_INVALID          if 'p_stk_base' is a NULL pointer
+*                              OS_ERR_TASK_SLAB_NONE_FREE  if all the pool's slabs are in use
+*
+* Returns    : A pointer to the acquired OS_TCB, or a NULL pointer upon error.
+************************************************************************************************************************
+*/
+
+OS_TCB  *OSTaskSlabAcquire (OS_TASK_SLAB_POOL   *p_pool,
+                            CPU_STK            **p_stk_base,
+                            OS_ERR              *p_err)
+{
+    OS_TCB      *p_tcb;
+    OS_OBJ_QTY   i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TCB *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_pool == (OS_TASK_SLAB_POOL *)0) {                 /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_TCB *)0);
+    }
+    if (p_stk_base == (CPU_STK **)0) {
+        *p_err = OS_ERR_PTR_INVALID;
+        return ((OS_TCB *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_pool->FreeListPtr;
+    if (p_tcb == (OS_TCB *)0) {                             /* All slabs in use?                                      */
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_TASK_SLAB_NONE_FREE;
+        return ((OS_TCB *)0);
+    }
+    p_pool->FreeListPtr = p_tcb->NextPtr;                   /* Pop the head of the free list                          */
+    p_pool->NbrFree--;
+    CPU_CRITICAL_EXIT();
+
+    i           = (OS_OBJ_QTY)(p_tcb - p_pool->TcbTblPtr);  /* Slab i owns stack storage i (see os.h Note)            */
+    *p_stk_base = &p_pool->StkBasePtr[(CPU_STK_SIZE)i * p_pool->StkSizeEach];
+    *p_err      =  OS_ERR_NONE;
+    return (p_tcb);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                         RELEASE A TCB+STACK SLAB TO ITS POOL
+*
+* Description: This function returns a TCB (and implicitly its stack) to the task slab pool it was acquired from, in
+*              O(1).  The task MUST have been deleted with OSTaskDel() first.
+*
+* Arguments  : p_pool   is a pointer to the task slab pool
+*
+*              p_tcb    is a pointer to the TCB to recycle
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE                 the slab was recycled
+*                           OS_ERR_OBJ_PTR_NULL         if 'p_pool' is a NULL pointer
+*                           OS_ERR_TCB_INVALID          if 'p_tcb' is a NULL pointer
+*                           OS_ERR_TASK_SLAB_NOT_OWNED  if 'p_tcb' does not belong to the pool
+*                           OS_ERR_STATE_INVALID        if the task has not been deleted
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSTaskSlabRelease (OS_TASK_SLAB_POOL  *p_pool,
+                         OS_TCB             *p_tcb,
+                         OS_ERR             *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_pool == (OS_TASK_SLAB_POOL *)0) {                 /* Validate arguments                                     */
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_tcb == (OS_TCB *)0) {
+        *p_err = OS_ERR_TCB_INVALID;
+        return;
+    }
+    if ((p_tcb <  p_pool->TcbTblPtr) ||                     /* The TCB must come from this pool's table               */
+        (p_tcb >= &p_pool->TcbTblPtr[p_pool->SlabQty])) {
+        *p_err = OS_ERR_TASK_SLAB_NOT_OWNED;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb->TaskState != OS_TASK_STATE_DEL) {            /* Recycling a live task would corrupt the kernel lists   */
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_STATE_INVALID;
+        return;
+    }
+    p_tcb->StkPtr       = (CPU_STK *)0;
+    p_tcb->NextPtr      =  p_pool->FreeListPtr;             /* Push onto the head of the free list                    */
+    p_pool->FreeListPtr =  p_tcb;
+    p_pool->NbrFree++;
+    CPU_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -1901,6 +2445,9 @@ void  OS_TaskInitTCB (OS_TCB *p_tcb)
 #if OS_CFG_TASK_PROFILE_EN > 0u
     CPU_TS      ts;
 #endif
+#if OS_CFG_TASK_JITTER_EN > 0u
+    CPU_INT08U  ix;
+#endif
 
 
     p_tcb->StkPtr             = (CPU_STK       *)0;
@@ -1971,6 +2518,7 @@ void  OS_TaskInitTCB (OS_TCB *p_tcb)
 #if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
     p_tcb->StkFree            = (CPU_STK_SIZE   )0u;
     p_tcb->StkUsed            = (CPU_STK_SIZE   )0u;
+    p_tcb->StkFreeWatermark   = (CPU_STK_SIZE   )0u;
 #endif
 
     p_tcb->Opt                = (OS_OPT         )0u;
@@ -1990,6 +2538,14 @@ void  OS_TaskInitTCB (OS_TCB *p_tcb)
     p_tcb->CyclesStart        = ts;
     p_tcb->CyclesTotal        = (OS_CYCLES      )0u;
 #endif
+#if OS_CFG_TASK_JITTER_EN > 0u
+    p_tcb->WakeupTs           = (CPU_TS         )0u;
+    p_tcb->WakeupPending      =  DEF_FALSE;
+    p_tcb->JitterMax          = (CPU_TS         )0u;
+    for (ix = 0u; ix < OS_CFG_TASK_JITTER_HIST_SIZE; ix++) {
+        p_tcb->JitterHistTbl[ix] = (OS_CTR      )0u;
+    }
+#endif
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
     p_tcb->IntDisTimeMax      = (CPU_TS         )0u;
 #endif
@@ -2095,7 +2651,7 @@ void  OS_TaskQPost (OS_TCB      *p_tcb,
                          ts);
                  OS_CRITICAL_EXIT_NO_SCHED();
                  if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0u) {
-                     OSSched();                             /* Run the scheduler                                      */
+                     OS_SchedPost(p_tcb->Prio);             /* Skip the dispatch if the woken task cannot preempt     */
                  }
              } else {
                  OS_MsgQPut(&p_tcb->MsgQ,                   /* No,  Task is pending on something else ...             */
@@ -2151,6 +2707,47 @@ void  OS_TaskReturn (void)
 #endif
 }
 
+/*$PAGE*/
+#if OS_CFG_TASK_STK_REDZONE_EN > 0u
+/*
+************************************************************************************************************************
+*                                          INITIALIZE A TASK'S STACK REDZONE
+*
+* Description: This function writes the redzone pattern into the OS_CFG_TASK_STK_REDZONE_DEPTH stack entries at the
+*              stack-limit end of a task's stack.  OSTaskStkRedzoneChk() later verifies that the pattern is intact.
+*
+* Arguments  : p_stk_base    is the base address of the task's stack
+*
+*              stk_size      is the size of the task's stack, in CPU_STK elements
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TaskStkRedzoneInit (CPU_STK       *p_stk_base,
+                             CPU_STK_SIZE   stk_size)
+{
+    CPU_STK       *p_stk;
+    CPU_STK_SIZE   i;
+
+
+
+#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
+    p_stk = p_stk_base;                                     /* Redzone occupies the LOWEST stack entries              */
+#else
+    p_stk = p_stk_base                                      /* Redzone occupies the HIGHEST stack entries             */
+          + stk_size
+          - (CPU_STK_SIZE)OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+    for (i = 0u; i < (CPU_STK_SIZE)OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
+        *p_stk = OS_TASK_STK_REDZONE_MARK;
+        p_stk++;
+    }
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -2249,7 +2846,7 @@ OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,
                  ctr = p_tcb->SemCtr;
                  OS_CRITICAL_EXIT_NO_SCHED();
                  if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
-                     OSSched();                                 /* Run the scheduler                                  */
+                     OS_SchedPost(p_tcb->Prio);                 /* Skip the dispatch if the task cannot preempt       */
                  }
              } else {
                  p_tcb->SemCtr++;                           /* No,  Task signaled is NOT pending on semaphore ...     */
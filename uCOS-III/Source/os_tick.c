@@ -69,6 +69,9 @@ void  OS_TickTask (void *p_arg)
         if (err == OS_ERR_NONE) {
             if (OSRunning == OS_STATE_OS_RUNNING) {
                 OS_TickListUpdate();                        /* Update all tasks waiting for time                      */
+#if OS_CFG_EDF_EN > 0u
+                OS_EdfUpdate();                             /* Count EDF deadline overruns (os_edf.c)                 */
+#endif
             }
         }
     }
@@ -199,6 +202,11 @@ void  OS_TickListInit (void)
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The task is inserted in its spoke sorted by time remaining so that OS_TickListUpdate() can stop at
+*                 the first entry that expires in the future.  Insertion cost is proportional to the number of
+*                 entries in the spoke, but it is paid in the context of the task being delayed instead of at the
+*                 tick task's high priority, and each tick then touches exactly the entries that expire.
 ************************************************************************************************************************
 */
 
@@ -210,8 +218,8 @@ void  OS_TickListInsert (OS_TCB   *p_tcb,
     OS_TICK            tick_delta;
     OS_TICK            tick_next;
     OS_TICK_SPOKE     *p_spoke;
-    OS_TCB            *p_tcb0;
     OS_TCB            *p_tcb1;
+    OS_TCB            *p_tcb2;
     OS_TICK_SPOKE_IX   spoke;
 
 
@@ -263,34 +271,26 @@ void  OS_TickListInsert (OS_TCB   *p_tcb,
         p_spoke->FirstPtr    =  p_tcb;
         p_spoke->NbrEntries  = (OS_OBJ_QTY)1u;
     } else {
-        p_tcb1     = p_spoke->FirstPtr;                          /* Point to current first TCB in the list            */
+        tick_delta = p_tcb->TickCtrMatch - OSTickCtr;            /* Find the insertion point (see Note #3) by ...     */
+        p_tcb1     = p_spoke->FirstPtr;                          /* ... comparing the time remaining of each entry    */
+        p_tcb2     = (OS_TCB *)0;
         while (p_tcb1 != (OS_TCB *)0) {
-            p_tcb1->TickRemain = p_tcb1->TickCtrMatch            /* Compute time remaining of current TCB in list     */
-                               - OSTickCtr;
-            if (p_tcb->TickRemain > p_tcb1->TickRemain) {        /* Do we need to insert AFTER current TCB in list?   */
-                if (p_tcb1->TickNextPtr != (OS_TCB *)0) {        /* Yes, are we pointing at the last TCB in the list? */
-                    p_tcb1               =  p_tcb1->TickNextPtr; /* No,  Point to next TCB in the list                */
-                } else {
-                    p_tcb->TickNextPtr   = (OS_TCB *)0;
-                    p_tcb->TickPrevPtr   =  p_tcb1;
-                    p_tcb1->TickNextPtr  =  p_tcb;               /* Yes, TCB to add is now new last entry in the list */
-                    p_tcb1               = (OS_TCB *)0;          /* Break loop                                        */
-                }
-            } else {                                             /* Insert before the current TCB                     */
-                if (p_tcb1->TickPrevPtr == (OS_TCB *)0) {        /* Are we inserting before the first TCB?            */
-                    p_tcb->TickPrevPtr   = (OS_TCB *)0;
-                    p_tcb->TickNextPtr   =  p_tcb1;
-                    p_tcb1->TickPrevPtr  =  p_tcb;
-                    p_spoke->FirstPtr    =  p_tcb;
-                } else {                                         /* Insert in between 2 TCBs already in the list      */
-                    p_tcb0               =  p_tcb1->TickPrevPtr;
-                    p_tcb->TickPrevPtr   =  p_tcb0;
-                    p_tcb->TickNextPtr   =  p_tcb1;
-                    p_tcb0->TickNextPtr  =  p_tcb;
-                    p_tcb1->TickPrevPtr  =  p_tcb;
-                }
-                p_tcb1 = (OS_TCB *)0;                            /* Break loop                                        */
+            tick_next = p_tcb1->TickCtrMatch - OSTickCtr;
+            if (tick_delta < tick_next) {                        /* Stop at the first entry expiring later            */
+                break;
             }
+            p_tcb2 = p_tcb1;
+            p_tcb1 = p_tcb1->TickNextPtr;
+        }
+        p_tcb->TickNextPtr = p_tcb1;
+        p_tcb->TickPrevPtr = p_tcb2;
+        if (p_tcb2 == (OS_TCB *)0) {                             /* Insert at the head of the spoke                   */
+            p_spoke->FirstPtr   = p_tcb;
+        } else {
+            p_tcb2->TickNextPtr = p_tcb;
+        }
+        if (p_tcb1 != (OS_TCB *)0) {
+            p_tcb1->TickPrevPtr = p_tcb;
         }
         p_spoke->NbrEntries++;
     }
@@ -381,6 +381,52 @@ void  OS_TickListResetPeak (void)
     }
 }
 
+/*
+************************************************************************************************************************
+*                                           FIND THE NEXT TICK LIST EXPIRY
+*
+* Description: This function scans the tick wheel and determines the number of ticks until the next task in the tick
+*              list expires.  It is used by the tickless idle support in the port to decide how far the tick interrupt
+*              can be stretched while the CPU idles.
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks (relative to OSTickCtr) until the next expiry, or (OS_TICK)-1 if no task is in the
+*              tick list.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+OS_TICK  OS_TickNextExpiry (void)
+{
+    OS_TICK_SPOKE_IX   i;
+    OS_TICK_SPOKE     *p_spoke;
+    OS_TCB            *p_tcb;
+    OS_TICK            remain;
+    OS_TICK            remain_min;
+
+
+
+    remain_min = (OS_TICK)-1;                               /* Assume no task is waiting for time to expire           */
+    for (i = 0u; i < OSCfg_TickWheelSize; i++) {
+        p_spoke = (OS_TICK_SPOKE *)&OSCfg_TickWheel[i];
+        p_tcb   =  p_spoke->FirstPtr;
+        if (p_tcb != (OS_TCB *)0) {                         /* Spokes are sorted by time remaining so the head ...    */
+            remain = p_tcb->TickCtrMatch                    /* ... is each spoke's soonest expiry                     */
+                   - OSTickCtr;
+            if (remain < remain_min) {
+                remain_min = remain;
+            }
+        }
+    }
+    return (remain_min);
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -394,15 +440,20 @@ void  OS_TickListResetPeak (void)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Spoke lists are sorted by time remaining (see OS_TickListInsert() Note #3) so the scan stops at the
+*                 first entry that expires in the future; each tick touches exactly the entries that expire, no
+*                 matter how many delayed tasks reside in the wheel.
+*
+*              3) Every arm of the switch unlinks the expired task from the spoke, so the head advances on each pass
+*                 and the loop is guaranteed to terminate.
 ************************************************************************************************************************
 */
 
 void  OS_TickListUpdate (void)
 {
-    CPU_BOOLEAN        done;
     OS_TICK_SPOKE     *p_spoke;
     OS_TCB            *p_tcb;
-    OS_TCB            *p_tcb_next;
     OS_TICK_SPOKE_IX   spoke;
     CPU_TS             ts_start;
     CPU_TS             ts_end;
@@ -415,84 +466,67 @@ void  OS_TickListUpdate (void)
     spoke    = (OS_TICK_SPOKE_IX)(OSTickCtr % OSCfg_TickWheelSize);
     p_spoke  = &OSCfg_TickWheel[spoke];
     p_tcb    = p_spoke->FirstPtr;
-    done     = DEF_FALSE;
-    while (done == DEF_FALSE) {
-        if (p_tcb != (OS_TCB *)0) {
-            p_tcb_next = p_tcb->TickNextPtr;                           /* Point to next TCB to update                 */
-            switch (p_tcb->TaskState) {
-                case OS_TASK_STATE_RDY:
-                case OS_TASK_STATE_PEND:
-                case OS_TASK_STATE_SUSPENDED:
-                case OS_TASK_STATE_PEND_SUSPENDED:
-                     break;
-
-                case OS_TASK_STATE_DLY:
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch           /* Compute time remaining of current TCB       */
-                                       - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {           /* Process each TCB that expires               */
-                         p_tcb->TaskState = OS_TASK_STATE_RDY;
-                         OS_TaskRdy(p_tcb);                            /* Make task ready to run                      */
-                     } else {
-                         done             = DEF_TRUE;                  /* Don't find a match, we're done!             */
-                     }
-                     break;
-
-                case OS_TASK_STATE_PEND_TIMEOUT:
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch           /* Compute time remaining of current TCB       */
-                                       - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {           /* Process each TCB that expires               */
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->TickCtrMatch != OSTickCtr) {                        /* Sorted spoke: stop at the first entry ...   */
+            break;                                                     /* ... expiring in the future (see Note #2)    */
+        }
+        switch (p_tcb->TaskState) {
+            case OS_TASK_STATE_RDY:
+            case OS_TASK_STATE_PEND:
+            case OS_TASK_STATE_SUSPENDED:
+            case OS_TASK_STATE_PEND_SUSPENDED:
+                 OS_TickListRemove(p_tcb);                             /* Not waiting for time; unlink (see Note #3)  */
+                 break;
+
+            case OS_TASK_STATE_DLY:
+                 p_tcb->TaskState = OS_TASK_STATE_RDY;
+#if OS_CFG_TASK_JITTER_EN > 0u
+                 p_tcb->WakeupTs      = ts_start;                      /* Stamp the wake; dispatch delta is measured  */
+                 p_tcb->WakeupPending = DEF_TRUE;                      /* ... in OSTaskSwHook()                       */
+#endif
+                 OS_TaskRdy(p_tcb);                                    /* Make task ready to run                      */
+                 break;
+
+            case OS_TASK_STATE_PEND_TIMEOUT:
+#if OS_CFG_TASK_JITTER_EN > 0u
+                 p_tcb->WakeupTs      = ts_start;                      /* Timeout wake: stamp it too                  */
+                 p_tcb->WakeupPending = DEF_TRUE;
+#endif
 #if (OS_MSG_EN > 0u)
-                         p_tcb->MsgPtr     = (void      *)0;
-                         p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
+                 p_tcb->MsgPtr     = (void      *)0;
+                 p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
 #endif
-                         p_tcb->TS         = OS_TS_GET();
-                         OS_PendListRemove(p_tcb);                     /* Remove from wait list                       */
-                         OS_TaskRdy(p_tcb);
-                         p_tcb->TaskState  = OS_TASK_STATE_RDY;
-                         p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;   /* Indicate pend timed out                     */
-                         p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;  /* Indicate no longer pending                  */
-                     } else {
-                         done              = DEF_TRUE;                 /* Don't find a match, we're done!             */
-                     }
-                     break;
-
-                case OS_TASK_STATE_DLY_SUSPENDED:
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch           /* Compute time remaining of current TCB       */
-                                       - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {           /* Process each TCB that expires               */
-                         p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                         OS_TickListRemove(p_tcb);                     /* Remove from current wheel spoke             */
-                     } else {
-                         done              = DEF_TRUE;                 /* Don't find a match, we're done!             */
-                     }
-                     break;
-
-                case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-                     p_tcb->TickRemain = p_tcb->TickCtrMatch           /* Compute time remaining of current TCB       */
-                                       - OSTickCtr;
-                     if (OSTickCtr == p_tcb->TickCtrMatch) {           /* Process each TCB that expires               */
+                 p_tcb->TS         = OS_TS_GET();
+                 OS_PendListRemove(p_tcb);                             /* Remove from wait list                       */
+                 OS_TaskRdy(p_tcb);
+                 p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                 p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;           /* Indicate pend timed out                     */
+                 p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;          /* Indicate no longer pending                  */
+                 break;
+
+            case OS_TASK_STATE_DLY_SUSPENDED:
+                 p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                 OS_TickListRemove(p_tcb);                             /* Remove from current wheel spoke             */
+                 break;
+
+            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
 #if (OS_MSG_EN > 0u)
-                         p_tcb->MsgPtr     = (void      *)0;
-                         p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
+                 p_tcb->MsgPtr     = (void      *)0;
+                 p_tcb->MsgSize    = (OS_MSG_SIZE)0u;
 #endif
-                         p_tcb->TS         = OS_TS_GET();
-                         OS_PendListRemove(p_tcb);                     /* Remove from wait list                       */
-                         OS_TickListRemove(p_tcb);                     /* Remove from current wheel spoke             */
-                         p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                         p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;   /* Indicate pend timed out                     */
-                         p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;  /* Indicate no longer pending                  */
-                     } else {
-                         done              = DEF_TRUE;                 /* Don't find a match, we're done!             */
-                     }
-                     break;
-
-                default:
-                     break;
-            }
-            p_tcb = p_tcb_next;
-        } else {
-            done  = DEF_TRUE;
+                 p_tcb->TS         = OS_TS_GET();
+                 OS_PendListRemove(p_tcb);                             /* Remove from wait list                       */
+                 OS_TickListRemove(p_tcb);                             /* Remove from current wheel spoke             */
+                 p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                 p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;           /* Indicate pend timed out                     */
+                 p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;          /* Indicate no longer pending                  */
+                 break;
+
+            default:
+                 OS_TickListRemove(p_tcb);                             /* Unknown state; unlink (see Note #3)         */
+                 break;
         }
+        p_tcb = p_spoke->FirstPtr;                                     /* Expired entry was unlinked; next is at head */
     }
     ts_end = OS_TS_GET() - ts_start;                                   /* Measure execution time of tick task         */
     if (ts_end > OSTickTaskTimeMax) {
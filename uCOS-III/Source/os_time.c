@@ -317,6 +317,104 @@ void  OSTimeDlyHMSM (CPU_INT16U  hours,
     }
 }
 #endif
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                         DELAY TASK UNTIL AN ABSOLUTE DEADLINE
+*
+* Description: This function delays the currently running task until the tick deadline '*p_prev + period' is reached.
+*              Because each deadline is computed from the PREVIOUS deadline rather than from the current time, a loop
+*              built around this call runs at a fixed timestep with zero accumulated drift, regardless of how long
+*              each iteration takes.
+*
+* Arguments  : p_prev    points to a variable holding the previous deadline, in ticks.  Initialize it with the value
+*                        of OSTickCtr (see OSTimeGet()) before the first call; this function updates it on every call.
+*
+*              period    is the loop period in clock ticks and must be non-zero.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE                   the delay occurred and the deadline was met.
+*                            OS_ERR_PTR_INVALID            'p_prev' is a NULL pointer.
+*                            OS_ERR_SCHED_LOCKED           can't delay when the scheduler is locked.
+*                            OS_ERR_TIME_DLY_ISR           if you called this function from an ISR.
+*                            OS_ERR_TIME_ZERO_DLY          if you specified a period of zero.
+*                            OS_ERR_TIME_DEADLINE_MISSED   the deadline had already passed on entry.  The task does
+*                                                          NOT block and '*p_prev' is resynchronized to the current
+*                                                          tick counter so the loop recovers instead of spinning.
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSTimeDlyUntil (OS_TICK  *p_prev,
+                      OS_TICK   period,
+                      OS_ERR   *p_err)
+{
+    OS_TICK  deadline;
+    OS_TICK  remain;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {             /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0u) {       /* Can't delay when the scheduler is locked               */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_prev == (OS_TICK *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    if (period == (OS_TICK)0u) {                            /* 0 means no delay!                                      */
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    deadline = *p_prev + period;                            /* Next deadline relative to the PREVIOUS one             */
+
+    OS_CRITICAL_ENTER();
+    remain = deadline - OSTickCtr;                          /* Unsigned wrap-safe distance to the deadline            */
+    if ((remain == (OS_TICK)0u) ||
+        (remain >  (OS_TICK)(((OS_TICK)-1) / 2u))) {        /* Deadline reached or already in the past                */
+       *p_prev = OSTickCtr;                                 /* Resync so the loop recovers instead of spinning        */
+        OS_CRITICAL_EXIT_NO_SCHED();
+       *p_err   = OS_ERR_TIME_DEADLINE_MISSED;
+        return;
+    }
+   *p_prev = deadline;
+    OSTCBCurPtr->TaskState = OS_TASK_STATE_DLY;
+    OS_TickListInsert(OSTCBCurPtr,
+                      deadline,
+                      OS_OPT_TIME_MATCH,                    /* Absolute match on OSTickCtr                            */
+                      p_err);
+    if (*p_err != OS_ERR_NONE) {
+         OS_CRITICAL_EXIT_NO_SCHED();
+         return;
+    }
+    OS_RdyListRemove(OSTCBCurPtr);                          /* Remove current task from ready list                    */
+    OS_CRITICAL_EXIT_NO_SCHED();
+    OSSched();                                              /* Find next task to run!                                 */
+   *p_err = OS_ERR_NONE;
+}
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -559,3 +657,69 @@ void  OSTimeTick (void)
 
 #endif
 }
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                         GET TIMED-WAKEUP JITTER STATISTICS
+*
+* Description: This function returns the wakeup jitter statistics collected for a task when OS_CFG_TASK_JITTER_EN is
+*              set to 1 in os_cfg.h.  The kernel timestamps the tick that makes a task ready (a delay or pend timeout
+*              expiring, see OS_TickListUpdate()) and, on the first context switch into that task, records how late
+*              the dispatch was (see OSTaskSwHook()).  The per-task maximum and a log2 histogram of the deltas are
+*              copied out under a critical section so the caller sees a consistent snapshot.
+*
+* Arguments  : p_tcb       is a pointer to the TCB of the task to query.  Specifying a NULL pointer queries the
+*                          calling task.
+*
+*              p_max       is a pointer to where the largest wake-to-dispatch delta seen (in CPU_TS units) will be
+*                          stored.  A NULL pointer is allowed if the caller only wants the histogram.
+*
+*              p_hist_tbl  is a pointer to an array of OS_CFG_TASK_JITTER_HIST_SIZE counters that will receive a copy
+*                          of the histogram; bucket 'n' counts deltas in [2^n, 2^(n+1)) CPU_TS units.  A NULL pointer
+*                          is allowed if the caller only wants the maximum.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE        the statistics were copied
+*
+* Returns    : none
+*
+* Note(s)    : 1) Statistics accumulate from task creation; call OSStatReset() to restart the measurement window.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TASK_JITTER_EN > 0u
+void  OSTaskJitterGet (OS_TCB  *p_tcb,
+                       CPU_TS  *p_max,
+                       OS_CTR  *p_hist_tbl,
+                       OS_ERR  *p_err)
+{
+    CPU_INT08U  ix;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                             /* Query the current task when no TCB is given            */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_max != (CPU_TS *)0) {
+       *p_max = p_tcb->JitterMax;
+    }
+    if (p_hist_tbl != (OS_CTR *)0) {
+        for (ix = 0u; ix < OS_CFG_TASK_JITTER_HIST_SIZE; ix++) {
+            p_hist_tbl[ix] = p_tcb->JitterHistTbl[ix];
+        }
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
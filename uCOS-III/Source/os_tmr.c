@@ -93,6 +93,9 @@ const  CPU_CHAR  *os_tmr__c = "$Id: $";
 *
 * Note(s)    : 1) This function only creates the timer.  In other words, the timer is not started when created.  To
 *                 start the timer, call OSTmrStart().
+*
+*              2) The callback executes in the context of the timer task with the scheduler UNLOCKED.  See the
+*                 reentrancy contract in the OS_TmrTask() banner for what the callback is allowed to call.
 ************************************************************************************************************************
 */
 
@@ -157,6 +160,13 @@ void  OSTmrCreate (OS_TMR              *p_tmr,
     }
 #endif
 
+    if (OSTmrTaskTCB.StkPtr == (CPU_STK *)0) {              /* First timer?  Create the timer task now               */
+        OS_TmrTaskInit(p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+
     CPU_CRITICAL_ENTER();
     p_tmr->State          = (OS_STATE           )OS_TMR_STATE_STOPPED;     /* Initialize the timer fields             */
     p_tmr->Type           = (OS_OBJ_TYPE        )OS_OBJ_TYPE_TMR;
@@ -704,6 +714,7 @@ void  OS_TmrClr (OS_TMR *p_tmr)
     p_tmr->CallbackPtrArg = (void              *)0;
     p_tmr->NextPtr        = (OS_TMR            *)0;
     p_tmr->PrevPtr        = (OS_TMR            *)0;
+    p_tmr->ExpNextPtr     = (OS_TMR            *)0;
 }
 
 /*$PAGE*/
@@ -771,7 +782,9 @@ void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
 ************************************************************************************************************************
 *                                             INITIALIZE THE TIMER MANAGER
 *
-* Description: This function is called by OSInit() to initialize the timer manager module.
+* Description: This function is called by OSInit() to initialize the timer manager module.  The timer task itself is
+*              NOT created here; it is created by the first OSTmrCreate() call (see OS_TmrTaskInit()) so that boots
+*              which never use a timer do not pay for it.
 *
 * Argument(s): p_err    is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -823,7 +836,42 @@ void  OS_TmrInit (OS_ERR  *p_err)
         p_spoke->FirstPtr      = (OS_TMR   *)0;
     }
 
-                                                            /* ---------------- CREATE THE TIMER TASK --------------- */
+    OSTmrTaskTCB.StkPtr = (CPU_STK *)0;                     /* Timer task is created by the first OSTmrCreate() ...   */
+    *p_err              =  OS_ERR_NONE;                     /* ... (see OS_TmrTaskInit()), NOT here                   */
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                               CREATE THE TIMER TASK
+*
+* Description: This function is called by OSTmrCreate(), the first time a timer is created, to create the timer task.
+*              OSInit() only initializes the timer wheel and variables, so configurations that enable OS_CFG_TMR_EN but
+*              never create a timer never spend boot time creating this task.
+*
+* Argument(s): p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE
+*                           OS_ERR_TMR_STK_INVALID       if you didn't specify a stack for the timer task
+*                           OS_ERR_TMR_STK_SIZE_INVALID  if you didn't allocate enough space for the timer stack
+*                           OS_ERR_PRIO_INVALID          if you specified the same priority as the idle task
+*                           OS_ERR_xxx                   any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TmrTaskInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
     if (OSCfg_TmrTaskStkBasePtr == (CPU_STK*)0) {
         *p_err = OS_ERR_TMR_STK_INVALID;
         return;
@@ -873,6 +921,16 @@ void  OS_TmrInit (OS_ERR  *p_err)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer is inserted at the HEAD of its spoke so that insertion cost is constant regardless of the
+*                 number of timers sharing the spoke.  Spoke lists are therefore NOT sorted by time remaining;
+*                 expiration is detected by OS_TmrTask() which matches .Match against OSTmrTickCtr when it visits the
+*                 spoke.
+*
+*              3) A periodic timer is rearmed from its PREVIOUS match value, not from the time at which OS_TmrTask()
+*                 got around to processing the expiry, so the long-run average period stays exact even when individual
+*                 expirations are processed late.  If processing fell behind by one or more whole periods the match is
+*                 resynchronized to the current time, as for a newly started timer.
 ************************************************************************************************************************
 */
 
@@ -880,15 +938,22 @@ void  OS_TmrLink (OS_TMR      *p_tmr,
                   OS_OPT       opt)
 {
     OS_TMR_SPOKE     *p_spoke;
-    OS_TMR           *p_tmr0;
     OS_TMR           *p_tmr1;
     OS_TMR_SPOKE_IX   spoke;
+    OS_TICK           match;
+    OS_TICK           remain;
 
 
 
     p_tmr->State = OS_TMR_STATE_RUNNING;
     if (opt == OS_OPT_LINK_PERIODIC) {                      /* Determine when timer will expire                      */
-        p_tmr->Match = p_tmr->Period + OSTmrTickCtr;
+        match  = p_tmr->Match + p_tmr->Period;              /* Rearm from the previous match (see Note #3)           */
+        remain = match - OSTmrTickCtr;
+        if ((remain == (OS_TICK)0) ||                       /* If one or more whole periods were missed, ...         */
+            (remain >  p_tmr->Period)) {
+            match  = p_tmr->Period + OSTmrTickCtr;          /* ... resynchronize to the current time                 */
+        }
+        p_tmr->Match = match;
     } else {
         if (p_tmr->Dly == (OS_TICK)0) {
             p_tmr->Match = p_tmr->Period + OSTmrTickCtr;
@@ -899,43 +964,19 @@ void  OS_TmrLink (OS_TMR      *p_tmr,
     spoke  = (OS_TMR_SPOKE_IX)(p_tmr->Match % OSCfg_TmrWheelSize);
     p_spoke = &OSCfg_TmrWheel[spoke];
 
+    p_tmr->Remain  = p_tmr->Match                           /* Compute remaining time for timer                       */
+                   - OSTmrTickCtr;
     if (p_spoke->FirstPtr ==  (OS_TMR *)0) {                /* Link into timer wheel                                  */
         p_tmr->NextPtr      = (OS_TMR *)0;
         p_tmr->PrevPtr      = (OS_TMR *)0;
         p_spoke->FirstPtr   = p_tmr;
         p_spoke->NbrEntries = 1u;
     } else {
-        p_tmr->Remain  = p_tmr->Match                       /* Compute remaining time for timer                       */
-                       - OSTmrTickCtr;
-        p_tmr1         = p_spoke->FirstPtr;                 /* Point to current first timer in the list               */
-        while (p_tmr1 != (OS_TMR *)0) {
-            p_tmr1->Remain = p_tmr1->Match                  /* Compute time remaining of current timer in list        */
-                           - OSTmrTickCtr;
-            if (p_tmr->Remain > p_tmr1->Remain) {           /* Do we need to insert AFTER current timer in list?      */
-                if (p_tmr1->NextPtr  != (OS_TMR *)0) {      /* Yes, are we pointing at the last timer in the list?    */
-                    p_tmr1            = p_tmr1->NextPtr;    /* No,  Point to next timer in the list                   */
-                } else {
-                    p_tmr->NextPtr    = (OS_TMR *)0;
-                    p_tmr->PrevPtr    =  p_tmr1;
-                    p_tmr1->NextPtr   =  p_tmr;             /* Yes, timer to insert is now new last entry in the list */
-                    p_tmr1            = (OS_TMR *)0;        /* Break loop                                             */
-                }
-            } else {                                        /* Insert before the current timer                        */
-                if (p_tmr1->PrevPtr == (OS_TMR *)0) {       /* Are we inserting before the first timer?               */
-                    p_tmr->PrevPtr    = (OS_TMR *)0;
-                    p_tmr->NextPtr    = p_tmr1;
-                    p_tmr1->PrevPtr   = p_tmr;
-                    p_spoke->FirstPtr = p_tmr;
-                } else {                                    /* Insert in between 2 timers already in the list         */
-                    p_tmr0            = p_tmr1->PrevPtr;
-                    p_tmr->PrevPtr    = p_tmr0;
-                    p_tmr->NextPtr    = p_tmr1;
-                    p_tmr0->NextPtr   = p_tmr;
-                    p_tmr1->PrevPtr   = p_tmr;
-                }
-                p_tmr1 = (OS_TMR *)0;                       /* Break loop                                             */
-            }
-        }
+        p_tmr1              = p_spoke->FirstPtr;            /* Insert at the head of the spoke (see Note #2)          */
+        p_tmr->PrevPtr      = (OS_TMR *)0;
+        p_tmr->NextPtr      = p_tmr1;
+        p_tmr1->PrevPtr     = p_tmr;
+        p_spoke->FirstPtr   = p_tmr;
         p_spoke->NbrEntries++;
     }
     if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {     /* Keep track of maximum number of entries in each spoke  */
@@ -943,6 +984,58 @@ void  OS_TmrLink (OS_TMR      *p_tmr,
     }
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                           FIND THE NEXT TIMER WHEEL EXPIRY
+*
+* Description: This function scans the timer wheel and determines the number of timer ticks (i.e. timer task update
+*              periods, NOT base ticks) until the soonest armed timer expires.  It is used by the tickless idle support
+*              in the port so that an armed soft timer bounds the tick stretch the same way a delayed task does (see
+*              OS_TickNextExpiry() for the task side).
+*
+* Arguments  : none
+*
+* Returns    : The number of timer ticks (relative to OSTmrTickCtr) until the next expiry, or (OS_TICK)-1 if no timer
+*              is running.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) Timer wheel spokes are NOT sorted (see OS_TmrLink() Note #2), so every entry of every spoke is
+*                 visited -- acceptable here because the caller is the idle path.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICKLESS_IDLE_EN > 0u
+OS_TICK  OS_TmrNextExpiry (void)
+{
+    OS_TMR_SPOKE_IX   i;
+    OS_TMR_SPOKE     *p_spoke;
+    OS_TMR           *p_tmr;
+    OS_TICK           remain;
+    OS_TICK           remain_min;
+
+
+
+    remain_min = (OS_TICK)-1;                               /* Assume no timer is running                             */
+    for (i = 0u; i < OSCfg_TmrWheelSize; i++) {
+        p_spoke = (OS_TMR_SPOKE *)&OSCfg_TmrWheel[i];
+        p_tmr   =  p_spoke->FirstPtr;
+        while (p_tmr != (OS_TMR *)0) {
+            remain = p_tmr->Match
+                   - OSTmrTickCtr;
+            if (remain < remain_min) {
+                remain_min = remain;
+            }
+            p_tmr  = p_tmr->NextPtr;
+        }
+    }
+    return (remain_min);
+}
+#endif
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -1031,17 +1124,39 @@ void  OS_TmrUnlink (OS_TMR *p_tmr)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) All timers expiring this period are collected under ONE scheduler lock acquisition and their
+*                 callbacks are executed AFTER the scheduler is unlocked.  A burst of simultaneous expirations thus
+*                 doesn't serialize through repeated lock/unlock cycles and callbacks no longer run with the
+*                 scheduler locked.
+*
+*              3) REENTRANCY CONTRACT -- callbacks execute in the context of the timer task with the scheduler
+*                 UNLOCKED, so a callback must NOT assume that other tasks are prevented from running.  A callback:
+*
+*                 (a) MAY call OSTmrCreate(), OSTmrStart(), OSTmrStop(), OSTmrStateGet() and OSTmrRemainGet() on
+*                     ANY timer, including the one passed to it.  These only touch the timer wheel, never the
+*                     expired-this-period chain being walked below.
+*
+*                 (b) MAY call OSTmrDel() ONLY on the timer passed to it (the walk advances past a timer before
+*                     its callback runs).  Deleting any OTHER timer from a callback -- or from another task while
+*                     expirations are being processed -- is an application error: OS_TmrClr() zeroes .ExpNextPtr,
+*                     which would cut the chain and silently drop the remaining callbacks of the period.
+*
+*                 (c) MAY use any kernel service legal at task level, but must not block for long: callbacks run
+*                     back-to-back in this task, so time spent here delays every later callback of the period and,
+*                     past one timer period, the processing of the next one.  Cross-timer interference through the
+*                     LOCK is zero; interference through this task's serial execution is bounded only by (c).
 ************************************************************************************************************************
 */
 
 void  OS_TmrTask (void *p_arg)
 {
-    CPU_BOOLEAN          done;
     OS_ERR               err;
     OS_TMR_CALLBACK_PTR  p_fnct;
     OS_TMR_SPOKE        *p_spoke;
     OS_TMR              *p_tmr;
     OS_TMR              *p_tmr_next;
+    OS_TMR              *p_tmr_exp;
     OS_TMR_SPOKE_IX      spoke;
     CPU_TS               ts;
     CPU_TS               ts_start;
@@ -1057,42 +1172,44 @@ void  OS_TmrTask (void *p_arg)
                             (OS_ERR *)&err);
 
         OSSchedLock(&err);
-        ts_start = OS_TS_GET();
+        ts_start  = OS_TS_GET();
         OSTmrTickCtr++;                                          /* Increment the current time                        */
-        spoke    = (OS_TMR_SPOKE_IX)(OSTmrTickCtr % OSCfg_TmrWheelSize);
-        p_spoke  = &OSCfg_TmrWheel[spoke];
-        p_tmr    = p_spoke->FirstPtr;
-        done     = DEF_FALSE;
-        while (done == DEF_FALSE) {
-            if (p_tmr != (OS_TMR *)0) {
-                p_tmr_next = (OS_TMR *)p_tmr->NextPtr;           /* Point to next tmr to update because current ...   */
+        spoke     = (OS_TMR_SPOKE_IX)(OSTmrTickCtr % OSCfg_TmrWheelSize);
+        p_spoke   = &OSCfg_TmrWheel[spoke];
+        p_tmr     = p_spoke->FirstPtr;
+        p_tmr_exp = (OS_TMR *)0;
+        while (p_tmr != (OS_TMR *)0) {                           /* Scan the whole spoke (see OS_TmrLink() Note #2)   */
+            p_tmr_next = (OS_TMR *)p_tmr->NextPtr;               /* Point to next tmr to update because current ...   */
                                                                  /* ... timer could get unlinked from the wheel.      */
-                if (OSTmrTickCtr == p_tmr->Match) {              /* Process each timer that expires                   */
-                    OS_TmrUnlink(p_tmr);                         /* Remove from current wheel spoke                   */
-                    if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
-                        OS_TmrLink(p_tmr,
-                                   OS_OPT_LINK_PERIODIC);        /* Recalculate new position of timer in wheel        */
-                    } else {
-                        p_tmr->State = OS_TMR_STATE_COMPLETED;   /* Indicate that the timer has completed             */
-                    }
-                    p_fnct = p_tmr->CallbackPtr;                 /* Execute callback function if available            */
-                    if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
-                        (*p_fnct)((void *)p_tmr,
-                                  p_tmr->CallbackPtrArg);
-                    }
-                    p_tmr = p_tmr_next;                          /* See if next timer matches                         */
+            if (OSTmrTickCtr == p_tmr->Match) {                  /* Collect each timer that expires (see Note #2)     */
+                OS_TmrUnlink(p_tmr);                             /* Remove from current wheel spoke                   */
+                if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                    OS_TmrLink(p_tmr,
+                               OS_OPT_LINK_PERIODIC);            /* Recalculate new position of timer in wheel        */
                 } else {
-                    done  = DEF_TRUE;
+                    p_tmr->State = OS_TMR_STATE_COMPLETED;       /* Indicate that the timer has completed             */
                 }
-            } else {
-                done = DEF_TRUE;
+                p_tmr->ExpNextPtr = p_tmr_exp;                   /* Chain onto the list of timers expired this period */
+                p_tmr_exp         = p_tmr;
             }
+            p_tmr = p_tmr_next;                                  /* See if next timer matches                         */
         }
         ts_end = OS_TS_GET() - ts_start;                         /* Measure execution time of timer task              */
         OSSchedUnlock(&err);
         if (ts_end > OSTmrTaskTimeMax) {
             OSTmrTaskTimeMax = ts_end;
         }
+
+        while (p_tmr_exp != (OS_TMR *)0) {                       /* Execute callbacks OUTSIDE the lock (see Note #3)  */
+            p_fnct            = p_tmr_exp->CallbackPtr;
+            p_tmr             = p_tmr_exp->ExpNextPtr;
+            p_tmr_exp->ExpNextPtr = (OS_TMR *)0;
+            if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
+                (*p_fnct)((void *)p_tmr_exp,
+                          p_tmr_exp->CallbackPtrArg);
+            }
+            p_tmr_exp = p_tmr;
+        }
     }
 }
 
@@ -55,7 +55,7 @@ typedef   CPU_INT32U      OS_FLAGS;                    /* Event flags,
 
 typedef   CPU_INT32U      OS_IDLE_CTR;                 /* Holds the number of times the idle task runs,       <32>/64 */
 
-typedef   CPU_INT16U      OS_MEM_QTY;                  /* Number of memory blocks,                            <16>/32 */
+typedef   CPU_INT32U      OS_MEM_QTY;                  /* Number of memory blocks,                            16/<32> */
 typedef   CPU_INT16U      OS_MEM_SIZE;                 /* Size in bytes of a memory block,                    <16>/32 */
 
 typedef   CPU_INT16U      OS_MSG_QTY;                  /* Number of OS_MSGs in the msg pool,                  <16>/32 */
@@ -63,6 +63,7 @@ typedef   CPU_INT16U      OS_MSG_SIZE;                 /* Size of messages in nu
 
 typedef   CPU_INT08U      OS_NESTING_CTR;              /* Interrupt and scheduler nesting,                  <8>/16/32 */
 
+typedef   CPU_INT08U      OS_OBJ_ID;                   /* Compact registry handle of a kernel object,          <8>    */
 typedef   CPU_INT16U      OS_OBJ_QTY;                  /* Number of kernel objects counter,                   <16>/32 */
 typedef   CPU_INT32U      OS_OBJ_TYPE;                 /* Special flag to determine object type,                   32 */
 